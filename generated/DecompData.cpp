@@ -2122,4 +2122,124 @@ const AggressiveExpand aggressive_expand[] = {
 };
 const size_t aggressive_expand_size = 9;
 
+// foldAccents8 of U+00C0..U+027F by lead and trail byte: {length, byte, byte}
+const uint8_t latin_fold8[][3] = {
+    {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {2, 0xC3, 0x86}, {1, 0x43, 0x00},
+    {1, 0x45, 0x00}, {1, 0x45, 0x00}, {1, 0x45, 0x00}, {1, 0x45, 0x00}, {1, 0x49, 0x00}, {1, 0x49, 0x00}, {1, 0x49, 0x00}, {1, 0x49, 0x00},
+    {2, 0xC3, 0x90}, {1, 0x4E, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {2, 0xC3, 0x97},
+    {2, 0xC3, 0x98}, {1, 0x55, 0x00}, {1, 0x55, 0x00}, {1, 0x55, 0x00}, {1, 0x55, 0x00}, {1, 0x59, 0x00}, {2, 0xC3, 0x9E}, {2, 0xC3, 0x9F},
+    {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {2, 0xC3, 0xA6}, {1, 0x63, 0x00},
+    {1, 0x65, 0x00}, {1, 0x65, 0x00}, {1, 0x65, 0x00}, {1, 0x65, 0x00}, {1, 0x69, 0x00}, {1, 0x69, 0x00}, {1, 0x69, 0x00}, {1, 0x69, 0x00},
+    {2, 0xC3, 0xB0}, {1, 0x6E, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC3, 0xB7},
+    {2, 0xC3, 0xB8}, {1, 0x75, 0x00}, {1, 0x75, 0x00}, {1, 0x75, 0x00}, {1, 0x75, 0x00}, {1, 0x79, 0x00}, {2, 0xC3, 0xBE}, {1, 0x79, 0x00},
+    {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x43, 0x00}, {1, 0x63, 0x00},
+    {1, 0x43, 0x00}, {1, 0x63, 0x00}, {1, 0x43, 0x00}, {1, 0x63, 0x00}, {1, 0x43, 0x00}, {1, 0x63, 0x00}, {1, 0x44, 0x00}, {1, 0x64, 0x00},
+    {2, 0xC4, 0x90}, {2, 0xC4, 0x91}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00},
+    {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x47, 0x00}, {1, 0x67, 0x00}, {1, 0x47, 0x00}, {1, 0x67, 0x00},
+    {1, 0x47, 0x00}, {1, 0x67, 0x00}, {1, 0x47, 0x00}, {1, 0x67, 0x00}, {1, 0x48, 0x00}, {1, 0x68, 0x00}, {2, 0xC4, 0xA6}, {2, 0xC4, 0xA7},
+    {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00},
+    {1, 0x49, 0x00}, {2, 0xC4, 0xB1}, {2, 0xC4, 0xB2}, {2, 0xC4, 0xB3}, {1, 0x4A, 0x00}, {1, 0x6A, 0x00}, {1, 0x4B, 0x00}, {1, 0x6B, 0x00},
+    {2, 0xC4, 0xB8}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {2, 0xC4, 0xBF},
+    {2, 0xC5, 0x80}, {2, 0xC5, 0x81}, {2, 0xC5, 0x82}, {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {1, 0x4E, 0x00},
+    {1, 0x6E, 0x00}, {2, 0xC5, 0x89}, {2, 0xC5, 0x8A}, {2, 0xC5, 0x8B}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00},
+    {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC5, 0x92}, {2, 0xC5, 0x93}, {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x52, 0x00}, {1, 0x72, 0x00},
+    {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x53, 0x00}, {1, 0x73, 0x00},
+    {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00}, {2, 0xC5, 0xA6}, {2, 0xC5, 0xA7},
+    {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00},
+    {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x57, 0x00}, {1, 0x77, 0x00}, {1, 0x59, 0x00}, {1, 0x79, 0x00},
+    {1, 0x59, 0x00}, {1, 0x5A, 0x00}, {1, 0x7A, 0x00}, {1, 0x5A, 0x00}, {1, 0x7A, 0x00}, {1, 0x5A, 0x00}, {1, 0x7A, 0x00}, {2, 0xC5, 0xBF},
+    {2, 0xC6, 0x80}, {2, 0xC6, 0x81}, {2, 0xC6, 0x82}, {2, 0xC6, 0x83}, {2, 0xC6, 0x84}, {2, 0xC6, 0x85}, {2, 0xC6, 0x86}, {2, 0xC6, 0x87},
+    {2, 0xC6, 0x88}, {2, 0xC6, 0x89}, {2, 0xC6, 0x8A}, {2, 0xC6, 0x8B}, {2, 0xC6, 0x8C}, {2, 0xC6, 0x8D}, {2, 0xC6, 0x8E}, {2, 0xC6, 0x8F},
+    {2, 0xC6, 0x90}, {2, 0xC6, 0x91}, {2, 0xC6, 0x92}, {2, 0xC6, 0x93}, {2, 0xC6, 0x94}, {2, 0xC6, 0x95}, {2, 0xC6, 0x96}, {2, 0xC6, 0x97},
+    {2, 0xC6, 0x98}, {2, 0xC6, 0x99}, {2, 0xC6, 0x9A}, {2, 0xC6, 0x9B}, {2, 0xC6, 0x9C}, {2, 0xC6, 0x9D}, {2, 0xC6, 0x9E}, {2, 0xC6, 0x9F},
+    {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC6, 0xA2}, {2, 0xC6, 0xA3}, {2, 0xC6, 0xA4}, {2, 0xC6, 0xA5}, {2, 0xC6, 0xA6}, {2, 0xC6, 0xA7},
+    {2, 0xC6, 0xA8}, {2, 0xC6, 0xA9}, {2, 0xC6, 0xAA}, {2, 0xC6, 0xAB}, {2, 0xC6, 0xAC}, {2, 0xC6, 0xAD}, {2, 0xC6, 0xAE}, {1, 0x55, 0x00},
+    {1, 0x75, 0x00}, {2, 0xC6, 0xB1}, {2, 0xC6, 0xB2}, {2, 0xC6, 0xB3}, {2, 0xC6, 0xB4}, {2, 0xC6, 0xB5}, {2, 0xC6, 0xB6}, {2, 0xC6, 0xB7},
+    {2, 0xC6, 0xB8}, {2, 0xC6, 0xB9}, {2, 0xC6, 0xBA}, {2, 0xC6, 0xBB}, {2, 0xC6, 0xBC}, {2, 0xC6, 0xBD}, {2, 0xC6, 0xBE}, {2, 0xC6, 0xBF},
+    {2, 0xC7, 0x80}, {2, 0xC7, 0x81}, {2, 0xC7, 0x82}, {2, 0xC7, 0x83}, {2, 0xC7, 0x84}, {2, 0xC7, 0x85}, {2, 0xC7, 0x86}, {2, 0xC7, 0x87},
+    {2, 0xC7, 0x88}, {2, 0xC7, 0x89}, {2, 0xC7, 0x8A}, {2, 0xC7, 0x8B}, {2, 0xC7, 0x8C}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x49, 0x00},
+    {1, 0x69, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {2, 0xC3, 0x9C}, {2, 0xC3, 0xBC}, {2, 0xC3, 0x9C},
+    {2, 0xC3, 0xBC}, {2, 0xC3, 0x9C}, {2, 0xC3, 0xBC}, {2, 0xC3, 0x9C}, {2, 0xC3, 0xBC}, {2, 0xC7, 0x9D}, {2, 0xC3, 0x84}, {2, 0xC3, 0xA4},
+    {2, 0xC8, 0xA6}, {2, 0xC8, 0xA7}, {2, 0xC3, 0x86}, {2, 0xC3, 0xA6}, {2, 0xC7, 0xA4}, {2, 0xC7, 0xA5}, {1, 0x47, 0x00}, {1, 0x67, 0x00},
+    {1, 0x4B, 0x00}, {1, 0x6B, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC7, 0xAA}, {2, 0xC7, 0xAB}, {2, 0xC6, 0xB7}, {2, 0xCA, 0x92},
+    {1, 0x6A, 0x00}, {2, 0xC7, 0xB1}, {2, 0xC7, 0xB2}, {2, 0xC7, 0xB3}, {1, 0x47, 0x00}, {1, 0x67, 0x00}, {2, 0xC7, 0xB6}, {2, 0xC7, 0xB7},
+    {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {2, 0xC3, 0x85}, {2, 0xC3, 0xA5}, {2, 0xC3, 0x86}, {2, 0xC3, 0xA6}, {2, 0xC3, 0x98}, {2, 0xC3, 0xB8},
+    {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00},
+    {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00},
+    {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00},
+    {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00}, {2, 0xC8, 0x9C}, {2, 0xC8, 0x9D}, {1, 0x48, 0x00}, {1, 0x68, 0x00},
+    {2, 0xC8, 0xA0}, {2, 0xC8, 0xA1}, {2, 0xC8, 0xA2}, {2, 0xC8, 0xA3}, {2, 0xC8, 0xA4}, {2, 0xC8, 0xA5}, {1, 0x41, 0x00}, {1, 0x61, 0x00},
+    {1, 0x45, 0x00}, {1, 0x65, 0x00}, {2, 0xC3, 0x96}, {2, 0xC3, 0xB6}, {2, 0xC3, 0x95}, {2, 0xC3, 0xB5}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00},
+    {2, 0xC8, 0xAE}, {2, 0xC8, 0xAF}, {1, 0x59, 0x00}, {1, 0x79, 0x00}, {2, 0xC8, 0xB4}, {2, 0xC8, 0xB5}, {2, 0xC8, 0xB6}, {2, 0xC8, 0xB7},
+    {2, 0xC8, 0xB8}, {2, 0xC8, 0xB9}, {2, 0xC8, 0xBA}, {2, 0xC8, 0xBB}, {2, 0xC8, 0xBC}, {2, 0xC8, 0xBD}, {2, 0xC8, 0xBE}, {2, 0xC8, 0xBF},
+    {2, 0xC9, 0x80}, {2, 0xC9, 0x81}, {2, 0xC9, 0x82}, {2, 0xC9, 0x83}, {2, 0xC9, 0x84}, {2, 0xC9, 0x85}, {2, 0xC9, 0x86}, {2, 0xC9, 0x87},
+    {2, 0xC9, 0x88}, {2, 0xC9, 0x89}, {2, 0xC9, 0x8A}, {2, 0xC9, 0x8B}, {2, 0xC9, 0x8C}, {2, 0xC9, 0x8D}, {2, 0xC9, 0x8E}, {2, 0xC9, 0x8F},
+    {2, 0xC9, 0x90}, {2, 0xC9, 0x91}, {2, 0xC9, 0x92}, {2, 0xC9, 0x93}, {2, 0xC9, 0x94}, {2, 0xC9, 0x95}, {2, 0xC9, 0x96}, {2, 0xC9, 0x97},
+    {2, 0xC9, 0x98}, {2, 0xC9, 0x99}, {2, 0xC9, 0x9A}, {2, 0xC9, 0x9B}, {2, 0xC9, 0x9C}, {2, 0xC9, 0x9D}, {2, 0xC9, 0x9E}, {2, 0xC9, 0x9F},
+    {2, 0xC9, 0xA0}, {2, 0xC9, 0xA1}, {2, 0xC9, 0xA2}, {2, 0xC9, 0xA3}, {2, 0xC9, 0xA4}, {2, 0xC9, 0xA5}, {2, 0xC9, 0xA6}, {2, 0xC9, 0xA7},
+    {2, 0xC9, 0xA8}, {2, 0xC9, 0xA9}, {2, 0xC9, 0xAA}, {2, 0xC9, 0xAB}, {2, 0xC9, 0xAC}, {2, 0xC9, 0xAD}, {2, 0xC9, 0xAE}, {2, 0xC9, 0xAF},
+    {2, 0xC9, 0xB0}, {2, 0xC9, 0xB1}, {2, 0xC9, 0xB2}, {2, 0xC9, 0xB3}, {2, 0xC9, 0xB4}, {2, 0xC9, 0xB5}, {2, 0xC9, 0xB6}, {2, 0xC9, 0xB7},
+    {2, 0xC9, 0xB8}, {2, 0xC9, 0xB9}, {2, 0xC9, 0xBA}, {2, 0xC9, 0xBB}, {2, 0xC9, 0xBC}, {2, 0xC9, 0xBD}, {2, 0xC9, 0xBE}, {2, 0xC9, 0xBF},
+};
+
+// foldAccents8Aggressive of U+00C0..U+027F by lead and trail byte: {length, byte, byte}
+const uint8_t latin_fold8_aggressive[][3] = {
+    {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {1, 0x41, 0x00}, {2, 0x41, 0x45}, {1, 0x43, 0x00},
+    {1, 0x45, 0x00}, {1, 0x45, 0x00}, {1, 0x45, 0x00}, {1, 0x45, 0x00}, {1, 0x49, 0x00}, {1, 0x49, 0x00}, {1, 0x49, 0x00}, {1, 0x49, 0x00},
+    {1, 0x44, 0x00}, {1, 0x4E, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {1, 0x4F, 0x00}, {2, 0xC3, 0x97},
+    {1, 0x4F, 0x00}, {1, 0x55, 0x00}, {1, 0x55, 0x00}, {1, 0x55, 0x00}, {1, 0x55, 0x00}, {1, 0x59, 0x00}, {2, 0x54, 0x48}, {2, 0x73, 0x73},
+    {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {1, 0x61, 0x00}, {2, 0x61, 0x65}, {1, 0x63, 0x00},
+    {1, 0x65, 0x00}, {1, 0x65, 0x00}, {1, 0x65, 0x00}, {1, 0x65, 0x00}, {1, 0x69, 0x00}, {1, 0x69, 0x00}, {1, 0x69, 0x00}, {1, 0x69, 0x00},
+    {1, 0x64, 0x00}, {1, 0x6E, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC3, 0xB7},
+    {1, 0x6F, 0x00}, {1, 0x75, 0x00}, {1, 0x75, 0x00}, {1, 0x75, 0x00}, {1, 0x75, 0x00}, {1, 0x79, 0x00}, {2, 0x74, 0x68}, {1, 0x79, 0x00},
+    {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x43, 0x00}, {1, 0x63, 0x00},
+    {1, 0x43, 0x00}, {1, 0x63, 0x00}, {1, 0x43, 0x00}, {1, 0x63, 0x00}, {1, 0x43, 0x00}, {1, 0x63, 0x00}, {1, 0x44, 0x00}, {1, 0x64, 0x00},
+    {1, 0x44, 0x00}, {1, 0x64, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00},
+    {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x47, 0x00}, {1, 0x67, 0x00}, {1, 0x47, 0x00}, {1, 0x67, 0x00},
+    {1, 0x47, 0x00}, {1, 0x67, 0x00}, {1, 0x47, 0x00}, {1, 0x67, 0x00}, {1, 0x48, 0x00}, {1, 0x68, 0x00}, {1, 0x48, 0x00}, {1, 0x68, 0x00},
+    {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00},
+    {1, 0x49, 0x00}, {2, 0xC4, 0xB1}, {2, 0xC4, 0xB2}, {2, 0xC4, 0xB3}, {1, 0x4A, 0x00}, {1, 0x6A, 0x00}, {1, 0x4B, 0x00}, {1, 0x6B, 0x00},
+    {2, 0xC4, 0xB8}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {2, 0xC4, 0xBF},
+    {2, 0xC5, 0x80}, {1, 0x4C, 0x00}, {1, 0x6C, 0x00}, {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {1, 0x4E, 0x00},
+    {1, 0x6E, 0x00}, {2, 0xC5, 0x89}, {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00},
+    {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {2, 0x4F, 0x45}, {2, 0x6F, 0x65}, {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x52, 0x00}, {1, 0x72, 0x00},
+    {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x53, 0x00}, {1, 0x73, 0x00},
+    {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00},
+    {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00},
+    {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x57, 0x00}, {1, 0x77, 0x00}, {1, 0x59, 0x00}, {1, 0x79, 0x00},
+    {1, 0x59, 0x00}, {1, 0x5A, 0x00}, {1, 0x7A, 0x00}, {1, 0x5A, 0x00}, {1, 0x7A, 0x00}, {1, 0x5A, 0x00}, {1, 0x7A, 0x00}, {2, 0xC5, 0xBF},
+    {2, 0xC6, 0x80}, {2, 0xC6, 0x81}, {2, 0xC6, 0x82}, {2, 0xC6, 0x83}, {2, 0xC6, 0x84}, {2, 0xC6, 0x85}, {2, 0xC6, 0x86}, {2, 0xC6, 0x87},
+    {2, 0xC6, 0x88}, {2, 0xC6, 0x89}, {2, 0xC6, 0x8A}, {2, 0xC6, 0x8B}, {2, 0xC6, 0x8C}, {2, 0xC6, 0x8D}, {2, 0xC6, 0x8E}, {2, 0xC6, 0x8F},
+    {2, 0xC6, 0x90}, {2, 0xC6, 0x91}, {2, 0xC6, 0x92}, {2, 0xC6, 0x93}, {2, 0xC6, 0x94}, {2, 0xC6, 0x95}, {2, 0xC6, 0x96}, {2, 0xC6, 0x97},
+    {2, 0xC6, 0x98}, {2, 0xC6, 0x99}, {2, 0xC6, 0x9A}, {2, 0xC6, 0x9B}, {2, 0xC6, 0x9C}, {2, 0xC6, 0x9D}, {2, 0xC6, 0x9E}, {2, 0xC6, 0x9F},
+    {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC6, 0xA2}, {2, 0xC6, 0xA3}, {2, 0xC6, 0xA4}, {2, 0xC6, 0xA5}, {2, 0xC6, 0xA6}, {2, 0xC6, 0xA7},
+    {2, 0xC6, 0xA8}, {2, 0xC6, 0xA9}, {2, 0xC6, 0xAA}, {2, 0xC6, 0xAB}, {2, 0xC6, 0xAC}, {2, 0xC6, 0xAD}, {2, 0xC6, 0xAE}, {1, 0x55, 0x00},
+    {1, 0x75, 0x00}, {2, 0xC6, 0xB1}, {2, 0xC6, 0xB2}, {2, 0xC6, 0xB3}, {2, 0xC6, 0xB4}, {2, 0xC6, 0xB5}, {2, 0xC6, 0xB6}, {2, 0xC6, 0xB7},
+    {2, 0xC6, 0xB8}, {2, 0xC6, 0xB9}, {2, 0xC6, 0xBA}, {2, 0xC6, 0xBB}, {2, 0xC6, 0xBC}, {2, 0xC6, 0xBD}, {2, 0xC6, 0xBE}, {2, 0xC6, 0xBF},
+    {2, 0xC7, 0x80}, {2, 0xC7, 0x81}, {2, 0xC7, 0x82}, {2, 0xC7, 0x83}, {2, 0xC7, 0x84}, {2, 0xC7, 0x85}, {2, 0xC7, 0x86}, {2, 0xC7, 0x87},
+    {2, 0xC7, 0x88}, {2, 0xC7, 0x89}, {2, 0xC7, 0x8A}, {2, 0xC7, 0x8B}, {2, 0xC7, 0x8C}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x49, 0x00},
+    {1, 0x69, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {2, 0xC3, 0x9C}, {2, 0xC3, 0xBC}, {2, 0xC3, 0x9C},
+    {2, 0xC3, 0xBC}, {2, 0xC3, 0x9C}, {2, 0xC3, 0xBC}, {2, 0xC3, 0x9C}, {2, 0xC3, 0xBC}, {2, 0xC7, 0x9D}, {2, 0xC3, 0x84}, {2, 0xC3, 0xA4},
+    {2, 0xC8, 0xA6}, {2, 0xC8, 0xA7}, {2, 0xC3, 0x86}, {2, 0xC3, 0xA6}, {2, 0xC7, 0xA4}, {2, 0xC7, 0xA5}, {1, 0x47, 0x00}, {1, 0x67, 0x00},
+    {1, 0x4B, 0x00}, {1, 0x6B, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {2, 0xC7, 0xAA}, {2, 0xC7, 0xAB}, {2, 0xC6, 0xB7}, {2, 0xCA, 0x92},
+    {1, 0x6A, 0x00}, {2, 0xC7, 0xB1}, {2, 0xC7, 0xB2}, {2, 0xC7, 0xB3}, {1, 0x47, 0x00}, {1, 0x67, 0x00}, {2, 0xC7, 0xB6}, {2, 0xC7, 0xB7},
+    {1, 0x4E, 0x00}, {1, 0x6E, 0x00}, {2, 0xC3, 0x85}, {2, 0xC3, 0xA5}, {2, 0xC3, 0x86}, {2, 0xC3, 0xA6}, {2, 0xC3, 0x98}, {2, 0xC3, 0xB8},
+    {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x41, 0x00}, {1, 0x61, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00}, {1, 0x45, 0x00}, {1, 0x65, 0x00},
+    {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x49, 0x00}, {1, 0x69, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00},
+    {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x52, 0x00}, {1, 0x72, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00}, {1, 0x55, 0x00}, {1, 0x75, 0x00},
+    {1, 0x53, 0x00}, {1, 0x73, 0x00}, {1, 0x54, 0x00}, {1, 0x74, 0x00}, {2, 0xC8, 0x9C}, {2, 0xC8, 0x9D}, {1, 0x48, 0x00}, {1, 0x68, 0x00},
+    {2, 0xC8, 0xA0}, {2, 0xC8, 0xA1}, {2, 0xC8, 0xA2}, {2, 0xC8, 0xA3}, {2, 0xC8, 0xA4}, {2, 0xC8, 0xA5}, {1, 0x41, 0x00}, {1, 0x61, 0x00},
+    {1, 0x45, 0x00}, {1, 0x65, 0x00}, {2, 0xC3, 0x96}, {2, 0xC3, 0xB6}, {2, 0xC3, 0x95}, {2, 0xC3, 0xB5}, {1, 0x4F, 0x00}, {1, 0x6F, 0x00},
+    {2, 0xC8, 0xAE}, {2, 0xC8, 0xAF}, {1, 0x59, 0x00}, {1, 0x79, 0x00}, {2, 0xC8, 0xB4}, {2, 0xC8, 0xB5}, {2, 0xC8, 0xB6}, {2, 0xC8, 0xB7},
+    {2, 0xC8, 0xB8}, {2, 0xC8, 0xB9}, {2, 0xC8, 0xBA}, {2, 0xC8, 0xBB}, {2, 0xC8, 0xBC}, {2, 0xC8, 0xBD}, {2, 0xC8, 0xBE}, {2, 0xC8, 0xBF},
+    {2, 0xC9, 0x80}, {2, 0xC9, 0x81}, {2, 0xC9, 0x82}, {2, 0xC9, 0x83}, {2, 0xC9, 0x84}, {2, 0xC9, 0x85}, {2, 0xC9, 0x86}, {2, 0xC9, 0x87},
+    {2, 0xC9, 0x88}, {2, 0xC9, 0x89}, {2, 0xC9, 0x8A}, {2, 0xC9, 0x8B}, {2, 0xC9, 0x8C}, {2, 0xC9, 0x8D}, {2, 0xC9, 0x8E}, {2, 0xC9, 0x8F},
+    {2, 0xC9, 0x90}, {2, 0xC9, 0x91}, {2, 0xC9, 0x92}, {2, 0xC9, 0x93}, {2, 0xC9, 0x94}, {2, 0xC9, 0x95}, {2, 0xC9, 0x96}, {2, 0xC9, 0x97},
+    {2, 0xC9, 0x98}, {2, 0xC9, 0x99}, {2, 0xC9, 0x9A}, {2, 0xC9, 0x9B}, {2, 0xC9, 0x9C}, {2, 0xC9, 0x9D}, {2, 0xC9, 0x9E}, {2, 0xC9, 0x9F},
+    {2, 0xC9, 0xA0}, {2, 0xC9, 0xA1}, {2, 0xC9, 0xA2}, {2, 0xC9, 0xA3}, {2, 0xC9, 0xA4}, {2, 0xC9, 0xA5}, {2, 0xC9, 0xA6}, {2, 0xC9, 0xA7},
+    {2, 0xC9, 0xA8}, {2, 0xC9, 0xA9}, {2, 0xC9, 0xAA}, {2, 0xC9, 0xAB}, {2, 0xC9, 0xAC}, {2, 0xC9, 0xAD}, {2, 0xC9, 0xAE}, {2, 0xC9, 0xAF},
+    {2, 0xC9, 0xB0}, {2, 0xC9, 0xB1}, {2, 0xC9, 0xB2}, {2, 0xC9, 0xB3}, {2, 0xC9, 0xB4}, {2, 0xC9, 0xB5}, {2, 0xC9, 0xB6}, {2, 0xC9, 0xB7},
+    {2, 0xC9, 0xB8}, {2, 0xC9, 0xB9}, {2, 0xC9, 0xBA}, {2, 0xC9, 0xBB}, {2, 0xC9, 0xBC}, {2, 0xC9, 0xBD}, {2, 0xC9, 0xBE}, {2, 0xC9, 0xBF},
+};
+
 } // namespace utf::data
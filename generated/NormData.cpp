@@ -0,0 +1,5719 @@
+// Auto-generated by generate_tables.py
+// Do not edit manually!
+
+#include "utf/UnicodeData.hpp"
+
+namespace utf::data {
+
+// Full decompositions: canonical length and code points, then compatibility ones if NORM_COMPAT
+const char32_t norm_decomp[] = {
+    0x0000, 0x0000, 0x0001, 0x0020, 0x0000, 0x0002, 0x0020, 0x0308,
+    0x0000, 0x0001, 0x0061, 0x0000, 0x0002, 0x0020, 0x0304, 0x0000,
+    0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000, 0x0002, 0x0020,
+    0x0301, 0x0000, 0x0001, 0x03BC, 0x0000, 0x0002, 0x0020, 0x0327,
+    0x0000, 0x0001, 0x0031, 0x0000, 0x0001, 0x006F, 0x0000, 0x0003,
+    0x0031, 0x2044, 0x0034, 0x0000, 0x0003, 0x0031, 0x2044, 0x0032,
+    0x0000, 0x0003, 0x0033, 0x2044, 0x0034, 0x0002, 0x0041, 0x0300,
+    0x0002, 0x0041, 0x0301, 0x0002, 0x0041, 0x0302, 0x0002, 0x0041,
+    0x0303, 0x0002, 0x0041, 0x0308, 0x0002, 0x0041, 0x030A, 0x0002,
+    0x0043, 0x0327, 0x0002, 0x0045, 0x0300, 0x0002, 0x0045, 0x0301,
+    0x0002, 0x0045, 0x0302, 0x0002, 0x0045, 0x0308, 0x0002, 0x0049,
+    0x0300, 0x0002, 0x0049, 0x0301, 0x0002, 0x0049, 0x0302, 0x0002,
+    0x0049, 0x0308, 0x0002, 0x004E, 0x0303, 0x0002, 0x004F, 0x0300,
+    0x0002, 0x004F, 0x0301, 0x0002, 0x004F, 0x0302, 0x0002, 0x004F,
+    0x0303, 0x0002, 0x004F, 0x0308, 0x0002, 0x0055, 0x0300, 0x0002,
+    0x0055, 0x0301, 0x0002, 0x0055, 0x0302, 0x0002, 0x0055, 0x0308,
+    0x0002, 0x0059, 0x0301, 0x0002, 0x0061, 0x0300, 0x0002, 0x0061,
+    0x0301, 0x0002, 0x0061, 0x0302, 0x0002, 0x0061, 0x0303, 0x0002,
+    0x0061, 0x0308, 0x0002, 0x0061, 0x030A, 0x0002, 0x0063, 0x0327,
+    0x0002, 0x0065, 0x0300, 0x0002, 0x0065, 0x0301, 0x0002, 0x0065,
+    0x0302, 0x0002, 0x0065, 0x0308, 0x0002, 0x0069, 0x0300, 0x0002,
+    0x0069, 0x0301, 0x0002, 0x0069, 0x0302, 0x0002, 0x0069, 0x0308,
+    0x0002, 0x006E, 0x0303, 0x0002, 0x006F, 0x0300, 0x0002, 0x006F,
+    0x0301, 0x0002, 0x006F, 0x0302, 0x0002, 0x006F, 0x0303, 0x0002,
+    0x006F, 0x0308, 0x0002, 0x0075, 0x0300, 0x0002, 0x0075, 0x0301,
+    0x0002, 0x0075, 0x0302, 0x0002, 0x0075, 0x0308, 0x0002, 0x0079,
+    0x0301, 0x0002, 0x0079, 0x0308, 0x0002, 0x0041, 0x0304, 0x0002,
+    0x0061, 0x0304, 0x0002, 0x0041, 0x0306, 0x0002, 0x0061, 0x0306,
+    0x0002, 0x0041, 0x0328, 0x0002, 0x0061, 0x0328, 0x0002, 0x0043,
+    0x0301, 0x0002, 0x0063, 0x0301, 0x0002, 0x0043, 0x0302, 0x0002,
+    0x0063, 0x0302, 0x0002, 0x0043, 0x0307, 0x0002, 0x0063, 0x0307,
+    0x0002, 0x0043, 0x030C, 0x0002, 0x0063, 0x030C, 0x0002, 0x0044,
+    0x030C, 0x0002, 0x0064, 0x030C, 0x0002, 0x0045, 0x0304, 0x0002,
+    0x0065, 0x0304, 0x0002, 0x0045, 0x0306, 0x0002, 0x0065, 0x0306,
+    0x0002, 0x0045, 0x0307, 0x0002, 0x0065, 0x0307, 0x0002, 0x0045,
+    0x0328, 0x0002, 0x0065, 0x0328, 0x0002, 0x0045, 0x030C, 0x0002,
+    0x0065, 0x030C, 0x0002, 0x0047, 0x0302, 0x0002, 0x0067, 0x0302,
+    0x0002, 0x0047, 0x0306, 0x0002, 0x0067, 0x0306, 0x0002, 0x0047,
+    0x0307, 0x0002, 0x0067, 0x0307, 0x0002, 0x0047, 0x0327, 0x0002,
+    0x0067, 0x0327, 0x0002, 0x0048, 0x0302, 0x0002, 0x0068, 0x0302,
+    0x0002, 0x0049, 0x0303, 0x0002, 0x0069, 0x0303, 0x0002, 0x0049,
+    0x0304, 0x0002, 0x0069, 0x0304, 0x0002, 0x0049, 0x0306, 0x0002,
+    0x0069, 0x0306, 0x0002, 0x0049, 0x0328, 0x0002, 0x0069, 0x0328,
+    0x0002, 0x0049, 0x0307, 0x0000, 0x0002, 0x0049, 0x004A, 0x0000,
+    0x0002, 0x0069, 0x006A, 0x0002, 0x004A, 0x0302, 0x0002, 0x006A,
+    0x0302, 0x0002, 0x004B, 0x0327, 0x0002, 0x006B, 0x0327, 0x0002,
+    0x004C, 0x0301, 0x0002, 0x006C, 0x0301, 0x0002, 0x004C, 0x0327,
+    0x0002, 0x006C, 0x0327, 0x0002, 0x004C, 0x030C, 0x0002, 0x006C,
+    0x030C, 0x0000, 0x0002, 0x004C, 0x00B7, 0x0000, 0x0002, 0x006C,
+    0x00B7, 0x0002, 0x004E, 0x0301, 0x0002, 0x006E, 0x0301, 0x0002,
+    0x004E, 0x0327, 0x0002, 0x006E, 0x0327, 0x0002, 0x004E, 0x030C,
+    0x0002, 0x006E, 0x030C, 0x0000, 0x0002, 0x02BC, 0x006E, 0x0002,
+    0x004F, 0x0304, 0x0002, 0x006F, 0x0304, 0x0002, 0x004F, 0x0306,
+    0x0002, 0x006F, 0x0306, 0x0002, 0x004F, 0x030B, 0x0002, 0x006F,
+    0x030B, 0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301, 0x0002,
+    0x0052, 0x0327, 0x0002, 0x0072, 0x0327, 0x0002, 0x0052, 0x030C,
+    0x0002, 0x0072, 0x030C, 0x0002, 0x0053, 0x0301, 0x0002, 0x0073,
+    0x0301, 0x0002, 0x0053, 0x0302, 0x0002, 0x0073, 0x0302, 0x0002,
+    0x0053, 0x0327, 0x0002, 0x0073, 0x0327, 0x0002, 0x0053, 0x030C,
+    0x0002, 0x0073, 0x030C, 0x0002, 0x0054, 0x0327, 0x0002, 0x0074,
+    0x0327, 0x0002, 0x0054, 0x030C, 0x0002, 0x0074, 0x030C, 0x0002,
+    0x0055, 0x0303, 0x0002, 0x0075, 0x0303, 0x0002, 0x0055, 0x0304,
+    0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075,
+    0x0306, 0x0002, 0x0055, 0x030A, 0x0002, 0x0075, 0x030A, 0x0002,
+    0x0055, 0x030B, 0x0002, 0x0075, 0x030B, 0x0002, 0x0055, 0x0328,
+    0x0002, 0x0075, 0x0328, 0x0002, 0x0057, 0x0302, 0x0002, 0x0077,
+    0x0302, 0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302, 0x0002,
+    0x0059, 0x0308, 0x0002, 0x005A, 0x0301, 0x0002, 0x007A, 0x0301,
+    0x0002, 0x005A, 0x0307, 0x0002, 0x007A, 0x0307, 0x0002, 0x005A,
+    0x030C, 0x0002, 0x007A, 0x030C, 0x0000, 0x0001, 0x0073, 0x0002,
+    0x004F, 0x031B, 0x0002, 0x006F, 0x031B, 0x0002, 0x0055, 0x031B,
+    0x0002, 0x0075, 0x031B, 0x0000, 0x0003, 0x0044, 0x005A, 0x030C,
+    0x0000, 0x0003, 0x0044, 0x007A, 0x030C, 0x0000, 0x0003, 0x0064,
+    0x007A, 0x030C, 0x0000, 0x0002, 0x004C, 0x004A, 0x0000, 0x0002,
+    0x004C, 0x006A, 0x0000, 0x0002, 0x006C, 0x006A, 0x0000, 0x0002,
+    0x004E, 0x004A, 0x0000, 0x0002, 0x004E, 0x006A, 0x0000, 0x0002,
+    0x006E, 0x006A, 0x0002, 0x0041, 0x030C, 0x0002, 0x0061, 0x030C,
+    0x0002, 0x0049, 0x030C, 0x0002, 0x0069, 0x030C, 0x0002, 0x004F,
+    0x030C, 0x0002, 0x006F, 0x030C, 0x0002, 0x0055, 0x030C, 0x0002,
+    0x0075, 0x030C, 0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075,
+    0x0308, 0x0304, 0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075,
+    0x0308, 0x0301, 0x0003, 0x0055, 0x0308, 0x030C, 0x0003, 0x0075,
+    0x0308, 0x030C, 0x0003, 0x0055, 0x0308, 0x0300, 0x0003, 0x0075,
+    0x0308, 0x0300, 0x0003, 0x0041, 0x0308, 0x0304, 0x0003, 0x0061,
+    0x0308, 0x0304, 0x0003, 0x0041, 0x0307, 0x0304, 0x0003, 0x0061,
+    0x0307, 0x0304, 0x0002, 0x00C6, 0x0304, 0x0002, 0x00E6, 0x0304,
+    0x0002, 0x0047, 0x030C, 0x0002, 0x0067, 0x030C, 0x0002, 0x004B,
+    0x030C, 0x0002, 0x006B, 0x030C, 0x0002, 0x004F, 0x0328, 0x0002,
+    0x006F, 0x0328, 0x0003, 0x004F, 0x0328, 0x0304, 0x0003, 0x006F,
+    0x0328, 0x0304, 0x0002, 0x01B7, 0x030C, 0x0002, 0x0292, 0x030C,
+    0x0002, 0x006A, 0x030C, 0x0000, 0x0002, 0x0044, 0x005A, 0x0000,
+    0x0002, 0x0044, 0x007A, 0x0000, 0x0002, 0x0064, 0x007A, 0x0002,
+    0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0002, 0x004E, 0x0300,
+    0x0002, 0x006E, 0x0300, 0x0003, 0x0041, 0x030A, 0x0301, 0x0003,
+    0x0061, 0x030A, 0x0301, 0x0002, 0x00C6, 0x0301, 0x0002, 0x00E6,
+    0x0301, 0x0002, 0x00D8, 0x0301, 0x0002, 0x00F8, 0x0301, 0x0002,
+    0x0041, 0x030F, 0x0002, 0x0061, 0x030F, 0x0002, 0x0041, 0x0311,
+    0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030F, 0x0002, 0x0065,
+    0x030F, 0x0002, 0x0045, 0x0311, 0x0002, 0x0065, 0x0311, 0x0002,
+    0x0049, 0x030F, 0x0002, 0x0069, 0x030F, 0x0002, 0x0049, 0x0311,
+    0x0002, 0x0069, 0x0311, 0x0002, 0x004F, 0x030F, 0x0002, 0x006F,
+    0x030F, 0x0002, 0x004F, 0x0311, 0x0002, 0x006F, 0x0311, 0x0002,
+    0x0052, 0x030F, 0x0002, 0x0072, 0x030F, 0x0002, 0x0052, 0x0311,
+    0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030F, 0x0002, 0x0075,
+    0x030F, 0x0002, 0x0055, 0x0311, 0x0002, 0x0075, 0x0311, 0x0002,
+    0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002, 0x0054, 0x0326,
+    0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030C, 0x0002, 0x0068,
+    0x030C, 0x0002, 0x0041, 0x0307, 0x0002, 0x0061, 0x0307, 0x0002,
+    0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003, 0x004F, 0x0308,
+    0x0304, 0x0003, 0x006F, 0x0308, 0x0304, 0x0003, 0x004F, 0x0303,
+    0x0304, 0x0003, 0x006F, 0x0303, 0x0304, 0x0002, 0x004F, 0x0307,
+    0x0002, 0x006F, 0x0307, 0x0003, 0x004F, 0x0307, 0x0304, 0x0003,
+    0x006F, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304, 0x0002, 0x0079,
+    0x0304, 0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0266, 0x0000,
+    0x0001, 0x006A, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0279,
+    0x0000, 0x0001, 0x027B, 0x0000, 0x0001, 0x0281, 0x0000, 0x0001,
+    0x0077, 0x0000, 0x0001, 0x0079, 0x0000, 0x0002, 0x0020, 0x0306,
+    0x0000, 0x0002, 0x0020, 0x0307, 0x0000, 0x0002, 0x0020, 0x030A,
+    0x0000, 0x0002, 0x0020, 0x0328, 0x0000, 0x0002, 0x0020, 0x0303,
+    0x0000, 0x0002, 0x0020, 0x030B, 0x0000, 0x0001, 0x0263, 0x0000,
+    0x0001, 0x006C, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0078,
+    0x0000, 0x0001, 0x0295, 0x0001, 0x0300, 0x0001, 0x0301, 0x0001,
+    0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x02B9, 0x0000, 0x0002,
+    0x0020, 0x0345, 0x0001, 0x003B, 0x0000, 0x0002, 0x0020, 0x0301,
+    0x0002, 0x00A8, 0x0301, 0x0003, 0x0020, 0x0308, 0x0301, 0x0002,
+    0x0391, 0x0301, 0x0001, 0x00B7, 0x0002, 0x0395, 0x0301, 0x0002,
+    0x0397, 0x0301, 0x0002, 0x0399, 0x0301, 0x0002, 0x039F, 0x0301,
+    0x0002, 0x03A5, 0x0301, 0x0002, 0x03A9, 0x0301, 0x0003, 0x03B9,
+    0x0308, 0x0301, 0x0002, 0x0399, 0x0308, 0x0002, 0x03A5, 0x0308,
+    0x0002, 0x03B1, 0x0301, 0x0002, 0x03B5, 0x0301, 0x0002, 0x03B7,
+    0x0301, 0x0002, 0x03B9, 0x0301, 0x0003, 0x03C5, 0x0308, 0x0301,
+    0x0002, 0x03B9, 0x0308, 0x0002, 0x03C5, 0x0308, 0x0002, 0x03BF,
+    0x0301, 0x0002, 0x03C5, 0x0301, 0x0002, 0x03C9, 0x0301, 0x0000,
+    0x0001, 0x03B2, 0x0000, 0x0001, 0x03B8, 0x0000, 0x0001, 0x03A5,
+    0x0002, 0x03D2, 0x0301, 0x0002, 0x03A5, 0x0301, 0x0002, 0x03D2,
+    0x0308, 0x0002, 0x03A5, 0x0308, 0x0000, 0x0001, 0x03C6, 0x0000,
+    0x0001, 0x03C0, 0x0000, 0x0001, 0x03BA, 0x0000, 0x0001, 0x03C1,
+    0x0000, 0x0001, 0x03C2, 0x0000, 0x0001, 0x0398, 0x0000, 0x0001,
+    0x03B5, 0x0000, 0x0001, 0x03A3, 0x0002, 0x0415, 0x0300, 0x0002,
+    0x0415, 0x0308, 0x0002, 0x0413, 0x0301, 0x0002, 0x0406, 0x0308,
+    0x0002, 0x041A, 0x0301, 0x0002, 0x0418, 0x0300, 0x0002, 0x0423,
+    0x0306, 0x0002, 0x0418, 0x0306, 0x0002, 0x0438, 0x0306, 0x0002,
+    0x0435, 0x0300, 0x0002, 0x0435, 0x0308, 0x0002, 0x0433, 0x0301,
+    0x0002, 0x0456, 0x0308, 0x0002, 0x043A, 0x0301, 0x0002, 0x0438,
+    0x0300, 0x0002, 0x0443, 0x0306, 0x0002, 0x0474, 0x030F, 0x0002,
+    0x0475, 0x030F, 0x0002, 0x0416, 0x0306, 0x0002, 0x0436, 0x0306,
+    0x0002, 0x0410, 0x0306, 0x0002, 0x0430, 0x0306, 0x0002, 0x0410,
+    0x0308, 0x0002, 0x0430, 0x0308, 0x0002, 0x0415, 0x0306, 0x0002,
+    0x0435, 0x0306, 0x0002, 0x04D8, 0x0308, 0x0002, 0x04D9, 0x0308,
+    0x0002, 0x0416, 0x0308, 0x0002, 0x0436, 0x0308, 0x0002, 0x0417,
+    0x0308, 0x0002, 0x0437, 0x0308, 0x0002, 0x0418, 0x0304, 0x0002,
+    0x0438, 0x0304, 0x0002, 0x0418, 0x0308, 0x0002, 0x0438, 0x0308,
+    0x0002, 0x041E, 0x0308, 0x0002, 0x043E, 0x0308, 0x0002, 0x04E8,
+    0x0308, 0x0002, 0x04E9, 0x0308, 0x0002, 0x042D, 0x0308, 0x0002,
+    0x044D, 0x0308, 0x0002, 0x0423, 0x0304, 0x0002, 0x0443, 0x0304,
+    0x0002, 0x0423, 0x0308, 0x0002, 0x0443, 0x0308, 0x0002, 0x0423,
+    0x030B, 0x0002, 0x0443, 0x030B, 0x0002, 0x0427, 0x0308, 0x0002,
+    0x0447, 0x0308, 0x0002, 0x042B, 0x0308, 0x0002, 0x044B, 0x0308,
+    0x0000, 0x0002, 0x0565, 0x0582, 0x0002, 0x0627, 0x0653, 0x0002,
+    0x0627, 0x0654, 0x0002, 0x0648, 0x0654, 0x0002, 0x0627, 0x0655,
+    0x0002, 0x064A, 0x0654, 0x0000, 0x0002, 0x0627, 0x0674, 0x0000,
+    0x0002, 0x0648, 0x0674, 0x0000, 0x0002, 0x06C7, 0x0674, 0x0000,
+    0x0002, 0x064A, 0x0674, 0x0002, 0x06D5, 0x0654, 0x0002, 0x06C1,
+    0x0654, 0x0002, 0x06D2, 0x0654, 0x0002, 0x0928, 0x093C, 0x0002,
+    0x0930, 0x093C, 0x0002, 0x0933, 0x093C, 0x0002, 0x0915, 0x093C,
+    0x0002, 0x0916, 0x093C, 0x0002, 0x0917, 0x093C, 0x0002, 0x091C,
+    0x093C, 0x0002, 0x0921, 0x093C, 0x0002, 0x0922, 0x093C, 0x0002,
+    0x092B, 0x093C, 0x0002, 0x092F, 0x093C, 0x0002, 0x09C7, 0x09BE,
+    0x0002, 0x09C7, 0x09D7, 0x0002, 0x09A1, 0x09BC, 0x0002, 0x09A2,
+    0x09BC, 0x0002, 0x09AF, 0x09BC, 0x0002, 0x0A32, 0x0A3C, 0x0002,
+    0x0A38, 0x0A3C, 0x0002, 0x0A16, 0x0A3C, 0x0002, 0x0A17, 0x0A3C,
+    0x0002, 0x0A1C, 0x0A3C, 0x0002, 0x0A2B, 0x0A3C, 0x0002, 0x0B47,
+    0x0B56, 0x0002, 0x0B47, 0x0B3E, 0x0002, 0x0B47, 0x0B57, 0x0002,
+    0x0B21, 0x0B3C, 0x0002, 0x0B22, 0x0B3C, 0x0002, 0x0B92, 0x0BD7,
+    0x0002, 0x0BC6, 0x0BBE, 0x0002, 0x0BC7, 0x0BBE, 0x0002, 0x0BC6,
+    0x0BD7, 0x0002, 0x0C46, 0x0C56, 0x0002, 0x0CBF, 0x0CD5, 0x0002,
+    0x0CC6, 0x0CD5, 0x0002, 0x0CC6, 0x0CD6, 0x0002, 0x0CC6, 0x0CC2,
+    0x0003, 0x0CC6, 0x0CC2, 0x0CD5, 0x0002, 0x0D46, 0x0D3E, 0x0002,
+    0x0D47, 0x0D3E, 0x0002, 0x0D46, 0x0D57, 0x0002, 0x0DD9, 0x0DCA,
+    0x0002, 0x0DD9, 0x0DCF, 0x0003, 0x0DD9, 0x0DCF, 0x0DCA, 0x0002,
+    0x0DD9, 0x0DDF, 0x0000, 0x0002, 0x0E4D, 0x0E32, 0x0000, 0x0002,
+    0x0ECD, 0x0EB2, 0x0000, 0x0002, 0x0EAB, 0x0E99, 0x0000, 0x0002,
+    0x0EAB, 0x0EA1, 0x0000, 0x0001, 0x0F0B, 0x0002, 0x0F42, 0x0FB7,
+    0x0002, 0x0F4C, 0x0FB7, 0x0002, 0x0F51, 0x0FB7, 0x0002, 0x0F56,
+    0x0FB7, 0x0002, 0x0F5B, 0x0FB7, 0x0002, 0x0F40, 0x0FB5, 0x0002,
+    0x0F71, 0x0F72, 0x0002, 0x0F71, 0x0F74, 0x0002, 0x0FB2, 0x0F80,
+    0x0000, 0x0003, 0x0FB2, 0x0F71, 0x0F80, 0x0002, 0x0FB3, 0x0F80,
+    0x0000, 0x0003, 0x0FB3, 0x0F71, 0x0F80, 0x0002, 0x0F71, 0x0F80,
+    0x0002, 0x0F92, 0x0FB7, 0x0002, 0x0F9C, 0x0FB7, 0x0002, 0x0FA1,
+    0x0FB7, 0x0002, 0x0FA6, 0x0FB7, 0x0002, 0x0FAB, 0x0FB7, 0x0002,
+    0x0F90, 0x0FB5, 0x0002, 0x1025, 0x102E, 0x0000, 0x0001, 0x10DC,
+    0x0002, 0x1B05, 0x1B35, 0x0002, 0x1B07, 0x1B35, 0x0002, 0x1B09,
+    0x1B35, 0x0002, 0x1B0B, 0x1B35, 0x0002, 0x1B0D, 0x1B35, 0x0002,
+    0x1B11, 0x1B35, 0x0002, 0x1B3A, 0x1B35, 0x0002, 0x1B3C, 0x1B35,
+    0x0002, 0x1B3E, 0x1B35, 0x0002, 0x1B3F, 0x1B35, 0x0002, 0x1B42,
+    0x1B35, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x00C6, 0x0000,
+    0x0001, 0x0042, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x018E, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0222, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0057,
+    0x0000, 0x0001, 0x0061, 0x0000, 0x0001, 0x0250, 0x0000, 0x0001,
+    0x0251, 0x0000, 0x0001, 0x1D02, 0x0000, 0x0001, 0x0062, 0x0000,
+    0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x0259,
+    0x0000, 0x0001, 0x025B, 0x0000, 0x0001, 0x025C, 0x0000, 0x0001,
+    0x0067, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006D, 0x0000,
+    0x0001, 0x014B, 0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0254,
+    0x0000, 0x0001, 0x1D16, 0x0000, 0x0001, 0x1D17, 0x0000, 0x0001,
+    0x0070, 0x0000, 0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000,
+    0x0001, 0x1D1D, 0x0000, 0x0001, 0x026F, 0x0000, 0x0001, 0x0076,
+    0x0000, 0x0001, 0x1D25, 0x0000, 0x0001, 0x03B2, 0x0000, 0x0001,
+    0x03B3, 0x0000, 0x0001, 0x03B4, 0x0000, 0x0001, 0x03C6, 0x0000,
+    0x0001, 0x03C7, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001, 0x0072,
+    0x0000, 0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001,
+    0x03B2, 0x0000, 0x0001, 0x03B3, 0x0000, 0x0001, 0x03C1, 0x0000,
+    0x0001, 0x03C6, 0x0000, 0x0001, 0x03C7, 0x0000, 0x0001, 0x043D,
+    0x0000, 0x0001, 0x0252, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001,
+    0x0255, 0x0000, 0x0001, 0x00F0, 0x0000, 0x0001, 0x025C, 0x0000,
+    0x0001, 0x0066, 0x0000, 0x0001, 0x025F, 0x0000, 0x0001, 0x0261,
+    0x0000, 0x0001, 0x0265, 0x0000, 0x0001, 0x0268, 0x0000, 0x0001,
+    0x0269, 0x0000, 0x0001, 0x026A, 0x0000, 0x0001, 0x1D7B, 0x0000,
+    0x0001, 0x029D, 0x0000, 0x0001, 0x026D, 0x0000, 0x0001, 0x1D85,
+    0x0000, 0x0001, 0x029F, 0x0000, 0x0001, 0x0271, 0x0000, 0x0001,
+    0x0270, 0x0000, 0x0001, 0x0272, 0x0000, 0x0001, 0x0273, 0x0000,
+    0x0001, 0x0274, 0x0000, 0x0001, 0x0275, 0x0000, 0x0001, 0x0278,
+    0x0000, 0x0001, 0x0282, 0x0000, 0x0001, 0x0283, 0x0000, 0x0001,
+    0x01AB, 0x0000, 0x0001, 0x0289, 0x0000, 0x0001, 0x028A, 0x0000,
+    0x0001, 0x1D1C, 0x0000, 0x0001, 0x028B, 0x0000, 0x0001, 0x028C,
+    0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x0290, 0x0000, 0x0001,
+    0x0291, 0x0000, 0x0001, 0x0292, 0x0000, 0x0001, 0x03B8, 0x0002,
+    0x0041, 0x0325, 0x0002, 0x0061, 0x0325, 0x0002, 0x0042, 0x0307,
+    0x0002, 0x0062, 0x0307, 0x0002, 0x0042, 0x0323, 0x0002, 0x0062,
+    0x0323, 0x0002, 0x0042, 0x0331, 0x0002, 0x0062, 0x0331, 0x0003,
+    0x0043, 0x0327, 0x0301, 0x0003, 0x0063, 0x0327, 0x0301, 0x0002,
+    0x0044, 0x0307, 0x0002, 0x0064, 0x0307, 0x0002, 0x0044, 0x0323,
+    0x0002, 0x0064, 0x0323, 0x0002, 0x0044, 0x0331, 0x0002, 0x0064,
+    0x0331, 0x0002, 0x0044, 0x0327, 0x0002, 0x0064, 0x0327, 0x0002,
+    0x0044, 0x032D, 0x0002, 0x0064, 0x032D, 0x0003, 0x0045, 0x0304,
+    0x0300, 0x0003, 0x0065, 0x0304, 0x0300, 0x0003, 0x0045, 0x0304,
+    0x0301, 0x0003, 0x0065, 0x0304, 0x0301, 0x0002, 0x0045, 0x032D,
+    0x0002, 0x0065, 0x032D, 0x0002, 0x0045, 0x0330, 0x0002, 0x0065,
+    0x0330, 0x0003, 0x0045, 0x0327, 0x0306, 0x0003, 0x0065, 0x0327,
+    0x0306, 0x0002, 0x0046, 0x0307, 0x0002, 0x0066, 0x0307, 0x0002,
+    0x0047, 0x0304, 0x0002, 0x0067, 0x0304, 0x0002, 0x0048, 0x0307,
+    0x0002, 0x0068, 0x0307, 0x0002, 0x0048, 0x0323, 0x0002, 0x0068,
+    0x0323, 0x0002, 0x0048, 0x0308, 0x0002, 0x0068, 0x0308, 0x0002,
+    0x0048, 0x0327, 0x0002, 0x0068, 0x0327, 0x0002, 0x0048, 0x032E,
+    0x0002, 0x0068, 0x032E, 0x0002, 0x0049, 0x0330, 0x0002, 0x0069,
+    0x0330, 0x0003, 0x0049, 0x0308, 0x0301, 0x0003, 0x0069, 0x0308,
+    0x0301, 0x0002, 0x004B, 0x0301, 0x0002, 0x006B, 0x0301, 0x0002,
+    0x004B, 0x0323, 0x0002, 0x006B, 0x0323, 0x0002, 0x004B, 0x0331,
+    0x0002, 0x006B, 0x0331, 0x0002, 0x004C, 0x0323, 0x0002, 0x006C,
+    0x0323, 0x0003, 0x004C, 0x0323, 0x0304, 0x0003, 0x006C, 0x0323,
+    0x0304, 0x0002, 0x004C, 0x0331, 0x0002, 0x006C, 0x0331, 0x0002,
+    0x004C, 0x032D, 0x0002, 0x006C, 0x032D, 0x0002, 0x004D, 0x0301,
+    0x0002, 0x006D, 0x0301, 0x0002, 0x004D, 0x0307, 0x0002, 0x006D,
+    0x0307, 0x0002, 0x004D, 0x0323, 0x0002, 0x006D, 0x0323, 0x0002,
+    0x004E, 0x0307, 0x0002, 0x006E, 0x0307, 0x0002, 0x004E, 0x0323,
+    0x0002, 0x006E, 0x0323, 0x0002, 0x004E, 0x0331, 0x0002, 0x006E,
+    0x0331, 0x0002, 0x004E, 0x032D, 0x0002, 0x006E, 0x032D, 0x0003,
+    0x004F, 0x0303, 0x0301, 0x0003, 0x006F, 0x0303, 0x0301, 0x0003,
+    0x004F, 0x0303, 0x0308, 0x0003, 0x006F, 0x0303, 0x0308, 0x0003,
+    0x004F, 0x0304, 0x0300, 0x0003, 0x006F, 0x0304, 0x0300, 0x0003,
+    0x004F, 0x0304, 0x0301, 0x0003, 0x006F, 0x0304, 0x0301, 0x0002,
+    0x0050, 0x0301, 0x0002, 0x0070, 0x0301, 0x0002, 0x0050, 0x0307,
+    0x0002, 0x0070, 0x0307, 0x0002, 0x0052, 0x0307, 0x0002, 0x0072,
+    0x0307, 0x0002, 0x0052, 0x0323, 0x0002, 0x0072, 0x0323, 0x0003,
+    0x0052, 0x0323, 0x0304, 0x0003, 0x0072, 0x0323, 0x0304, 0x0002,
+    0x0052, 0x0331, 0x0002, 0x0072, 0x0331, 0x0002, 0x0053, 0x0307,
+    0x0002, 0x0073, 0x0307, 0x0002, 0x0053, 0x0323, 0x0002, 0x0073,
+    0x0323, 0x0003, 0x0053, 0x0301, 0x0307, 0x0003, 0x0073, 0x0301,
+    0x0307, 0x0003, 0x0053, 0x030C, 0x0307, 0x0003, 0x0073, 0x030C,
+    0x0307, 0x0003, 0x0053, 0x0323, 0x0307, 0x0003, 0x0073, 0x0323,
+    0x0307, 0x0002, 0x0054, 0x0307, 0x0002, 0x0074, 0x0307, 0x0002,
+    0x0054, 0x0323, 0x0002, 0x0074, 0x0323, 0x0002, 0x0054, 0x0331,
+    0x0002, 0x0074, 0x0331, 0x0002, 0x0054, 0x032D, 0x0002, 0x0074,
+    0x032D, 0x0002, 0x0055, 0x0324, 0x0002, 0x0075, 0x0324, 0x0002,
+    0x0055, 0x0330, 0x0002, 0x0075, 0x0330, 0x0002, 0x0055, 0x032D,
+    0x0002, 0x0075, 0x032D, 0x0003, 0x0055, 0x0303, 0x0301, 0x0003,
+    0x0075, 0x0303, 0x0301, 0x0003, 0x0055, 0x0304, 0x0308, 0x0003,
+    0x0075, 0x0304, 0x0308, 0x0002, 0x0056, 0x0303, 0x0002, 0x0076,
+    0x0303, 0x0002, 0x0056, 0x0323, 0x0002, 0x0076, 0x0323, 0x0002,
+    0x0057, 0x0300, 0x0002, 0x0077, 0x0300, 0x0002, 0x0057, 0x0301,
+    0x0002, 0x0077, 0x0301, 0x0002, 0x0057, 0x0308, 0x0002, 0x0077,
+    0x0308, 0x0002, 0x0057, 0x0307, 0x0002, 0x0077, 0x0307, 0x0002,
+    0x0057, 0x0323, 0x0002, 0x0077, 0x0323, 0x0002, 0x0058, 0x0307,
+    0x0002, 0x0078, 0x0307, 0x0002, 0x0058, 0x0308, 0x0002, 0x0078,
+    0x0308, 0x0002, 0x0059, 0x0307, 0x0002, 0x0079, 0x0307, 0x0002,
+    0x005A, 0x0302, 0x0002, 0x007A, 0x0302, 0x0002, 0x005A, 0x0323,
+    0x0002, 0x007A, 0x0323, 0x0002, 0x005A, 0x0331, 0x0002, 0x007A,
+    0x0331, 0x0002, 0x0068, 0x0331, 0x0002, 0x0074, 0x0308, 0x0002,
+    0x0077, 0x030A, 0x0002, 0x0079, 0x030A, 0x0000, 0x0002, 0x0061,
+    0x02BE, 0x0002, 0x017F, 0x0307, 0x0002, 0x0073, 0x0307, 0x0002,
+    0x0041, 0x0323, 0x0002, 0x0061, 0x0323, 0x0002, 0x0041, 0x0309,
+    0x0002, 0x0061, 0x0309, 0x0003, 0x0041, 0x0302, 0x0301, 0x0003,
+    0x0061, 0x0302, 0x0301, 0x0003, 0x0041, 0x0302, 0x0300, 0x0003,
+    0x0061, 0x0302, 0x0300, 0x0003, 0x0041, 0x0302, 0x0309, 0x0003,
+    0x0061, 0x0302, 0x0309, 0x0003, 0x0041, 0x0302, 0x0303, 0x0003,
+    0x0061, 0x0302, 0x0303, 0x0003, 0x0041, 0x0323, 0x0302, 0x0003,
+    0x0061, 0x0323, 0x0302, 0x0003, 0x0041, 0x0306, 0x0301, 0x0003,
+    0x0061, 0x0306, 0x0301, 0x0003, 0x0041, 0x0306, 0x0300, 0x0003,
+    0x0061, 0x0306, 0x0300, 0x0003, 0x0041, 0x0306, 0x0309, 0x0003,
+    0x0061, 0x0306, 0x0309, 0x0003, 0x0041, 0x0306, 0x0303, 0x0003,
+    0x0061, 0x0306, 0x0303, 0x0003, 0x0041, 0x0323, 0x0306, 0x0003,
+    0x0061, 0x0323, 0x0306, 0x0002, 0x0045, 0x0323, 0x0002, 0x0065,
+    0x0323, 0x0002, 0x0045, 0x0309, 0x0002, 0x0065, 0x0309, 0x0002,
+    0x0045, 0x0303, 0x0002, 0x0065, 0x0303, 0x0003, 0x0045, 0x0302,
+    0x0301, 0x0003, 0x0065, 0x0302, 0x0301, 0x0003, 0x0045, 0x0302,
+    0x0300, 0x0003, 0x0065, 0x0302, 0x0300, 0x0003, 0x0045, 0x0302,
+    0x0309, 0x0003, 0x0065, 0x0302, 0x0309, 0x0003, 0x0045, 0x0302,
+    0x0303, 0x0003, 0x0065, 0x0302, 0x0303, 0x0003, 0x0045, 0x0323,
+    0x0302, 0x0003, 0x0065, 0x0323, 0x0302, 0x0002, 0x0049, 0x0309,
+    0x0002, 0x0069, 0x0309, 0x0002, 0x0049, 0x0323, 0x0002, 0x0069,
+    0x0323, 0x0002, 0x004F, 0x0323, 0x0002, 0x006F, 0x0323, 0x0002,
+    0x004F, 0x0309, 0x0002, 0x006F, 0x0309, 0x0003, 0x004F, 0x0302,
+    0x0301, 0x0003, 0x006F, 0x0302, 0x0301, 0x0003, 0x004F, 0x0302,
+    0x0300, 0x0003, 0x006F, 0x0302, 0x0300, 0x0003, 0x004F, 0x0302,
+    0x0309, 0x0003, 0x006F, 0x0302, 0x0309, 0x0003, 0x004F, 0x0302,
+    0x0303, 0x0003, 0x006F, 0x0302, 0x0303, 0x0003, 0x004F, 0x0323,
+    0x0302, 0x0003, 0x006F, 0x0323, 0x0302, 0x0003, 0x004F, 0x031B,
+    0x0301, 0x0003, 0x006F, 0x031B, 0x0301, 0x0003, 0x004F, 0x031B,
+    0x0300, 0x0003, 0x006F, 0x031B, 0x0300, 0x0003, 0x004F, 0x031B,
+    0x0309, 0x0003, 0x006F, 0x031B, 0x0309, 0x0003, 0x004F, 0x031B,
+    0x0303, 0x0003, 0x006F, 0x031B, 0x0303, 0x0003, 0x004F, 0x031B,
+    0x0323, 0x0003, 0x006F, 0x031B, 0x0323, 0x0002, 0x0055, 0x0323,
+    0x0002, 0x0075, 0x0323, 0x0002, 0x0055, 0x0309, 0x0002, 0x0075,
+    0x0309, 0x0003, 0x0055, 0x031B, 0x0301, 0x0003, 0x0075, 0x031B,
+    0x0301, 0x0003, 0x0055, 0x031B, 0x0300, 0x0003, 0x0075, 0x031B,
+    0x0300, 0x0003, 0x0055, 0x031B, 0x0309, 0x0003, 0x0075, 0x031B,
+    0x0309, 0x0003, 0x0055, 0x031B, 0x0303, 0x0003, 0x0075, 0x031B,
+    0x0303, 0x0003, 0x0055, 0x031B, 0x0323, 0x0003, 0x0075, 0x031B,
+    0x0323, 0x0002, 0x0059, 0x0300, 0x0002, 0x0079, 0x0300, 0x0002,
+    0x0059, 0x0323, 0x0002, 0x0079, 0x0323, 0x0002, 0x0059, 0x0309,
+    0x0002, 0x0079, 0x0309, 0x0002, 0x0059, 0x0303, 0x0002, 0x0079,
+    0x0303, 0x0002, 0x03B1, 0x0313, 0x0002, 0x03B1, 0x0314, 0x0003,
+    0x03B1, 0x0313, 0x0300, 0x0003, 0x03B1, 0x0314, 0x0300, 0x0003,
+    0x03B1, 0x0313, 0x0301, 0x0003, 0x03B1, 0x0314, 0x0301, 0x0003,
+    0x03B1, 0x0313, 0x0342, 0x0003, 0x03B1, 0x0314, 0x0342, 0x0002,
+    0x0391, 0x0313, 0x0002, 0x0391, 0x0314, 0x0003, 0x0391, 0x0313,
+    0x0300, 0x0003, 0x0391, 0x0314, 0x0300, 0x0003, 0x0391, 0x0313,
+    0x0301, 0x0003, 0x0391, 0x0314, 0x0301, 0x0003, 0x0391, 0x0313,
+    0x0342, 0x0003, 0x0391, 0x0314, 0x0342, 0x0002, 0x03B5, 0x0313,
+    0x0002, 0x03B5, 0x0314, 0x0003, 0x03B5, 0x0313, 0x0300, 0x0003,
+    0x03B5, 0x0314, 0x0300, 0x0003, 0x03B5, 0x0313, 0x0301, 0x0003,
+    0x03B5, 0x0314, 0x0301, 0x0002, 0x0395, 0x0313, 0x0002, 0x0395,
+    0x0314, 0x0003, 0x0395, 0x0313, 0x0300, 0x0003, 0x0395, 0x0314,
+    0x0300, 0x0003, 0x0395, 0x0313, 0x0301, 0x0003, 0x0395, 0x0314,
+    0x0301, 0x0002, 0x03B7, 0x0313, 0x0002, 0x03B7, 0x0314, 0x0003,
+    0x03B7, 0x0313, 0x0300, 0x0003, 0x03B7, 0x0314, 0x0300, 0x0003,
+    0x03B7, 0x0313, 0x0301, 0x0003, 0x03B7, 0x0314, 0x0301, 0x0003,
+    0x03B7, 0x0313, 0x0342, 0x0003, 0x03B7, 0x0314, 0x0342, 0x0002,
+    0x0397, 0x0313, 0x0002, 0x0397, 0x0314, 0x0003, 0x0397, 0x0313,
+    0x0300, 0x0003, 0x0397, 0x0314, 0x0300, 0x0003, 0x0397, 0x0313,
+    0x0301, 0x0003, 0x0397, 0x0314, 0x0301, 0x0003, 0x0397, 0x0313,
+    0x0342, 0x0003, 0x0397, 0x0314, 0x0342, 0x0002, 0x03B9, 0x0313,
+    0x0002, 0x03B9, 0x0314, 0x0003, 0x03B9, 0x0313, 0x0300, 0x0003,
+    0x03B9, 0x0314, 0x0300, 0x0003, 0x03B9, 0x0313, 0x0301, 0x0003,
+    0x03B9, 0x0314, 0x0301, 0x0003, 0x03B9, 0x0313, 0x0342, 0x0003,
+    0x03B9, 0x0314, 0x0342, 0x0002, 0x0399, 0x0313, 0x0002, 0x0399,
+    0x0314, 0x0003, 0x0399, 0x0313, 0x0300, 0x0003, 0x0399, 0x0314,
+    0x0300, 0x0003, 0x0399, 0x0313, 0x0301, 0x0003, 0x0399, 0x0314,
+    0x0301, 0x0003, 0x0399, 0x0313, 0x0342, 0x0003, 0x0399, 0x0314,
+    0x0342, 0x0002, 0x03BF, 0x0313, 0x0002, 0x03BF, 0x0314, 0x0003,
+    0x03BF, 0x0313, 0x0300, 0x0003, 0x03BF, 0x0314, 0x0300, 0x0003,
+    0x03BF, 0x0313, 0x0301, 0x0003, 0x03BF, 0x0314, 0x0301, 0x0002,
+    0x039F, 0x0313, 0x0002, 0x039F, 0x0314, 0x0003, 0x039F, 0x0313,
+    0x0300, 0x0003, 0x039F, 0x0314, 0x0300, 0x0003, 0x039F, 0x0313,
+    0x0301, 0x0003, 0x039F, 0x0314, 0x0301, 0x0002, 0x03C5, 0x0313,
+    0x0002, 0x03C5, 0x0314, 0x0003, 0x03C5, 0x0313, 0x0300, 0x0003,
+    0x03C5, 0x0314, 0x0300, 0x0003, 0x03C5, 0x0313, 0x0301, 0x0003,
+    0x03C5, 0x0314, 0x0301, 0x0003, 0x03C5, 0x0313, 0x0342, 0x0003,
+    0x03C5, 0x0314, 0x0342, 0x0002, 0x03A5, 0x0314, 0x0003, 0x03A5,
+    0x0314, 0x0300, 0x0003, 0x03A5, 0x0314, 0x0301, 0x0003, 0x03A5,
+    0x0314, 0x0342, 0x0002, 0x03C9, 0x0313, 0x0002, 0x03C9, 0x0314,
+    0x0003, 0x03C9, 0x0313, 0x0300, 0x0003, 0x03C9, 0x0314, 0x0300,
+    0x0003, 0x03C9, 0x0313, 0x0301, 0x0003, 0x03C9, 0x0314, 0x0301,
+    0x0003, 0x03C9, 0x0313, 0x0342, 0x0003, 0x03C9, 0x0314, 0x0342,
+    0x0002, 0x03A9, 0x0313, 0x0002, 0x03A9, 0x0314, 0x0003, 0x03A9,
+    0x0313, 0x0300, 0x0003, 0x03A9, 0x0314, 0x0300, 0x0003, 0x03A9,
+    0x0313, 0x0301, 0x0003, 0x03A9, 0x0314, 0x0301, 0x0003, 0x03A9,
+    0x0313, 0x0342, 0x0003, 0x03A9, 0x0314, 0x0342, 0x0002, 0x03B1,
+    0x0300, 0x0002, 0x03B1, 0x0301, 0x0002, 0x03B5, 0x0300, 0x0002,
+    0x03B5, 0x0301, 0x0002, 0x03B7, 0x0300, 0x0002, 0x03B7, 0x0301,
+    0x0002, 0x03B9, 0x0300, 0x0002, 0x03B9, 0x0301, 0x0002, 0x03BF,
+    0x0300, 0x0002, 0x03BF, 0x0301, 0x0002, 0x03C5, 0x0300, 0x0002,
+    0x03C5, 0x0301, 0x0002, 0x03C9, 0x0300, 0x0002, 0x03C9, 0x0301,
+    0x0003, 0x03B1, 0x0313, 0x0345, 0x0003, 0x03B1, 0x0314, 0x0345,
+    0x0004, 0x03B1, 0x0313, 0x0300, 0x0345, 0x0004, 0x03B1, 0x0314,
+    0x0300, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0301, 0x0345, 0x0004,
+    0x03B1, 0x0314, 0x0301, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0342,
+    0x0345, 0x0004, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0003, 0x0391,
+    0x0313, 0x0345, 0x0003, 0x0391, 0x0314, 0x0345, 0x0004, 0x0391,
+    0x0313, 0x0300, 0x0345, 0x0004, 0x0391, 0x0314, 0x0300, 0x0345,
+    0x0004, 0x0391, 0x0313, 0x0301, 0x0345, 0x0004, 0x0391, 0x0314,
+    0x0301, 0x0345, 0x0004, 0x0391, 0x0313, 0x0342, 0x0345, 0x0004,
+    0x0391, 0x0314, 0x0342, 0x0345, 0x0003, 0x03B7, 0x0313, 0x0345,
+    0x0003, 0x03B7, 0x0314, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0300,
+    0x0345, 0x0004, 0x03B7, 0x0314, 0x0300, 0x0345, 0x0004, 0x03B7,
+    0x0313, 0x0301, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0301, 0x0345,
+    0x0004, 0x03B7, 0x0313, 0x0342, 0x0345, 0x0004, 0x03B7, 0x0314,
+    0x0342, 0x0345, 0x0003, 0x0397, 0x0313, 0x0345, 0x0003, 0x0397,
+    0x0314, 0x0345, 0x0004, 0x0397, 0x0313, 0x0300, 0x0345, 0x0004,
+    0x0397, 0x0314, 0x0300, 0x0345, 0x0004, 0x0397, 0x0313, 0x0301,
+    0x0345, 0x0004, 0x0397, 0x0314, 0x0301, 0x0345, 0x0004, 0x0397,
+    0x0313, 0x0342, 0x0345, 0x0004, 0x0397, 0x0314, 0x0342, 0x0345,
+    0x0003, 0x03C9, 0x0313, 0x0345, 0x0003, 0x03C9, 0x0314, 0x0345,
+    0x0004, 0x03C9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03C9, 0x0314,
+    0x0300, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0301, 0x0345, 0x0004,
+    0x03C9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0342,
+    0x0345, 0x0004, 0x03C9, 0x0314, 0x0342, 0x0345, 0x0003, 0x03A9,
+    0x0313, 0x0345, 0x0003, 0x03A9, 0x0314, 0x0345, 0x0004, 0x03A9,
+    0x0313, 0x0300, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0300, 0x0345,
+    0x0004, 0x03A9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03A9, 0x0314,
+    0x0301, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0342, 0x0345, 0x0004,
+    0x03A9, 0x0314, 0x0342, 0x0345, 0x0002, 0x03B1, 0x0306, 0x0002,
+    0x03B1, 0x0304, 0x0003, 0x03B1, 0x0300, 0x0345, 0x0002, 0x03B1,
+    0x0345, 0x0003, 0x03B1, 0x0301, 0x0345, 0x0002, 0x03B1, 0x0342,
+    0x0003, 0x03B1, 0x0342, 0x0345, 0x0002, 0x0391, 0x0306, 0x0002,
+    0x0391, 0x0304, 0x0002, 0x0391, 0x0300, 0x0002, 0x0391, 0x0301,
+    0x0002, 0x0391, 0x0345, 0x0000, 0x0002, 0x0020, 0x0313, 0x0001,
+    0x03B9, 0x0000, 0x0002, 0x0020, 0x0313, 0x0000, 0x0002, 0x0020,
+    0x0342, 0x0002, 0x00A8, 0x0342, 0x0003, 0x0020, 0x0308, 0x0342,
+    0x0003, 0x03B7, 0x0300, 0x0345, 0x0002, 0x03B7, 0x0345, 0x0003,
+    0x03B7, 0x0301, 0x0345, 0x0002, 0x03B7, 0x0342, 0x0003, 0x03B7,
+    0x0342, 0x0345, 0x0002, 0x0395, 0x0300, 0x0002, 0x0395, 0x0301,
+    0x0002, 0x0397, 0x0300, 0x0002, 0x0397, 0x0301, 0x0002, 0x0397,
+    0x0345, 0x0002, 0x1FBF, 0x0300, 0x0003, 0x0020, 0x0313, 0x0300,
+    0x0002, 0x1FBF, 0x0301, 0x0003, 0x0020, 0x0313, 0x0301, 0x0002,
+    0x1FBF, 0x0342, 0x0003, 0x0020, 0x0313, 0x0342, 0x0002, 0x03B9,
+    0x0306, 0x0002, 0x03B9, 0x0304, 0x0003, 0x03B9, 0x0308, 0x0300,
+    0x0003, 0x03B9, 0x0308, 0x0301, 0x0002, 0x03B9, 0x0342, 0x0003,
+    0x03B9, 0x0308, 0x0342, 0x0002, 0x0399, 0x0306, 0x0002, 0x0399,
+    0x0304, 0x0002, 0x0399, 0x0300, 0x0002, 0x0399, 0x0301, 0x0002,
+    0x1FFE, 0x0300, 0x0003, 0x0020, 0x0314, 0x0300, 0x0002, 0x1FFE,
+    0x0301, 0x0003, 0x0020, 0x0314, 0x0301, 0x0002, 0x1FFE, 0x0342,
+    0x0003, 0x0020, 0x0314, 0x0342, 0x0002, 0x03C5, 0x0306, 0x0002,
+    0x03C5, 0x0304, 0x0003, 0x03C5, 0x0308, 0x0300, 0x0003, 0x03C5,
+    0x0308, 0x0301, 0x0002, 0x03C1, 0x0313, 0x0002, 0x03C1, 0x0314,
+    0x0002, 0x03C5, 0x0342, 0x0003, 0x03C5, 0x0308, 0x0342, 0x0002,
+    0x03A5, 0x0306, 0x0002, 0x03A5, 0x0304, 0x0002, 0x03A5, 0x0300,
+    0x0002, 0x03A5, 0x0301, 0x0002, 0x03A1, 0x0314, 0x0002, 0x00A8,
+    0x0300, 0x0003, 0x0020, 0x0308, 0x0300, 0x0002, 0x00A8, 0x0301,
+    0x0003, 0x0020, 0x0308, 0x0301, 0x0001, 0x0060, 0x0003, 0x03C9,
+    0x0300, 0x0345, 0x0002, 0x03C9, 0x0345, 0x0003, 0x03C9, 0x0301,
+    0x0345, 0x0002, 0x03C9, 0x0342, 0x0003, 0x03C9, 0x0342, 0x0345,
+    0x0002, 0x039F, 0x0300, 0x0002, 0x039F, 0x0301, 0x0002, 0x03A9,
+    0x0300, 0x0002, 0x03A9, 0x0301, 0x0002, 0x03A9, 0x0345, 0x0001,
+    0x00B4, 0x0002, 0x0020, 0x0301, 0x0000, 0x0002, 0x0020, 0x0314,
+    0x0001, 0x2002, 0x0001, 0x0020, 0x0001, 0x2003, 0x0001, 0x0020,
+    0x0000, 0x0001, 0x0020, 0x0000, 0x0001, 0x0020, 0x0000, 0x0001,
+    0x0020, 0x0000, 0x0001, 0x0020, 0x0000, 0x0001, 0x0020, 0x0000,
+    0x0001, 0x0020, 0x0000, 0x0001, 0x0020, 0x0000, 0x0001, 0x0020,
+    0x0000, 0x0001, 0x0020, 0x0000, 0x0001, 0x2010, 0x0000, 0x0002,
+    0x0020, 0x0333, 0x0000, 0x0001, 0x002E, 0x0000, 0x0002, 0x002E,
+    0x002E, 0x0000, 0x0003, 0x002E, 0x002E, 0x002E, 0x0000, 0x0001,
+    0x0020, 0x0000, 0x0002, 0x2032, 0x2032, 0x0000, 0x0003, 0x2032,
+    0x2032, 0x2032, 0x0000, 0x0002, 0x2035, 0x2035, 0x0000, 0x0003,
+    0x2035, 0x2035, 0x2035, 0x0000, 0x0002, 0x0021, 0x0021, 0x0000,
+    0x0002, 0x0020, 0x0305, 0x0000, 0x0002, 0x003F, 0x003F, 0x0000,
+    0x0002, 0x003F, 0x0021, 0x0000, 0x0002, 0x0021, 0x003F, 0x0000,
+    0x0004, 0x2032, 0x2032, 0x2032, 0x2032, 0x0000, 0x0001, 0x0020,
+    0x0000, 0x0001, 0x0030, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x0034, 0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036, 0x0000,
+    0x0001, 0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001, 0x0039,
+    0x0000, 0x0001, 0x002B, 0x0000, 0x0001, 0x2212, 0x0000, 0x0001,
+    0x003D, 0x0000, 0x0001, 0x0028, 0x0000, 0x0001, 0x0029, 0x0000,
+    0x0001, 0x006E, 0x0000, 0x0001, 0x0030, 0x0000, 0x0001, 0x0031,
+    0x0000, 0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000, 0x0001,
+    0x0034, 0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036, 0x0000,
+    0x0001, 0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001, 0x0039,
+    0x0000, 0x0001, 0x002B, 0x0000, 0x0001, 0x2212, 0x0000, 0x0001,
+    0x003D, 0x0000, 0x0001, 0x0028, 0x0000, 0x0001, 0x0029, 0x0000,
+    0x0001, 0x0061, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x006F,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0259, 0x0000, 0x0001,
+    0x0068, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C, 0x0000,
+    0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001, 0x0070,
+    0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000, 0x0002,
+    0x0052, 0x0073, 0x0000, 0x0003, 0x0061, 0x002F, 0x0063, 0x0000,
+    0x0003, 0x0061, 0x002F, 0x0073, 0x0000, 0x0001, 0x0043, 0x0000,
+    0x0002, 0x00B0, 0x0043, 0x0000, 0x0003, 0x0063, 0x002F, 0x006F,
+    0x0000, 0x0003, 0x0063, 0x002F, 0x0075, 0x0000, 0x0001, 0x0190,
+    0x0000, 0x0002, 0x00B0, 0x0046, 0x0000, 0x0001, 0x0067, 0x0000,
+    0x0001, 0x0048, 0x0000, 0x0001, 0x0048, 0x0000, 0x0001, 0x0048,
+    0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0127, 0x0000, 0x0001,
+    0x0049, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004C, 0x0000,
+    0x0001, 0x006C, 0x0000, 0x0001, 0x004E, 0x0000, 0x0002, 0x004E,
+    0x006F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051, 0x0000,
+    0x0001, 0x0052, 0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0052,
+    0x0000, 0x0002, 0x0053, 0x004D, 0x0000, 0x0003, 0x0054, 0x0045,
+    0x004C, 0x0000, 0x0002, 0x0054, 0x004D, 0x0000, 0x0001, 0x005A,
+    0x0001, 0x03A9, 0x0000, 0x0001, 0x005A, 0x0001, 0x004B, 0x0002,
+    0x0041, 0x030A, 0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043,
+    0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001,
+    0x0046, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x006F, 0x0000,
+    0x0001, 0x05D0, 0x0000, 0x0001, 0x05D1, 0x0000, 0x0001, 0x05D2,
+    0x0000, 0x0001, 0x05D3, 0x0000, 0x0001, 0x0069, 0x0000, 0x0003,
+    0x0046, 0x0041, 0x0058, 0x0000, 0x0001, 0x03C0, 0x0000, 0x0001,
+    0x03B3, 0x0000, 0x0001, 0x0393, 0x0000, 0x0001, 0x03A0, 0x0000,
+    0x0001, 0x2211, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0064,
+    0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x006A, 0x0000, 0x0003, 0x0031, 0x2044, 0x0037, 0x0000, 0x0003,
+    0x0031, 0x2044, 0x0039, 0x0000, 0x0004, 0x0031, 0x2044, 0x0031,
+    0x0030, 0x0000, 0x0003, 0x0031, 0x2044, 0x0033, 0x0000, 0x0003,
+    0x0032, 0x2044, 0x0033, 0x0000, 0x0003, 0x0031, 0x2044, 0x0035,
+    0x0000, 0x0003, 0x0032, 0x2044, 0x0035, 0x0000, 0x0003, 0x0033,
+    0x2044, 0x0035, 0x0000, 0x0003, 0x0034, 0x2044, 0x0035, 0x0000,
+    0x0003, 0x0031, 0x2044, 0x0036, 0x0000, 0x0003, 0x0035, 0x2044,
+    0x0036, 0x0000, 0x0003, 0x0031, 0x2044, 0x0038, 0x0000, 0x0003,
+    0x0033, 0x2044, 0x0038, 0x0000, 0x0003, 0x0035, 0x2044, 0x0038,
+    0x0000, 0x0003, 0x0037, 0x2044, 0x0038, 0x0000, 0x0002, 0x0031,
+    0x2044, 0x0000, 0x0001, 0x0049, 0x0000, 0x0002, 0x0049, 0x0049,
+    0x0000, 0x0003, 0x0049, 0x0049, 0x0049, 0x0000, 0x0002, 0x0049,
+    0x0056, 0x0000, 0x0001, 0x0056, 0x0000, 0x0002, 0x0056, 0x0049,
+    0x0000, 0x0003, 0x0056, 0x0049, 0x0049, 0x0000, 0x0004, 0x0056,
+    0x0049, 0x0049, 0x0049, 0x0000, 0x0002, 0x0049, 0x0058, 0x0000,
+    0x0001, 0x0058, 0x0000, 0x0002, 0x0058, 0x0049, 0x0000, 0x0003,
+    0x0058, 0x0049, 0x0049, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001,
+    0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x004D, 0x0000,
+    0x0001, 0x0069, 0x0000, 0x0002, 0x0069, 0x0069, 0x0000, 0x0003,
+    0x0069, 0x0069, 0x0069, 0x0000, 0x0002, 0x0069, 0x0076, 0x0000,
+    0x0001, 0x0076, 0x0000, 0x0002, 0x0076, 0x0069, 0x0000, 0x0003,
+    0x0076, 0x0069, 0x0069, 0x0000, 0x0004, 0x0076, 0x0069, 0x0069,
+    0x0069, 0x0000, 0x0002, 0x0069, 0x0078, 0x0000, 0x0001, 0x0078,
+    0x0000, 0x0002, 0x0078, 0x0069, 0x0000, 0x0003, 0x0078, 0x0069,
+    0x0069, 0x0000, 0x0001, 0x006C, 0x0000, 0x0001, 0x0063, 0x0000,
+    0x0001, 0x0064, 0x0000, 0x0001, 0x006D, 0x0000, 0x0003, 0x0030,
+    0x2044, 0x0033, 0x0002, 0x2190, 0x0338, 0x0002, 0x2192, 0x0338,
+    0x0002, 0x2194, 0x0338, 0x0002, 0x21D0, 0x0338, 0x0002, 0x21D4,
+    0x0338, 0x0002, 0x21D2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002,
+    0x2208, 0x0338, 0x0002, 0x220B, 0x0338, 0x0002, 0x2223, 0x0338,
+    0x0002, 0x2225, 0x0338, 0x0000, 0x0002, 0x222B, 0x222B, 0x0000,
+    0x0003, 0x222B, 0x222B, 0x222B, 0x0000, 0x0002, 0x222E, 0x222E,
+    0x0000, 0x0003, 0x222E, 0x222E, 0x222E, 0x0002, 0x223C, 0x0338,
+    0x0002, 0x2243, 0x0338, 0x0002, 0x2245, 0x0338, 0x0002, 0x2248,
+    0x0338, 0x0002, 0x003D, 0x0338, 0x0002, 0x2261, 0x0338, 0x0002,
+    0x224D, 0x0338, 0x0002, 0x003C, 0x0338, 0x0002, 0x003E, 0x0338,
+    0x0002, 0x2264, 0x0338, 0x0002, 0x2265, 0x0338, 0x0002, 0x2272,
+    0x0338, 0x0002, 0x2273, 0x0338, 0x0002, 0x2276, 0x0338, 0x0002,
+    0x2277, 0x0338, 0x0002, 0x227A, 0x0338, 0x0002, 0x227B, 0x0338,
+    0x0002, 0x2282, 0x0338, 0x0002, 0x2283, 0x0338, 0x0002, 0x2286,
+    0x0338, 0x0002, 0x2287, 0x0338, 0x0002, 0x22A2, 0x0338, 0x0002,
+    0x22A8, 0x0338, 0x0002, 0x22A9, 0x0338, 0x0002, 0x22AB, 0x0338,
+    0x0002, 0x227C, 0x0338, 0x0002, 0x227D, 0x0338, 0x0002, 0x2291,
+    0x0338, 0x0002, 0x2292, 0x0338, 0x0002, 0x22B2, 0x0338, 0x0002,
+    0x22B3, 0x0338, 0x0002, 0x22B4, 0x0338, 0x0002, 0x22B5, 0x0338,
+    0x0001, 0x3008, 0x0001, 0x3009, 0x0000, 0x0001, 0x0031, 0x0000,
+    0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000, 0x0001, 0x0034,
+    0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036, 0x0000, 0x0001,
+    0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001, 0x0039, 0x0000,
+    0x0002, 0x0031, 0x0030, 0x0000, 0x0002, 0x0031, 0x0031, 0x0000,
+    0x0002, 0x0031, 0x0032, 0x0000, 0x0002, 0x0031, 0x0033, 0x0000,
+    0x0002, 0x0031, 0x0034, 0x0000, 0x0002, 0x0031, 0x0035, 0x0000,
+    0x0002, 0x0031, 0x0036, 0x0000, 0x0002, 0x0031, 0x0037, 0x0000,
+    0x0002, 0x0031, 0x0038, 0x0000, 0x0002, 0x0031, 0x0039, 0x0000,
+    0x0002, 0x0032, 0x0030, 0x0000, 0x0003, 0x0028, 0x0031, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x0032, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x0033, 0x0029, 0x0000, 0x0003, 0x0028, 0x0034, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x0035, 0x0029, 0x0000, 0x0003, 0x0028, 0x0036,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x0037, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x0038, 0x0029, 0x0000, 0x0003, 0x0028, 0x0039, 0x0029,
+    0x0000, 0x0004, 0x0028, 0x0031, 0x0030, 0x0029, 0x0000, 0x0004,
+    0x0028, 0x0031, 0x0031, 0x0029, 0x0000, 0x0004, 0x0028, 0x0031,
+    0x0032, 0x0029, 0x0000, 0x0004, 0x0028, 0x0031, 0x0033, 0x0029,
+    0x0000, 0x0004, 0x0028, 0x0031, 0x0034, 0x0029, 0x0000, 0x0004,
+    0x0028, 0x0031, 0x0035, 0x0029, 0x0000, 0x0004, 0x0028, 0x0031,
+    0x0036, 0x0029, 0x0000, 0x0004, 0x0028, 0x0031, 0x0037, 0x0029,
+    0x0000, 0x0004, 0x0028, 0x0031, 0x0038, 0x0029, 0x0000, 0x0004,
+    0x0028, 0x0031, 0x0039, 0x0029, 0x0000, 0x0004, 0x0028, 0x0032,
+    0x0030, 0x0029, 0x0000, 0x0002, 0x0031, 0x002E, 0x0000, 0x0002,
+    0x0032, 0x002E, 0x0000, 0x0002, 0x0033, 0x002E, 0x0000, 0x0002,
+    0x0034, 0x002E, 0x0000, 0x0002, 0x0035, 0x002E, 0x0000, 0x0002,
+    0x0036, 0x002E, 0x0000, 0x0002, 0x0037, 0x002E, 0x0000, 0x0002,
+    0x0038, 0x002E, 0x0000, 0x0002, 0x0039, 0x002E, 0x0000, 0x0003,
+    0x0031, 0x0030, 0x002E, 0x0000, 0x0003, 0x0031, 0x0031, 0x002E,
+    0x0000, 0x0003, 0x0031, 0x0032, 0x002E, 0x0000, 0x0003, 0x0031,
+    0x0033, 0x002E, 0x0000, 0x0003, 0x0031, 0x0034, 0x002E, 0x0000,
+    0x0003, 0x0031, 0x0035, 0x002E, 0x0000, 0x0003, 0x0031, 0x0036,
+    0x002E, 0x0000, 0x0003, 0x0031, 0x0037, 0x002E, 0x0000, 0x0003,
+    0x0031, 0x0038, 0x002E, 0x0000, 0x0003, 0x0031, 0x0039, 0x002E,
+    0x0000, 0x0003, 0x0032, 0x0030, 0x002E, 0x0000, 0x0003, 0x0028,
+    0x0061, 0x0029, 0x0000, 0x0003, 0x0028, 0x0062, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x0063, 0x0029, 0x0000, 0x0003, 0x0028, 0x0064,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x0065, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x0066, 0x0029, 0x0000, 0x0003, 0x0028, 0x0067, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x0068, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x0069, 0x0029, 0x0000, 0x0003, 0x0028, 0x006A, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x006B, 0x0029, 0x0000, 0x0003, 0x0028, 0x006C,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x006D, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x006E, 0x0029, 0x0000, 0x0003, 0x0028, 0x006F, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x0070, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x0071, 0x0029, 0x0000, 0x0003, 0x0028, 0x0072, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x0073, 0x0029, 0x0000, 0x0003, 0x0028, 0x0074,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x0075, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x0076, 0x0029, 0x0000, 0x0003, 0x0028, 0x0077, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x0078, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x0079, 0x0029, 0x0000, 0x0003, 0x0028, 0x007A, 0x0029, 0x0000,
+    0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043,
+    0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001,
+    0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001, 0x0048, 0x0000,
+    0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B,
+    0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001,
+    0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001, 0x0050, 0x0000,
+    0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0053,
+    0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001,
+    0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000,
+    0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x0061,
+    0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001,
+    0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000,
+    0x0001, 0x0067, 0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069,
+    0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001,
+    0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000,
+    0x0001, 0x006F, 0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071,
+    0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001,
+    0x0074, 0x0000, 0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000,
+    0x0001, 0x0077, 0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079,
+    0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x0030, 0x0000, 0x0004,
+    0x222B, 0x222B, 0x222B, 0x222B, 0x0000, 0x0003, 0x003A, 0x003A,
+    0x003D, 0x0000, 0x0002, 0x003D, 0x003D, 0x0000, 0x0003, 0x003D,
+    0x003D, 0x003D, 0x0002, 0x2ADD, 0x0338, 0x0000, 0x0001, 0x006A,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x2D61, 0x0000, 0x0001,
+    0x6BCD, 0x0000, 0x0001, 0x9F9F, 0x0000, 0x0001, 0x4E00, 0x0000,
+    0x0001, 0x4E28, 0x0000, 0x0001, 0x4E36, 0x0000, 0x0001, 0x4E3F,
+    0x0000, 0x0001, 0x4E59, 0x0000, 0x0001, 0x4E85, 0x0000, 0x0001,
+    0x4E8C, 0x0000, 0x0001, 0x4EA0, 0x0000, 0x0001, 0x4EBA, 0x0000,
+    0x0001, 0x513F, 0x0000, 0x0001, 0x5165, 0x0000, 0x0001, 0x516B,
+    0x0000, 0x0001, 0x5182, 0x0000, 0x0001, 0x5196, 0x0000, 0x0001,
+    0x51AB, 0x0000, 0x0001, 0x51E0, 0x0000, 0x0001, 0x51F5, 0x0000,
+    0x0001, 0x5200, 0x0000, 0x0001, 0x529B, 0x0000, 0x0001, 0x52F9,
+    0x0000, 0x0001, 0x5315, 0x0000, 0x0001, 0x531A, 0x0000, 0x0001,
+    0x5338, 0x0000, 0x0001, 0x5341, 0x0000, 0x0001, 0x535C, 0x0000,
+    0x0001, 0x5369, 0x0000, 0x0001, 0x5382, 0x0000, 0x0001, 0x53B6,
+    0x0000, 0x0001, 0x53C8, 0x0000, 0x0001, 0x53E3, 0x0000, 0x0001,
+    0x56D7, 0x0000, 0x0001, 0x571F, 0x0000, 0x0001, 0x58EB, 0x0000,
+    0x0001, 0x5902, 0x0000, 0x0001, 0x590A, 0x0000, 0x0001, 0x5915,
+    0x0000, 0x0001, 0x5927, 0x0000, 0x0001, 0x5973, 0x0000, 0x0001,
+    0x5B50, 0x0000, 0x0001, 0x5B80, 0x0000, 0x0001, 0x5BF8, 0x0000,
+    0x0001, 0x5C0F, 0x0000, 0x0001, 0x5C22, 0x0000, 0x0001, 0x5C38,
+    0x0000, 0x0001, 0x5C6E, 0x0000, 0x0001, 0x5C71, 0x0000, 0x0001,
+    0x5DDB, 0x0000, 0x0001, 0x5DE5, 0x0000, 0x0001, 0x5DF1, 0x0000,
+    0x0001, 0x5DFE, 0x0000, 0x0001, 0x5E72, 0x0000, 0x0001, 0x5E7A,
+    0x0000, 0x0001, 0x5E7F, 0x0000, 0x0001, 0x5EF4, 0x0000, 0x0001,
+    0x5EFE, 0x0000, 0x0001, 0x5F0B, 0x0000, 0x0001, 0x5F13, 0x0000,
+    0x0001, 0x5F50, 0x0000, 0x0001, 0x5F61, 0x0000, 0x0001, 0x5F73,
+    0x0000, 0x0001, 0x5FC3, 0x0000, 0x0001, 0x6208, 0x0000, 0x0001,
+    0x6236, 0x0000, 0x0001, 0x624B, 0x0000, 0x0001, 0x652F, 0x0000,
+    0x0001, 0x6534, 0x0000, 0x0001, 0x6587, 0x0000, 0x0001, 0x6597,
+    0x0000, 0x0001, 0x65A4, 0x0000, 0x0001, 0x65B9, 0x0000, 0x0001,
+    0x65E0, 0x0000, 0x0001, 0x65E5, 0x0000, 0x0001, 0x66F0, 0x0000,
+    0x0001, 0x6708, 0x0000, 0x0001, 0x6728, 0x0000, 0x0001, 0x6B20,
+    0x0000, 0x0001, 0x6B62, 0x0000, 0x0001, 0x6B79, 0x0000, 0x0001,
+    0x6BB3, 0x0000, 0x0001, 0x6BCB, 0x0000, 0x0001, 0x6BD4, 0x0000,
+    0x0001, 0x6BDB, 0x0000, 0x0001, 0x6C0F, 0x0000, 0x0001, 0x6C14,
+    0x0000, 0x0001, 0x6C34, 0x0000, 0x0001, 0x706B, 0x0000, 0x0001,
+    0x722A, 0x0000, 0x0001, 0x7236, 0x0000, 0x0001, 0x723B, 0x0000,
+    0x0001, 0x723F, 0x0000, 0x0001, 0x7247, 0x0000, 0x0001, 0x7259,
+    0x0000, 0x0001, 0x725B, 0x0000, 0x0001, 0x72AC, 0x0000, 0x0001,
+    0x7384, 0x0000, 0x0001, 0x7389, 0x0000, 0x0001, 0x74DC, 0x0000,
+    0x0001, 0x74E6, 0x0000, 0x0001, 0x7518, 0x0000, 0x0001, 0x751F,
+    0x0000, 0x0001, 0x7528, 0x0000, 0x0001, 0x7530, 0x0000, 0x0001,
+    0x758B, 0x0000, 0x0001, 0x7592, 0x0000, 0x0001, 0x7676, 0x0000,
+    0x0001, 0x767D, 0x0000, 0x0001, 0x76AE, 0x0000, 0x0001, 0x76BF,
+    0x0000, 0x0001, 0x76EE, 0x0000, 0x0001, 0x77DB, 0x0000, 0x0001,
+    0x77E2, 0x0000, 0x0001, 0x77F3, 0x0000, 0x0001, 0x793A, 0x0000,
+    0x0001, 0x79B8, 0x0000, 0x0001, 0x79BE, 0x0000, 0x0001, 0x7A74,
+    0x0000, 0x0001, 0x7ACB, 0x0000, 0x0001, 0x7AF9, 0x0000, 0x0001,
+    0x7C73, 0x0000, 0x0001, 0x7CF8, 0x0000, 0x0001, 0x7F36, 0x0000,
+    0x0001, 0x7F51, 0x0000, 0x0001, 0x7F8A, 0x0000, 0x0001, 0x7FBD,
+    0x0000, 0x0001, 0x8001, 0x0000, 0x0001, 0x800C, 0x0000, 0x0001,
+    0x8012, 0x0000, 0x0001, 0x8033, 0x0000, 0x0001, 0x807F, 0x0000,
+    0x0001, 0x8089, 0x0000, 0x0001, 0x81E3, 0x0000, 0x0001, 0x81EA,
+    0x0000, 0x0001, 0x81F3, 0x0000, 0x0001, 0x81FC, 0x0000, 0x0001,
+    0x820C, 0x0000, 0x0001, 0x821B, 0x0000, 0x0001, 0x821F, 0x0000,
+    0x0001, 0x826E, 0x0000, 0x0001, 0x8272, 0x0000, 0x0001, 0x8278,
+    0x0000, 0x0001, 0x864D, 0x0000, 0x0001, 0x866B, 0x0000, 0x0001,
+    0x8840, 0x0000, 0x0001, 0x884C, 0x0000, 0x0001, 0x8863, 0x0000,
+    0x0001, 0x897E, 0x0000, 0x0001, 0x898B, 0x0000, 0x0001, 0x89D2,
+    0x0000, 0x0001, 0x8A00, 0x0000, 0x0001, 0x8C37, 0x0000, 0x0001,
+    0x8C46, 0x0000, 0x0001, 0x8C55, 0x0000, 0x0001, 0x8C78, 0x0000,
+    0x0001, 0x8C9D, 0x0000, 0x0001, 0x8D64, 0x0000, 0x0001, 0x8D70,
+    0x0000, 0x0001, 0x8DB3, 0x0000, 0x0001, 0x8EAB, 0x0000, 0x0001,
+    0x8ECA, 0x0000, 0x0001, 0x8F9B, 0x0000, 0x0001, 0x8FB0, 0x0000,
+    0x0001, 0x8FB5, 0x0000, 0x0001, 0x9091, 0x0000, 0x0001, 0x9149,
+    0x0000, 0x0001, 0x91C6, 0x0000, 0x0001, 0x91CC, 0x0000, 0x0001,
+    0x91D1, 0x0000, 0x0001, 0x9577, 0x0000, 0x0001, 0x9580, 0x0000,
+    0x0001, 0x961C, 0x0000, 0x0001, 0x96B6, 0x0000, 0x0001, 0x96B9,
+    0x0000, 0x0001, 0x96E8, 0x0000, 0x0001, 0x9751, 0x0000, 0x0001,
+    0x975E, 0x0000, 0x0001, 0x9762, 0x0000, 0x0001, 0x9769, 0x0000,
+    0x0001, 0x97CB, 0x0000, 0x0001, 0x97ED, 0x0000, 0x0001, 0x97F3,
+    0x0000, 0x0001, 0x9801, 0x0000, 0x0001, 0x98A8, 0x0000, 0x0001,
+    0x98DB, 0x0000, 0x0001, 0x98DF, 0x0000, 0x0001, 0x9996, 0x0000,
+    0x0001, 0x9999, 0x0000, 0x0001, 0x99AC, 0x0000, 0x0001, 0x9AA8,
+    0x0000, 0x0001, 0x9AD8, 0x0000, 0x0001, 0x9ADF, 0x0000, 0x0001,
+    0x9B25, 0x0000, 0x0001, 0x9B2F, 0x0000, 0x0001, 0x9B32, 0x0000,
+    0x0001, 0x9B3C, 0x0000, 0x0001, 0x9B5A, 0x0000, 0x0001, 0x9CE5,
+    0x0000, 0x0001, 0x9E75, 0x0000, 0x0001, 0x9E7F, 0x0000, 0x0001,
+    0x9EA5, 0x0000, 0x0001, 0x9EBB, 0x0000, 0x0001, 0x9EC3, 0x0000,
+    0x0001, 0x9ECD, 0x0000, 0x0001, 0x9ED1, 0x0000, 0x0001, 0x9EF9,
+    0x0000, 0x0001, 0x9EFD, 0x0000, 0x0001, 0x9F0E, 0x0000, 0x0001,
+    0x9F13, 0x0000, 0x0001, 0x9F20, 0x0000, 0x0001, 0x9F3B, 0x0000,
+    0x0001, 0x9F4A, 0x0000, 0x0001, 0x9F52, 0x0000, 0x0001, 0x9F8D,
+    0x0000, 0x0001, 0x9F9C, 0x0000, 0x0001, 0x9FA0, 0x0000, 0x0001,
+    0x0020, 0x0000, 0x0001, 0x3012, 0x0000, 0x0001, 0x5341, 0x0000,
+    0x0001, 0x5344, 0x0000, 0x0001, 0x5345, 0x0002, 0x304B, 0x3099,
+    0x0002, 0x304D, 0x3099, 0x0002, 0x304F, 0x3099, 0x0002, 0x3051,
+    0x3099, 0x0002, 0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002,
+    0x3057, 0x3099, 0x0002, 0x3059, 0x3099, 0x0002, 0x305B, 0x3099,
+    0x0002, 0x305D, 0x3099, 0x0002, 0x305F, 0x3099, 0x0002, 0x3061,
+    0x3099, 0x0002, 0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002,
+    0x3068, 0x3099, 0x0002, 0x306F, 0x3099, 0x0002, 0x306F, 0x309A,
+    0x0002, 0x3072, 0x3099, 0x0002, 0x3072, 0x309A, 0x0002, 0x3075,
+    0x3099, 0x0002, 0x3075, 0x309A, 0x0002, 0x3078, 0x3099, 0x0002,
+    0x3078, 0x309A, 0x0002, 0x307B, 0x3099, 0x0002, 0x307B, 0x309A,
+    0x0002, 0x3046, 0x3099, 0x0000, 0x0002, 0x0020, 0x3099, 0x0000,
+    0x0002, 0x0020, 0x309A, 0x0002, 0x309D, 0x3099, 0x0000, 0x0002,
+    0x3088, 0x308A, 0x0002, 0x30AB, 0x3099, 0x0002, 0x30AD, 0x3099,
+    0x0002, 0x30AF, 0x3099, 0x0002, 0x30B1, 0x3099, 0x0002, 0x30B3,
+    0x3099, 0x0002, 0x30B5, 0x3099, 0x0002, 0x30B7, 0x3099, 0x0002,
+    0x30B9, 0x3099, 0x0002, 0x30BB, 0x3099, 0x0002, 0x30BD, 0x3099,
+    0x0002, 0x30BF, 0x3099, 0x0002, 0x30C1, 0x3099, 0x0002, 0x30C4,
+    0x3099, 0x0002, 0x30C6, 0x3099, 0x0002, 0x30C8, 0x3099, 0x0002,
+    0x30CF, 0x3099, 0x0002, 0x30CF, 0x309A, 0x0002, 0x30D2, 0x3099,
+    0x0002, 0x30D2, 0x309A, 0x0002, 0x30D5, 0x3099, 0x0002, 0x30D5,
+    0x309A, 0x0002, 0x30D8, 0x3099, 0x0002, 0x30D8, 0x309A, 0x0002,
+    0x30DB, 0x3099, 0x0002, 0x30DB, 0x309A, 0x0002, 0x30A6, 0x3099,
+    0x0002, 0x30EF, 0x3099, 0x0002, 0x30F0, 0x3099, 0x0002, 0x30F1,
+    0x3099, 0x0002, 0x30F2, 0x3099, 0x0002, 0x30FD, 0x3099, 0x0000,
+    0x0002, 0x30B3, 0x30C8, 0x0000, 0x0001, 0x1100, 0x0000, 0x0001,
+    0x1101, 0x0000, 0x0001, 0x11AA, 0x0000, 0x0001, 0x1102, 0x0000,
+    0x0001, 0x11AC, 0x0000, 0x0001, 0x11AD, 0x0000, 0x0001, 0x1103,
+    0x0000, 0x0001, 0x1104, 0x0000, 0x0001, 0x1105, 0x0000, 0x0001,
+    0x11B0, 0x0000, 0x0001, 0x11B1, 0x0000, 0x0001, 0x11B2, 0x0000,
+    0x0001, 0x11B3, 0x0000, 0x0001, 0x11B4, 0x0000, 0x0001, 0x11B5,
+    0x0000, 0x0001, 0x111A, 0x0000, 0x0001, 0x1106, 0x0000, 0x0001,
+    0x1107, 0x0000, 0x0001, 0x1108, 0x0000, 0x0001, 0x1121, 0x0000,
+    0x0001, 0x1109, 0x0000, 0x0001, 0x110A, 0x0000, 0x0001, 0x110B,
+    0x0000, 0x0001, 0x110C, 0x0000, 0x0001, 0x110D, 0x0000, 0x0001,
+    0x110E, 0x0000, 0x0001, 0x110F, 0x0000, 0x0001, 0x1110, 0x0000,
+    0x0001, 0x1111, 0x0000, 0x0001, 0x1112, 0x0000, 0x0001, 0x1161,
+    0x0000, 0x0001, 0x1162, 0x0000, 0x0001, 0x1163, 0x0000, 0x0001,
+    0x1164, 0x0000, 0x0001, 0x1165, 0x0000, 0x0001, 0x1166, 0x0000,
+    0x0001, 0x1167, 0x0000, 0x0001, 0x1168, 0x0000, 0x0001, 0x1169,
+    0x0000, 0x0001, 0x116A, 0x0000, 0x0001, 0x116B, 0x0000, 0x0001,
+    0x116C, 0x0000, 0x0001, 0x116D, 0x0000, 0x0001, 0x116E, 0x0000,
+    0x0001, 0x116F, 0x0000, 0x0001, 0x1170, 0x0000, 0x0001, 0x1171,
+    0x0000, 0x0001, 0x1172, 0x0000, 0x0001, 0x1173, 0x0000, 0x0001,
+    0x1174, 0x0000, 0x0001, 0x1175, 0x0000, 0x0001, 0x1160, 0x0000,
+    0x0001, 0x1114, 0x0000, 0x0001, 0x1115, 0x0000, 0x0001, 0x11C7,
+    0x0000, 0x0001, 0x11C8, 0x0000, 0x0001, 0x11CC, 0x0000, 0x0001,
+    0x11CE, 0x0000, 0x0001, 0x11D3, 0x0000, 0x0001, 0x11D7, 0x0000,
+    0x0001, 0x11D9, 0x0000, 0x0001, 0x111C, 0x0000, 0x0001, 0x11DD,
+    0x0000, 0x0001, 0x11DF, 0x0000, 0x0001, 0x111D, 0x0000, 0x0001,
+    0x111E, 0x0000, 0x0001, 0x1120, 0x0000, 0x0001, 0x1122, 0x0000,
+    0x0001, 0x1123, 0x0000, 0x0001, 0x1127, 0x0000, 0x0001, 0x1129,
+    0x0000, 0x0001, 0x112B, 0x0000, 0x0001, 0x112C, 0x0000, 0x0001,
+    0x112D, 0x0000, 0x0001, 0x112E, 0x0000, 0x0001, 0x112F, 0x0000,
+    0x0001, 0x1132, 0x0000, 0x0001, 0x1136, 0x0000, 0x0001, 0x1140,
+    0x0000, 0x0001, 0x1147, 0x0000, 0x0001, 0x114C, 0x0000, 0x0001,
+    0x11F1, 0x0000, 0x0001, 0x11F2, 0x0000, 0x0001, 0x1157, 0x0000,
+    0x0001, 0x1158, 0x0000, 0x0001, 0x1159, 0x0000, 0x0001, 0x1184,
+    0x0000, 0x0001, 0x1185, 0x0000, 0x0001, 0x1188, 0x0000, 0x0001,
+    0x1191, 0x0000, 0x0001, 0x1192, 0x0000, 0x0001, 0x1194, 0x0000,
+    0x0001, 0x119E, 0x0000, 0x0001, 0x11A1, 0x0000, 0x0001, 0x4E00,
+    0x0000, 0x0001, 0x4E8C, 0x0000, 0x0001, 0x4E09, 0x0000, 0x0001,
+    0x56DB, 0x0000, 0x0001, 0x4E0A, 0x0000, 0x0001, 0x4E2D, 0x0000,
+    0x0001, 0x4E0B, 0x0000, 0x0001, 0x7532, 0x0000, 0x0001, 0x4E59,
+    0x0000, 0x0001, 0x4E19, 0x0000, 0x0001, 0x4E01, 0x0000, 0x0001,
+    0x5929, 0x0000, 0x0001, 0x5730, 0x0000, 0x0001, 0x4EBA, 0x0000,
+    0x0003, 0x0028, 0x1100, 0x0029, 0x0000, 0x0003, 0x0028, 0x1102,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x1103, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x1105, 0x0029, 0x0000, 0x0003, 0x0028, 0x1106, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x1107, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x1109, 0x0029, 0x0000, 0x0003, 0x0028, 0x110B, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x110C, 0x0029, 0x0000, 0x0003, 0x0028, 0x110E,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x110F, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x1110, 0x0029, 0x0000, 0x0003, 0x0028, 0x1111, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x1112, 0x0029, 0x0000, 0x0004, 0x0028,
+    0x1100, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028, 0x1102, 0x1161,
+    0x0029, 0x0000, 0x0004, 0x0028, 0x1103, 0x1161, 0x0029, 0x0000,
+    0x0004, 0x0028, 0x1105, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028,
+    0x1106, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028, 0x1107, 0x1161,
+    0x0029, 0x0000, 0x0004, 0x0028, 0x1109, 0x1161, 0x0029, 0x0000,
+    0x0004, 0x0028, 0x110B, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028,
+    0x110C, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028, 0x110E, 0x1161,
+    0x0029, 0x0000, 0x0004, 0x0028, 0x110F, 0x1161, 0x0029, 0x0000,
+    0x0004, 0x0028, 0x1110, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028,
+    0x1111, 0x1161, 0x0029, 0x0000, 0x0004, 0x0028, 0x1112, 0x1161,
+    0x0029, 0x0000, 0x0004, 0x0028, 0x110C, 0x116E, 0x0029, 0x0000,
+    0x0007, 0x0028, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x0029,
+    0x0000, 0x0006, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x4E00, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x4E8C, 0x0029, 0x0000, 0x0003, 0x0028, 0x4E09, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x56DB, 0x0029, 0x0000, 0x0003, 0x0028, 0x4E94,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x516D, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x4E03, 0x0029, 0x0000, 0x0003, 0x0028, 0x516B, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x4E5D, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x5341, 0x0029, 0x0000, 0x0003, 0x0028, 0x6708, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x706B, 0x0029, 0x0000, 0x0003, 0x0028, 0x6C34,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x6728, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x91D1, 0x0029, 0x0000, 0x0003, 0x0028, 0x571F, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x65E5, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x682A, 0x0029, 0x0000, 0x0003, 0x0028, 0x6709, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x793E, 0x0029, 0x0000, 0x0003, 0x0028, 0x540D,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x7279, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x8CA1, 0x0029, 0x0000, 0x0003, 0x0028, 0x795D, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x52B4, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x4EE3, 0x0029, 0x0000, 0x0003, 0x0028, 0x547C, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x5B66, 0x0029, 0x0000, 0x0003, 0x0028, 0x76E3,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x4F01, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x8CC7, 0x0029, 0x0000, 0x0003, 0x0028, 0x5354, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x796D, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x4F11, 0x0029, 0x0000, 0x0003, 0x0028, 0x81EA, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x81F3, 0x0029, 0x0000, 0x0001, 0x554F, 0x0000,
+    0x0001, 0x5E7C, 0x0000, 0x0001, 0x6587, 0x0000, 0x0001, 0x7B8F,
+    0x0000, 0x0003, 0x0050, 0x0054, 0x0045, 0x0000, 0x0002, 0x0032,
+    0x0031, 0x0000, 0x0002, 0x0032, 0x0032, 0x0000, 0x0002, 0x0032,
+    0x0033, 0x0000, 0x0002, 0x0032, 0x0034, 0x0000, 0x0002, 0x0032,
+    0x0035, 0x0000, 0x0002, 0x0032, 0x0036, 0x0000, 0x0002, 0x0032,
+    0x0037, 0x0000, 0x0002, 0x0032, 0x0038, 0x0000, 0x0002, 0x0032,
+    0x0039, 0x0000, 0x0002, 0x0033, 0x0030, 0x0000, 0x0002, 0x0033,
+    0x0031, 0x0000, 0x0002, 0x0033, 0x0032, 0x0000, 0x0002, 0x0033,
+    0x0033, 0x0000, 0x0002, 0x0033, 0x0034, 0x0000, 0x0002, 0x0033,
+    0x0035, 0x0000, 0x0001, 0x1100, 0x0000, 0x0001, 0x1102, 0x0000,
+    0x0001, 0x1103, 0x0000, 0x0001, 0x1105, 0x0000, 0x0001, 0x1106,
+    0x0000, 0x0001, 0x1107, 0x0000, 0x0001, 0x1109, 0x0000, 0x0001,
+    0x110B, 0x0000, 0x0001, 0x110C, 0x0000, 0x0001, 0x110E, 0x0000,
+    0x0001, 0x110F, 0x0000, 0x0001, 0x1110, 0x0000, 0x0001, 0x1111,
+    0x0000, 0x0001, 0x1112, 0x0000, 0x0002, 0x1100, 0x1161, 0x0000,
+    0x0002, 0x1102, 0x1161, 0x0000, 0x0002, 0x1103, 0x1161, 0x0000,
+    0x0002, 0x1105, 0x1161, 0x0000, 0x0002, 0x1106, 0x1161, 0x0000,
+    0x0002, 0x1107, 0x1161, 0x0000, 0x0002, 0x1109, 0x1161, 0x0000,
+    0x0002, 0x110B, 0x1161, 0x0000, 0x0002, 0x110C, 0x1161, 0x0000,
+    0x0002, 0x110E, 0x1161, 0x0000, 0x0002, 0x110F, 0x1161, 0x0000,
+    0x0002, 0x1110, 0x1161, 0x0000, 0x0002, 0x1111, 0x1161, 0x0000,
+    0x0002, 0x1112, 0x1161, 0x0000, 0x0005, 0x110E, 0x1161, 0x11B7,
+    0x1100, 0x1169, 0x0000, 0x0004, 0x110C, 0x116E, 0x110B, 0x1174,
+    0x0000, 0x0002, 0x110B, 0x116E, 0x0000, 0x0001, 0x4E00, 0x0000,
+    0x0001, 0x4E8C, 0x0000, 0x0001, 0x4E09, 0x0000, 0x0001, 0x56DB,
+    0x0000, 0x0001, 0x4E94, 0x0000, 0x0001, 0x516D, 0x0000, 0x0001,
+    0x4E03, 0x0000, 0x0001, 0x516B, 0x0000, 0x0001, 0x4E5D, 0x0000,
+    0x0001, 0x5341, 0x0000, 0x0001, 0x6708, 0x0000, 0x0001, 0x706B,
+    0x0000, 0x0001, 0x6C34, 0x0000, 0x0001, 0x6728, 0x0000, 0x0001,
+    0x91D1, 0x0000, 0x0001, 0x571F, 0x0000, 0x0001, 0x65E5, 0x0000,
+    0x0001, 0x682A, 0x0000, 0x0001, 0x6709, 0x0000, 0x0001, 0x793E,
+    0x0000, 0x0001, 0x540D, 0x0000, 0x0001, 0x7279, 0x0000, 0x0001,
+    0x8CA1, 0x0000, 0x0001, 0x795D, 0x0000, 0x0001, 0x52B4, 0x0000,
+    0x0001, 0x79D8, 0x0000, 0x0001, 0x7537, 0x0000, 0x0001, 0x5973,
+    0x0000, 0x0001, 0x9069, 0x0000, 0x0001, 0x512A, 0x0000, 0x0001,
+    0x5370, 0x0000, 0x0001, 0x6CE8, 0x0000, 0x0001, 0x9805, 0x0000,
+    0x0001, 0x4F11, 0x0000, 0x0001, 0x5199, 0x0000, 0x0001, 0x6B63,
+    0x0000, 0x0001, 0x4E0A, 0x0000, 0x0001, 0x4E2D, 0x0000, 0x0001,
+    0x4E0B, 0x0000, 0x0001, 0x5DE6, 0x0000, 0x0001, 0x53F3, 0x0000,
+    0x0001, 0x533B, 0x0000, 0x0001, 0x5B97, 0x0000, 0x0001, 0x5B66,
+    0x0000, 0x0001, 0x76E3, 0x0000, 0x0001, 0x4F01, 0x0000, 0x0001,
+    0x8CC7, 0x0000, 0x0001, 0x5354, 0x0000, 0x0001, 0x591C, 0x0000,
+    0x0002, 0x0033, 0x0036, 0x0000, 0x0002, 0x0033, 0x0037, 0x0000,
+    0x0002, 0x0033, 0x0038, 0x0000, 0x0002, 0x0033, 0x0039, 0x0000,
+    0x0002, 0x0034, 0x0030, 0x0000, 0x0002, 0x0034, 0x0031, 0x0000,
+    0x0002, 0x0034, 0x0032, 0x0000, 0x0002, 0x0034, 0x0033, 0x0000,
+    0x0002, 0x0034, 0x0034, 0x0000, 0x0002, 0x0034, 0x0035, 0x0000,
+    0x0002, 0x0034, 0x0036, 0x0000, 0x0002, 0x0034, 0x0037, 0x0000,
+    0x0002, 0x0034, 0x0038, 0x0000, 0x0002, 0x0034, 0x0039, 0x0000,
+    0x0002, 0x0035, 0x0030, 0x0000, 0x0002, 0x0031, 0x6708, 0x0000,
+    0x0002, 0x0032, 0x6708, 0x0000, 0x0002, 0x0033, 0x6708, 0x0000,
+    0x0002, 0x0034, 0x6708, 0x0000, 0x0002, 0x0035, 0x6708, 0x0000,
+    0x0002, 0x0036, 0x6708, 0x0000, 0x0002, 0x0037, 0x6708, 0x0000,
+    0x0002, 0x0038, 0x6708, 0x0000, 0x0002, 0x0039, 0x6708, 0x0000,
+    0x0003, 0x0031, 0x0030, 0x6708, 0x0000, 0x0003, 0x0031, 0x0031,
+    0x6708, 0x0000, 0x0003, 0x0031, 0x0032, 0x6708, 0x0000, 0x0002,
+    0x0048, 0x0067, 0x0000, 0x0003, 0x0065, 0x0072, 0x0067, 0x0000,
+    0x0002, 0x0065, 0x0056, 0x0000, 0x0003, 0x004C, 0x0054, 0x0044,
+    0x0000, 0x0001, 0x30A2, 0x0000, 0x0001, 0x30A4, 0x0000, 0x0001,
+    0x30A6, 0x0000, 0x0001, 0x30A8, 0x0000, 0x0001, 0x30AA, 0x0000,
+    0x0001, 0x30AB, 0x0000, 0x0001, 0x30AD, 0x0000, 0x0001, 0x30AF,
+    0x0000, 0x0001, 0x30B1, 0x0000, 0x0001, 0x30B3, 0x0000, 0x0001,
+    0x30B5, 0x0000, 0x0001, 0x30B7, 0x0000, 0x0001, 0x30B9, 0x0000,
+    0x0001, 0x30BB, 0x0000, 0x0001, 0x30BD, 0x0000, 0x0001, 0x30BF,
+    0x0000, 0x0001, 0x30C1, 0x0000, 0x0001, 0x30C4, 0x0000, 0x0001,
+    0x30C6, 0x0000, 0x0001, 0x30C8, 0x0000, 0x0001, 0x30CA, 0x0000,
+    0x0001, 0x30CB, 0x0000, 0x0001, 0x30CC, 0x0000, 0x0001, 0x30CD,
+    0x0000, 0x0001, 0x30CE, 0x0000, 0x0001, 0x30CF, 0x0000, 0x0001,
+    0x30D2, 0x0000, 0x0001, 0x30D5, 0x0000, 0x0001, 0x30D8, 0x0000,
+    0x0001, 0x30DB, 0x0000, 0x0001, 0x30DE, 0x0000, 0x0001, 0x30DF,
+    0x0000, 0x0001, 0x30E0, 0x0000, 0x0001, 0x30E1, 0x0000, 0x0001,
+    0x30E2, 0x0000, 0x0001, 0x30E4, 0x0000, 0x0001, 0x30E6, 0x0000,
+    0x0001, 0x30E8, 0x0000, 0x0001, 0x30E9, 0x0000, 0x0001, 0x30EA,
+    0x0000, 0x0001, 0x30EB, 0x0000, 0x0001, 0x30EC, 0x0000, 0x0001,
+    0x30ED, 0x0000, 0x0001, 0x30EF, 0x0000, 0x0001, 0x30F0, 0x0000,
+    0x0001, 0x30F1, 0x0000, 0x0001, 0x30F2, 0x0000, 0x0002, 0x4EE4,
+    0x548C, 0x0000, 0x0005, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8,
+    0x0000, 0x0004, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x0000, 0x0005,
+    0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x0000, 0x0003, 0x30A2,
+    0x30FC, 0x30EB, 0x0000, 0x0005, 0x30A4, 0x30CB, 0x30F3, 0x30AF,
+    0x3099, 0x0000, 0x0003, 0x30A4, 0x30F3, 0x30C1, 0x0000, 0x0003,
+    0x30A6, 0x30A9, 0x30F3, 0x0000, 0x0006, 0x30A8, 0x30B9, 0x30AF,
+    0x30FC, 0x30C8, 0x3099, 0x0000, 0x0004, 0x30A8, 0x30FC, 0x30AB,
+    0x30FC, 0x0000, 0x0003, 0x30AA, 0x30F3, 0x30B9, 0x0000, 0x0003,
+    0x30AA, 0x30FC, 0x30E0, 0x0000, 0x0003, 0x30AB, 0x30A4, 0x30EA,
+    0x0000, 0x0004, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x0000, 0x0004,
+    0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x0000, 0x0004, 0x30AB, 0x3099,
+    0x30ED, 0x30F3, 0x0000, 0x0004, 0x30AB, 0x3099, 0x30F3, 0x30DE,
+    0x0000, 0x0004, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x0000, 0x0004,
+    0x30AD, 0x3099, 0x30CB, 0x30FC, 0x0000, 0x0004, 0x30AD, 0x30E5,
+    0x30EA, 0x30FC, 0x0000, 0x0006, 0x30AD, 0x3099, 0x30EB, 0x30BF,
+    0x3099, 0x30FC, 0x0000, 0x0002, 0x30AD, 0x30ED, 0x0000, 0x0006,
+    0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x0000, 0x0006,
+    0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x0000, 0x0005,
+    0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x0000, 0x0004, 0x30AF,
+    0x3099, 0x30E9, 0x30E0, 0x0000, 0x0006, 0x30AF, 0x3099, 0x30E9,
+    0x30E0, 0x30C8, 0x30F3, 0x0000, 0x0006, 0x30AF, 0x30EB, 0x30BB,
+    0x3099, 0x30A4, 0x30ED, 0x0000, 0x0004, 0x30AF, 0x30ED, 0x30FC,
+    0x30CD, 0x0000, 0x0003, 0x30B1, 0x30FC, 0x30B9, 0x0000, 0x0003,
+    0x30B3, 0x30EB, 0x30CA, 0x0000, 0x0004, 0x30B3, 0x30FC, 0x30DB,
+    0x309A, 0x0000, 0x0004, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x0000,
+    0x0005, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x0000, 0x0005,
+    0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x0000, 0x0003, 0x30BB,
+    0x30F3, 0x30C1, 0x0000, 0x0003, 0x30BB, 0x30F3, 0x30C8, 0x0000,
+    0x0004, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x0000, 0x0003, 0x30C6,
+    0x3099, 0x30B7, 0x0000, 0x0003, 0x30C8, 0x3099, 0x30EB, 0x0000,
+    0x0002, 0x30C8, 0x30F3, 0x0000, 0x0002, 0x30CA, 0x30CE, 0x0000,
+    0x0003, 0x30CE, 0x30C3, 0x30C8, 0x0000, 0x0003, 0x30CF, 0x30A4,
+    0x30C4, 0x0000, 0x0006, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3,
+    0x30C8, 0x0000, 0x0004, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x0000,
+    0x0005, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x0000, 0x0006,
+    0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x0000, 0x0004,
+    0x30D2, 0x309A, 0x30AF, 0x30EB, 0x0000, 0x0003, 0x30D2, 0x309A,
+    0x30B3, 0x0000, 0x0003, 0x30D2, 0x3099, 0x30EB, 0x0000, 0x0006,
+    0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x0000, 0x0004,
+    0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x0000, 0x0006, 0x30D5, 0x3099,
+    0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x0000, 0x0003, 0x30D5, 0x30E9,
+    0x30F3, 0x0000, 0x0005, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB,
+    0x0000, 0x0003, 0x30D8, 0x309A, 0x30BD, 0x0000, 0x0004, 0x30D8,
+    0x309A, 0x30CB, 0x30D2, 0x0000, 0x0003, 0x30D8, 0x30EB, 0x30C4,
+    0x0000, 0x0004, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x0000, 0x0005,
+    0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x0000, 0x0004, 0x30D8,
+    0x3099, 0x30FC, 0x30BF, 0x0000, 0x0005, 0x30DB, 0x309A, 0x30A4,
+    0x30F3, 0x30C8, 0x0000, 0x0004, 0x30DB, 0x3099, 0x30EB, 0x30C8,
+    0x0000, 0x0002, 0x30DB, 0x30F3, 0x0000, 0x0005, 0x30DB, 0x309A,
+    0x30F3, 0x30C8, 0x3099, 0x0000, 0x0003, 0x30DB, 0x30FC, 0x30EB,
+    0x0000, 0x0003, 0x30DB, 0x30FC, 0x30F3, 0x0000, 0x0004, 0x30DE,
+    0x30A4, 0x30AF, 0x30ED, 0x0000, 0x0003, 0x30DE, 0x30A4, 0x30EB,
+    0x0000, 0x0003, 0x30DE, 0x30C3, 0x30CF, 0x0000, 0x0003, 0x30DE,
+    0x30EB, 0x30AF, 0x0000, 0x0005, 0x30DE, 0x30F3, 0x30B7, 0x30E7,
+    0x30F3, 0x0000, 0x0004, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x0000,
+    0x0002, 0x30DF, 0x30EA, 0x0000, 0x0006, 0x30DF, 0x30EA, 0x30CF,
+    0x3099, 0x30FC, 0x30EB, 0x0000, 0x0003, 0x30E1, 0x30AB, 0x3099,
+    0x0000, 0x0005, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x0000,
+    0x0004, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x0000, 0x0004, 0x30E4,
+    0x30FC, 0x30C8, 0x3099, 0x0000, 0x0003, 0x30E4, 0x30FC, 0x30EB,
+    0x0000, 0x0003, 0x30E6, 0x30A2, 0x30F3, 0x0000, 0x0004, 0x30EA,
+    0x30C3, 0x30C8, 0x30EB, 0x0000, 0x0002, 0x30EA, 0x30E9, 0x0000,
+    0x0004, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x0000, 0x0005, 0x30EB,
+    0x30FC, 0x30D5, 0x3099, 0x30EB, 0x0000, 0x0002, 0x30EC, 0x30E0,
+    0x0000, 0x0006, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3,
+    0x0000, 0x0003, 0x30EF, 0x30C3, 0x30C8, 0x0000, 0x0002, 0x0030,
+    0x70B9, 0x0000, 0x0002, 0x0031, 0x70B9, 0x0000, 0x0002, 0x0032,
+    0x70B9, 0x0000, 0x0002, 0x0033, 0x70B9, 0x0000, 0x0002, 0x0034,
+    0x70B9, 0x0000, 0x0002, 0x0035, 0x70B9, 0x0000, 0x0002, 0x0036,
+    0x70B9, 0x0000, 0x0002, 0x0037, 0x70B9, 0x0000, 0x0002, 0x0038,
+    0x70B9, 0x0000, 0x0002, 0x0039, 0x70B9, 0x0000, 0x0003, 0x0031,
+    0x0030, 0x70B9, 0x0000, 0x0003, 0x0031, 0x0031, 0x70B9, 0x0000,
+    0x0003, 0x0031, 0x0032, 0x70B9, 0x0000, 0x0003, 0x0031, 0x0033,
+    0x70B9, 0x0000, 0x0003, 0x0031, 0x0034, 0x70B9, 0x0000, 0x0003,
+    0x0031, 0x0035, 0x70B9, 0x0000, 0x0003, 0x0031, 0x0036, 0x70B9,
+    0x0000, 0x0003, 0x0031, 0x0037, 0x70B9, 0x0000, 0x0003, 0x0031,
+    0x0038, 0x70B9, 0x0000, 0x0003, 0x0031, 0x0039, 0x70B9, 0x0000,
+    0x0003, 0x0032, 0x0030, 0x70B9, 0x0000, 0x0003, 0x0032, 0x0031,
+    0x70B9, 0x0000, 0x0003, 0x0032, 0x0032, 0x70B9, 0x0000, 0x0003,
+    0x0032, 0x0033, 0x70B9, 0x0000, 0x0003, 0x0032, 0x0034, 0x70B9,
+    0x0000, 0x0003, 0x0068, 0x0050, 0x0061, 0x0000, 0x0002, 0x0064,
+    0x0061, 0x0000, 0x0002, 0x0041, 0x0055, 0x0000, 0x0003, 0x0062,
+    0x0061, 0x0072, 0x0000, 0x0002, 0x006F, 0x0056, 0x0000, 0x0002,
+    0x0070, 0x0063, 0x0000, 0x0002, 0x0064, 0x006D, 0x0000, 0x0003,
+    0x0064, 0x006D, 0x0032, 0x0000, 0x0003, 0x0064, 0x006D, 0x0033,
+    0x0000, 0x0002, 0x0049, 0x0055, 0x0000, 0x0002, 0x5E73, 0x6210,
+    0x0000, 0x0002, 0x662D, 0x548C, 0x0000, 0x0002, 0x5927, 0x6B63,
+    0x0000, 0x0002, 0x660E, 0x6CBB, 0x0000, 0x0004, 0x682A, 0x5F0F,
+    0x4F1A, 0x793E, 0x0000, 0x0002, 0x0070, 0x0041, 0x0000, 0x0002,
+    0x006E, 0x0041, 0x0000, 0x0002, 0x03BC, 0x0041, 0x0000, 0x0002,
+    0x006D, 0x0041, 0x0000, 0x0002, 0x006B, 0x0041, 0x0000, 0x0002,
+    0x004B, 0x0042, 0x0000, 0x0002, 0x004D, 0x0042, 0x0000, 0x0002,
+    0x0047, 0x0042, 0x0000, 0x0003, 0x0063, 0x0061, 0x006C, 0x0000,
+    0x0004, 0x006B, 0x0063, 0x0061, 0x006C, 0x0000, 0x0002, 0x0070,
+    0x0046, 0x0000, 0x0002, 0x006E, 0x0046, 0x0000, 0x0002, 0x03BC,
+    0x0046, 0x0000, 0x0002, 0x03BC, 0x0067, 0x0000, 0x0002, 0x006D,
+    0x0067, 0x0000, 0x0002, 0x006B, 0x0067, 0x0000, 0x0002, 0x0048,
+    0x007A, 0x0000, 0x0003, 0x006B, 0x0048, 0x007A, 0x0000, 0x0003,
+    0x004D, 0x0048, 0x007A, 0x0000, 0x0003, 0x0047, 0x0048, 0x007A,
+    0x0000, 0x0003, 0x0054, 0x0048, 0x007A, 0x0000, 0x0002, 0x03BC,
+    0x006C, 0x0000, 0x0002, 0x006D, 0x006C, 0x0000, 0x0002, 0x0064,
+    0x006C, 0x0000, 0x0002, 0x006B, 0x006C, 0x0000, 0x0002, 0x0066,
+    0x006D, 0x0000, 0x0002, 0x006E, 0x006D, 0x0000, 0x0002, 0x03BC,
+    0x006D, 0x0000, 0x0002, 0x006D, 0x006D, 0x0000, 0x0002, 0x0063,
+    0x006D, 0x0000, 0x0002, 0x006B, 0x006D, 0x0000, 0x0003, 0x006D,
+    0x006D, 0x0032, 0x0000, 0x0003, 0x0063, 0x006D, 0x0032, 0x0000,
+    0x0002, 0x006D, 0x0032, 0x0000, 0x0003, 0x006B, 0x006D, 0x0032,
+    0x0000, 0x0003, 0x006D, 0x006D, 0x0033, 0x0000, 0x0003, 0x0063,
+    0x006D, 0x0033, 0x0000, 0x0002, 0x006D, 0x0033, 0x0000, 0x0003,
+    0x006B, 0x006D, 0x0033, 0x0000, 0x0003, 0x006D, 0x2215, 0x0073,
+    0x0000, 0x0004, 0x006D, 0x2215, 0x0073, 0x0032, 0x0000, 0x0002,
+    0x0050, 0x0061, 0x0000, 0x0003, 0x006B, 0x0050, 0x0061, 0x0000,
+    0x0003, 0x004D, 0x0050, 0x0061, 0x0000, 0x0003, 0x0047, 0x0050,
+    0x0061, 0x0000, 0x0003, 0x0072, 0x0061, 0x0064, 0x0000, 0x0005,
+    0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0000, 0x0006, 0x0072,
+    0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0000, 0x0002, 0x0070,
+    0x0073, 0x0000, 0x0002, 0x006E, 0x0073, 0x0000, 0x0002, 0x03BC,
+    0x0073, 0x0000, 0x0002, 0x006D, 0x0073, 0x0000, 0x0002, 0x0070,
+    0x0056, 0x0000, 0x0002, 0x006E, 0x0056, 0x0000, 0x0002, 0x03BC,
+    0x0056, 0x0000, 0x0002, 0x006D, 0x0056, 0x0000, 0x0002, 0x006B,
+    0x0056, 0x0000, 0x0002, 0x004D, 0x0056, 0x0000, 0x0002, 0x0070,
+    0x0057, 0x0000, 0x0002, 0x006E, 0x0057, 0x0000, 0x0002, 0x03BC,
+    0x0057, 0x0000, 0x0002, 0x006D, 0x0057, 0x0000, 0x0002, 0x006B,
+    0x0057, 0x0000, 0x0002, 0x004D, 0x0057, 0x0000, 0x0002, 0x006B,
+    0x03A9, 0x0000, 0x0002, 0x004D, 0x03A9, 0x0000, 0x0004, 0x0061,
+    0x002E, 0x006D, 0x002E, 0x0000, 0x0002, 0x0042, 0x0071, 0x0000,
+    0x0002, 0x0063, 0x0063, 0x0000, 0x0002, 0x0063, 0x0064, 0x0000,
+    0x0004, 0x0043, 0x2215, 0x006B, 0x0067, 0x0000, 0x0003, 0x0043,
+    0x006F, 0x002E, 0x0000, 0x0002, 0x0064, 0x0042, 0x0000, 0x0002,
+    0x0047, 0x0079, 0x0000, 0x0002, 0x0068, 0x0061, 0x0000, 0x0002,
+    0x0048, 0x0050, 0x0000, 0x0002, 0x0069, 0x006E, 0x0000, 0x0002,
+    0x004B, 0x004B, 0x0000, 0x0002, 0x004B, 0x004D, 0x0000, 0x0002,
+    0x006B, 0x0074, 0x0000, 0x0002, 0x006C, 0x006D, 0x0000, 0x0002,
+    0x006C, 0x006E, 0x0000, 0x0003, 0x006C, 0x006F, 0x0067, 0x0000,
+    0x0002, 0x006C, 0x0078, 0x0000, 0x0002, 0x006D, 0x0062, 0x0000,
+    0x0003, 0x006D, 0x0069, 0x006C, 0x0000, 0x0003, 0x006D, 0x006F,
+    0x006C, 0x0000, 0x0002, 0x0050, 0x0048, 0x0000, 0x0004, 0x0070,
+    0x002E, 0x006D, 0x002E, 0x0000, 0x0003, 0x0050, 0x0050, 0x004D,
+    0x0000, 0x0002, 0x0050, 0x0052, 0x0000, 0x0002, 0x0073, 0x0072,
+    0x0000, 0x0002, 0x0053, 0x0076, 0x0000, 0x0002, 0x0057, 0x0062,
+    0x0000, 0x0003, 0x0056, 0x2215, 0x006D, 0x0000, 0x0003, 0x0041,
+    0x2215, 0x006D, 0x0000, 0x0002, 0x0031, 0x65E5, 0x0000, 0x0002,
+    0x0032, 0x65E5, 0x0000, 0x0002, 0x0033, 0x65E5, 0x0000, 0x0002,
+    0x0034, 0x65E5, 0x0000, 0x0002, 0x0035, 0x65E5, 0x0000, 0x0002,
+    0x0036, 0x65E5, 0x0000, 0x0002, 0x0037, 0x65E5, 0x0000, 0x0002,
+    0x0038, 0x65E5, 0x0000, 0x0002, 0x0039, 0x65E5, 0x0000, 0x0003,
+    0x0031, 0x0030, 0x65E5, 0x0000, 0x0003, 0x0031, 0x0031, 0x65E5,
+    0x0000, 0x0003, 0x0031, 0x0032, 0x65E5, 0x0000, 0x0003, 0x0031,
+    0x0033, 0x65E5, 0x0000, 0x0003, 0x0031, 0x0034, 0x65E5, 0x0000,
+    0x0003, 0x0031, 0x0035, 0x65E5, 0x0000, 0x0003, 0x0031, 0x0036,
+    0x65E5, 0x0000, 0x0003, 0x0031, 0x0037, 0x65E5, 0x0000, 0x0003,
+    0x0031, 0x0038, 0x65E5, 0x0000, 0x0003, 0x0031, 0x0039, 0x65E5,
+    0x0000, 0x0003, 0x0032, 0x0030, 0x65E5, 0x0000, 0x0003, 0x0032,
+    0x0031, 0x65E5, 0x0000, 0x0003, 0x0032, 0x0032, 0x65E5, 0x0000,
+    0x0003, 0x0032, 0x0033, 0x65E5, 0x0000, 0x0003, 0x0032, 0x0034,
+    0x65E5, 0x0000, 0x0003, 0x0032, 0x0035, 0x65E5, 0x0000, 0x0003,
+    0x0032, 0x0036, 0x65E5, 0x0000, 0x0003, 0x0032, 0x0037, 0x65E5,
+    0x0000, 0x0003, 0x0032, 0x0038, 0x65E5, 0x0000, 0x0003, 0x0032,
+    0x0039, 0x65E5, 0x0000, 0x0003, 0x0033, 0x0030, 0x65E5, 0x0000,
+    0x0003, 0x0033, 0x0031, 0x65E5, 0x0000, 0x0003, 0x0067, 0x0061,
+    0x006C, 0x0000, 0x0001, 0x044A, 0x0000, 0x0001, 0x044C, 0x0000,
+    0x0001, 0xA76F, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001, 0x0046,
+    0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0126, 0x0000, 0x0001,
+    0x0153, 0x0000, 0x0001, 0xA727, 0x0000, 0x0001, 0xAB37, 0x0000,
+    0x0001, 0x026B, 0x0000, 0x0001, 0xAB52, 0x0000, 0x0001, 0x028D,
+    0x0001, 0x8C48, 0x0001, 0x66F4, 0x0001, 0x8ECA, 0x0001, 0x8CC8,
+    0x0001, 0x6ED1, 0x0001, 0x4E32, 0x0001, 0x53E5, 0x0001, 0x9F9C,
+    0x0001, 0x9F9C, 0x0001, 0x5951, 0x0001, 0x91D1, 0x0001, 0x5587,
+    0x0001, 0x5948, 0x0001, 0x61F6, 0x0001, 0x7669, 0x0001, 0x7F85,
+    0x0001, 0x863F, 0x0001, 0x87BA, 0x0001, 0x88F8, 0x0001, 0x908F,
+    0x0001, 0x6A02, 0x0001, 0x6D1B, 0x0001, 0x70D9, 0x0001, 0x73DE,
+    0x0001, 0x843D, 0x0001, 0x916A, 0x0001, 0x99F1, 0x0001, 0x4E82,
+    0x0001, 0x5375, 0x0001, 0x6B04, 0x0001, 0x721B, 0x0001, 0x862D,
+    0x0001, 0x9E1E, 0x0001, 0x5D50, 0x0001, 0x6FEB, 0x0001, 0x85CD,
+    0x0001, 0x8964, 0x0001, 0x62C9, 0x0001, 0x81D8, 0x0001, 0x881F,
+    0x0001, 0x5ECA, 0x0001, 0x6717, 0x0001, 0x6D6A, 0x0001, 0x72FC,
+    0x0001, 0x90CE, 0x0001, 0x4F86, 0x0001, 0x51B7, 0x0001, 0x52DE,
+    0x0001, 0x64C4, 0x0001, 0x6AD3, 0x0001, 0x7210, 0x0001, 0x76E7,
+    0x0001, 0x8001, 0x0001, 0x8606, 0x0001, 0x865C, 0x0001, 0x8DEF,
+    0x0001, 0x9732, 0x0001, 0x9B6F, 0x0001, 0x9DFA, 0x0001, 0x788C,
+    0x0001, 0x797F, 0x0001, 0x7DA0, 0x0001, 0x83C9, 0x0001, 0x9304,
+    0x0001, 0x9E7F, 0x0001, 0x8AD6, 0x0001, 0x58DF, 0x0001, 0x5F04,
+    0x0001, 0x7C60, 0x0001, 0x807E, 0x0001, 0x7262, 0x0001, 0x78CA,
+    0x0001, 0x8CC2, 0x0001, 0x96F7, 0x0001, 0x58D8, 0x0001, 0x5C62,
+    0x0001, 0x6A13, 0x0001, 0x6DDA, 0x0001, 0x6F0F, 0x0001, 0x7D2F,
+    0x0001, 0x7E37, 0x0001, 0x964B, 0x0001, 0x52D2, 0x0001, 0x808B,
+    0x0001, 0x51DC, 0x0001, 0x51CC, 0x0001, 0x7A1C, 0x0001, 0x7DBE,
+    0x0001, 0x83F1, 0x0001, 0x9675, 0x0001, 0x8B80, 0x0001, 0x62CF,
+    0x0001, 0x6A02, 0x0001, 0x8AFE, 0x0001, 0x4E39, 0x0001, 0x5BE7,
+    0x0001, 0x6012, 0x0001, 0x7387, 0x0001, 0x7570, 0x0001, 0x5317,
+    0x0001, 0x78FB, 0x0001, 0x4FBF, 0x0001, 0x5FA9, 0x0001, 0x4E0D,
+    0x0001, 0x6CCC, 0x0001, 0x6578, 0x0001, 0x7D22, 0x0001, 0x53C3,
+    0x0001, 0x585E, 0x0001, 0x7701, 0x0001, 0x8449, 0x0001, 0x8AAA,
+    0x0001, 0x6BBA, 0x0001, 0x8FB0, 0x0001, 0x6C88, 0x0001, 0x62FE,
+    0x0001, 0x82E5, 0x0001, 0x63A0, 0x0001, 0x7565, 0x0001, 0x4EAE,
+    0x0001, 0x5169, 0x0001, 0x51C9, 0x0001, 0x6881, 0x0001, 0x7CE7,
+    0x0001, 0x826F, 0x0001, 0x8AD2, 0x0001, 0x91CF, 0x0001, 0x52F5,
+    0x0001, 0x5442, 0x0001, 0x5973, 0x0001, 0x5EEC, 0x0001, 0x65C5,
+    0x0001, 0x6FFE, 0x0001, 0x792A, 0x0001, 0x95AD, 0x0001, 0x9A6A,
+    0x0001, 0x9E97, 0x0001, 0x9ECE, 0x0001, 0x529B, 0x0001, 0x66C6,
+    0x0001, 0x6B77, 0x0001, 0x8F62, 0x0001, 0x5E74, 0x0001, 0x6190,
+    0x0001, 0x6200, 0x0001, 0x649A, 0x0001, 0x6F23, 0x0001, 0x7149,
+    0x0001, 0x7489, 0x0001, 0x79CA, 0x0001, 0x7DF4, 0x0001, 0x806F,
+    0x0001, 0x8F26, 0x0001, 0x84EE, 0x0001, 0x9023, 0x0001, 0x934A,
+    0x0001, 0x5217, 0x0001, 0x52A3, 0x0001, 0x54BD, 0x0001, 0x70C8,
+    0x0001, 0x88C2, 0x0001, 0x8AAA, 0x0001, 0x5EC9, 0x0001, 0x5FF5,
+    0x0001, 0x637B, 0x0001, 0x6BAE, 0x0001, 0x7C3E, 0x0001, 0x7375,
+    0x0001, 0x4EE4, 0x0001, 0x56F9, 0x0001, 0x5BE7, 0x0001, 0x5DBA,
+    0x0001, 0x601C, 0x0001, 0x73B2, 0x0001, 0x7469, 0x0001, 0x7F9A,
+    0x0001, 0x8046, 0x0001, 0x9234, 0x0001, 0x96F6, 0x0001, 0x9748,
+    0x0001, 0x9818, 0x0001, 0x4F8B, 0x0001, 0x79AE, 0x0001, 0x91B4,
+    0x0001, 0x96B8, 0x0001, 0x60E1, 0x0001, 0x4E86, 0x0001, 0x50DA,
+    0x0001, 0x5BEE, 0x0001, 0x5C3F, 0x0001, 0x6599, 0x0001, 0x6A02,
+    0x0001, 0x71CE, 0x0001, 0x7642, 0x0001, 0x84FC, 0x0001, 0x907C,
+    0x0001, 0x9F8D, 0x0001, 0x6688, 0x0001, 0x962E, 0x0001, 0x5289,
+    0x0001, 0x677B, 0x0001, 0x67F3, 0x0001, 0x6D41, 0x0001, 0x6E9C,
+    0x0001, 0x7409, 0x0001, 0x7559, 0x0001, 0x786B, 0x0001, 0x7D10,
+    0x0001, 0x985E, 0x0001, 0x516D, 0x0001, 0x622E, 0x0001, 0x9678,
+    0x0001, 0x502B, 0x0001, 0x5D19, 0x0001, 0x6DEA, 0x0001, 0x8F2A,
+    0x0001, 0x5F8B, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001, 0x7387,
+    0x0001, 0x9686, 0x0001, 0x5229, 0x0001, 0x540F, 0x0001, 0x5C65,
+    0x0001, 0x6613, 0x0001, 0x674E, 0x0001, 0x68A8, 0x0001, 0x6CE5,
+    0x0001, 0x7406, 0x0001, 0x75E2, 0x0001, 0x7F79, 0x0001, 0x88CF,
+    0x0001, 0x88E1, 0x0001, 0x91CC, 0x0001, 0x96E2, 0x0001, 0x533F,
+    0x0001, 0x6EBA, 0x0001, 0x541D, 0x0001, 0x71D0, 0x0001, 0x7498,
+    0x0001, 0x85FA, 0x0001, 0x96A3, 0x0001, 0x9C57, 0x0001, 0x9E9F,
+    0x0001, 0x6797, 0x0001, 0x6DCB, 0x0001, 0x81E8, 0x0001, 0x7ACB,
+    0x0001, 0x7B20, 0x0001, 0x7C92, 0x0001, 0x72C0, 0x0001, 0x7099,
+    0x0001, 0x8B58, 0x0001, 0x4EC0, 0x0001, 0x8336, 0x0001, 0x523A,
+    0x0001, 0x5207, 0x0001, 0x5EA6, 0x0001, 0x62D3, 0x0001, 0x7CD6,
+    0x0001, 0x5B85, 0x0001, 0x6D1E, 0x0001, 0x66B4, 0x0001, 0x8F3B,
+    0x0001, 0x884C, 0x0001, 0x964D, 0x0001, 0x898B, 0x0001, 0x5ED3,
+    0x0001, 0x5140, 0x0001, 0x55C0, 0x0001, 0x585A, 0x0001, 0x6674,
+    0x0001, 0x51DE, 0x0001, 0x732A, 0x0001, 0x76CA, 0x0001, 0x793C,
+    0x0001, 0x795E, 0x0001, 0x7965, 0x0001, 0x798F, 0x0001, 0x9756,
+    0x0001, 0x7CBE, 0x0001, 0x7FBD, 0x0001, 0x8612, 0x0001, 0x8AF8,
+    0x0001, 0x9038, 0x0001, 0x90FD, 0x0001, 0x98EF, 0x0001, 0x98FC,
+    0x0001, 0x9928, 0x0001, 0x9DB4, 0x0001, 0x90DE, 0x0001, 0x96B7,
+    0x0001, 0x4FAE, 0x0001, 0x50E7, 0x0001, 0x514D, 0x0001, 0x52C9,
+    0x0001, 0x52E4, 0x0001, 0x5351, 0x0001, 0x559D, 0x0001, 0x5606,
+    0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58A8, 0x0001, 0x5C64,
+    0x0001, 0x5C6E, 0x0001, 0x6094, 0x0001, 0x6168, 0x0001, 0x618E,
+    0x0001, 0x61F2, 0x0001, 0x654F, 0x0001, 0x65E2, 0x0001, 0x6691,
+    0x0001, 0x6885, 0x0001, 0x6D77, 0x0001, 0x6E1A, 0x0001, 0x6F22,
+    0x0001, 0x716E, 0x0001, 0x722B, 0x0001, 0x7422, 0x0001, 0x7891,
+    0x0001, 0x793E, 0x0001, 0x7949, 0x0001, 0x7948, 0x0001, 0x7950,
+    0x0001, 0x7956, 0x0001, 0x795D, 0x0001, 0x798D, 0x0001, 0x798E,
+    0x0001, 0x7A40, 0x0001, 0x7A81, 0x0001, 0x7BC0, 0x0001, 0x7DF4,
+    0x0001, 0x7E09, 0x0001, 0x7E41, 0x0001, 0x7F72, 0x0001, 0x8005,
+    0x0001, 0x81ED, 0x0001, 0x8279, 0x0001, 0x8279, 0x0001, 0x8457,
+    0x0001, 0x8910, 0x0001, 0x8996, 0x0001, 0x8B01, 0x0001, 0x8B39,
+    0x0001, 0x8CD3, 0x0001, 0x8D08, 0x0001, 0x8FB6, 0x0001, 0x9038,
+    0x0001, 0x96E3, 0x0001, 0x97FF, 0x0001, 0x983B, 0x0001, 0x6075,
+    0x0001, 0x242EE, 0x0001, 0x8218, 0x0001, 0x4E26, 0x0001, 0x51B5,
+    0x0001, 0x5168, 0x0001, 0x4F80, 0x0001, 0x5145, 0x0001, 0x5180,
+    0x0001, 0x52C7, 0x0001, 0x52FA, 0x0001, 0x559D, 0x0001, 0x5555,
+    0x0001, 0x5599, 0x0001, 0x55E2, 0x0001, 0x585A, 0x0001, 0x58B3,
+    0x0001, 0x5944, 0x0001, 0x5954, 0x0001, 0x5A62, 0x0001, 0x5B28,
+    0x0001, 0x5ED2, 0x0001, 0x5ED9, 0x0001, 0x5F69, 0x0001, 0x5FAD,
+    0x0001, 0x60D8, 0x0001, 0x614E, 0x0001, 0x6108, 0x0001, 0x618E,
+    0x0001, 0x6160, 0x0001, 0x61F2, 0x0001, 0x6234, 0x0001, 0x63C4,
+    0x0001, 0x641C, 0x0001, 0x6452, 0x0001, 0x6556, 0x0001, 0x6674,
+    0x0001, 0x6717, 0x0001, 0x671B, 0x0001, 0x6756, 0x0001, 0x6B79,
+    0x0001, 0x6BBA, 0x0001, 0x6D41, 0x0001, 0x6EDB, 0x0001, 0x6ECB,
+    0x0001, 0x6F22, 0x0001, 0x701E, 0x0001, 0x716E, 0x0001, 0x77A7,
+    0x0001, 0x7235, 0x0001, 0x72AF, 0x0001, 0x732A, 0x0001, 0x7471,
+    0x0001, 0x7506, 0x0001, 0x753B, 0x0001, 0x761D, 0x0001, 0x761F,
+    0x0001, 0x76CA, 0x0001, 0x76DB, 0x0001, 0x76F4, 0x0001, 0x774A,
+    0x0001, 0x7740, 0x0001, 0x78CC, 0x0001, 0x7AB1, 0x0001, 0x7BC0,
+    0x0001, 0x7C7B, 0x0001, 0x7D5B, 0x0001, 0x7DF4, 0x0001, 0x7F3E,
+    0x0001, 0x8005, 0x0001, 0x8352, 0x0001, 0x83EF, 0x0001, 0x8779,
+    0x0001, 0x8941, 0x0001, 0x8986, 0x0001, 0x8996, 0x0001, 0x8ABF,
+    0x0001, 0x8AF8, 0x0001, 0x8ACB, 0x0001, 0x8B01, 0x0001, 0x8AFE,
+    0x0001, 0x8AED, 0x0001, 0x8B39, 0x0001, 0x8B8A, 0x0001, 0x8D08,
+    0x0001, 0x8F38, 0x0001, 0x9072, 0x0001, 0x9199, 0x0001, 0x9276,
+    0x0001, 0x967C, 0x0001, 0x96E3, 0x0001, 0x9756, 0x0001, 0x97DB,
+    0x0001, 0x97FF, 0x0001, 0x980B, 0x0001, 0x983B, 0x0001, 0x9B12,
+    0x0001, 0x9F9C, 0x0001, 0x2284A, 0x0001, 0x22844, 0x0001, 0x233D5,
+    0x0001, 0x3B9D, 0x0001, 0x4018, 0x0001, 0x4039, 0x0001, 0x25249,
+    0x0001, 0x25CD0, 0x0001, 0x27ED3, 0x0001, 0x9F43, 0x0001, 0x9F8E,
+    0x0000, 0x0002, 0x0066, 0x0066, 0x0000, 0x0002, 0x0066, 0x0069,
+    0x0000, 0x0002, 0x0066, 0x006C, 0x0000, 0x0003, 0x0066, 0x0066,
+    0x0069, 0x0000, 0x0003, 0x0066, 0x0066, 0x006C, 0x0000, 0x0002,
+    0x0073, 0x0074, 0x0000, 0x0002, 0x0073, 0x0074, 0x0000, 0x0002,
+    0x0574, 0x0576, 0x0000, 0x0002, 0x0574, 0x0565, 0x0000, 0x0002,
+    0x0574, 0x056B, 0x0000, 0x0002, 0x057E, 0x0576, 0x0000, 0x0002,
+    0x0574, 0x056D, 0x0002, 0x05D9, 0x05B4, 0x0002, 0x05F2, 0x05B7,
+    0x0000, 0x0001, 0x05E2, 0x0000, 0x0001, 0x05D0, 0x0000, 0x0001,
+    0x05D3, 0x0000, 0x0001, 0x05D4, 0x0000, 0x0001, 0x05DB, 0x0000,
+    0x0001, 0x05DC, 0x0000, 0x0001, 0x05DD, 0x0000, 0x0001, 0x05E8,
+    0x0000, 0x0001, 0x05EA, 0x0000, 0x0001, 0x002B, 0x0002, 0x05E9,
+    0x05C1, 0x0002, 0x05E9, 0x05C2, 0x0003, 0x05E9, 0x05BC, 0x05C1,
+    0x0003, 0x05E9, 0x05BC, 0x05C2, 0x0002, 0x05D0, 0x05B7, 0x0002,
+    0x05D0, 0x05B8, 0x0002, 0x05D0, 0x05BC, 0x0002, 0x05D1, 0x05BC,
+    0x0002, 0x05D2, 0x05BC, 0x0002, 0x05D3, 0x05BC, 0x0002, 0x05D4,
+    0x05BC, 0x0002, 0x05D5, 0x05BC, 0x0002, 0x05D6, 0x05BC, 0x0002,
+    0x05D8, 0x05BC, 0x0002, 0x05D9, 0x05BC, 0x0002, 0x05DA, 0x05BC,
+    0x0002, 0x05DB, 0x05BC, 0x0002, 0x05DC, 0x05BC, 0x0002, 0x05DE,
+    0x05BC, 0x0002, 0x05E0, 0x05BC, 0x0002, 0x05E1, 0x05BC, 0x0002,
+    0x05E3, 0x05BC, 0x0002, 0x05E4, 0x05BC, 0x0002, 0x05E6, 0x05BC,
+    0x0002, 0x05E7, 0x05BC, 0x0002, 0x05E8, 0x05BC, 0x0002, 0x05E9,
+    0x05BC, 0x0002, 0x05EA, 0x05BC, 0x0002, 0x05D5, 0x05B9, 0x0002,
+    0x05D1, 0x05BF, 0x0002, 0x05DB, 0x05BF, 0x0002, 0x05E4, 0x05BF,
+    0x0000, 0x0002, 0x05D0, 0x05DC, 0x0000, 0x0001, 0x0671, 0x0000,
+    0x0001, 0x0671, 0x0000, 0x0001, 0x067B, 0x0000, 0x0001, 0x067B,
+    0x0000, 0x0001, 0x067B, 0x0000, 0x0001, 0x067B, 0x0000, 0x0001,
+    0x067E, 0x0000, 0x0001, 0x067E, 0x0000, 0x0001, 0x067E, 0x0000,
+    0x0001, 0x067E, 0x0000, 0x0001, 0x0680, 0x0000, 0x0001, 0x0680,
+    0x0000, 0x0001, 0x0680, 0x0000, 0x0001, 0x0680, 0x0000, 0x0001,
+    0x067A, 0x0000, 0x0001, 0x067A, 0x0000, 0x0001, 0x067A, 0x0000,
+    0x0001, 0x067A, 0x0000, 0x0001, 0x067F, 0x0000, 0x0001, 0x067F,
+    0x0000, 0x0001, 0x067F, 0x0000, 0x0001, 0x067F, 0x0000, 0x0001,
+    0x0679, 0x0000, 0x0001, 0x0679, 0x0000, 0x0001, 0x0679, 0x0000,
+    0x0001, 0x0679, 0x0000, 0x0001, 0x06A4, 0x0000, 0x0001, 0x06A4,
+    0x0000, 0x0001, 0x06A4, 0x0000, 0x0001, 0x06A4, 0x0000, 0x0001,
+    0x06A6, 0x0000, 0x0001, 0x06A6, 0x0000, 0x0001, 0x06A6, 0x0000,
+    0x0001, 0x06A6, 0x0000, 0x0001, 0x0684, 0x0000, 0x0001, 0x0684,
+    0x0000, 0x0001, 0x0684, 0x0000, 0x0001, 0x0684, 0x0000, 0x0001,
+    0x0683, 0x0000, 0x0001, 0x0683, 0x0000, 0x0001, 0x0683, 0x0000,
+    0x0001, 0x0683, 0x0000, 0x0001, 0x0686, 0x0000, 0x0001, 0x0686,
+    0x0000, 0x0001, 0x0686, 0x0000, 0x0001, 0x0686, 0x0000, 0x0001,
+    0x0687, 0x0000, 0x0001, 0x0687, 0x0000, 0x0001, 0x0687, 0x0000,
+    0x0001, 0x0687, 0x0000, 0x0001, 0x068D, 0x0000, 0x0001, 0x068D,
+    0x0000, 0x0001, 0x068C, 0x0000, 0x0001, 0x068C, 0x0000, 0x0001,
+    0x068E, 0x0000, 0x0001, 0x068E, 0x0000, 0x0001, 0x0688, 0x0000,
+    0x0001, 0x0688, 0x0000, 0x0001, 0x0698, 0x0000, 0x0001, 0x0698,
+    0x0000, 0x0001, 0x0691, 0x0000, 0x0001, 0x0691, 0x0000, 0x0001,
+    0x06A9, 0x0000, 0x0001, 0x06A9, 0x0000, 0x0001, 0x06A9, 0x0000,
+    0x0001, 0x06A9, 0x0000, 0x0001, 0x06AF, 0x0000, 0x0001, 0x06AF,
+    0x0000, 0x0001, 0x06AF, 0x0000, 0x0001, 0x06AF, 0x0000, 0x0001,
+    0x06B3, 0x0000, 0x0001, 0x06B3, 0x0000, 0x0001, 0x06B3, 0x0000,
+    0x0001, 0x06B3, 0x0000, 0x0001, 0x06B1, 0x0000, 0x0001, 0x06B1,
+    0x0000, 0x0001, 0x06B1, 0x0000, 0x0001, 0x06B1, 0x0000, 0x0001,
+    0x06BA, 0x0000, 0x0001, 0x06BA, 0x0000, 0x0001, 0x06BB, 0x0000,
+    0x0001, 0x06BB, 0x0000, 0x0001, 0x06BB, 0x0000, 0x0001, 0x06BB,
+    0x0000, 0x0002, 0x06D5, 0x0654, 0x0000, 0x0002, 0x06D5, 0x0654,
+    0x0000, 0x0001, 0x06C1, 0x0000, 0x0001, 0x06C1, 0x0000, 0x0001,
+    0x06C1, 0x0000, 0x0001, 0x06C1, 0x0000, 0x0001, 0x06BE, 0x0000,
+    0x0001, 0x06BE, 0x0000, 0x0001, 0x06BE, 0x0000, 0x0001, 0x06BE,
+    0x0000, 0x0001, 0x06D2, 0x0000, 0x0001, 0x06D2, 0x0000, 0x0002,
+    0x06D2, 0x0654, 0x0000, 0x0002, 0x06D2, 0x0654, 0x0000, 0x0001,
+    0x06AD, 0x0000, 0x0001, 0x06AD, 0x0000, 0x0001, 0x06AD, 0x0000,
+    0x0001, 0x06AD, 0x0000, 0x0001, 0x06C7, 0x0000, 0x0001, 0x06C7,
+    0x0000, 0x0001, 0x06C6, 0x0000, 0x0001, 0x06C6, 0x0000, 0x0001,
+    0x06C8, 0x0000, 0x0001, 0x06C8, 0x0000, 0x0002, 0x06C7, 0x0674,
+    0x0000, 0x0001, 0x06CB, 0x0000, 0x0001, 0x06CB, 0x0000, 0x0001,
+    0x06C5, 0x0000, 0x0001, 0x06C5, 0x0000, 0x0001, 0x06C9, 0x0000,
+    0x0001, 0x06C9, 0x0000, 0x0001, 0x06D0, 0x0000, 0x0001, 0x06D0,
+    0x0000, 0x0001, 0x06D0, 0x0000, 0x0001, 0x06D0, 0x0000, 0x0001,
+    0x0649, 0x0000, 0x0001, 0x0649, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x0627, 0x0000, 0x0003, 0x064A, 0x0654, 0x0627, 0x0000, 0x0003,
+    0x064A, 0x0654, 0x06D5, 0x0000, 0x0003, 0x064A, 0x0654, 0x06D5,
+    0x0000, 0x0003, 0x064A, 0x0654, 0x0648, 0x0000, 0x0003, 0x064A,
+    0x0654, 0x0648, 0x0000, 0x0003, 0x064A, 0x0654, 0x06C7, 0x0000,
+    0x0003, 0x064A, 0x0654, 0x06C7, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x06C6, 0x0000, 0x0003, 0x064A, 0x0654, 0x06C6, 0x0000, 0x0003,
+    0x064A, 0x0654, 0x06C8, 0x0000, 0x0003, 0x064A, 0x0654, 0x06C8,
+    0x0000, 0x0003, 0x064A, 0x0654, 0x06D0, 0x0000, 0x0003, 0x064A,
+    0x0654, 0x06D0, 0x0000, 0x0003, 0x064A, 0x0654, 0x06D0, 0x0000,
+    0x0003, 0x064A, 0x0654, 0x0649, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x0649, 0x0000, 0x0003, 0x064A, 0x0654, 0x0649, 0x0000, 0x0001,
+    0x06CC, 0x0000, 0x0001, 0x06CC, 0x0000, 0x0001, 0x06CC, 0x0000,
+    0x0001, 0x06CC, 0x0000, 0x0003, 0x064A, 0x0654, 0x062C, 0x0000,
+    0x0003, 0x064A, 0x0654, 0x062D, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x0645, 0x0000, 0x0003, 0x064A, 0x0654, 0x0649, 0x0000, 0x0003,
+    0x064A, 0x0654, 0x064A, 0x0000, 0x0002, 0x0628, 0x062C, 0x0000,
+    0x0002, 0x0628, 0x062D, 0x0000, 0x0002, 0x0628, 0x062E, 0x0000,
+    0x0002, 0x0628, 0x0645, 0x0000, 0x0002, 0x0628, 0x0649, 0x0000,
+    0x0002, 0x0628, 0x064A, 0x0000, 0x0002, 0x062A, 0x062C, 0x0000,
+    0x0002, 0x062A, 0x062D, 0x0000, 0x0002, 0x062A, 0x062E, 0x0000,
+    0x0002, 0x062A, 0x0645, 0x0000, 0x0002, 0x062A, 0x0649, 0x0000,
+    0x0002, 0x062A, 0x064A, 0x0000, 0x0002, 0x062B, 0x062C, 0x0000,
+    0x0002, 0x062B, 0x0645, 0x0000, 0x0002, 0x062B, 0x0649, 0x0000,
+    0x0002, 0x062B, 0x064A, 0x0000, 0x0002, 0x062C, 0x062D, 0x0000,
+    0x0002, 0x062C, 0x0645, 0x0000, 0x0002, 0x062D, 0x062C, 0x0000,
+    0x0002, 0x062D, 0x0645, 0x0000, 0x0002, 0x062E, 0x062C, 0x0000,
+    0x0002, 0x062E, 0x062D, 0x0000, 0x0002, 0x062E, 0x0645, 0x0000,
+    0x0002, 0x0633, 0x062C, 0x0000, 0x0002, 0x0633, 0x062D, 0x0000,
+    0x0002, 0x0633, 0x062E, 0x0000, 0x0002, 0x0633, 0x0645, 0x0000,
+    0x0002, 0x0635, 0x062D, 0x0000, 0x0002, 0x0635, 0x0645, 0x0000,
+    0x0002, 0x0636, 0x062C, 0x0000, 0x0002, 0x0636, 0x062D, 0x0000,
+    0x0002, 0x0636, 0x062E, 0x0000, 0x0002, 0x0636, 0x0645, 0x0000,
+    0x0002, 0x0637, 0x062D, 0x0000, 0x0002, 0x0637, 0x0645, 0x0000,
+    0x0002, 0x0638, 0x0645, 0x0000, 0x0002, 0x0639, 0x062C, 0x0000,
+    0x0002, 0x0639, 0x0645, 0x0000, 0x0002, 0x063A, 0x062C, 0x0000,
+    0x0002, 0x063A, 0x0645, 0x0000, 0x0002, 0x0641, 0x062C, 0x0000,
+    0x0002, 0x0641, 0x062D, 0x0000, 0x0002, 0x0641, 0x062E, 0x0000,
+    0x0002, 0x0641, 0x0645, 0x0000, 0x0002, 0x0641, 0x0649, 0x0000,
+    0x0002, 0x0641, 0x064A, 0x0000, 0x0002, 0x0642, 0x062D, 0x0000,
+    0x0002, 0x0642, 0x0645, 0x0000, 0x0002, 0x0642, 0x0649, 0x0000,
+    0x0002, 0x0642, 0x064A, 0x0000, 0x0002, 0x0643, 0x0627, 0x0000,
+    0x0002, 0x0643, 0x062C, 0x0000, 0x0002, 0x0643, 0x062D, 0x0000,
+    0x0002, 0x0643, 0x062E, 0x0000, 0x0002, 0x0643, 0x0644, 0x0000,
+    0x0002, 0x0643, 0x0645, 0x0000, 0x0002, 0x0643, 0x0649, 0x0000,
+    0x0002, 0x0643, 0x064A, 0x0000, 0x0002, 0x0644, 0x062C, 0x0000,
+    0x0002, 0x0644, 0x062D, 0x0000, 0x0002, 0x0644, 0x062E, 0x0000,
+    0x0002, 0x0644, 0x0645, 0x0000, 0x0002, 0x0644, 0x0649, 0x0000,
+    0x0002, 0x0644, 0x064A, 0x0000, 0x0002, 0x0645, 0x062C, 0x0000,
+    0x0002, 0x0645, 0x062D, 0x0000, 0x0002, 0x0645, 0x062E, 0x0000,
+    0x0002, 0x0645, 0x0645, 0x0000, 0x0002, 0x0645, 0x0649, 0x0000,
+    0x0002, 0x0645, 0x064A, 0x0000, 0x0002, 0x0646, 0x062C, 0x0000,
+    0x0002, 0x0646, 0x062D, 0x0000, 0x0002, 0x0646, 0x062E, 0x0000,
+    0x0002, 0x0646, 0x0645, 0x0000, 0x0002, 0x0646, 0x0649, 0x0000,
+    0x0002, 0x0646, 0x064A, 0x0000, 0x0002, 0x0647, 0x062C, 0x0000,
+    0x0002, 0x0647, 0x0645, 0x0000, 0x0002, 0x0647, 0x0649, 0x0000,
+    0x0002, 0x0647, 0x064A, 0x0000, 0x0002, 0x064A, 0x062C, 0x0000,
+    0x0002, 0x064A, 0x062D, 0x0000, 0x0002, 0x064A, 0x062E, 0x0000,
+    0x0002, 0x064A, 0x0645, 0x0000, 0x0002, 0x064A, 0x0649, 0x0000,
+    0x0002, 0x064A, 0x064A, 0x0000, 0x0002, 0x0630, 0x0670, 0x0000,
+    0x0002, 0x0631, 0x0670, 0x0000, 0x0002, 0x0649, 0x0670, 0x0000,
+    0x0003, 0x0020, 0x064C, 0x0651, 0x0000, 0x0003, 0x0020, 0x064D,
+    0x0651, 0x0000, 0x0003, 0x0020, 0x064E, 0x0651, 0x0000, 0x0003,
+    0x0020, 0x064F, 0x0651, 0x0000, 0x0003, 0x0020, 0x0650, 0x0651,
+    0x0000, 0x0003, 0x0020, 0x0651, 0x0670, 0x0000, 0x0003, 0x064A,
+    0x0654, 0x0631, 0x0000, 0x0003, 0x064A, 0x0654, 0x0632, 0x0000,
+    0x0003, 0x064A, 0x0654, 0x0645, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x0646, 0x0000, 0x0003, 0x064A, 0x0654, 0x0649, 0x0000, 0x0003,
+    0x064A, 0x0654, 0x064A, 0x0000, 0x0002, 0x0628, 0x0631, 0x0000,
+    0x0002, 0x0628, 0x0632, 0x0000, 0x0002, 0x0628, 0x0645, 0x0000,
+    0x0002, 0x0628, 0x0646, 0x0000, 0x0002, 0x0628, 0x0649, 0x0000,
+    0x0002, 0x0628, 0x064A, 0x0000, 0x0002, 0x062A, 0x0631, 0x0000,
+    0x0002, 0x062A, 0x0632, 0x0000, 0x0002, 0x062A, 0x0645, 0x0000,
+    0x0002, 0x062A, 0x0646, 0x0000, 0x0002, 0x062A, 0x0649, 0x0000,
+    0x0002, 0x062A, 0x064A, 0x0000, 0x0002, 0x062B, 0x0631, 0x0000,
+    0x0002, 0x062B, 0x0632, 0x0000, 0x0002, 0x062B, 0x0645, 0x0000,
+    0x0002, 0x062B, 0x0646, 0x0000, 0x0002, 0x062B, 0x0649, 0x0000,
+    0x0002, 0x062B, 0x064A, 0x0000, 0x0002, 0x0641, 0x0649, 0x0000,
+    0x0002, 0x0641, 0x064A, 0x0000, 0x0002, 0x0642, 0x0649, 0x0000,
+    0x0002, 0x0642, 0x064A, 0x0000, 0x0002, 0x0643, 0x0627, 0x0000,
+    0x0002, 0x0643, 0x0644, 0x0000, 0x0002, 0x0643, 0x0645, 0x0000,
+    0x0002, 0x0643, 0x0649, 0x0000, 0x0002, 0x0643, 0x064A, 0x0000,
+    0x0002, 0x0644, 0x0645, 0x0000, 0x0002, 0x0644, 0x0649, 0x0000,
+    0x0002, 0x0644, 0x064A, 0x0000, 0x0002, 0x0645, 0x0627, 0x0000,
+    0x0002, 0x0645, 0x0645, 0x0000, 0x0002, 0x0646, 0x0631, 0x0000,
+    0x0002, 0x0646, 0x0632, 0x0000, 0x0002, 0x0646, 0x0645, 0x0000,
+    0x0002, 0x0646, 0x0646, 0x0000, 0x0002, 0x0646, 0x0649, 0x0000,
+    0x0002, 0x0646, 0x064A, 0x0000, 0x0002, 0x0649, 0x0670, 0x0000,
+    0x0002, 0x064A, 0x0631, 0x0000, 0x0002, 0x064A, 0x0632, 0x0000,
+    0x0002, 0x064A, 0x0645, 0x0000, 0x0002, 0x064A, 0x0646, 0x0000,
+    0x0002, 0x064A, 0x0649, 0x0000, 0x0002, 0x064A, 0x064A, 0x0000,
+    0x0003, 0x064A, 0x0654, 0x062C, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x062D, 0x0000, 0x0003, 0x064A, 0x0654, 0x062E, 0x0000, 0x0003,
+    0x064A, 0x0654, 0x0645, 0x0000, 0x0003, 0x064A, 0x0654, 0x0647,
+    0x0000, 0x0002, 0x0628, 0x062C, 0x0000, 0x0002, 0x0628, 0x062D,
+    0x0000, 0x0002, 0x0628, 0x062E, 0x0000, 0x0002, 0x0628, 0x0645,
+    0x0000, 0x0002, 0x0628, 0x0647, 0x0000, 0x0002, 0x062A, 0x062C,
+    0x0000, 0x0002, 0x062A, 0x062D, 0x0000, 0x0002, 0x062A, 0x062E,
+    0x0000, 0x0002, 0x062A, 0x0645, 0x0000, 0x0002, 0x062A, 0x0647,
+    0x0000, 0x0002, 0x062B, 0x0645, 0x0000, 0x0002, 0x062C, 0x062D,
+    0x0000, 0x0002, 0x062C, 0x0645, 0x0000, 0x0002, 0x062D, 0x062C,
+    0x0000, 0x0002, 0x062D, 0x0645, 0x0000, 0x0002, 0x062E, 0x062C,
+    0x0000, 0x0002, 0x062E, 0x0645, 0x0000, 0x0002, 0x0633, 0x062C,
+    0x0000, 0x0002, 0x0633, 0x062D, 0x0000, 0x0002, 0x0633, 0x062E,
+    0x0000, 0x0002, 0x0633, 0x0645, 0x0000, 0x0002, 0x0635, 0x062D,
+    0x0000, 0x0002, 0x0635, 0x062E, 0x0000, 0x0002, 0x0635, 0x0645,
+    0x0000, 0x0002, 0x0636, 0x062C, 0x0000, 0x0002, 0x0636, 0x062D,
+    0x0000, 0x0002, 0x0636, 0x062E, 0x0000, 0x0002, 0x0636, 0x0645,
+    0x0000, 0x0002, 0x0637, 0x062D, 0x0000, 0x0002, 0x0638, 0x0645,
+    0x0000, 0x0002, 0x0639, 0x062C, 0x0000, 0x0002, 0x0639, 0x0645,
+    0x0000, 0x0002, 0x063A, 0x062C, 0x0000, 0x0002, 0x063A, 0x0645,
+    0x0000, 0x0002, 0x0641, 0x062C, 0x0000, 0x0002, 0x0641, 0x062D,
+    0x0000, 0x0002, 0x0641, 0x062E, 0x0000, 0x0002, 0x0641, 0x0645,
+    0x0000, 0x0002, 0x0642, 0x062D, 0x0000, 0x0002, 0x0642, 0x0645,
+    0x0000, 0x0002, 0x0643, 0x062C, 0x0000, 0x0002, 0x0643, 0x062D,
+    0x0000, 0x0002, 0x0643, 0x062E, 0x0000, 0x0002, 0x0643, 0x0644,
+    0x0000, 0x0002, 0x0643, 0x0645, 0x0000, 0x0002, 0x0644, 0x062C,
+    0x0000, 0x0002, 0x0644, 0x062D, 0x0000, 0x0002, 0x0644, 0x062E,
+    0x0000, 0x0002, 0x0644, 0x0645, 0x0000, 0x0002, 0x0644, 0x0647,
+    0x0000, 0x0002, 0x0645, 0x062C, 0x0000, 0x0002, 0x0645, 0x062D,
+    0x0000, 0x0002, 0x0645, 0x062E, 0x0000, 0x0002, 0x0645, 0x0645,
+    0x0000, 0x0002, 0x0646, 0x062C, 0x0000, 0x0002, 0x0646, 0x062D,
+    0x0000, 0x0002, 0x0646, 0x062E, 0x0000, 0x0002, 0x0646, 0x0645,
+    0x0000, 0x0002, 0x0646, 0x0647, 0x0000, 0x0002, 0x0647, 0x062C,
+    0x0000, 0x0002, 0x0647, 0x0645, 0x0000, 0x0002, 0x0647, 0x0670,
+    0x0000, 0x0002, 0x064A, 0x062C, 0x0000, 0x0002, 0x064A, 0x062D,
+    0x0000, 0x0002, 0x064A, 0x062E, 0x0000, 0x0002, 0x064A, 0x0645,
+    0x0000, 0x0002, 0x064A, 0x0647, 0x0000, 0x0003, 0x064A, 0x0654,
+    0x0645, 0x0000, 0x0003, 0x064A, 0x0654, 0x0647, 0x0000, 0x0002,
+    0x0628, 0x0645, 0x0000, 0x0002, 0x0628, 0x0647, 0x0000, 0x0002,
+    0x062A, 0x0645, 0x0000, 0x0002, 0x062A, 0x0647, 0x0000, 0x0002,
+    0x062B, 0x0645, 0x0000, 0x0002, 0x062B, 0x0647, 0x0000, 0x0002,
+    0x0633, 0x0645, 0x0000, 0x0002, 0x0633, 0x0647, 0x0000, 0x0002,
+    0x0634, 0x0645, 0x0000, 0x0002, 0x0634, 0x0647, 0x0000, 0x0002,
+    0x0643, 0x0644, 0x0000, 0x0002, 0x0643, 0x0645, 0x0000, 0x0002,
+    0x0644, 0x0645, 0x0000, 0x0002, 0x0646, 0x0645, 0x0000, 0x0002,
+    0x0646, 0x0647, 0x0000, 0x0002, 0x064A, 0x0645, 0x0000, 0x0002,
+    0x064A, 0x0647, 0x0000, 0x0003, 0x0640, 0x064E, 0x0651, 0x0000,
+    0x0003, 0x0640, 0x064F, 0x0651, 0x0000, 0x0003, 0x0640, 0x0650,
+    0x0651, 0x0000, 0x0002, 0x0637, 0x0649, 0x0000, 0x0002, 0x0637,
+    0x064A, 0x0000, 0x0002, 0x0639, 0x0649, 0x0000, 0x0002, 0x0639,
+    0x064A, 0x0000, 0x0002, 0x063A, 0x0649, 0x0000, 0x0002, 0x063A,
+    0x064A, 0x0000, 0x0002, 0x0633, 0x0649, 0x0000, 0x0002, 0x0633,
+    0x064A, 0x0000, 0x0002, 0x0634, 0x0649, 0x0000, 0x0002, 0x0634,
+    0x064A, 0x0000, 0x0002, 0x062D, 0x0649, 0x0000, 0x0002, 0x062D,
+    0x064A, 0x0000, 0x0002, 0x062C, 0x0649, 0x0000, 0x0002, 0x062C,
+    0x064A, 0x0000, 0x0002, 0x062E, 0x0649, 0x0000, 0x0002, 0x062E,
+    0x064A, 0x0000, 0x0002, 0x0635, 0x0649, 0x0000, 0x0002, 0x0635,
+    0x064A, 0x0000, 0x0002, 0x0636, 0x0649, 0x0000, 0x0002, 0x0636,
+    0x064A, 0x0000, 0x0002, 0x0634, 0x062C, 0x0000, 0x0002, 0x0634,
+    0x062D, 0x0000, 0x0002, 0x0634, 0x062E, 0x0000, 0x0002, 0x0634,
+    0x0645, 0x0000, 0x0002, 0x0634, 0x0631, 0x0000, 0x0002, 0x0633,
+    0x0631, 0x0000, 0x0002, 0x0635, 0x0631, 0x0000, 0x0002, 0x0636,
+    0x0631, 0x0000, 0x0002, 0x0637, 0x0649, 0x0000, 0x0002, 0x0637,
+    0x064A, 0x0000, 0x0002, 0x0639, 0x0649, 0x0000, 0x0002, 0x0639,
+    0x064A, 0x0000, 0x0002, 0x063A, 0x0649, 0x0000, 0x0002, 0x063A,
+    0x064A, 0x0000, 0x0002, 0x0633, 0x0649, 0x0000, 0x0002, 0x0633,
+    0x064A, 0x0000, 0x0002, 0x0634, 0x0649, 0x0000, 0x0002, 0x0634,
+    0x064A, 0x0000, 0x0002, 0x062D, 0x0649, 0x0000, 0x0002, 0x062D,
+    0x064A, 0x0000, 0x0002, 0x062C, 0x0649, 0x0000, 0x0002, 0x062C,
+    0x064A, 0x0000, 0x0002, 0x062E, 0x0649, 0x0000, 0x0002, 0x062E,
+    0x064A, 0x0000, 0x0002, 0x0635, 0x0649, 0x0000, 0x0002, 0x0635,
+    0x064A, 0x0000, 0x0002, 0x0636, 0x0649, 0x0000, 0x0002, 0x0636,
+    0x064A, 0x0000, 0x0002, 0x0634, 0x062C, 0x0000, 0x0002, 0x0634,
+    0x062D, 0x0000, 0x0002, 0x0634, 0x062E, 0x0000, 0x0002, 0x0634,
+    0x0645, 0x0000, 0x0002, 0x0634, 0x0631, 0x0000, 0x0002, 0x0633,
+    0x0631, 0x0000, 0x0002, 0x0635, 0x0631, 0x0000, 0x0002, 0x0636,
+    0x0631, 0x0000, 0x0002, 0x0634, 0x062C, 0x0000, 0x0002, 0x0634,
+    0x062D, 0x0000, 0x0002, 0x0634, 0x062E, 0x0000, 0x0002, 0x0634,
+    0x0645, 0x0000, 0x0002, 0x0633, 0x0647, 0x0000, 0x0002, 0x0634,
+    0x0647, 0x0000, 0x0002, 0x0637, 0x0645, 0x0000, 0x0002, 0x0633,
+    0x062C, 0x0000, 0x0002, 0x0633, 0x062D, 0x0000, 0x0002, 0x0633,
+    0x062E, 0x0000, 0x0002, 0x0634, 0x062C, 0x0000, 0x0002, 0x0634,
+    0x062D, 0x0000, 0x0002, 0x0634, 0x062E, 0x0000, 0x0002, 0x0637,
+    0x0645, 0x0000, 0x0002, 0x0638, 0x0645, 0x0000, 0x0002, 0x0627,
+    0x064B, 0x0000, 0x0002, 0x0627, 0x064B, 0x0000, 0x0003, 0x062A,
+    0x062C, 0x0645, 0x0000, 0x0003, 0x062A, 0x062D, 0x062C, 0x0000,
+    0x0003, 0x062A, 0x062D, 0x062C, 0x0000, 0x0003, 0x062A, 0x062D,
+    0x0645, 0x0000, 0x0003, 0x062A, 0x062E, 0x0645, 0x0000, 0x0003,
+    0x062A, 0x0645, 0x062C, 0x0000, 0x0003, 0x062A, 0x0645, 0x062D,
+    0x0000, 0x0003, 0x062A, 0x0645, 0x062E, 0x0000, 0x0003, 0x062C,
+    0x0645, 0x062D, 0x0000, 0x0003, 0x062C, 0x0645, 0x062D, 0x0000,
+    0x0003, 0x062D, 0x0645, 0x064A, 0x0000, 0x0003, 0x062D, 0x0645,
+    0x0649, 0x0000, 0x0003, 0x0633, 0x062D, 0x062C, 0x0000, 0x0003,
+    0x0633, 0x062C, 0x062D, 0x0000, 0x0003, 0x0633, 0x062C, 0x0649,
+    0x0000, 0x0003, 0x0633, 0x0645, 0x062D, 0x0000, 0x0003, 0x0633,
+    0x0645, 0x062D, 0x0000, 0x0003, 0x0633, 0x0645, 0x062C, 0x0000,
+    0x0003, 0x0633, 0x0645, 0x0645, 0x0000, 0x0003, 0x0633, 0x0645,
+    0x0645, 0x0000, 0x0003, 0x0635, 0x062D, 0x062D, 0x0000, 0x0003,
+    0x0635, 0x062D, 0x062D, 0x0000, 0x0003, 0x0635, 0x0645, 0x0645,
+    0x0000, 0x0003, 0x0634, 0x062D, 0x0645, 0x0000, 0x0003, 0x0634,
+    0x062D, 0x0645, 0x0000, 0x0003, 0x0634, 0x062C, 0x064A, 0x0000,
+    0x0003, 0x0634, 0x0645, 0x062E, 0x0000, 0x0003, 0x0634, 0x0645,
+    0x062E, 0x0000, 0x0003, 0x0634, 0x0645, 0x0645, 0x0000, 0x0003,
+    0x0634, 0x0645, 0x0645, 0x0000, 0x0003, 0x0636, 0x062D, 0x0649,
+    0x0000, 0x0003, 0x0636, 0x062E, 0x0645, 0x0000, 0x0003, 0x0636,
+    0x062E, 0x0645, 0x0000, 0x0003, 0x0637, 0x0645, 0x062D, 0x0000,
+    0x0003, 0x0637, 0x0645, 0x062D, 0x0000, 0x0003, 0x0637, 0x0645,
+    0x0645, 0x0000, 0x0003, 0x0637, 0x0645, 0x064A, 0x0000, 0x0003,
+    0x0639, 0x062C, 0x0645, 0x0000, 0x0003, 0x0639, 0x0645, 0x0645,
+    0x0000, 0x0003, 0x0639, 0x0645, 0x0645, 0x0000, 0x0003, 0x0639,
+    0x0645, 0x0649, 0x0000, 0x0003, 0x063A, 0x0645, 0x0645, 0x0000,
+    0x0003, 0x063A, 0x0645, 0x064A, 0x0000, 0x0003, 0x063A, 0x0645,
+    0x0649, 0x0000, 0x0003, 0x0641, 0x062E, 0x0645, 0x0000, 0x0003,
+    0x0641, 0x062E, 0x0645, 0x0000, 0x0003, 0x0642, 0x0645, 0x062D,
+    0x0000, 0x0003, 0x0642, 0x0645, 0x0645, 0x0000, 0x0003, 0x0644,
+    0x062D, 0x0645, 0x0000, 0x0003, 0x0644, 0x062D, 0x064A, 0x0000,
+    0x0003, 0x0644, 0x062D, 0x0649, 0x0000, 0x0003, 0x0644, 0x062C,
+    0x062C, 0x0000, 0x0003, 0x0644, 0x062C, 0x062C, 0x0000, 0x0003,
+    0x0644, 0x062E, 0x0645, 0x0000, 0x0003, 0x0644, 0x062E, 0x0645,
+    0x0000, 0x0003, 0x0644, 0x0645, 0x062D, 0x0000, 0x0003, 0x0644,
+    0x0645, 0x062D, 0x0000, 0x0003, 0x0645, 0x062D, 0x062C, 0x0000,
+    0x0003, 0x0645, 0x062D, 0x0645, 0x0000, 0x0003, 0x0645, 0x062D,
+    0x064A, 0x0000, 0x0003, 0x0645, 0x062C, 0x062D, 0x0000, 0x0003,
+    0x0645, 0x062C, 0x0645, 0x0000, 0x0003, 0x0645, 0x062E, 0x062C,
+    0x0000, 0x0003, 0x0645, 0x062E, 0x0645, 0x0000, 0x0003, 0x0645,
+    0x062C, 0x062E, 0x0000, 0x0003, 0x0647, 0x0645, 0x062C, 0x0000,
+    0x0003, 0x0647, 0x0645, 0x0645, 0x0000, 0x0003, 0x0646, 0x062D,
+    0x0645, 0x0000, 0x0003, 0x0646, 0x062D, 0x0649, 0x0000, 0x0003,
+    0x0646, 0x062C, 0x0645, 0x0000, 0x0003, 0x0646, 0x062C, 0x0645,
+    0x0000, 0x0003, 0x0646, 0x062C, 0x0649, 0x0000, 0x0003, 0x0646,
+    0x0645, 0x064A, 0x0000, 0x0003, 0x0646, 0x0645, 0x0649, 0x0000,
+    0x0003, 0x064A, 0x0645, 0x0645, 0x0000, 0x0003, 0x064A, 0x0645,
+    0x0645, 0x0000, 0x0003, 0x0628, 0x062E, 0x064A, 0x0000, 0x0003,
+    0x062A, 0x062C, 0x064A, 0x0000, 0x0003, 0x062A, 0x062C, 0x0649,
+    0x0000, 0x0003, 0x062A, 0x062E, 0x064A, 0x0000, 0x0003, 0x062A,
+    0x062E, 0x0649, 0x0000, 0x0003, 0x062A, 0x0645, 0x064A, 0x0000,
+    0x0003, 0x062A, 0x0645, 0x0649, 0x0000, 0x0003, 0x062C, 0x0645,
+    0x064A, 0x0000, 0x0003, 0x062C, 0x062D, 0x0649, 0x0000, 0x0003,
+    0x062C, 0x0645, 0x0649, 0x0000, 0x0003, 0x0633, 0x062E, 0x0649,
+    0x0000, 0x0003, 0x0635, 0x062D, 0x064A, 0x0000, 0x0003, 0x0634,
+    0x062D, 0x064A, 0x0000, 0x0003, 0x0636, 0x062D, 0x064A, 0x0000,
+    0x0003, 0x0644, 0x062C, 0x064A, 0x0000, 0x0003, 0x0644, 0x0645,
+    0x064A, 0x0000, 0x0003, 0x064A, 0x062D, 0x064A, 0x0000, 0x0003,
+    0x064A, 0x062C, 0x064A, 0x0000, 0x0003, 0x064A, 0x0645, 0x064A,
+    0x0000, 0x0003, 0x0645, 0x0645, 0x064A, 0x0000, 0x0003, 0x0642,
+    0x0645, 0x064A, 0x0000, 0x0003, 0x0646, 0x062D, 0x064A, 0x0000,
+    0x0003, 0x0642, 0x0645, 0x062D, 0x0000, 0x0003, 0x0644, 0x062D,
+    0x0645, 0x0000, 0x0003, 0x0639, 0x0645, 0x064A, 0x0000, 0x0003,
+    0x0643, 0x0645, 0x064A, 0x0000, 0x0003, 0x0646, 0x062C, 0x062D,
+    0x0000, 0x0003, 0x0645, 0x062E, 0x064A, 0x0000, 0x0003, 0x0644,
+    0x062C, 0x0645, 0x0000, 0x0003, 0x0643, 0x0645, 0x0645, 0x0000,
+    0x0003, 0x0644, 0x062C, 0x0645, 0x0000, 0x0003, 0x0646, 0x062C,
+    0x062D, 0x0000, 0x0003, 0x062C, 0x062D, 0x064A, 0x0000, 0x0003,
+    0x062D, 0x062C, 0x064A, 0x0000, 0x0003, 0x0645, 0x062C, 0x064A,
+    0x0000, 0x0003, 0x0641, 0x0645, 0x064A, 0x0000, 0x0003, 0x0628,
+    0x062D, 0x064A, 0x0000, 0x0003, 0x0643, 0x0645, 0x0645, 0x0000,
+    0x0003, 0x0639, 0x062C, 0x0645, 0x0000, 0x0003, 0x0635, 0x0645,
+    0x0645, 0x0000, 0x0003, 0x0633, 0x062E, 0x064A, 0x0000, 0x0003,
+    0x0646, 0x062C, 0x064A, 0x0000, 0x0003, 0x0635, 0x0644, 0x06D2,
+    0x0000, 0x0003, 0x0642, 0x0644, 0x06D2, 0x0000, 0x0004, 0x0627,
+    0x0644, 0x0644, 0x0647, 0x0000, 0x0004, 0x0627, 0x0643, 0x0628,
+    0x0631, 0x0000, 0x0004, 0x0645, 0x062D, 0x0645, 0x062F, 0x0000,
+    0x0004, 0x0635, 0x0644, 0x0639, 0x0645, 0x0000, 0x0004, 0x0631,
+    0x0633, 0x0648, 0x0644, 0x0000, 0x0004, 0x0639, 0x0644, 0x064A,
+    0x0647, 0x0000, 0x0004, 0x0648, 0x0633, 0x0644, 0x0645, 0x0000,
+    0x0003, 0x0635, 0x0644, 0x0649, 0x0000, 0x0012, 0x0635, 0x0644,
+    0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639,
+    0x0644, 0x064A, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645,
+    0x0000, 0x0008, 0x062C, 0x0644, 0x0020, 0x062C, 0x0644, 0x0627,
+    0x0644, 0x0647, 0x0000, 0x0004, 0x0631, 0x06CC, 0x0627, 0x0644,
+    0x0000, 0x0001, 0x002C, 0x0000, 0x0001, 0x3001, 0x0000, 0x0001,
+    0x3002, 0x0000, 0x0001, 0x003A, 0x0000, 0x0001, 0x003B, 0x0000,
+    0x0001, 0x0021, 0x0000, 0x0001, 0x003F, 0x0000, 0x0001, 0x3016,
+    0x0000, 0x0001, 0x3017, 0x0000, 0x0003, 0x002E, 0x002E, 0x002E,
+    0x0000, 0x0002, 0x002E, 0x002E, 0x0000, 0x0001, 0x2014, 0x0000,
+    0x0001, 0x2013, 0x0000, 0x0001, 0x005F, 0x0000, 0x0001, 0x005F,
+    0x0000, 0x0001, 0x0028, 0x0000, 0x0001, 0x0029, 0x0000, 0x0001,
+    0x007B, 0x0000, 0x0001, 0x007D, 0x0000, 0x0001, 0x3014, 0x0000,
+    0x0001, 0x3015, 0x0000, 0x0001, 0x3010, 0x0000, 0x0001, 0x3011,
+    0x0000, 0x0001, 0x300A, 0x0000, 0x0001, 0x300B, 0x0000, 0x0001,
+    0x3008, 0x0000, 0x0001, 0x3009, 0x0000, 0x0001, 0x300C, 0x0000,
+    0x0001, 0x300D, 0x0000, 0x0001, 0x300E, 0x0000, 0x0001, 0x300F,
+    0x0000, 0x0001, 0x005B, 0x0000, 0x0001, 0x005D, 0x0000, 0x0002,
+    0x0020, 0x0305, 0x0000, 0x0002, 0x0020, 0x0305, 0x0000, 0x0002,
+    0x0020, 0x0305, 0x0000, 0x0002, 0x0020, 0x0305, 0x0000, 0x0001,
+    0x005F, 0x0000, 0x0001, 0x005F, 0x0000, 0x0001, 0x005F, 0x0000,
+    0x0001, 0x002C, 0x0000, 0x0001, 0x3001, 0x0000, 0x0001, 0x002E,
+    0x0000, 0x0001, 0x003B, 0x0000, 0x0001, 0x003A, 0x0000, 0x0001,
+    0x003F, 0x0000, 0x0001, 0x0021, 0x0000, 0x0001, 0x2014, 0x0000,
+    0x0001, 0x0028, 0x0000, 0x0001, 0x0029, 0x0000, 0x0001, 0x007B,
+    0x0000, 0x0001, 0x007D, 0x0000, 0x0001, 0x3014, 0x0000, 0x0001,
+    0x3015, 0x0000, 0x0001, 0x0023, 0x0000, 0x0001, 0x0026, 0x0000,
+    0x0001, 0x002A, 0x0000, 0x0001, 0x002B, 0x0000, 0x0001, 0x002D,
+    0x0000, 0x0001, 0x003C, 0x0000, 0x0001, 0x003E, 0x0000, 0x0001,
+    0x003D, 0x0000, 0x0001, 0x005C, 0x0000, 0x0001, 0x0024, 0x0000,
+    0x0001, 0x0025, 0x0000, 0x0001, 0x0040, 0x0000, 0x0002, 0x0020,
+    0x064B, 0x0000, 0x0002, 0x0640, 0x064B, 0x0000, 0x0002, 0x0020,
+    0x064C, 0x0000, 0x0002, 0x0020, 0x064D, 0x0000, 0x0002, 0x0020,
+    0x064E, 0x0000, 0x0002, 0x0640, 0x064E, 0x0000, 0x0002, 0x0020,
+    0x064F, 0x0000, 0x0002, 0x0640, 0x064F, 0x0000, 0x0002, 0x0020,
+    0x0650, 0x0000, 0x0002, 0x0640, 0x0650, 0x0000, 0x0002, 0x0020,
+    0x0651, 0x0000, 0x0002, 0x0640, 0x0651, 0x0000, 0x0002, 0x0020,
+    0x0652, 0x0000, 0x0002, 0x0640, 0x0652, 0x0000, 0x0001, 0x0621,
+    0x0000, 0x0002, 0x0627, 0x0653, 0x0000, 0x0002, 0x0627, 0x0653,
+    0x0000, 0x0002, 0x0627, 0x0654, 0x0000, 0x0002, 0x0627, 0x0654,
+    0x0000, 0x0002, 0x0648, 0x0654, 0x0000, 0x0002, 0x0648, 0x0654,
+    0x0000, 0x0002, 0x0627, 0x0655, 0x0000, 0x0002, 0x0627, 0x0655,
+    0x0000, 0x0002, 0x064A, 0x0654, 0x0000, 0x0002, 0x064A, 0x0654,
+    0x0000, 0x0002, 0x064A, 0x0654, 0x0000, 0x0002, 0x064A, 0x0654,
+    0x0000, 0x0001, 0x0627, 0x0000, 0x0001, 0x0627, 0x0000, 0x0001,
+    0x0628, 0x0000, 0x0001, 0x0628, 0x0000, 0x0001, 0x0628, 0x0000,
+    0x0001, 0x0628, 0x0000, 0x0001, 0x0629, 0x0000, 0x0001, 0x0629,
+    0x0000, 0x0001, 0x062A, 0x0000, 0x0001, 0x062A, 0x0000, 0x0001,
+    0x062A, 0x0000, 0x0001, 0x062A, 0x0000, 0x0001, 0x062B, 0x0000,
+    0x0001, 0x062B, 0x0000, 0x0001, 0x062B, 0x0000, 0x0001, 0x062B,
+    0x0000, 0x0001, 0x062C, 0x0000, 0x0001, 0x062C, 0x0000, 0x0001,
+    0x062C, 0x0000, 0x0001, 0x062C, 0x0000, 0x0001, 0x062D, 0x0000,
+    0x0001, 0x062D, 0x0000, 0x0001, 0x062D, 0x0000, 0x0001, 0x062D,
+    0x0000, 0x0001, 0x062E, 0x0000, 0x0001, 0x062E, 0x0000, 0x0001,
+    0x062E, 0x0000, 0x0001, 0x062E, 0x0000, 0x0001, 0x062F, 0x0000,
+    0x0001, 0x062F, 0x0000, 0x0001, 0x0630, 0x0000, 0x0001, 0x0630,
+    0x0000, 0x0001, 0x0631, 0x0000, 0x0001, 0x0631, 0x0000, 0x0001,
+    0x0632, 0x0000, 0x0001, 0x0632, 0x0000, 0x0001, 0x0633, 0x0000,
+    0x0001, 0x0633, 0x0000, 0x0001, 0x0633, 0x0000, 0x0001, 0x0633,
+    0x0000, 0x0001, 0x0634, 0x0000, 0x0001, 0x0634, 0x0000, 0x0001,
+    0x0634, 0x0000, 0x0001, 0x0634, 0x0000, 0x0001, 0x0635, 0x0000,
+    0x0001, 0x0635, 0x0000, 0x0001, 0x0635, 0x0000, 0x0001, 0x0635,
+    0x0000, 0x0001, 0x0636, 0x0000, 0x0001, 0x0636, 0x0000, 0x0001,
+    0x0636, 0x0000, 0x0001, 0x0636, 0x0000, 0x0001, 0x0637, 0x0000,
+    0x0001, 0x0637, 0x0000, 0x0001, 0x0637, 0x0000, 0x0001, 0x0637,
+    0x0000, 0x0001, 0x0638, 0x0000, 0x0001, 0x0638, 0x0000, 0x0001,
+    0x0638, 0x0000, 0x0001, 0x0638, 0x0000, 0x0001, 0x0639, 0x0000,
+    0x0001, 0x0639, 0x0000, 0x0001, 0x0639, 0x0000, 0x0001, 0x0639,
+    0x0000, 0x0001, 0x063A, 0x0000, 0x0001, 0x063A, 0x0000, 0x0001,
+    0x063A, 0x0000, 0x0001, 0x063A, 0x0000, 0x0001, 0x0641, 0x0000,
+    0x0001, 0x0641, 0x0000, 0x0001, 0x0641, 0x0000, 0x0001, 0x0641,
+    0x0000, 0x0001, 0x0642, 0x0000, 0x0001, 0x0642, 0x0000, 0x0001,
+    0x0642, 0x0000, 0x0001, 0x0642, 0x0000, 0x0001, 0x0643, 0x0000,
+    0x0001, 0x0643, 0x0000, 0x0001, 0x0643, 0x0000, 0x0001, 0x0643,
+    0x0000, 0x0001, 0x0644, 0x0000, 0x0001, 0x0644, 0x0000, 0x0001,
+    0x0644, 0x0000, 0x0001, 0x0644, 0x0000, 0x0001, 0x0645, 0x0000,
+    0x0001, 0x0645, 0x0000, 0x0001, 0x0645, 0x0000, 0x0001, 0x0645,
+    0x0000, 0x0001, 0x0646, 0x0000, 0x0001, 0x0646, 0x0000, 0x0001,
+    0x0646, 0x0000, 0x0001, 0x0646, 0x0000, 0x0001, 0x0647, 0x0000,
+    0x0001, 0x0647, 0x0000, 0x0001, 0x0647, 0x0000, 0x0001, 0x0647,
+    0x0000, 0x0001, 0x0648, 0x0000, 0x0001, 0x0648, 0x0000, 0x0001,
+    0x0649, 0x0000, 0x0001, 0x0649, 0x0000, 0x0001, 0x064A, 0x0000,
+    0x0001, 0x064A, 0x0000, 0x0001, 0x064A, 0x0000, 0x0001, 0x064A,
+    0x0000, 0x0003, 0x0644, 0x0627, 0x0653, 0x0000, 0x0003, 0x0644,
+    0x0627, 0x0653, 0x0000, 0x0003, 0x0644, 0x0627, 0x0654, 0x0000,
+    0x0003, 0x0644, 0x0627, 0x0654, 0x0000, 0x0003, 0x0644, 0x0627,
+    0x0655, 0x0000, 0x0003, 0x0644, 0x0627, 0x0655, 0x0000, 0x0002,
+    0x0644, 0x0627, 0x0000, 0x0002, 0x0644, 0x0627, 0x0000, 0x0001,
+    0x0021, 0x0000, 0x0001, 0x0022, 0x0000, 0x0001, 0x0023, 0x0000,
+    0x0001, 0x0024, 0x0000, 0x0001, 0x0025, 0x0000, 0x0001, 0x0026,
+    0x0000, 0x0001, 0x0027, 0x0000, 0x0001, 0x0028, 0x0000, 0x0001,
+    0x0029, 0x0000, 0x0001, 0x002A, 0x0000, 0x0001, 0x002B, 0x0000,
+    0x0001, 0x002C, 0x0000, 0x0001, 0x002D, 0x0000, 0x0001, 0x002E,
+    0x0000, 0x0001, 0x002F, 0x0000, 0x0001, 0x0030, 0x0000, 0x0001,
+    0x0031, 0x0000, 0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000,
+    0x0001, 0x0034, 0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036,
+    0x0000, 0x0001, 0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001,
+    0x0039, 0x0000, 0x0001, 0x003A, 0x0000, 0x0001, 0x003B, 0x0000,
+    0x0001, 0x003C, 0x0000, 0x0001, 0x003D, 0x0000, 0x0001, 0x003E,
+    0x0000, 0x0001, 0x003F, 0x0000, 0x0001, 0x0040, 0x0000, 0x0001,
+    0x0041, 0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043, 0x0000,
+    0x0001, 0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001, 0x0046,
+    0x0000, 0x0001, 0x0047, 0x0000, 0x0001, 0x0048, 0x0000, 0x0001,
+    0x0049, 0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000,
+    0x0001, 0x004C, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004E,
+    0x0000, 0x0001, 0x004F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001,
+    0x0051, 0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0053, 0x0000,
+    0x0001, 0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0056,
+    0x0000, 0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000, 0x0001,
+    0x0059, 0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x005B, 0x0000,
+    0x0001, 0x005C, 0x0000, 0x0001, 0x005D, 0x0000, 0x0001, 0x005E,
+    0x0000, 0x0001, 0x005F, 0x0000, 0x0001, 0x0060, 0x0000, 0x0001,
+    0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063, 0x0000,
+    0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x0066,
+    0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0068, 0x0000, 0x0001,
+    0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B, 0x0000,
+    0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001, 0x006E,
+    0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0070, 0x0000, 0x0001,
+    0x0071, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0073, 0x0000,
+    0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000, 0x0001, 0x0076,
+    0x0000, 0x0001, 0x0077, 0x0000, 0x0001, 0x0078, 0x0000, 0x0001,
+    0x0079, 0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x007B, 0x0000,
+    0x0001, 0x007C, 0x0000, 0x0001, 0x007D, 0x0000, 0x0001, 0x007E,
+    0x0000, 0x0001, 0x2985, 0x0000, 0x0001, 0x2986, 0x0000, 0x0001,
+    0x3002, 0x0000, 0x0001, 0x300C, 0x0000, 0x0001, 0x300D, 0x0000,
+    0x0001, 0x3001, 0x0000, 0x0001, 0x30FB, 0x0000, 0x0001, 0x30F2,
+    0x0000, 0x0001, 0x30A1, 0x0000, 0x0001, 0x30A3, 0x0000, 0x0001,
+    0x30A5, 0x0000, 0x0001, 0x30A7, 0x0000, 0x0001, 0x30A9, 0x0000,
+    0x0001, 0x30E3, 0x0000, 0x0001, 0x30E5, 0x0000, 0x0001, 0x30E7,
+    0x0000, 0x0001, 0x30C3, 0x0000, 0x0001, 0x30FC, 0x0000, 0x0001,
+    0x30A2, 0x0000, 0x0001, 0x30A4, 0x0000, 0x0001, 0x30A6, 0x0000,
+    0x0001, 0x30A8, 0x0000, 0x0001, 0x30AA, 0x0000, 0x0001, 0x30AB,
+    0x0000, 0x0001, 0x30AD, 0x0000, 0x0001, 0x30AF, 0x0000, 0x0001,
+    0x30B1, 0x0000, 0x0001, 0x30B3, 0x0000, 0x0001, 0x30B5, 0x0000,
+    0x0001, 0x30B7, 0x0000, 0x0001, 0x30B9, 0x0000, 0x0001, 0x30BB,
+    0x0000, 0x0001, 0x30BD, 0x0000, 0x0001, 0x30BF, 0x0000, 0x0001,
+    0x30C1, 0x0000, 0x0001, 0x30C4, 0x0000, 0x0001, 0x30C6, 0x0000,
+    0x0001, 0x30C8, 0x0000, 0x0001, 0x30CA, 0x0000, 0x0001, 0x30CB,
+    0x0000, 0x0001, 0x30CC, 0x0000, 0x0001, 0x30CD, 0x0000, 0x0001,
+    0x30CE, 0x0000, 0x0001, 0x30CF, 0x0000, 0x0001, 0x30D2, 0x0000,
+    0x0001, 0x30D5, 0x0000, 0x0001, 0x30D8, 0x0000, 0x0001, 0x30DB,
+    0x0000, 0x0001, 0x30DE, 0x0000, 0x0001, 0x30DF, 0x0000, 0x0001,
+    0x30E0, 0x0000, 0x0001, 0x30E1, 0x0000, 0x0001, 0x30E2, 0x0000,
+    0x0001, 0x30E4, 0x0000, 0x0001, 0x30E6, 0x0000, 0x0001, 0x30E8,
+    0x0000, 0x0001, 0x30E9, 0x0000, 0x0001, 0x30EA, 0x0000, 0x0001,
+    0x30EB, 0x0000, 0x0001, 0x30EC, 0x0000, 0x0001, 0x30ED, 0x0000,
+    0x0001, 0x30EF, 0x0000, 0x0001, 0x30F3, 0x0000, 0x0001, 0x3099,
+    0x0000, 0x0001, 0x309A, 0x0000, 0x0001, 0x1160, 0x0000, 0x0001,
+    0x1100, 0x0000, 0x0001, 0x1101, 0x0000, 0x0001, 0x11AA, 0x0000,
+    0x0001, 0x1102, 0x0000, 0x0001, 0x11AC, 0x0000, 0x0001, 0x11AD,
+    0x0000, 0x0001, 0x1103, 0x0000, 0x0001, 0x1104, 0x0000, 0x0001,
+    0x1105, 0x0000, 0x0001, 0x11B0, 0x0000, 0x0001, 0x11B1, 0x0000,
+    0x0001, 0x11B2, 0x0000, 0x0001, 0x11B3, 0x0000, 0x0001, 0x11B4,
+    0x0000, 0x0001, 0x11B5, 0x0000, 0x0001, 0x111A, 0x0000, 0x0001,
+    0x1106, 0x0000, 0x0001, 0x1107, 0x0000, 0x0001, 0x1108, 0x0000,
+    0x0001, 0x1121, 0x0000, 0x0001, 0x1109, 0x0000, 0x0001, 0x110A,
+    0x0000, 0x0001, 0x110B, 0x0000, 0x0001, 0x110C, 0x0000, 0x0001,
+    0x110D, 0x0000, 0x0001, 0x110E, 0x0000, 0x0001, 0x110F, 0x0000,
+    0x0001, 0x1110, 0x0000, 0x0001, 0x1111, 0x0000, 0x0001, 0x1112,
+    0x0000, 0x0001, 0x1161, 0x0000, 0x0001, 0x1162, 0x0000, 0x0001,
+    0x1163, 0x0000, 0x0001, 0x1164, 0x0000, 0x0001, 0x1165, 0x0000,
+    0x0001, 0x1166, 0x0000, 0x0001, 0x1167, 0x0000, 0x0001, 0x1168,
+    0x0000, 0x0001, 0x1169, 0x0000, 0x0001, 0x116A, 0x0000, 0x0001,
+    0x116B, 0x0000, 0x0001, 0x116C, 0x0000, 0x0001, 0x116D, 0x0000,
+    0x0001, 0x116E, 0x0000, 0x0001, 0x116F, 0x0000, 0x0001, 0x1170,
+    0x0000, 0x0001, 0x1171, 0x0000, 0x0001, 0x1172, 0x0000, 0x0001,
+    0x1173, 0x0000, 0x0001, 0x1174, 0x0000, 0x0001, 0x1175, 0x0000,
+    0x0001, 0x00A2, 0x0000, 0x0001, 0x00A3, 0x0000, 0x0001, 0x00AC,
+    0x0000, 0x0002, 0x0020, 0x0304, 0x0000, 0x0001, 0x00A6, 0x0000,
+    0x0001, 0x00A5, 0x0000, 0x0001, 0x20A9, 0x0000, 0x0001, 0x2502,
+    0x0000, 0x0001, 0x2190, 0x0000, 0x0001, 0x2191, 0x0000, 0x0001,
+    0x2192, 0x0000, 0x0001, 0x2193, 0x0000, 0x0001, 0x25A0, 0x0000,
+    0x0001, 0x25CB, 0x0002, 0x105D2, 0x0307, 0x0002, 0x105DA, 0x0307,
+    0x0000, 0x0001, 0x02D0, 0x0000, 0x0001, 0x02D1, 0x0000, 0x0001,
+    0x00E6, 0x0000, 0x0001, 0x0299, 0x0000, 0x0001, 0x0253, 0x0000,
+    0x0001, 0x02A3, 0x0000, 0x0001, 0xAB66, 0x0000, 0x0001, 0x02A5,
+    0x0000, 0x0001, 0x02A4, 0x0000, 0x0001, 0x0256, 0x0000, 0x0001,
+    0x0257, 0x0000, 0x0001, 0x1D91, 0x0000, 0x0001, 0x0258, 0x0000,
+    0x0001, 0x025E, 0x0000, 0x0001, 0x02A9, 0x0000, 0x0001, 0x0264,
+    0x0000, 0x0001, 0x0262, 0x0000, 0x0001, 0x0260, 0x0000, 0x0001,
+    0x029B, 0x0000, 0x0001, 0x0127, 0x0000, 0x0001, 0x029C, 0x0000,
+    0x0001, 0x0267, 0x0000, 0x0001, 0x0284, 0x0000, 0x0001, 0x02AA,
+    0x0000, 0x0001, 0x02AB, 0x0000, 0x0001, 0x026C, 0x0000, 0x0001,
+    0x1DF04, 0x0000, 0x0001, 0xA78E, 0x0000, 0x0001, 0x026E, 0x0000,
+    0x0001, 0x1DF05, 0x0000, 0x0001, 0x028E, 0x0000, 0x0001, 0x1DF06,
+    0x0000, 0x0001, 0x00F8, 0x0000, 0x0001, 0x0276, 0x0000, 0x0001,
+    0x0277, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001, 0x027A, 0x0000,
+    0x0001, 0x1DF08, 0x0000, 0x0001, 0x027D, 0x0000, 0x0001, 0x027E,
+    0x0000, 0x0001, 0x0280, 0x0000, 0x0001, 0x02A8, 0x0000, 0x0001,
+    0x02A6, 0x0000, 0x0001, 0xAB67, 0x0000, 0x0001, 0x02A7, 0x0000,
+    0x0001, 0x0288, 0x0000, 0x0001, 0x2C71, 0x0000, 0x0001, 0x028F,
+    0x0000, 0x0001, 0x02A1, 0x0000, 0x0001, 0x02A2, 0x0000, 0x0001,
+    0x0298, 0x0000, 0x0001, 0x01C0, 0x0000, 0x0001, 0x01C1, 0x0000,
+    0x0001, 0x01C2, 0x0000, 0x0001, 0x1DF0A, 0x0000, 0x0001, 0x1DF1E,
+    0x0002, 0x11099, 0x110BA, 0x0002, 0x1109B, 0x110BA, 0x0002, 0x110A5,
+    0x110BA, 0x0002, 0x11131, 0x11127, 0x0002, 0x11132, 0x11127, 0x0002,
+    0x11347, 0x1133E, 0x0002, 0x11347, 0x11357, 0x0002, 0x11382, 0x113C9,
+    0x0002, 0x11384, 0x113BB, 0x0002, 0x1138B, 0x113C2, 0x0002, 0x11390,
+    0x113C9, 0x0002, 0x113C2, 0x113C2, 0x0002, 0x113C2, 0x113B8, 0x0002,
+    0x113C2, 0x113C9, 0x0002, 0x114B9, 0x114BA, 0x0002, 0x114B9, 0x114B0,
+    0x0002, 0x114B9, 0x114BD, 0x0002, 0x115B8, 0x115AF, 0x0002, 0x115B9,
+    0x115AF, 0x0002, 0x11935, 0x11930, 0x0002, 0x1611E, 0x1611E, 0x0002,
+    0x1611E, 0x16129, 0x0002, 0x1611E, 0x1611F, 0x0002, 0x16129, 0x1611F,
+    0x0002, 0x1611E, 0x16120, 0x0003, 0x1611E, 0x1611E, 0x1611F, 0x0003,
+    0x1611E, 0x16129, 0x1611F, 0x0003, 0x1611E, 0x1611E, 0x16120, 0x0002,
+    0x16D67, 0x16D67, 0x0002, 0x16D63, 0x16D67, 0x0003, 0x16D63, 0x16D67,
+    0x16D67, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000,
+    0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000,
+    0x0001, 0x0030, 0x0000, 0x0001, 0x0031, 0x0000, 0x0001, 0x0032,
+    0x0000, 0x0001, 0x0033, 0x0000, 0x0001, 0x0034, 0x0000, 0x0001,
+    0x0035, 0x0000, 0x0001, 0x0036, 0x0000, 0x0001, 0x0037, 0x0000,
+    0x0001, 0x0038, 0x0000, 0x0001, 0x0039, 0x0002, 0x1D157, 0x1D165,
+    0x0002, 0x1D158, 0x1D165, 0x0003, 0x1D158, 0x1D165, 0x1D16E, 0x0003,
+    0x1D158, 0x1D165, 0x1D16F, 0x0003, 0x1D158, 0x1D165, 0x1D170, 0x0003,
+    0x1D158, 0x1D165, 0x1D171, 0x0003, 0x1D158, 0x1D165, 0x1D172, 0x0002,
+    0x1D1B9, 0x1D165, 0x0002, 0x1D1BA, 0x1D165, 0x0003, 0x1D1B9, 0x1D165,
+    0x1D16E, 0x0003, 0x1D1BA, 0x1D165, 0x1D16E, 0x0003, 0x1D1B9, 0x1D165,
+    0x1D16F, 0x0003, 0x1D1BA, 0x1D165, 0x1D16F, 0x0000, 0x0001, 0x0041,
+    0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001,
+    0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001, 0x0046, 0x0000,
+    0x0001, 0x0047, 0x0000, 0x0001, 0x0048, 0x0000, 0x0001, 0x0049,
+    0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001,
+    0x004C, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004E, 0x0000,
+    0x0001, 0x004F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051,
+    0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0053, 0x0000, 0x0001,
+    0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0056, 0x0000,
+    0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000, 0x0001, 0x0059,
+    0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x0061, 0x0000, 0x0001,
+    0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064, 0x0000,
+    0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000, 0x0001, 0x0067,
+    0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C, 0x0000,
+    0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001, 0x006F,
+    0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001,
+    0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000,
+    0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001, 0x0077,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000, 0x0001,
+    0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000,
+    0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000,
+    0x0001, 0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063,
+    0x0000, 0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001,
+    0x0066, 0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0069, 0x0000,
+    0x0001, 0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C,
+    0x0000, 0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001,
+    0x006F, 0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000,
+    0x0001, 0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074,
+    0x0000, 0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001,
+    0x0077, 0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000,
+    0x0001, 0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042,
+    0x0000, 0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001,
+    0x0045, 0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000,
+    0x0001, 0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A,
+    0x0000, 0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001,
+    0x004D, 0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000,
+    0x0001, 0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052,
+    0x0000, 0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001,
+    0x0055, 0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000,
+    0x0001, 0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A,
+    0x0000, 0x0001, 0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001,
+    0x0063, 0x0000, 0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000,
+    0x0001, 0x0066, 0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0068,
+    0x0000, 0x0001, 0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001,
+    0x006B, 0x0000, 0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000,
+    0x0001, 0x006E, 0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0070,
+    0x0000, 0x0001, 0x0071, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001,
+    0x0073, 0x0000, 0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000,
+    0x0001, 0x0076, 0x0000, 0x0001, 0x0077, 0x0000, 0x0001, 0x0078,
+    0x0000, 0x0001, 0x0079, 0x0000, 0x0001, 0x007A, 0x0000, 0x0001,
+    0x0041, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000,
+    0x0001, 0x0047, 0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0053, 0x0000,
+    0x0001, 0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0056,
+    0x0000, 0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000, 0x0001,
+    0x0059, 0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x0061, 0x0000,
+    0x0001, 0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064,
+    0x0000, 0x0001, 0x0066, 0x0000, 0x0001, 0x0068, 0x0000, 0x0001,
+    0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B, 0x0000,
+    0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001, 0x006E,
+    0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001,
+    0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000,
+    0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001, 0x0077,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000, 0x0001,
+    0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000,
+    0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000,
+    0x0001, 0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063,
+    0x0000, 0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001,
+    0x0066, 0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0068, 0x0000,
+    0x0001, 0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B,
+    0x0000, 0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001,
+    0x006E, 0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0070, 0x0000,
+    0x0001, 0x0071, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0073,
+    0x0000, 0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000, 0x0001,
+    0x0076, 0x0000, 0x0001, 0x0077, 0x0000, 0x0001, 0x0078, 0x0000,
+    0x0001, 0x0079, 0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x0041,
+    0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001,
+    0x0045, 0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000,
+    0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001, 0x004C,
+    0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004E, 0x0000, 0x0001,
+    0x004F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x0061, 0x0000,
+    0x0001, 0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064,
+    0x0000, 0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000, 0x0001,
+    0x0067, 0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069, 0x0000,
+    0x0001, 0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C,
+    0x0000, 0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001,
+    0x006F, 0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000,
+    0x0001, 0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074,
+    0x0000, 0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001,
+    0x0077, 0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000,
+    0x0001, 0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042,
+    0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001,
+    0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001, 0x0049, 0x0000,
+    0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001, 0x004C,
+    0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055, 0x0000,
+    0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001, 0x0058,
+    0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x0061, 0x0000, 0x0001,
+    0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064, 0x0000,
+    0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000, 0x0001, 0x0067,
+    0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C, 0x0000,
+    0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001, 0x006F,
+    0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001,
+    0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000,
+    0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001, 0x0077,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000, 0x0001,
+    0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000,
+    0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000,
+    0x0001, 0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063,
+    0x0000, 0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001,
+    0x0066, 0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0068, 0x0000,
+    0x0001, 0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B,
+    0x0000, 0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001,
+    0x006E, 0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0070, 0x0000,
+    0x0001, 0x0071, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0073,
+    0x0000, 0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000, 0x0001,
+    0x0076, 0x0000, 0x0001, 0x0077, 0x0000, 0x0001, 0x0078, 0x0000,
+    0x0001, 0x0079, 0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x0041,
+    0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001,
+    0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001, 0x0046, 0x0000,
+    0x0001, 0x0047, 0x0000, 0x0001, 0x0048, 0x0000, 0x0001, 0x0049,
+    0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001,
+    0x004C, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004E, 0x0000,
+    0x0001, 0x004F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051,
+    0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0053, 0x0000, 0x0001,
+    0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0056, 0x0000,
+    0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000, 0x0001, 0x0059,
+    0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x0061, 0x0000, 0x0001,
+    0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064, 0x0000,
+    0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000, 0x0001, 0x0067,
+    0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C, 0x0000,
+    0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001, 0x006F,
+    0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001,
+    0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000,
+    0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001, 0x0077,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000, 0x0001,
+    0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000,
+    0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000,
+    0x0001, 0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063,
+    0x0000, 0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001,
+    0x0066, 0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0068, 0x0000,
+    0x0001, 0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B,
+    0x0000, 0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001,
+    0x006E, 0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0070, 0x0000,
+    0x0001, 0x0071, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0073,
+    0x0000, 0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000, 0x0001,
+    0x0076, 0x0000, 0x0001, 0x0077, 0x0000, 0x0001, 0x0078, 0x0000,
+    0x0001, 0x0079, 0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x0041,
+    0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001,
+    0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001, 0x0046, 0x0000,
+    0x0001, 0x0047, 0x0000, 0x0001, 0x0048, 0x0000, 0x0001, 0x0049,
+    0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001,
+    0x004C, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004E, 0x0000,
+    0x0001, 0x004F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051,
+    0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0053, 0x0000, 0x0001,
+    0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0056, 0x0000,
+    0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000, 0x0001, 0x0059,
+    0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x0061, 0x0000, 0x0001,
+    0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064, 0x0000,
+    0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000, 0x0001, 0x0067,
+    0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C, 0x0000,
+    0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001, 0x006F,
+    0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001,
+    0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000,
+    0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001, 0x0077,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000, 0x0001,
+    0x007A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001, 0x0042, 0x0000,
+    0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000, 0x0001, 0x0045,
+    0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047, 0x0000, 0x0001,
+    0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001, 0x004A, 0x0000,
+    0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000, 0x0001, 0x004D,
+    0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F, 0x0000, 0x0001,
+    0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001, 0x0052, 0x0000,
+    0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000, 0x0001, 0x0055,
+    0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057, 0x0000, 0x0001,
+    0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001, 0x005A, 0x0000,
+    0x0001, 0x0061, 0x0000, 0x0001, 0x0062, 0x0000, 0x0001, 0x0063,
+    0x0000, 0x0001, 0x0064, 0x0000, 0x0001, 0x0065, 0x0000, 0x0001,
+    0x0066, 0x0000, 0x0001, 0x0067, 0x0000, 0x0001, 0x0068, 0x0000,
+    0x0001, 0x0069, 0x0000, 0x0001, 0x006A, 0x0000, 0x0001, 0x006B,
+    0x0000, 0x0001, 0x006C, 0x0000, 0x0001, 0x006D, 0x0000, 0x0001,
+    0x006E, 0x0000, 0x0001, 0x006F, 0x0000, 0x0001, 0x0070, 0x0000,
+    0x0001, 0x0071, 0x0000, 0x0001, 0x0072, 0x0000, 0x0001, 0x0073,
+    0x0000, 0x0001, 0x0074, 0x0000, 0x0001, 0x0075, 0x0000, 0x0001,
+    0x0076, 0x0000, 0x0001, 0x0077, 0x0000, 0x0001, 0x0078, 0x0000,
+    0x0001, 0x0079, 0x0000, 0x0001, 0x007A, 0x0000, 0x0001, 0x0041,
+    0x0000, 0x0001, 0x0042, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001,
+    0x0044, 0x0000, 0x0001, 0x0045, 0x0000, 0x0001, 0x0046, 0x0000,
+    0x0001, 0x0047, 0x0000, 0x0001, 0x0048, 0x0000, 0x0001, 0x0049,
+    0x0000, 0x0001, 0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001,
+    0x004C, 0x0000, 0x0001, 0x004D, 0x0000, 0x0001, 0x004E, 0x0000,
+    0x0001, 0x004F, 0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051,
+    0x0000, 0x0001, 0x0052, 0x0000, 0x0001, 0x0053, 0x0000, 0x0001,
+    0x0054, 0x0000, 0x0001, 0x0055, 0x0000, 0x0001, 0x0056, 0x0000,
+    0x0001, 0x0057, 0x0000, 0x0001, 0x0058, 0x0000, 0x0001, 0x0059,
+    0x0000, 0x0001, 0x005A, 0x0000, 0x0001, 0x0061, 0x0000, 0x0001,
+    0x0062, 0x0000, 0x0001, 0x0063, 0x0000, 0x0001, 0x0064, 0x0000,
+    0x0001, 0x0065, 0x0000, 0x0001, 0x0066, 0x0000, 0x0001, 0x0067,
+    0x0000, 0x0001, 0x0068, 0x0000, 0x0001, 0x0069, 0x0000, 0x0001,
+    0x006A, 0x0000, 0x0001, 0x006B, 0x0000, 0x0001, 0x006C, 0x0000,
+    0x0001, 0x006D, 0x0000, 0x0001, 0x006E, 0x0000, 0x0001, 0x006F,
+    0x0000, 0x0001, 0x0070, 0x0000, 0x0001, 0x0071, 0x0000, 0x0001,
+    0x0072, 0x0000, 0x0001, 0x0073, 0x0000, 0x0001, 0x0074, 0x0000,
+    0x0001, 0x0075, 0x0000, 0x0001, 0x0076, 0x0000, 0x0001, 0x0077,
+    0x0000, 0x0001, 0x0078, 0x0000, 0x0001, 0x0079, 0x0000, 0x0001,
+    0x007A, 0x0000, 0x0001, 0x0131, 0x0000, 0x0001, 0x0237, 0x0000,
+    0x0001, 0x0391, 0x0000, 0x0001, 0x0392, 0x0000, 0x0001, 0x0393,
+    0x0000, 0x0001, 0x0394, 0x0000, 0x0001, 0x0395, 0x0000, 0x0001,
+    0x0396, 0x0000, 0x0001, 0x0397, 0x0000, 0x0001, 0x0398, 0x0000,
+    0x0001, 0x0399, 0x0000, 0x0001, 0x039A, 0x0000, 0x0001, 0x039B,
+    0x0000, 0x0001, 0x039C, 0x0000, 0x0001, 0x039D, 0x0000, 0x0001,
+    0x039E, 0x0000, 0x0001, 0x039F, 0x0000, 0x0001, 0x03A0, 0x0000,
+    0x0001, 0x03A1, 0x0000, 0x0001, 0x0398, 0x0000, 0x0001, 0x03A3,
+    0x0000, 0x0001, 0x03A4, 0x0000, 0x0001, 0x03A5, 0x0000, 0x0001,
+    0x03A6, 0x0000, 0x0001, 0x03A7, 0x0000, 0x0001, 0x03A8, 0x0000,
+    0x0001, 0x03A9, 0x0000, 0x0001, 0x2207, 0x0000, 0x0001, 0x03B1,
+    0x0000, 0x0001, 0x03B2, 0x0000, 0x0001, 0x03B3, 0x0000, 0x0001,
+    0x03B4, 0x0000, 0x0001, 0x03B5, 0x0000, 0x0001, 0x03B6, 0x0000,
+    0x0001, 0x03B7, 0x0000, 0x0001, 0x03B8, 0x0000, 0x0001, 0x03B9,
+    0x0000, 0x0001, 0x03BA, 0x0000, 0x0001, 0x03BB, 0x0000, 0x0001,
+    0x03BC, 0x0000, 0x0001, 0x03BD, 0x0000, 0x0001, 0x03BE, 0x0000,
+    0x0001, 0x03BF, 0x0000, 0x0001, 0x03C0, 0x0000, 0x0001, 0x03C1,
+    0x0000, 0x0001, 0x03C2, 0x0000, 0x0001, 0x03C3, 0x0000, 0x0001,
+    0x03C4, 0x0000, 0x0001, 0x03C5, 0x0000, 0x0001, 0x03C6, 0x0000,
+    0x0001, 0x03C7, 0x0000, 0x0001, 0x03C8, 0x0000, 0x0001, 0x03C9,
+    0x0000, 0x0001, 0x2202, 0x0000, 0x0001, 0x03B5, 0x0000, 0x0001,
+    0x03B8, 0x0000, 0x0001, 0x03BA, 0x0000, 0x0001, 0x03C6, 0x0000,
+    0x0001, 0x03C1, 0x0000, 0x0001, 0x03C0, 0x0000, 0x0001, 0x0391,
+    0x0000, 0x0001, 0x0392, 0x0000, 0x0001, 0x0393, 0x0000, 0x0001,
+    0x0394, 0x0000, 0x0001, 0x0395, 0x0000, 0x0001, 0x0396, 0x0000,
+    0x0001, 0x0397, 0x0000, 0x0001, 0x0398, 0x0000, 0x0001, 0x0399,
+    0x0000, 0x0001, 0x039A, 0x0000, 0x0001, 0x039B, 0x0000, 0x0001,
+    0x039C, 0x0000, 0x0001, 0x039D, 0x0000, 0x0001, 0x039E, 0x0000,
+    0x0001, 0x039F, 0x0000, 0x0001, 0x03A0, 0x0000, 0x0001, 0x03A1,
+    0x0000, 0x0001, 0x0398, 0x0000, 0x0001, 0x03A3, 0x0000, 0x0001,
+    0x03A4, 0x0000, 0x0001, 0x03A5, 0x0000, 0x0001, 0x03A6, 0x0000,
+    0x0001, 0x03A7, 0x0000, 0x0001, 0x03A8, 0x0000, 0x0001, 0x03A9,
+    0x0000, 0x0001, 0x2207, 0x0000, 0x0001, 0x03B1, 0x0000, 0x0001,
+    0x03B2, 0x0000, 0x0001, 0x03B3, 0x0000, 0x0001, 0x03B4, 0x0000,
+    0x0001, 0x03B5, 0x0000, 0x0001, 0x03B6, 0x0000, 0x0001, 0x03B7,
+    0x0000, 0x0001, 0x03B8, 0x0000, 0x0001, 0x03B9, 0x0000, 0x0001,
+    0x03BA, 0x0000, 0x0001, 0x03BB, 0x0000, 0x0001, 0x03BC, 0x0000,
+    0x0001, 0x03BD, 0x0000, 0x0001, 0x03BE, 0x0000, 0x0001, 0x03BF,
+    0x0000, 0x0001, 0x03C0, 0x0000, 0x0001, 0x03C1, 0x0000, 0x0001,
+    0x03C2, 0x0000, 0x0001, 0x03C3, 0x0000, 0x0001, 0x03C4, 0x0000,
+    0x0001, 0x03C5, 0x0000, 0x0001, 0x03C6, 0x0000, 0x0001, 0x03C7,
+    0x0000, 0x0001, 0x03C8, 0x0000, 0x0001, 0x03C9, 0x0000, 0x0001,
+    0x2202, 0x0000, 0x0001, 0x03B5, 0x0000, 0x0001, 0x03B8, 0x0000,
+    0x0001, 0x03BA, 0x0000, 0x0001, 0x03C6, 0x0000, 0x0001, 0x03C1,
+    0x0000, 0x0001, 0x03C0, 0x0000, 0x0001, 0x0391, 0x0000, 0x0001,
+    0x0392, 0x0000, 0x0001, 0x0393, 0x0000, 0x0001, 0x0394, 0x0000,
+    0x0001, 0x0395, 0x0000, 0x0001, 0x0396, 0x0000, 0x0001, 0x0397,
+    0x0000, 0x0001, 0x0398, 0x0000, 0x0001, 0x0399, 0x0000, 0x0001,
+    0x039A, 0x0000, 0x0001, 0x039B, 0x0000, 0x0001, 0x039C, 0x0000,
+    0x0001, 0x039D, 0x0000, 0x0001, 0x039E, 0x0000, 0x0001, 0x039F,
+    0x0000, 0x0001, 0x03A0, 0x0000, 0x0001, 0x03A1, 0x0000, 0x0001,
+    0x0398, 0x0000, 0x0001, 0x03A3, 0x0000, 0x0001, 0x03A4, 0x0000,
+    0x0001, 0x03A5, 0x0000, 0x0001, 0x03A6, 0x0000, 0x0001, 0x03A7,
+    0x0000, 0x0001, 0x03A8, 0x0000, 0x0001, 0x03A9, 0x0000, 0x0001,
+    0x2207, 0x0000, 0x0001, 0x03B1, 0x0000, 0x0001, 0x03B2, 0x0000,
+    0x0001, 0x03B3, 0x0000, 0x0001, 0x03B4, 0x0000, 0x0001, 0x03B5,
+    0x0000, 0x0001, 0x03B6, 0x0000, 0x0001, 0x03B7, 0x0000, 0x0001,
+    0x03B8, 0x0000, 0x0001, 0x03B9, 0x0000, 0x0001, 0x03BA, 0x0000,
+    0x0001, 0x03BB, 0x0000, 0x0001, 0x03BC, 0x0000, 0x0001, 0x03BD,
+    0x0000, 0x0001, 0x03BE, 0x0000, 0x0001, 0x03BF, 0x0000, 0x0001,
+    0x03C0, 0x0000, 0x0001, 0x03C1, 0x0000, 0x0001, 0x03C2, 0x0000,
+    0x0001, 0x03C3, 0x0000, 0x0001, 0x03C4, 0x0000, 0x0001, 0x03C5,
+    0x0000, 0x0001, 0x03C6, 0x0000, 0x0001, 0x03C7, 0x0000, 0x0001,
+    0x03C8, 0x0000, 0x0001, 0x03C9, 0x0000, 0x0001, 0x2202, 0x0000,
+    0x0001, 0x03B5, 0x0000, 0x0001, 0x03B8, 0x0000, 0x0001, 0x03BA,
+    0x0000, 0x0001, 0x03C6, 0x0000, 0x0001, 0x03C1, 0x0000, 0x0001,
+    0x03C0, 0x0000, 0x0001, 0x0391, 0x0000, 0x0001, 0x0392, 0x0000,
+    0x0001, 0x0393, 0x0000, 0x0001, 0x0394, 0x0000, 0x0001, 0x0395,
+    0x0000, 0x0001, 0x0396, 0x0000, 0x0001, 0x0397, 0x0000, 0x0001,
+    0x0398, 0x0000, 0x0001, 0x0399, 0x0000, 0x0001, 0x039A, 0x0000,
+    0x0001, 0x039B, 0x0000, 0x0001, 0x039C, 0x0000, 0x0001, 0x039D,
+    0x0000, 0x0001, 0x039E, 0x0000, 0x0001, 0x039F, 0x0000, 0x0001,
+    0x03A0, 0x0000, 0x0001, 0x03A1, 0x0000, 0x0001, 0x0398, 0x0000,
+    0x0001, 0x03A3, 0x0000, 0x0001, 0x03A4, 0x0000, 0x0001, 0x03A5,
+    0x0000, 0x0001, 0x03A6, 0x0000, 0x0001, 0x03A7, 0x0000, 0x0001,
+    0x03A8, 0x0000, 0x0001, 0x03A9, 0x0000, 0x0001, 0x2207, 0x0000,
+    0x0001, 0x03B1, 0x0000, 0x0001, 0x03B2, 0x0000, 0x0001, 0x03B3,
+    0x0000, 0x0001, 0x03B4, 0x0000, 0x0001, 0x03B5, 0x0000, 0x0001,
+    0x03B6, 0x0000, 0x0001, 0x03B7, 0x0000, 0x0001, 0x03B8, 0x0000,
+    0x0001, 0x03B9, 0x0000, 0x0001, 0x03BA, 0x0000, 0x0001, 0x03BB,
+    0x0000, 0x0001, 0x03BC, 0x0000, 0x0001, 0x03BD, 0x0000, 0x0001,
+    0x03BE, 0x0000, 0x0001, 0x03BF, 0x0000, 0x0001, 0x03C0, 0x0000,
+    0x0001, 0x03C1, 0x0000, 0x0001, 0x03C2, 0x0000, 0x0001, 0x03C3,
+    0x0000, 0x0001, 0x03C4, 0x0000, 0x0001, 0x03C5, 0x0000, 0x0001,
+    0x03C6, 0x0000, 0x0001, 0x03C7, 0x0000, 0x0001, 0x03C8, 0x0000,
+    0x0001, 0x03C9, 0x0000, 0x0001, 0x2202, 0x0000, 0x0001, 0x03B5,
+    0x0000, 0x0001, 0x03B8, 0x0000, 0x0001, 0x03BA, 0x0000, 0x0001,
+    0x03C6, 0x0000, 0x0001, 0x03C1, 0x0000, 0x0001, 0x03C0, 0x0000,
+    0x0001, 0x0391, 0x0000, 0x0001, 0x0392, 0x0000, 0x0001, 0x0393,
+    0x0000, 0x0001, 0x0394, 0x0000, 0x0001, 0x0395, 0x0000, 0x0001,
+    0x0396, 0x0000, 0x0001, 0x0397, 0x0000, 0x0001, 0x0398, 0x0000,
+    0x0001, 0x0399, 0x0000, 0x0001, 0x039A, 0x0000, 0x0001, 0x039B,
+    0x0000, 0x0001, 0x039C, 0x0000, 0x0001, 0x039D, 0x0000, 0x0001,
+    0x039E, 0x0000, 0x0001, 0x039F, 0x0000, 0x0001, 0x03A0, 0x0000,
+    0x0001, 0x03A1, 0x0000, 0x0001, 0x0398, 0x0000, 0x0001, 0x03A3,
+    0x0000, 0x0001, 0x03A4, 0x0000, 0x0001, 0x03A5, 0x0000, 0x0001,
+    0x03A6, 0x0000, 0x0001, 0x03A7, 0x0000, 0x0001, 0x03A8, 0x0000,
+    0x0001, 0x03A9, 0x0000, 0x0001, 0x2207, 0x0000, 0x0001, 0x03B1,
+    0x0000, 0x0001, 0x03B2, 0x0000, 0x0001, 0x03B3, 0x0000, 0x0001,
+    0x03B4, 0x0000, 0x0001, 0x03B5, 0x0000, 0x0001, 0x03B6, 0x0000,
+    0x0001, 0x03B7, 0x0000, 0x0001, 0x03B8, 0x0000, 0x0001, 0x03B9,
+    0x0000, 0x0001, 0x03BA, 0x0000, 0x0001, 0x03BB, 0x0000, 0x0001,
+    0x03BC, 0x0000, 0x0001, 0x03BD, 0x0000, 0x0001, 0x03BE, 0x0000,
+    0x0001, 0x03BF, 0x0000, 0x0001, 0x03C0, 0x0000, 0x0001, 0x03C1,
+    0x0000, 0x0001, 0x03C2, 0x0000, 0x0001, 0x03C3, 0x0000, 0x0001,
+    0x03C4, 0x0000, 0x0001, 0x03C5, 0x0000, 0x0001, 0x03C6, 0x0000,
+    0x0001, 0x03C7, 0x0000, 0x0001, 0x03C8, 0x0000, 0x0001, 0x03C9,
+    0x0000, 0x0001, 0x2202, 0x0000, 0x0001, 0x03B5, 0x0000, 0x0001,
+    0x03B8, 0x0000, 0x0001, 0x03BA, 0x0000, 0x0001, 0x03C6, 0x0000,
+    0x0001, 0x03C1, 0x0000, 0x0001, 0x03C0, 0x0000, 0x0001, 0x03DC,
+    0x0000, 0x0001, 0x03DD, 0x0000, 0x0001, 0x0030, 0x0000, 0x0001,
+    0x0031, 0x0000, 0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000,
+    0x0001, 0x0034, 0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036,
+    0x0000, 0x0001, 0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001,
+    0x0039, 0x0000, 0x0001, 0x0030, 0x0000, 0x0001, 0x0031, 0x0000,
+    0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000, 0x0001, 0x0034,
+    0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036, 0x0000, 0x0001,
+    0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001, 0x0039, 0x0000,
+    0x0001, 0x0030, 0x0000, 0x0001, 0x0031, 0x0000, 0x0001, 0x0032,
+    0x0000, 0x0001, 0x0033, 0x0000, 0x0001, 0x0034, 0x0000, 0x0001,
+    0x0035, 0x0000, 0x0001, 0x0036, 0x0000, 0x0001, 0x0037, 0x0000,
+    0x0001, 0x0038, 0x0000, 0x0001, 0x0039, 0x0000, 0x0001, 0x0030,
+    0x0000, 0x0001, 0x0031, 0x0000, 0x0001, 0x0032, 0x0000, 0x0001,
+    0x0033, 0x0000, 0x0001, 0x0034, 0x0000, 0x0001, 0x0035, 0x0000,
+    0x0001, 0x0036, 0x0000, 0x0001, 0x0037, 0x0000, 0x0001, 0x0038,
+    0x0000, 0x0001, 0x0039, 0x0000, 0x0001, 0x0030, 0x0000, 0x0001,
+    0x0031, 0x0000, 0x0001, 0x0032, 0x0000, 0x0001, 0x0033, 0x0000,
+    0x0001, 0x0034, 0x0000, 0x0001, 0x0035, 0x0000, 0x0001, 0x0036,
+    0x0000, 0x0001, 0x0037, 0x0000, 0x0001, 0x0038, 0x0000, 0x0001,
+    0x0039, 0x0000, 0x0001, 0x0430, 0x0000, 0x0001, 0x0431, 0x0000,
+    0x0001, 0x0432, 0x0000, 0x0001, 0x0433, 0x0000, 0x0001, 0x0434,
+    0x0000, 0x0001, 0x0435, 0x0000, 0x0001, 0x0436, 0x0000, 0x0001,
+    0x0437, 0x0000, 0x0001, 0x0438, 0x0000, 0x0001, 0x043A, 0x0000,
+    0x0001, 0x043B, 0x0000, 0x0001, 0x043C, 0x0000, 0x0001, 0x043E,
+    0x0000, 0x0001, 0x043F, 0x0000, 0x0001, 0x0440, 0x0000, 0x0001,
+    0x0441, 0x0000, 0x0001, 0x0442, 0x0000, 0x0001, 0x0443, 0x0000,
+    0x0001, 0x0444, 0x0000, 0x0001, 0x0445, 0x0000, 0x0001, 0x0446,
+    0x0000, 0x0001, 0x0447, 0x0000, 0x0001, 0x0448, 0x0000, 0x0001,
+    0x044B, 0x0000, 0x0001, 0x044D, 0x0000, 0x0001, 0x044E, 0x0000,
+    0x0001, 0xA689, 0x0000, 0x0001, 0x04D9, 0x0000, 0x0001, 0x0456,
+    0x0000, 0x0001, 0x0458, 0x0000, 0x0001, 0x04E9, 0x0000, 0x0001,
+    0x04AF, 0x0000, 0x0001, 0x04CF, 0x0000, 0x0001, 0x0430, 0x0000,
+    0x0001, 0x0431, 0x0000, 0x0001, 0x0432, 0x0000, 0x0001, 0x0433,
+    0x0000, 0x0001, 0x0434, 0x0000, 0x0001, 0x0435, 0x0000, 0x0001,
+    0x0436, 0x0000, 0x0001, 0x0437, 0x0000, 0x0001, 0x0438, 0x0000,
+    0x0001, 0x043A, 0x0000, 0x0001, 0x043B, 0x0000, 0x0001, 0x043E,
+    0x0000, 0x0001, 0x043F, 0x0000, 0x0001, 0x0441, 0x0000, 0x0001,
+    0x0443, 0x0000, 0x0001, 0x0444, 0x0000, 0x0001, 0x0445, 0x0000,
+    0x0001, 0x0446, 0x0000, 0x0001, 0x0447, 0x0000, 0x0001, 0x0448,
+    0x0000, 0x0001, 0x044A, 0x0000, 0x0001, 0x044B, 0x0000, 0x0001,
+    0x0491, 0x0000, 0x0001, 0x0456, 0x0000, 0x0001, 0x0455, 0x0000,
+    0x0001, 0x045F, 0x0000, 0x0001, 0x04AB, 0x0000, 0x0001, 0xA651,
+    0x0000, 0x0001, 0x04B1, 0x0000, 0x0001, 0x0627, 0x0000, 0x0001,
+    0x0628, 0x0000, 0x0001, 0x062C, 0x0000, 0x0001, 0x062F, 0x0000,
+    0x0001, 0x0648, 0x0000, 0x0001, 0x0632, 0x0000, 0x0001, 0x062D,
+    0x0000, 0x0001, 0x0637, 0x0000, 0x0001, 0x064A, 0x0000, 0x0001,
+    0x0643, 0x0000, 0x0001, 0x0644, 0x0000, 0x0001, 0x0645, 0x0000,
+    0x0001, 0x0646, 0x0000, 0x0001, 0x0633, 0x0000, 0x0001, 0x0639,
+    0x0000, 0x0001, 0x0641, 0x0000, 0x0001, 0x0635, 0x0000, 0x0001,
+    0x0642, 0x0000, 0x0001, 0x0631, 0x0000, 0x0001, 0x0634, 0x0000,
+    0x0001, 0x062A, 0x0000, 0x0001, 0x062B, 0x0000, 0x0001, 0x062E,
+    0x0000, 0x0001, 0x0630, 0x0000, 0x0001, 0x0636, 0x0000, 0x0001,
+    0x0638, 0x0000, 0x0001, 0x063A, 0x0000, 0x0001, 0x066E, 0x0000,
+    0x0001, 0x06BA, 0x0000, 0x0001, 0x06A1, 0x0000, 0x0001, 0x066F,
+    0x0000, 0x0001, 0x0628, 0x0000, 0x0001, 0x062C, 0x0000, 0x0001,
+    0x0647, 0x0000, 0x0001, 0x062D, 0x0000, 0x0001, 0x064A, 0x0000,
+    0x0001, 0x0643, 0x0000, 0x0001, 0x0644, 0x0000, 0x0001, 0x0645,
+    0x0000, 0x0001, 0x0646, 0x0000, 0x0001, 0x0633, 0x0000, 0x0001,
+    0x0639, 0x0000, 0x0001, 0x0641, 0x0000, 0x0001, 0x0635, 0x0000,
+    0x0001, 0x0642, 0x0000, 0x0001, 0x0634, 0x0000, 0x0001, 0x062A,
+    0x0000, 0x0001, 0x062B, 0x0000, 0x0001, 0x062E, 0x0000, 0x0001,
+    0x0636, 0x0000, 0x0001, 0x063A, 0x0000, 0x0001, 0x062C, 0x0000,
+    0x0001, 0x062D, 0x0000, 0x0001, 0x064A, 0x0000, 0x0001, 0x0644,
+    0x0000, 0x0001, 0x0646, 0x0000, 0x0001, 0x0633, 0x0000, 0x0001,
+    0x0639, 0x0000, 0x0001, 0x0635, 0x0000, 0x0001, 0x0642, 0x0000,
+    0x0001, 0x0634, 0x0000, 0x0001, 0x062E, 0x0000, 0x0001, 0x0636,
+    0x0000, 0x0001, 0x063A, 0x0000, 0x0001, 0x06BA, 0x0000, 0x0001,
+    0x066F, 0x0000, 0x0001, 0x0628, 0x0000, 0x0001, 0x062C, 0x0000,
+    0x0001, 0x0647, 0x0000, 0x0001, 0x062D, 0x0000, 0x0001, 0x0637,
+    0x0000, 0x0001, 0x064A, 0x0000, 0x0001, 0x0643, 0x0000, 0x0001,
+    0x0645, 0x0000, 0x0001, 0x0646, 0x0000, 0x0001, 0x0633, 0x0000,
+    0x0001, 0x0639, 0x0000, 0x0001, 0x0641, 0x0000, 0x0001, 0x0635,
+    0x0000, 0x0001, 0x0642, 0x0000, 0x0001, 0x0634, 0x0000, 0x0001,
+    0x062A, 0x0000, 0x0001, 0x062B, 0x0000, 0x0001, 0x062E, 0x0000,
+    0x0001, 0x0636, 0x0000, 0x0001, 0x0638, 0x0000, 0x0001, 0x063A,
+    0x0000, 0x0001, 0x066E, 0x0000, 0x0001, 0x06A1, 0x0000, 0x0001,
+    0x0627, 0x0000, 0x0001, 0x0628, 0x0000, 0x0001, 0x062C, 0x0000,
+    0x0001, 0x062F, 0x0000, 0x0001, 0x0647, 0x0000, 0x0001, 0x0648,
+    0x0000, 0x0001, 0x0632, 0x0000, 0x0001, 0x062D, 0x0000, 0x0001,
+    0x0637, 0x0000, 0x0001, 0x064A, 0x0000, 0x0001, 0x0644, 0x0000,
+    0x0001, 0x0645, 0x0000, 0x0001, 0x0646, 0x0000, 0x0001, 0x0633,
+    0x0000, 0x0001, 0x0639, 0x0000, 0x0001, 0x0641, 0x0000, 0x0001,
+    0x0635, 0x0000, 0x0001, 0x0642, 0x0000, 0x0001, 0x0631, 0x0000,
+    0x0001, 0x0634, 0x0000, 0x0001, 0x062A, 0x0000, 0x0001, 0x062B,
+    0x0000, 0x0001, 0x062E, 0x0000, 0x0001, 0x0630, 0x0000, 0x0001,
+    0x0636, 0x0000, 0x0001, 0x0638, 0x0000, 0x0001, 0x063A, 0x0000,
+    0x0001, 0x0628, 0x0000, 0x0001, 0x062C, 0x0000, 0x0001, 0x062F,
+    0x0000, 0x0001, 0x0648, 0x0000, 0x0001, 0x0632, 0x0000, 0x0001,
+    0x062D, 0x0000, 0x0001, 0x0637, 0x0000, 0x0001, 0x064A, 0x0000,
+    0x0001, 0x0644, 0x0000, 0x0001, 0x0645, 0x0000, 0x0001, 0x0646,
+    0x0000, 0x0001, 0x0633, 0x0000, 0x0001, 0x0639, 0x0000, 0x0001,
+    0x0641, 0x0000, 0x0001, 0x0635, 0x0000, 0x0001, 0x0642, 0x0000,
+    0x0001, 0x0631, 0x0000, 0x0001, 0x0634, 0x0000, 0x0001, 0x062A,
+    0x0000, 0x0001, 0x062B, 0x0000, 0x0001, 0x062E, 0x0000, 0x0001,
+    0x0630, 0x0000, 0x0001, 0x0636, 0x0000, 0x0001, 0x0638, 0x0000,
+    0x0001, 0x063A, 0x0000, 0x0002, 0x0030, 0x002E, 0x0000, 0x0002,
+    0x0030, 0x002C, 0x0000, 0x0002, 0x0031, 0x002C, 0x0000, 0x0002,
+    0x0032, 0x002C, 0x0000, 0x0002, 0x0033, 0x002C, 0x0000, 0x0002,
+    0x0034, 0x002C, 0x0000, 0x0002, 0x0035, 0x002C, 0x0000, 0x0002,
+    0x0036, 0x002C, 0x0000, 0x0002, 0x0037, 0x002C, 0x0000, 0x0002,
+    0x0038, 0x002C, 0x0000, 0x0002, 0x0039, 0x002C, 0x0000, 0x0003,
+    0x0028, 0x0041, 0x0029, 0x0000, 0x0003, 0x0028, 0x0042, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x0043, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x0044, 0x0029, 0x0000, 0x0003, 0x0028, 0x0045, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x0046, 0x0029, 0x0000, 0x0003, 0x0028, 0x0047,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x0048, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x0049, 0x0029, 0x0000, 0x0003, 0x0028, 0x004A, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x004B, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x004C, 0x0029, 0x0000, 0x0003, 0x0028, 0x004D, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x004E, 0x0029, 0x0000, 0x0003, 0x0028, 0x004F,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x0050, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x0051, 0x0029, 0x0000, 0x0003, 0x0028, 0x0052, 0x0029,
+    0x0000, 0x0003, 0x0028, 0x0053, 0x0029, 0x0000, 0x0003, 0x0028,
+    0x0054, 0x0029, 0x0000, 0x0003, 0x0028, 0x0055, 0x0029, 0x0000,
+    0x0003, 0x0028, 0x0056, 0x0029, 0x0000, 0x0003, 0x0028, 0x0057,
+    0x0029, 0x0000, 0x0003, 0x0028, 0x0058, 0x0029, 0x0000, 0x0003,
+    0x0028, 0x0059, 0x0029, 0x0000, 0x0003, 0x0028, 0x005A, 0x0029,
+    0x0000, 0x0003, 0x3014, 0x0053, 0x3015, 0x0000, 0x0001, 0x0043,
+    0x0000, 0x0001, 0x0052, 0x0000, 0x0002, 0x0043, 0x0044, 0x0000,
+    0x0002, 0x0057, 0x005A, 0x0000, 0x0001, 0x0041, 0x0000, 0x0001,
+    0x0042, 0x0000, 0x0001, 0x0043, 0x0000, 0x0001, 0x0044, 0x0000,
+    0x0001, 0x0045, 0x0000, 0x0001, 0x0046, 0x0000, 0x0001, 0x0047,
+    0x0000, 0x0001, 0x0048, 0x0000, 0x0001, 0x0049, 0x0000, 0x0001,
+    0x004A, 0x0000, 0x0001, 0x004B, 0x0000, 0x0001, 0x004C, 0x0000,
+    0x0001, 0x004D, 0x0000, 0x0001, 0x004E, 0x0000, 0x0001, 0x004F,
+    0x0000, 0x0001, 0x0050, 0x0000, 0x0001, 0x0051, 0x0000, 0x0001,
+    0x0052, 0x0000, 0x0001, 0x0053, 0x0000, 0x0001, 0x0054, 0x0000,
+    0x0001, 0x0055, 0x0000, 0x0001, 0x0056, 0x0000, 0x0001, 0x0057,
+    0x0000, 0x0001, 0x0058, 0x0000, 0x0001, 0x0059, 0x0000, 0x0001,
+    0x005A, 0x0000, 0x0002, 0x0048, 0x0056, 0x0000, 0x0002, 0x004D,
+    0x0056, 0x0000, 0x0002, 0x0053, 0x0044, 0x0000, 0x0002, 0x0053,
+    0x0053, 0x0000, 0x0003, 0x0050, 0x0050, 0x0056, 0x0000, 0x0002,
+    0x0057, 0x0043, 0x0000, 0x0002, 0x004D, 0x0043, 0x0000, 0x0002,
+    0x004D, 0x0044, 0x0000, 0x0002, 0x004D, 0x0052, 0x0000, 0x0002,
+    0x0044, 0x004A, 0x0000, 0x0002, 0x307B, 0x304B, 0x0000, 0x0002,
+    0x30B3, 0x30B3, 0x0000, 0x0001, 0x30B5, 0x0000, 0x0001, 0x624B,
+    0x0000, 0x0001, 0x5B57, 0x0000, 0x0001, 0x53CC, 0x0000, 0x0002,
+    0x30C6, 0x3099, 0x0000, 0x0001, 0x4E8C, 0x0000, 0x0001, 0x591A,
+    0x0000, 0x0001, 0x89E3, 0x0000, 0x0001, 0x5929, 0x0000, 0x0001,
+    0x4EA4, 0x0000, 0x0001, 0x6620, 0x0000, 0x0001, 0x7121, 0x0000,
+    0x0001, 0x6599, 0x0000, 0x0001, 0x524D, 0x0000, 0x0001, 0x5F8C,
+    0x0000, 0x0001, 0x518D, 0x0000, 0x0001, 0x65B0, 0x0000, 0x0001,
+    0x521D, 0x0000, 0x0001, 0x7D42, 0x0000, 0x0001, 0x751F, 0x0000,
+    0x0001, 0x8CA9, 0x0000, 0x0001, 0x58F0, 0x0000, 0x0001, 0x5439,
+    0x0000, 0x0001, 0x6F14, 0x0000, 0x0001, 0x6295, 0x0000, 0x0001,
+    0x6355, 0x0000, 0x0001, 0x4E00, 0x0000, 0x0001, 0x4E09, 0x0000,
+    0x0001, 0x904A, 0x0000, 0x0001, 0x5DE6, 0x0000, 0x0001, 0x4E2D,
+    0x0000, 0x0001, 0x53F3, 0x0000, 0x0001, 0x6307, 0x0000, 0x0001,
+    0x8D70, 0x0000, 0x0001, 0x6253, 0x0000, 0x0001, 0x7981, 0x0000,
+    0x0001, 0x7A7A, 0x0000, 0x0001, 0x5408, 0x0000, 0x0001, 0x6E80,
+    0x0000, 0x0001, 0x6709, 0x0000, 0x0001, 0x6708, 0x0000, 0x0001,
+    0x7533, 0x0000, 0x0001, 0x5272, 0x0000, 0x0001, 0x55B6, 0x0000,
+    0x0001, 0x914D, 0x0000, 0x0003, 0x3014, 0x672C, 0x3015, 0x0000,
+    0x0003, 0x3014, 0x4E09, 0x3015, 0x0000, 0x0003, 0x3014, 0x4E8C,
+    0x3015, 0x0000, 0x0003, 0x3014, 0x5B89, 0x3015, 0x0000, 0x0003,
+    0x3014, 0x70B9, 0x3015, 0x0000, 0x0003, 0x3014, 0x6253, 0x3015,
+    0x0000, 0x0003, 0x3014, 0x76D7, 0x3015, 0x0000, 0x0003, 0x3014,
+    0x52DD, 0x3015, 0x0000, 0x0003, 0x3014, 0x6557, 0x3015, 0x0000,
+    0x0001, 0x5F97, 0x0000, 0x0001, 0x53EF, 0x0000, 0x0001, 0x0030,
+    0x0000, 0x0001, 0x0031, 0x0000, 0x0001, 0x0032, 0x0000, 0x0001,
+    0x0033, 0x0000, 0x0001, 0x0034, 0x0000, 0x0001, 0x0035, 0x0000,
+    0x0001, 0x0036, 0x0000, 0x0001, 0x0037, 0x0000, 0x0001, 0x0038,
+    0x0000, 0x0001, 0x0039, 0x0001, 0x4E3D, 0x0001, 0x4E38, 0x0001,
+    0x4E41, 0x0001, 0x20122, 0x0001, 0x4F60, 0x0001, 0x4FAE, 0x0001,
+    0x4FBB, 0x0001, 0x5002, 0x0001, 0x507A, 0x0001, 0x5099, 0x0001,
+    0x50E7, 0x0001, 0x50CF, 0x0001, 0x349E, 0x0001, 0x2063A, 0x0001,
+    0x514D, 0x0001, 0x5154, 0x0001, 0x5164, 0x0001, 0x5177, 0x0001,
+    0x2051C, 0x0001, 0x34B9, 0x0001, 0x5167, 0x0001, 0x518D, 0x0001,
+    0x2054B, 0x0001, 0x5197, 0x0001, 0x51A4, 0x0001, 0x4ECC, 0x0001,
+    0x51AC, 0x0001, 0x51B5, 0x0001, 0x291DF, 0x0001, 0x51F5, 0x0001,
+    0x5203, 0x0001, 0x34DF, 0x0001, 0x523B, 0x0001, 0x5246, 0x0001,
+    0x5272, 0x0001, 0x5277, 0x0001, 0x3515, 0x0001, 0x52C7, 0x0001,
+    0x52C9, 0x0001, 0x52E4, 0x0001, 0x52FA, 0x0001, 0x5305, 0x0001,
+    0x5306, 0x0001, 0x5317, 0x0001, 0x5349, 0x0001, 0x5351, 0x0001,
+    0x535A, 0x0001, 0x5373, 0x0001, 0x537D, 0x0001, 0x537F, 0x0001,
+    0x537F, 0x0001, 0x537F, 0x0001, 0x20A2C, 0x0001, 0x7070, 0x0001,
+    0x53CA, 0x0001, 0x53DF, 0x0001, 0x20B63, 0x0001, 0x53EB, 0x0001,
+    0x53F1, 0x0001, 0x5406, 0x0001, 0x549E, 0x0001, 0x5438, 0x0001,
+    0x5448, 0x0001, 0x5468, 0x0001, 0x54A2, 0x0001, 0x54F6, 0x0001,
+    0x5510, 0x0001, 0x5553, 0x0001, 0x5563, 0x0001, 0x5584, 0x0001,
+    0x5584, 0x0001, 0x5599, 0x0001, 0x55AB, 0x0001, 0x55B3, 0x0001,
+    0x55C2, 0x0001, 0x5716, 0x0001, 0x5606, 0x0001, 0x5717, 0x0001,
+    0x5651, 0x0001, 0x5674, 0x0001, 0x5207, 0x0001, 0x58EE, 0x0001,
+    0x57CE, 0x0001, 0x57F4, 0x0001, 0x580D, 0x0001, 0x578B, 0x0001,
+    0x5832, 0x0001, 0x5831, 0x0001, 0x58AC, 0x0001, 0x214E4, 0x0001,
+    0x58F2, 0x0001, 0x58F7, 0x0001, 0x5906, 0x0001, 0x591A, 0x0001,
+    0x5922, 0x0001, 0x5962, 0x0001, 0x216A8, 0x0001, 0x216EA, 0x0001,
+    0x59EC, 0x0001, 0x5A1B, 0x0001, 0x5A27, 0x0001, 0x59D8, 0x0001,
+    0x5A66, 0x0001, 0x36EE, 0x0001, 0x36FC, 0x0001, 0x5B08, 0x0001,
+    0x5B3E, 0x0001, 0x5B3E, 0x0001, 0x219C8, 0x0001, 0x5BC3, 0x0001,
+    0x5BD8, 0x0001, 0x5BE7, 0x0001, 0x5BF3, 0x0001, 0x21B18, 0x0001,
+    0x5BFF, 0x0001, 0x5C06, 0x0001, 0x5F53, 0x0001, 0x5C22, 0x0001,
+    0x3781, 0x0001, 0x5C60, 0x0001, 0x5C6E, 0x0001, 0x5CC0, 0x0001,
+    0x5C8D, 0x0001, 0x21DE4, 0x0001, 0x5D43, 0x0001, 0x21DE6, 0x0001,
+    0x5D6E, 0x0001, 0x5D6B, 0x0001, 0x5D7C, 0x0001, 0x5DE1, 0x0001,
+    0x5DE2, 0x0001, 0x382F, 0x0001, 0x5DFD, 0x0001, 0x5E28, 0x0001,
+    0x5E3D, 0x0001, 0x5E69, 0x0001, 0x3862, 0x0001, 0x22183, 0x0001,
+    0x387C, 0x0001, 0x5EB0, 0x0001, 0x5EB3, 0x0001, 0x5EB6, 0x0001,
+    0x5ECA, 0x0001, 0x2A392, 0x0001, 0x5EFE, 0x0001, 0x22331, 0x0001,
+    0x22331, 0x0001, 0x8201, 0x0001, 0x5F22, 0x0001, 0x5F22, 0x0001,
+    0x38C7, 0x0001, 0x232B8, 0x0001, 0x261DA, 0x0001, 0x5F62, 0x0001,
+    0x5F6B, 0x0001, 0x38E3, 0x0001, 0x5F9A, 0x0001, 0x5FCD, 0x0001,
+    0x5FD7, 0x0001, 0x5FF9, 0x0001, 0x6081, 0x0001, 0x393A, 0x0001,
+    0x391C, 0x0001, 0x6094, 0x0001, 0x226D4, 0x0001, 0x60C7, 0x0001,
+    0x6148, 0x0001, 0x614C, 0x0001, 0x614E, 0x0001, 0x614C, 0x0001,
+    0x617A, 0x0001, 0x618E, 0x0001, 0x61B2, 0x0001, 0x61A4, 0x0001,
+    0x61AF, 0x0001, 0x61DE, 0x0001, 0x61F2, 0x0001, 0x61F6, 0x0001,
+    0x6210, 0x0001, 0x621B, 0x0001, 0x625D, 0x0001, 0x62B1, 0x0001,
+    0x62D4, 0x0001, 0x6350, 0x0001, 0x22B0C, 0x0001, 0x633D, 0x0001,
+    0x62FC, 0x0001, 0x6368, 0x0001, 0x6383, 0x0001, 0x63E4, 0x0001,
+    0x22BF1, 0x0001, 0x6422, 0x0001, 0x63C5, 0x0001, 0x63A9, 0x0001,
+    0x3A2E, 0x0001, 0x6469, 0x0001, 0x647E, 0x0001, 0x649D, 0x0001,
+    0x6477, 0x0001, 0x3A6C, 0x0001, 0x654F, 0x0001, 0x656C, 0x0001,
+    0x2300A, 0x0001, 0x65E3, 0x0001, 0x66F8, 0x0001, 0x6649, 0x0001,
+    0x3B19, 0x0001, 0x6691, 0x0001, 0x3B08, 0x0001, 0x3AE4, 0x0001,
+    0x5192, 0x0001, 0x5195, 0x0001, 0x6700, 0x0001, 0x669C, 0x0001,
+    0x80AD, 0x0001, 0x43D9, 0x0001, 0x6717, 0x0001, 0x671B, 0x0001,
+    0x6721, 0x0001, 0x675E, 0x0001, 0x6753, 0x0001, 0x233C3, 0x0001,
+    0x3B49, 0x0001, 0x67FA, 0x0001, 0x6785, 0x0001, 0x6852, 0x0001,
+    0x6885, 0x0001, 0x2346D, 0x0001, 0x688E, 0x0001, 0x681F, 0x0001,
+    0x6914, 0x0001, 0x3B9D, 0x0001, 0x6942, 0x0001, 0x69A3, 0x0001,
+    0x69EA, 0x0001, 0x6AA8, 0x0001, 0x236A3, 0x0001, 0x6ADB, 0x0001,
+    0x3C18, 0x0001, 0x6B21, 0x0001, 0x238A7, 0x0001, 0x6B54, 0x0001,
+    0x3C4E, 0x0001, 0x6B72, 0x0001, 0x6B9F, 0x0001, 0x6BBA, 0x0001,
+    0x6BBB, 0x0001, 0x23A8D, 0x0001, 0x21D0B, 0x0001, 0x23AFA, 0x0001,
+    0x6C4E, 0x0001, 0x23CBC, 0x0001, 0x6CBF, 0x0001, 0x6CCD, 0x0001,
+    0x6C67, 0x0001, 0x6D16, 0x0001, 0x6D3E, 0x0001, 0x6D77, 0x0001,
+    0x6D41, 0x0001, 0x6D69, 0x0001, 0x6D78, 0x0001, 0x6D85, 0x0001,
+    0x23D1E, 0x0001, 0x6D34, 0x0001, 0x6E2F, 0x0001, 0x6E6E, 0x0001,
+    0x3D33, 0x0001, 0x6ECB, 0x0001, 0x6EC7, 0x0001, 0x23ED1, 0x0001,
+    0x6DF9, 0x0001, 0x6F6E, 0x0001, 0x23F5E, 0x0001, 0x23F8E, 0x0001,
+    0x6FC6, 0x0001, 0x7039, 0x0001, 0x701E, 0x0001, 0x701B, 0x0001,
+    0x3D96, 0x0001, 0x704A, 0x0001, 0x707D, 0x0001, 0x7077, 0x0001,
+    0x70AD, 0x0001, 0x20525, 0x0001, 0x7145, 0x0001, 0x24263, 0x0001,
+    0x719C, 0x0001, 0x243AB, 0x0001, 0x7228, 0x0001, 0x7235, 0x0001,
+    0x7250, 0x0001, 0x24608, 0x0001, 0x7280, 0x0001, 0x7295, 0x0001,
+    0x24735, 0x0001, 0x24814, 0x0001, 0x737A, 0x0001, 0x738B, 0x0001,
+    0x3EAC, 0x0001, 0x73A5, 0x0001, 0x3EB8, 0x0001, 0x3EB8, 0x0001,
+    0x7447, 0x0001, 0x745C, 0x0001, 0x7471, 0x0001, 0x7485, 0x0001,
+    0x74CA, 0x0001, 0x3F1B, 0x0001, 0x7524, 0x0001, 0x24C36, 0x0001,
+    0x753E, 0x0001, 0x24C92, 0x0001, 0x7570, 0x0001, 0x2219F, 0x0001,
+    0x7610, 0x0001, 0x24FA1, 0x0001, 0x24FB8, 0x0001, 0x25044, 0x0001,
+    0x3FFC, 0x0001, 0x4008, 0x0001, 0x76F4, 0x0001, 0x250F3, 0x0001,
+    0x250F2, 0x0001, 0x25119, 0x0001, 0x25133, 0x0001, 0x771E, 0x0001,
+    0x771F, 0x0001, 0x771F, 0x0001, 0x774A, 0x0001, 0x4039, 0x0001,
+    0x778B, 0x0001, 0x4046, 0x0001, 0x4096, 0x0001, 0x2541D, 0x0001,
+    0x784E, 0x0001, 0x788C, 0x0001, 0x78CC, 0x0001, 0x40E3, 0x0001,
+    0x25626, 0x0001, 0x7956, 0x0001, 0x2569A, 0x0001, 0x256C5, 0x0001,
+    0x798F, 0x0001, 0x79EB, 0x0001, 0x412F, 0x0001, 0x7A40, 0x0001,
+    0x7A4A, 0x0001, 0x7A4F, 0x0001, 0x2597C, 0x0001, 0x25AA7, 0x0001,
+    0x25AA7, 0x0001, 0x7AEE, 0x0001, 0x4202, 0x0001, 0x25BAB, 0x0001,
+    0x7BC6, 0x0001, 0x7BC9, 0x0001, 0x4227, 0x0001, 0x25C80, 0x0001,
+    0x7CD2, 0x0001, 0x42A0, 0x0001, 0x7CE8, 0x0001, 0x7CE3, 0x0001,
+    0x7D00, 0x0001, 0x25F86, 0x0001, 0x7D63, 0x0001, 0x4301, 0x0001,
+    0x7DC7, 0x0001, 0x7E02, 0x0001, 0x7E45, 0x0001, 0x4334, 0x0001,
+    0x26228, 0x0001, 0x26247, 0x0001, 0x4359, 0x0001, 0x262D9, 0x0001,
+    0x7F7A, 0x0001, 0x2633E, 0x0001, 0x7F95, 0x0001, 0x7FFA, 0x0001,
+    0x8005, 0x0001, 0x264DA, 0x0001, 0x26523, 0x0001, 0x8060, 0x0001,
+    0x265A8, 0x0001, 0x8070, 0x0001, 0x2335F, 0x0001, 0x43D5, 0x0001,
+    0x80B2, 0x0001, 0x8103, 0x0001, 0x440B, 0x0001, 0x813E, 0x0001,
+    0x5AB5, 0x0001, 0x267A7, 0x0001, 0x267B5, 0x0001, 0x23393, 0x0001,
+    0x2339C, 0x0001, 0x8201, 0x0001, 0x8204, 0x0001, 0x8F9E, 0x0001,
+    0x446B, 0x0001, 0x8291, 0x0001, 0x828B, 0x0001, 0x829D, 0x0001,
+    0x52B3, 0x0001, 0x82B1, 0x0001, 0x82B3, 0x0001, 0x82BD, 0x0001,
+    0x82E6, 0x0001, 0x26B3C, 0x0001, 0x82E5, 0x0001, 0x831D, 0x0001,
+    0x8363, 0x0001, 0x83AD, 0x0001, 0x8323, 0x0001, 0x83BD, 0x0001,
+    0x83E7, 0x0001, 0x8457, 0x0001, 0x8353, 0x0001, 0x83CA, 0x0001,
+    0x83CC, 0x0001, 0x83DC, 0x0001, 0x26C36, 0x0001, 0x26D6B, 0x0001,
+    0x26CD5, 0x0001, 0x452B, 0x0001, 0x84F1, 0x0001, 0x84F3, 0x0001,
+    0x8516, 0x0001, 0x273CA, 0x0001, 0x8564, 0x0001, 0x26F2C, 0x0001,
+    0x455D, 0x0001, 0x4561, 0x0001, 0x26FB1, 0x0001, 0x270D2, 0x0001,
+    0x456B, 0x0001, 0x8650, 0x0001, 0x865C, 0x0001, 0x8667, 0x0001,
+    0x8669, 0x0001, 0x86A9, 0x0001, 0x8688, 0x0001, 0x870E, 0x0001,
+    0x86E2, 0x0001, 0x8779, 0x0001, 0x8728, 0x0001, 0x876B, 0x0001,
+    0x8786, 0x0001, 0x45D7, 0x0001, 0x87E1, 0x0001, 0x8801, 0x0001,
+    0x45F9, 0x0001, 0x8860, 0x0001, 0x8863, 0x0001, 0x27667, 0x0001,
+    0x88D7, 0x0001, 0x88DE, 0x0001, 0x4635, 0x0001, 0x88FA, 0x0001,
+    0x34BB, 0x0001, 0x278AE, 0x0001, 0x27966, 0x0001, 0x46BE, 0x0001,
+    0x46C7, 0x0001, 0x8AA0, 0x0001, 0x8AED, 0x0001, 0x8B8A, 0x0001,
+    0x8C55, 0x0001, 0x27CA8, 0x0001, 0x8CAB, 0x0001, 0x8CC1, 0x0001,
+    0x8D1B, 0x0001, 0x8D77, 0x0001, 0x27F2F, 0x0001, 0x20804, 0x0001,
+    0x8DCB, 0x0001, 0x8DBC, 0x0001, 0x8DF0, 0x0001, 0x208DE, 0x0001,
+    0x8ED4, 0x0001, 0x8F38, 0x0001, 0x285D2, 0x0001, 0x285ED, 0x0001,
+    0x9094, 0x0001, 0x90F1, 0x0001, 0x9111, 0x0001, 0x2872E, 0x0001,
+    0x911B, 0x0001, 0x9238, 0x0001, 0x92D7, 0x0001, 0x92D8, 0x0001,
+    0x927C, 0x0001, 0x93F9, 0x0001, 0x9415, 0x0001, 0x28BFA, 0x0001,
+    0x958B, 0x0001, 0x4995, 0x0001, 0x95B7, 0x0001, 0x28D77, 0x0001,
+    0x49E6, 0x0001, 0x96C3, 0x0001, 0x5DB2, 0x0001, 0x9723, 0x0001,
+    0x29145, 0x0001, 0x2921A, 0x0001, 0x4A6E, 0x0001, 0x4A76, 0x0001,
+    0x97E0, 0x0001, 0x2940A, 0x0001, 0x4AB2, 0x0001, 0x29496, 0x0001,
+    0x980B, 0x0001, 0x980B, 0x0001, 0x9829, 0x0001, 0x295B6, 0x0001,
+    0x98E2, 0x0001, 0x4B33, 0x0001, 0x9929, 0x0001, 0x99A7, 0x0001,
+    0x99C2, 0x0001, 0x99FE, 0x0001, 0x4BCE, 0x0001, 0x29B30, 0x0001,
+    0x9B12, 0x0001, 0x9C40, 0x0001, 0x9CFD, 0x0001, 0x4CCE, 0x0001,
+    0x4CED, 0x0001, 0x9D67, 0x0001, 0x2A0CE, 0x0001, 0x4CF8, 0x0001,
+    0x2A105, 0x0001, 0x2A20E, 0x0001, 0x2A291, 0x0001, 0x9EBB, 0x0001,
+    0x4D56, 0x0001, 0x9EF9, 0x0001, 0x9EFE, 0x0001, 0x9F05, 0x0001,
+    0x9F0F, 0x0001, 0x9F16, 0x0001, 0x9F3B, 0x0001, 0x2A600,
+};
+
+// Primary composites sorted by {first, second}
+const Composition norm_compositions[] = {
+    {0x003C, 0x0338, 0x226E},
+    {0x003D, 0x0338, 0x2260},
+    {0x003E, 0x0338, 0x226F},
+    {0x0041, 0x0300, 0x00C0},
+    {0x0041, 0x0301, 0x00C1},
+    {0x0041, 0x0302, 0x00C2},
+    {0x0041, 0x0303, 0x00C3},
+    {0x0041, 0x0304, 0x0100},
+    {0x0041, 0x0306, 0x0102},
+    {0x0041, 0x0307, 0x0226},
+    {0x0041, 0x0308, 0x00C4},
+    {0x0041, 0x0309, 0x1EA2},
+    {0x0041, 0x030A, 0x00C5},
+    {0x0041, 0x030C, 0x01CD},
+    {0x0041, 0x030F, 0x0200},
+    {0x0041, 0x0311, 0x0202},
+    {0x0041, 0x0323, 0x1EA0},
+    {0x0041, 0x0325, 0x1E00},
+    {0x0041, 0x0328, 0x0104},
+    {0x0042, 0x0307, 0x1E02},
+    {0x0042, 0x0323, 0x1E04},
+    {0x0042, 0x0331, 0x1E06},
+    {0x0043, 0x0301, 0x0106},
+    {0x0043, 0x0302, 0x0108},
+    {0x0043, 0x0307, 0x010A},
+    {0x0043, 0x030C, 0x010C},
+    {0x0043, 0x0327, 0x00C7},
+    {0x0044, 0x0307, 0x1E0A},
+    {0x0044, 0x030C, 0x010E},
+    {0x0044, 0x0323, 0x1E0C},
+    {0x0044, 0x0327, 0x1E10},
+    {0x0044, 0x032D, 0x1E12},
+    {0x0044, 0x0331, 0x1E0E},
+    {0x0045, 0x0300, 0x00C8},
+    {0x0045, 0x0301, 0x00C9},
+    {0x0045, 0x0302, 0x00CA},
+    {0x0045, 0x0303, 0x1EBC},
+    {0x0045, 0x0304, 0x0112},
+    {0x0045, 0x0306, 0x0114},
+    {0x0045, 0x0307, 0x0116},
+    {0x0045, 0x0308, 0x00CB},
+    {0x0045, 0x0309, 0x1EBA},
+    {0x0045, 0x030C, 0x011A},
+    {0x0045, 0x030F, 0x0204},
+    {0x0045, 0x0311, 0x0206},
+    {0x0045, 0x0323, 0x1EB8},
+    {0x0045, 0x0327, 0x0228},
+    {0x0045, 0x0328, 0x0118},
+    {0x0045, 0x032D, 0x1E18},
+    {0x0045, 0x0330, 0x1E1A},
+    {0x0046, 0x0307, 0x1E1E},
+    {0x0047, 0x0301, 0x01F4},
+    {0x0047, 0x0302, 0x011C},
+    {0x0047, 0x0304, 0x1E20},
+    {0x0047, 0x0306, 0x011E},
+    {0x0047, 0x0307, 0x0120},
+    {0x0047, 0x030C, 0x01E6},
+    {0x0047, 0x0327, 0x0122},
+    {0x0048, 0x0302, 0x0124},
+    {0x0048, 0x0307, 0x1E22},
+    {0x0048, 0x0308, 0x1E26},
+    {0x0048, 0x030C, 0x021E},
+    {0x0048, 0x0323, 0x1E24},
+    {0x0048, 0x0327, 0x1E28},
+    {0x0048, 0x032E, 0x1E2A},
+    {0x0049, 0x0300, 0x00CC},
+    {0x0049, 0x0301, 0x00CD},
+    {0x0049, 0x0302, 0x00CE},
+    {0x0049, 0x0303, 0x0128},
+    {0x0049, 0x0304, 0x012A},
+    {0x0049, 0x0306, 0x012C},
+    {0x0049, 0x0307, 0x0130},
+    {0x0049, 0x0308, 0x00CF},
+    {0x0049, 0x0309, 0x1EC8},
+    {0x0049, 0x030C, 0x01CF},
+    {0x0049, 0x030F, 0x0208},
+    {0x0049, 0x0311, 0x020A},
+    {0x0049, 0x0323, 0x1ECA},
+    {0x0049, 0x0328, 0x012E},
+    {0x0049, 0x0330, 0x1E2C},
+    {0x004A, 0x0302, 0x0134},
+    {0x004B, 0x0301, 0x1E30},
+    {0x004B, 0x030C, 0x01E8},
+    {0x004B, 0x0323, 0x1E32},
+    {0x004B, 0x0327, 0x0136},
+    {0x004B, 0x0331, 0x1E34},
+    {0x004C, 0x0301, 0x0139},
+    {0x004C, 0x030C, 0x013D},
+    {0x004C, 0x0323, 0x1E36},
+    {0x004C, 0x0327, 0x013B},
+    {0x004C, 0x032D, 0x1E3C},
+    {0x004C, 0x0331, 0x1E3A},
+    {0x004D, 0x0301, 0x1E3E},
+    {0x004D, 0x0307, 0x1E40},
+    {0x004D, 0x0323, 0x1E42},
+    {0x004E, 0x0300, 0x01F8},
+    {0x004E, 0x0301, 0x0143},
+    {0x004E, 0x0303, 0x00D1},
+    {0x004E, 0x0307, 0x1E44},
+    {0x004E, 0x030C, 0x0147},
+    {0x004E, 0x0323, 0x1E46},
+    {0x004E, 0x0327, 0x0145},
+    {0x004E, 0x032D, 0x1E4A},
+    {0x004E, 0x0331, 0x1E48},
+    {0x004F, 0x0300, 0x00D2},
+    {0x004F, 0x0301, 0x00D3},
+    {0x004F, 0x0302, 0x00D4},
+    {0x004F, 0x0303, 0x00D5},
+    {0x004F, 0x0304, 0x014C},
+    {0x004F, 0x0306, 0x014E},
+    {0x004F, 0x0307, 0x022E},
+    {0x004F, 0x0308, 0x00D6},
+    {0x004F, 0x0309, 0x1ECE},
+    {0x004F, 0x030B, 0x0150},
+    {0x004F, 0x030C, 0x01D1},
+    {0x004F, 0x030F, 0x020C},
+    {0x004F, 0x0311, 0x020E},
+    {0x004F, 0x031B, 0x01A0},
+    {0x004F, 0x0323, 0x1ECC},
+    {0x004F, 0x0328, 0x01EA},
+    {0x0050, 0x0301, 0x1E54},
+    {0x0050, 0x0307, 0x1E56},
+    {0x0052, 0x0301, 0x0154},
+    {0x0052, 0x0307, 0x1E58},
+    {0x0052, 0x030C, 0x0158},
+    {0x0052, 0x030F, 0x0210},
+    {0x0052, 0x0311, 0x0212},
+    {0x0052, 0x0323, 0x1E5A},
+    {0x0052, 0x0327, 0x0156},
+    {0x0052, 0x0331, 0x1E5E},
+    {0x0053, 0x0301, 0x015A},
+    {0x0053, 0x0302, 0x015C},
+    {0x0053, 0x0307, 0x1E60},
+    {0x0053, 0x030C, 0x0160},
+    {0x0053, 0x0323, 0x1E62},
+    {0x0053, 0x0326, 0x0218},
+    {0x0053, 0x0327, 0x015E},
+    {0x0054, 0x0307, 0x1E6A},
+    {0x0054, 0x030C, 0x0164},
+    {0x0054, 0x0323, 0x1E6C},
+    {0x0054, 0x0326, 0x021A},
+    {0x0054, 0x0327, 0x0162},
+    {0x0054, 0x032D, 0x1E70},
+    {0x0054, 0x0331, 0x1E6E},
+    {0x0055, 0x0300, 0x00D9},
+    {0x0055, 0x0301, 0x00DA},
+    {0x0055, 0x0302, 0x00DB},
+    {0x0055, 0x0303, 0x0168},
+    {0x0055, 0x0304, 0x016A},
+    {0x0055, 0x0306, 0x016C},
+    {0x0055, 0x0308, 0x00DC},
+    {0x0055, 0x0309, 0x1EE6},
+    {0x0055, 0x030A, 0x016E},
+    {0x0055, 0x030B, 0x0170},
+    {0x0055, 0x030C, 0x01D3},
+    {0x0055, 0x030F, 0x0214},
+    {0x0055, 0x0311, 0x0216},
+    {0x0055, 0x031B, 0x01AF},
+    {0x0055, 0x0323, 0x1EE4},
+    {0x0055, 0x0324, 0x1E72},
+    {0x0055, 0x0328, 0x0172},
+    {0x0055, 0x032D, 0x1E76},
+    {0x0055, 0x0330, 0x1E74},
+    {0x0056, 0x0303, 0x1E7C},
+    {0x0056, 0x0323, 0x1E7E},
+    {0x0057, 0x0300, 0x1E80},
+    {0x0057, 0x0301, 0x1E82},
+    {0x0057, 0x0302, 0x0174},
+    {0x0057, 0x0307, 0x1E86},
+    {0x0057, 0x0308, 0x1E84},
+    {0x0057, 0x0323, 0x1E88},
+    {0x0058, 0x0307, 0x1E8A},
+    {0x0058, 0x0308, 0x1E8C},
+    {0x0059, 0x0300, 0x1EF2},
+    {0x0059, 0x0301, 0x00DD},
+    {0x0059, 0x0302, 0x0176},
+    {0x0059, 0x0303, 0x1EF8},
+    {0x0059, 0x0304, 0x0232},
+    {0x0059, 0x0307, 0x1E8E},
+    {0x0059, 0x0308, 0x0178},
+    {0x0059, 0x0309, 0x1EF6},
+    {0x0059, 0x0323, 0x1EF4},
+    {0x005A, 0x0301, 0x0179},
+    {0x005A, 0x0302, 0x1E90},
+    {0x005A, 0x0307, 0x017B},
+    {0x005A, 0x030C, 0x017D},
+    {0x005A, 0x0323, 0x1E92},
+    {0x005A, 0x0331, 0x1E94},
+    {0x0061, 0x0300, 0x00E0},
+    {0x0061, 0x0301, 0x00E1},
+    {0x0061, 0x0302, 0x00E2},
+    {0x0061, 0x0303, 0x00E3},
+    {0x0061, 0x0304, 0x0101},
+    {0x0061, 0x0306, 0x0103},
+    {0x0061, 0x0307, 0x0227},
+    {0x0061, 0x0308, 0x00E4},
+    {0x0061, 0x0309, 0x1EA3},
+    {0x0061, 0x030A, 0x00E5},
+    {0x0061, 0x030C, 0x01CE},
+    {0x0061, 0x030F, 0x0201},
+    {0x0061, 0x0311, 0x0203},
+    {0x0061, 0x0323, 0x1EA1},
+    {0x0061, 0x0325, 0x1E01},
+    {0x0061, 0x0328, 0x0105},
+    {0x0062, 0x0307, 0x1E03},
+    {0x0062, 0x0323, 0x1E05},
+    {0x0062, 0x0331, 0x1E07},
+    {0x0063, 0x0301, 0x0107},
+    {0x0063, 0x0302, 0x0109},
+    {0x0063, 0x0307, 0x010B},
+    {0x0063, 0x030C, 0x010D},
+    {0x0063, 0x0327, 0x00E7},
+    {0x0064, 0x0307, 0x1E0B},
+    {0x0064, 0x030C, 0x010F},
+    {0x0064, 0x0323, 0x1E0D},
+    {0x0064, 0x0327, 0x1E11},
+    {0x0064, 0x032D, 0x1E13},
+    {0x0064, 0x0331, 0x1E0F},
+    {0x0065, 0x0300, 0x00E8},
+    {0x0065, 0x0301, 0x00E9},
+    {0x0065, 0x0302, 0x00EA},
+    {0x0065, 0x0303, 0x1EBD},
+    {0x0065, 0x0304, 0x0113},
+    {0x0065, 0x0306, 0x0115},
+    {0x0065, 0x0307, 0x0117},
+    {0x0065, 0x0308, 0x00EB},
+    {0x0065, 0x0309, 0x1EBB},
+    {0x0065, 0x030C, 0x011B},
+    {0x0065, 0x030F, 0x0205},
+    {0x0065, 0x0311, 0x0207},
+    {0x0065, 0x0323, 0x1EB9},
+    {0x0065, 0x0327, 0x0229},
+    {0x0065, 0x0328, 0x0119},
+    {0x0065, 0x032D, 0x1E19},
+    {0x0065, 0x0330, 0x1E1B},
+    {0x0066, 0x0307, 0x1E1F},
+    {0x0067, 0x0301, 0x01F5},
+    {0x0067, 0x0302, 0x011D},
+    {0x0067, 0x0304, 0x1E21},
+    {0x0067, 0x0306, 0x011F},
+    {0x0067, 0x0307, 0x0121},
+    {0x0067, 0x030C, 0x01E7},
+    {0x0067, 0x0327, 0x0123},
+    {0x0068, 0x0302, 0x0125},
+    {0x0068, 0x0307, 0x1E23},
+    {0x0068, 0x0308, 0x1E27},
+    {0x0068, 0x030C, 0x021F},
+    {0x0068, 0x0323, 0x1E25},
+    {0x0068, 0x0327, 0x1E29},
+    {0x0068, 0x032E, 0x1E2B},
+    {0x0068, 0x0331, 0x1E96},
+    {0x0069, 0x0300, 0x00EC},
+    {0x0069, 0x0301, 0x00ED},
+    {0x0069, 0x0302, 0x00EE},
+    {0x0069, 0x0303, 0x0129},
+    {0x0069, 0x0304, 0x012B},
+    {0x0069, 0x0306, 0x012D},
+    {0x0069, 0x0308, 0x00EF},
+    {0x0069, 0x0309, 0x1EC9},
+    {0x0069, 0x030C, 0x01D0},
+    {0x0069, 0x030F, 0x0209},
+    {0x0069, 0x0311, 0x020B},
+    {0x0069, 0x0323, 0x1ECB},
+    {0x0069, 0x0328, 0x012F},
+    {0x0069, 0x0330, 0x1E2D},
+    {0x006A, 0x0302, 0x0135},
+    {0x006A, 0x030C, 0x01F0},
+    {0x006B, 0x0301, 0x1E31},
+    {0x006B, 0x030C, 0x01E9},
+    {0x006B, 0x0323, 0x1E33},
+    {0x006B, 0x0327, 0x0137},
+    {0x006B, 0x0331, 0x1E35},
+    {0x006C, 0x0301, 0x013A},
+    {0x006C, 0x030C, 0x013E},
+    {0x006C, 0x0323, 0x1E37},
+    {0x006C, 0x0327, 0x013C},
+    {0x006C, 0x032D, 0x1E3D},
+    {0x006C, 0x0331, 0x1E3B},
+    {0x006D, 0x0301, 0x1E3F},
+    {0x006D, 0x0307, 0x1E41},
+    {0x006D, 0x0323, 0x1E43},
+    {0x006E, 0x0300, 0x01F9},
+    {0x006E, 0x0301, 0x0144},
+    {0x006E, 0x0303, 0x00F1},
+    {0x006E, 0x0307, 0x1E45},
+    {0x006E, 0x030C, 0x0148},
+    {0x006E, 0x0323, 0x1E47},
+    {0x006E, 0x0327, 0x0146},
+    {0x006E, 0x032D, 0x1E4B},
+    {0x006E, 0x0331, 0x1E49},
+    {0x006F, 0x0300, 0x00F2},
+    {0x006F, 0x0301, 0x00F3},
+    {0x006F, 0x0302, 0x00F4},
+    {0x006F, 0x0303, 0x00F5},
+    {0x006F, 0x0304, 0x014D},
+    {0x006F, 0x0306, 0x014F},
+    {0x006F, 0x0307, 0x022F},
+    {0x006F, 0x0308, 0x00F6},
+    {0x006F, 0x0309, 0x1ECF},
+    {0x006F, 0x030B, 0x0151},
+    {0x006F, 0x030C, 0x01D2},
+    {0x006F, 0x030F, 0x020D},
+    {0x006F, 0x0311, 0x020F},
+    {0x006F, 0x031B, 0x01A1},
+    {0x006F, 0x0323, 0x1ECD},
+    {0x006F, 0x0328, 0x01EB},
+    {0x0070, 0x0301, 0x1E55},
+    {0x0070, 0x0307, 0x1E57},
+    {0x0072, 0x0301, 0x0155},
+    {0x0072, 0x0307, 0x1E59},
+    {0x0072, 0x030C, 0x0159},
+    {0x0072, 0x030F, 0x0211},
+    {0x0072, 0x0311, 0x0213},
+    {0x0072, 0x0323, 0x1E5B},
+    {0x0072, 0x0327, 0x0157},
+    {0x0072, 0x0331, 0x1E5F},
+    {0x0073, 0x0301, 0x015B},
+    {0x0073, 0x0302, 0x015D},
+    {0x0073, 0x0307, 0x1E61},
+    {0x0073, 0x030C, 0x0161},
+    {0x0073, 0x0323, 0x1E63},
+    {0x0073, 0x0326, 0x0219},
+    {0x0073, 0x0327, 0x015F},
+    {0x0074, 0x0307, 0x1E6B},
+    {0x0074, 0x0308, 0x1E97},
+    {0x0074, 0x030C, 0x0165},
+    {0x0074, 0x0323, 0x1E6D},
+    {0x0074, 0x0326, 0x021B},
+    {0x0074, 0x0327, 0x0163},
+    {0x0074, 0x032D, 0x1E71},
+    {0x0074, 0x0331, 0x1E6F},
+    {0x0075, 0x0300, 0x00F9},
+    {0x0075, 0x0301, 0x00FA},
+    {0x0075, 0x0302, 0x00FB},
+    {0x0075, 0x0303, 0x0169},
+    {0x0075, 0x0304, 0x016B},
+    {0x0075, 0x0306, 0x016D},
+    {0x0075, 0x0308, 0x00FC},
+    {0x0075, 0x0309, 0x1EE7},
+    {0x0075, 0x030A, 0x016F},
+    {0x0075, 0x030B, 0x0171},
+    {0x0075, 0x030C, 0x01D4},
+    {0x0075, 0x030F, 0x0215},
+    {0x0075, 0x0311, 0x0217},
+    {0x0075, 0x031B, 0x01B0},
+    {0x0075, 0x0323, 0x1EE5},
+    {0x0075, 0x0324, 0x1E73},
+    {0x0075, 0x0328, 0x0173},
+    {0x0075, 0x032D, 0x1E77},
+    {0x0075, 0x0330, 0x1E75},
+    {0x0076, 0x0303, 0x1E7D},
+    {0x0076, 0x0323, 0x1E7F},
+    {0x0077, 0x0300, 0x1E81},
+    {0x0077, 0x0301, 0x1E83},
+    {0x0077, 0x0302, 0x0175},
+    {0x0077, 0x0307, 0x1E87},
+    {0x0077, 0x0308, 0x1E85},
+    {0x0077, 0x030A, 0x1E98},
+    {0x0077, 0x0323, 0x1E89},
+    {0x0078, 0x0307, 0x1E8B},
+    {0x0078, 0x0308, 0x1E8D},
+    {0x0079, 0x0300, 0x1EF3},
+    {0x0079, 0x0301, 0x00FD},
+    {0x0079, 0x0302, 0x0177},
+    {0x0079, 0x0303, 0x1EF9},
+    {0x0079, 0x0304, 0x0233},
+    {0x0079, 0x0307, 0x1E8F},
+    {0x0079, 0x0308, 0x00FF},
+    {0x0079, 0x0309, 0x1EF7},
+    {0x0079, 0x030A, 0x1E99},
+    {0x0079, 0x0323, 0x1EF5},
+    {0x007A, 0x0301, 0x017A},
+    {0x007A, 0x0302, 0x1E91},
+    {0x007A, 0x0307, 0x017C},
+    {0x007A, 0x030C, 0x017E},
+    {0x007A, 0x0323, 0x1E93},
+    {0x007A, 0x0331, 0x1E95},
+    {0x00A8, 0x0300, 0x1FED},
+    {0x00A8, 0x0301, 0x0385},
+    {0x00A8, 0x0342, 0x1FC1},
+    {0x00C2, 0x0300, 0x1EA6},
+    {0x00C2, 0x0301, 0x1EA4},
+    {0x00C2, 0x0303, 0x1EAA},
+    {0x00C2, 0x0309, 0x1EA8},
+    {0x00C4, 0x0304, 0x01DE},
+    {0x00C5, 0x0301, 0x01FA},
+    {0x00C6, 0x0301, 0x01FC},
+    {0x00C6, 0x0304, 0x01E2},
+    {0x00C7, 0x0301, 0x1E08},
+    {0x00CA, 0x0300, 0x1EC0},
+    {0x00CA, 0x0301, 0x1EBE},
+    {0x00CA, 0x0303, 0x1EC4},
+    {0x00CA, 0x0309, 0x1EC2},
+    {0x00CF, 0x0301, 0x1E2E},
+    {0x00D4, 0x0300, 0x1ED2},
+    {0x00D4, 0x0301, 0x1ED0},
+    {0x00D4, 0x0303, 0x1ED6},
+    {0x00D4, 0x0309, 0x1ED4},
+    {0x00D5, 0x0301, 0x1E4C},
+    {0x00D5, 0x0304, 0x022C},
+    {0x00D5, 0x0308, 0x1E4E},
+    {0x00D6, 0x0304, 0x022A},
+    {0x00D8, 0x0301, 0x01FE},
+    {0x00DC, 0x0300, 0x01DB},
+    {0x00DC, 0x0301, 0x01D7},
+    {0x00DC, 0x0304, 0x01D5},
+    {0x00DC, 0x030C, 0x01D9},
+    {0x00E2, 0x0300, 0x1EA7},
+    {0x00E2, 0x0301, 0x1EA5},
+    {0x00E2, 0x0303, 0x1EAB},
+    {0x00E2, 0x0309, 0x1EA9},
+    {0x00E4, 0x0304, 0x01DF},
+    {0x00E5, 0x0301, 0x01FB},
+    {0x00E6, 0x0301, 0x01FD},
+    {0x00E6, 0x0304, 0x01E3},
+    {0x00E7, 0x0301, 0x1E09},
+    {0x00EA, 0x0300, 0x1EC1},
+    {0x00EA, 0x0301, 0x1EBF},
+    {0x00EA, 0x0303, 0x1EC5},
+    {0x00EA, 0x0309, 0x1EC3},
+    {0x00EF, 0x0301, 0x1E2F},
+    {0x00F4, 0x0300, 0x1ED3},
+    {0x00F4, 0x0301, 0x1ED1},
+    {0x00F4, 0x0303, 0x1ED7},
+    {0x00F4, 0x0309, 0x1ED5},
+    {0x00F5, 0x0301, 0x1E4D},
+    {0x00F5, 0x0304, 0x022D},
+    {0x00F5, 0x0308, 0x1E4F},
+    {0x00F6, 0x0304, 0x022B},
+    {0x00F8, 0x0301, 0x01FF},
+    {0x00FC, 0x0300, 0x01DC},
+    {0x00FC, 0x0301, 0x01D8},
+    {0x00FC, 0x0304, 0x01D6},
+    {0x00FC, 0x030C, 0x01DA},
+    {0x0102, 0x0300, 0x1EB0},
+    {0x0102, 0x0301, 0x1EAE},
+    {0x0102, 0x0303, 0x1EB4},
+    {0x0102, 0x0309, 0x1EB2},
+    {0x0103, 0x0300, 0x1EB1},
+    {0x0103, 0x0301, 0x1EAF},
+    {0x0103, 0x0303, 0x1EB5},
+    {0x0103, 0x0309, 0x1EB3},
+    {0x0112, 0x0300, 0x1E14},
+    {0x0112, 0x0301, 0x1E16},
+    {0x0113, 0x0300, 0x1E15},
+    {0x0113, 0x0301, 0x1E17},
+    {0x014C, 0x0300, 0x1E50},
+    {0x014C, 0x0301, 0x1E52},
+    {0x014D, 0x0300, 0x1E51},
+    {0x014D, 0x0301, 0x1E53},
+    {0x015A, 0x0307, 0x1E64},
+    {0x015B, 0x0307, 0x1E65},
+    {0x0160, 0x0307, 0x1E66},
+    {0x0161, 0x0307, 0x1E67},
+    {0x0168, 0x0301, 0x1E78},
+    {0x0169, 0x0301, 0x1E79},
+    {0x016A, 0x0308, 0x1E7A},
+    {0x016B, 0x0308, 0x1E7B},
+    {0x017F, 0x0307, 0x1E9B},
+    {0x01A0, 0x0300, 0x1EDC},
+    {0x01A0, 0x0301, 0x1EDA},
+    {0x01A0, 0x0303, 0x1EE0},
+    {0x01A0, 0x0309, 0x1EDE},
+    {0x01A0, 0x0323, 0x1EE2},
+    {0x01A1, 0x0300, 0x1EDD},
+    {0x01A1, 0x0301, 0x1EDB},
+    {0x01A1, 0x0303, 0x1EE1},
+    {0x01A1, 0x0309, 0x1EDF},
+    {0x01A1, 0x0323, 0x1EE3},
+    {0x01AF, 0x0300, 0x1EEA},
+    {0x01AF, 0x0301, 0x1EE8},
+    {0x01AF, 0x0303, 0x1EEE},
+    {0x01AF, 0x0309, 0x1EEC},
+    {0x01AF, 0x0323, 0x1EF0},
+    {0x01B0, 0x0300, 0x1EEB},
+    {0x01B0, 0x0301, 0x1EE9},
+    {0x01B0, 0x0303, 0x1EEF},
+    {0x01B0, 0x0309, 0x1EED},
+    {0x01B0, 0x0323, 0x1EF1},
+    {0x01B7, 0x030C, 0x01EE},
+    {0x01EA, 0x0304, 0x01EC},
+    {0x01EB, 0x0304, 0x01ED},
+    {0x0226, 0x0304, 0x01E0},
+    {0x0227, 0x0304, 0x01E1},
+    {0x0228, 0x0306, 0x1E1C},
+    {0x0229, 0x0306, 0x1E1D},
+    {0x022E, 0x0304, 0x0230},
+    {0x022F, 0x0304, 0x0231},
+    {0x0292, 0x030C, 0x01EF},
+    {0x0391, 0x0300, 0x1FBA},
+    {0x0391, 0x0301, 0x0386},
+    {0x0391, 0x0304, 0x1FB9},
+    {0x0391, 0x0306, 0x1FB8},
+    {0x0391, 0x0313, 0x1F08},
+    {0x0391, 0x0314, 0x1F09},
+    {0x0391, 0x0345, 0x1FBC},
+    {0x0395, 0x0300, 0x1FC8},
+    {0x0395, 0x0301, 0x0388},
+    {0x0395, 0x0313, 0x1F18},
+    {0x0395, 0x0314, 0x1F19},
+    {0x0397, 0x0300, 0x1FCA},
+    {0x0397, 0x0301, 0x0389},
+    {0x0397, 0x0313, 0x1F28},
+    {0x0397, 0x0314, 0x1F29},
+    {0x0397, 0x0345, 0x1FCC},
+    {0x0399, 0x0300, 0x1FDA},
+    {0x0399, 0x0301, 0x038A},
+    {0x0399, 0x0304, 0x1FD9},
+    {0x0399, 0x0306, 0x1FD8},
+    {0x0399, 0x0308, 0x03AA},
+    {0x0399, 0x0313, 0x1F38},
+    {0x0399, 0x0314, 0x1F39},
+    {0x039F, 0x0300, 0x1FF8},
+    {0x039F, 0x0301, 0x038C},
+    {0x039F, 0x0313, 0x1F48},
+    {0x039F, 0x0314, 0x1F49},
+    {0x03A1, 0x0314, 0x1FEC},
+    {0x03A5, 0x0300, 0x1FEA},
+    {0x03A5, 0x0301, 0x038E},
+    {0x03A5, 0x0304, 0x1FE9},
+    {0x03A5, 0x0306, 0x1FE8},
+    {0x03A5, 0x0308, 0x03AB},
+    {0x03A5, 0x0314, 0x1F59},
+    {0x03A9, 0x0300, 0x1FFA},
+    {0x03A9, 0x0301, 0x038F},
+    {0x03A9, 0x0313, 0x1F68},
+    {0x03A9, 0x0314, 0x1F69},
+    {0x03A9, 0x0345, 0x1FFC},
+    {0x03AC, 0x0345, 0x1FB4},
+    {0x03AE, 0x0345, 0x1FC4},
+    {0x03B1, 0x0300, 0x1F70},
+    {0x03B1, 0x0301, 0x03AC},
+    {0x03B1, 0x0304, 0x1FB1},
+    {0x03B1, 0x0306, 0x1FB0},
+    {0x03B1, 0x0313, 0x1F00},
+    {0x03B1, 0x0314, 0x1F01},
+    {0x03B1, 0x0342, 0x1FB6},
+    {0x03B1, 0x0345, 0x1FB3},
+    {0x03B5, 0x0300, 0x1F72},
+    {0x03B5, 0x0301, 0x03AD},
+    {0x03B5, 0x0313, 0x1F10},
+    {0x03B5, 0x0314, 0x1F11},
+    {0x03B7, 0x0300, 0x1F74},
+    {0x03B7, 0x0301, 0x03AE},
+    {0x03B7, 0x0313, 0x1F20},
+    {0x03B7, 0x0314, 0x1F21},
+    {0x03B7, 0x0342, 0x1FC6},
+    {0x03B7, 0x0345, 0x1FC3},
+    {0x03B9, 0x0300, 0x1F76},
+    {0x03B9, 0x0301, 0x03AF},
+    {0x03B9, 0x0304, 0x1FD1},
+    {0x03B9, 0x0306, 0x1FD0},
+    {0x03B9, 0x0308, 0x03CA},
+    {0x03B9, 0x0313, 0x1F30},
+    {0x03B9, 0x0314, 0x1F31},
+    {0x03B9, 0x0342, 0x1FD6},
+    {0x03BF, 0x0300, 0x1F78},
+    {0x03BF, 0x0301, 0x03CC},
+    {0x03BF, 0x0313, 0x1F40},
+    {0x03BF, 0x0314, 0x1F41},
+    {0x03C1, 0x0313, 0x1FE4},
+    {0x03C1, 0x0314, 0x1FE5},
+    {0x03C5, 0x0300, 0x1F7A},
+    {0x03C5, 0x0301, 0x03CD},
+    {0x03C5, 0x0304, 0x1FE1},
+    {0x03C5, 0x0306, 0x1FE0},
+    {0x03C5, 0x0308, 0x03CB},
+    {0x03C5, 0x0313, 0x1F50},
+    {0x03C5, 0x0314, 0x1F51},
+    {0x03C5, 0x0342, 0x1FE6},
+    {0x03C9, 0x0300, 0x1F7C},
+    {0x03C9, 0x0301, 0x03CE},
+    {0x03C9, 0x0313, 0x1F60},
+    {0x03C9, 0x0314, 0x1F61},
+    {0x03C9, 0x0342, 0x1FF6},
+    {0x03C9, 0x0345, 0x1FF3},
+    {0x03CA, 0x0300, 0x1FD2},
+    {0x03CA, 0x0301, 0x0390},
+    {0x03CA, 0x0342, 0x1FD7},
+    {0x03CB, 0x0300, 0x1FE2},
+    {0x03CB, 0x0301, 0x03B0},
+    {0x03CB, 0x0342, 0x1FE7},
+    {0x03CE, 0x0345, 0x1FF4},
+    {0x03D2, 0x0301, 0x03D3},
+    {0x03D2, 0x0308, 0x03D4},
+    {0x0406, 0x0308, 0x0407},
+    {0x0410, 0x0306, 0x04D0},
+    {0x0410, 0x0308, 0x04D2},
+    {0x0413, 0x0301, 0x0403},
+    {0x0415, 0x0300, 0x0400},
+    {0x0415, 0x0306, 0x04D6},
+    {0x0415, 0x0308, 0x0401},
+    {0x0416, 0x0306, 0x04C1},
+    {0x0416, 0x0308, 0x04DC},
+    {0x0417, 0x0308, 0x04DE},
+    {0x0418, 0x0300, 0x040D},
+    {0x0418, 0x0304, 0x04E2},
+    {0x0418, 0x0306, 0x0419},
+    {0x0418, 0x0308, 0x04E4},
+    {0x041A, 0x0301, 0x040C},
+    {0x041E, 0x0308, 0x04E6},
+    {0x0423, 0x0304, 0x04EE},
+    {0x0423, 0x0306, 0x040E},
+    {0x0423, 0x0308, 0x04F0},
+    {0x0423, 0x030B, 0x04F2},
+    {0x0427, 0x0308, 0x04F4},
+    {0x042B, 0x0308, 0x04F8},
+    {0x042D, 0x0308, 0x04EC},
+    {0x0430, 0x0306, 0x04D1},
+    {0x0430, 0x0308, 0x04D3},
+    {0x0433, 0x0301, 0x0453},
+    {0x0435, 0x0300, 0x0450},
+    {0x0435, 0x0306, 0x04D7},
+    {0x0435, 0x0308, 0x0451},
+    {0x0436, 0x0306, 0x04C2},
+    {0x0436, 0x0308, 0x04DD},
+    {0x0437, 0x0308, 0x04DF},
+    {0x0438, 0x0300, 0x045D},
+    {0x0438, 0x0304, 0x04E3},
+    {0x0438, 0x0306, 0x0439},
+    {0x0438, 0x0308, 0x04E5},
+    {0x043A, 0x0301, 0x045C},
+    {0x043E, 0x0308, 0x04E7},
+    {0x0443, 0x0304, 0x04EF},
+    {0x0443, 0x0306, 0x045E},
+    {0x0443, 0x0308, 0x04F1},
+    {0x0443, 0x030B, 0x04F3},
+    {0x0447, 0x0308, 0x04F5},
+    {0x044B, 0x0308, 0x04F9},
+    {0x044D, 0x0308, 0x04ED},
+    {0x0456, 0x0308, 0x0457},
+    {0x0474, 0x030F, 0x0476},
+    {0x0475, 0x030F, 0x0477},
+    {0x04D8, 0x0308, 0x04DA},
+    {0x04D9, 0x0308, 0x04DB},
+    {0x04E8, 0x0308, 0x04EA},
+    {0x04E9, 0x0308, 0x04EB},
+    {0x0627, 0x0653, 0x0622},
+    {0x0627, 0x0654, 0x0623},
+    {0x0627, 0x0655, 0x0625},
+    {0x0648, 0x0654, 0x0624},
+    {0x064A, 0x0654, 0x0626},
+    {0x06C1, 0x0654, 0x06C2},
+    {0x06D2, 0x0654, 0x06D3},
+    {0x06D5, 0x0654, 0x06C0},
+    {0x0928, 0x093C, 0x0929},
+    {0x0930, 0x093C, 0x0931},
+    {0x0933, 0x093C, 0x0934},
+    {0x09C7, 0x09BE, 0x09CB},
+    {0x09C7, 0x09D7, 0x09CC},
+    {0x0B47, 0x0B3E, 0x0B4B},
+    {0x0B47, 0x0B56, 0x0B48},
+    {0x0B47, 0x0B57, 0x0B4C},
+    {0x0B92, 0x0BD7, 0x0B94},
+    {0x0BC6, 0x0BBE, 0x0BCA},
+    {0x0BC6, 0x0BD7, 0x0BCC},
+    {0x0BC7, 0x0BBE, 0x0BCB},
+    {0x0C46, 0x0C56, 0x0C48},
+    {0x0CBF, 0x0CD5, 0x0CC0},
+    {0x0CC6, 0x0CC2, 0x0CCA},
+    {0x0CC6, 0x0CD5, 0x0CC7},
+    {0x0CC6, 0x0CD6, 0x0CC8},
+    {0x0CCA, 0x0CD5, 0x0CCB},
+    {0x0D46, 0x0D3E, 0x0D4A},
+    {0x0D46, 0x0D57, 0x0D4C},
+    {0x0D47, 0x0D3E, 0x0D4B},
+    {0x0DD9, 0x0DCA, 0x0DDA},
+    {0x0DD9, 0x0DCF, 0x0DDC},
+    {0x0DD9, 0x0DDF, 0x0DDE},
+    {0x0DDC, 0x0DCA, 0x0DDD},
+    {0x1025, 0x102E, 0x1026},
+    {0x1B05, 0x1B35, 0x1B06},
+    {0x1B07, 0x1B35, 0x1B08},
+    {0x1B09, 0x1B35, 0x1B0A},
+    {0x1B0B, 0x1B35, 0x1B0C},
+    {0x1B0D, 0x1B35, 0x1B0E},
+    {0x1B11, 0x1B35, 0x1B12},
+    {0x1B3A, 0x1B35, 0x1B3B},
+    {0x1B3C, 0x1B35, 0x1B3D},
+    {0x1B3E, 0x1B35, 0x1B40},
+    {0x1B3F, 0x1B35, 0x1B41},
+    {0x1B42, 0x1B35, 0x1B43},
+    {0x1E36, 0x0304, 0x1E38},
+    {0x1E37, 0x0304, 0x1E39},
+    {0x1E5A, 0x0304, 0x1E5C},
+    {0x1E5B, 0x0304, 0x1E5D},
+    {0x1E62, 0x0307, 0x1E68},
+    {0x1E63, 0x0307, 0x1E69},
+    {0x1EA0, 0x0302, 0x1EAC},
+    {0x1EA0, 0x0306, 0x1EB6},
+    {0x1EA1, 0x0302, 0x1EAD},
+    {0x1EA1, 0x0306, 0x1EB7},
+    {0x1EB8, 0x0302, 0x1EC6},
+    {0x1EB9, 0x0302, 0x1EC7},
+    {0x1ECC, 0x0302, 0x1ED8},
+    {0x1ECD, 0x0302, 0x1ED9},
+    {0x1F00, 0x0300, 0x1F02},
+    {0x1F00, 0x0301, 0x1F04},
+    {0x1F00, 0x0342, 0x1F06},
+    {0x1F00, 0x0345, 0x1F80},
+    {0x1F01, 0x0300, 0x1F03},
+    {0x1F01, 0x0301, 0x1F05},
+    {0x1F01, 0x0342, 0x1F07},
+    {0x1F01, 0x0345, 0x1F81},
+    {0x1F02, 0x0345, 0x1F82},
+    {0x1F03, 0x0345, 0x1F83},
+    {0x1F04, 0x0345, 0x1F84},
+    {0x1F05, 0x0345, 0x1F85},
+    {0x1F06, 0x0345, 0x1F86},
+    {0x1F07, 0x0345, 0x1F87},
+    {0x1F08, 0x0300, 0x1F0A},
+    {0x1F08, 0x0301, 0x1F0C},
+    {0x1F08, 0x0342, 0x1F0E},
+    {0x1F08, 0x0345, 0x1F88},
+    {0x1F09, 0x0300, 0x1F0B},
+    {0x1F09, 0x0301, 0x1F0D},
+    {0x1F09, 0x0342, 0x1F0F},
+    {0x1F09, 0x0345, 0x1F89},
+    {0x1F0A, 0x0345, 0x1F8A},
+    {0x1F0B, 0x0345, 0x1F8B},
+    {0x1F0C, 0x0345, 0x1F8C},
+    {0x1F0D, 0x0345, 0x1F8D},
+    {0x1F0E, 0x0345, 0x1F8E},
+    {0x1F0F, 0x0345, 0x1F8F},
+    {0x1F10, 0x0300, 0x1F12},
+    {0x1F10, 0x0301, 0x1F14},
+    {0x1F11, 0x0300, 0x1F13},
+    {0x1F11, 0x0301, 0x1F15},
+    {0x1F18, 0x0300, 0x1F1A},
+    {0x1F18, 0x0301, 0x1F1C},
+    {0x1F19, 0x0300, 0x1F1B},
+    {0x1F19, 0x0301, 0x1F1D},
+    {0x1F20, 0x0300, 0x1F22},
+    {0x1F20, 0x0301, 0x1F24},
+    {0x1F20, 0x0342, 0x1F26},
+    {0x1F20, 0x0345, 0x1F90},
+    {0x1F21, 0x0300, 0x1F23},
+    {0x1F21, 0x0301, 0x1F25},
+    {0x1F21, 0x0342, 0x1F27},
+    {0x1F21, 0x0345, 0x1F91},
+    {0x1F22, 0x0345, 0x1F92},
+    {0x1F23, 0x0345, 0x1F93},
+    {0x1F24, 0x0345, 0x1F94},
+    {0x1F25, 0x0345, 0x1F95},
+    {0x1F26, 0x0345, 0x1F96},
+    {0x1F27, 0x0345, 0x1F97},
+    {0x1F28, 0x0300, 0x1F2A},
+    {0x1F28, 0x0301, 0x1F2C},
+    {0x1F28, 0x0342, 0x1F2E},
+    {0x1F28, 0x0345, 0x1F98},
+    {0x1F29, 0x0300, 0x1F2B},
+    {0x1F29, 0x0301, 0x1F2D},
+    {0x1F29, 0x0342, 0x1F2F},
+    {0x1F29, 0x0345, 0x1F99},
+    {0x1F2A, 0x0345, 0x1F9A},
+    {0x1F2B, 0x0345, 0x1F9B},
+    {0x1F2C, 0x0345, 0x1F9C},
+    {0x1F2D, 0x0345, 0x1F9D},
+    {0x1F2E, 0x0345, 0x1F9E},
+    {0x1F2F, 0x0345, 0x1F9F},
+    {0x1F30, 0x0300, 0x1F32},
+    {0x1F30, 0x0301, 0x1F34},
+    {0x1F30, 0x0342, 0x1F36},
+    {0x1F31, 0x0300, 0x1F33},
+    {0x1F31, 0x0301, 0x1F35},
+    {0x1F31, 0x0342, 0x1F37},
+    {0x1F38, 0x0300, 0x1F3A},
+    {0x1F38, 0x0301, 0x1F3C},
+    {0x1F38, 0x0342, 0x1F3E},
+    {0x1F39, 0x0300, 0x1F3B},
+    {0x1F39, 0x0301, 0x1F3D},
+    {0x1F39, 0x0342, 0x1F3F},
+    {0x1F40, 0x0300, 0x1F42},
+    {0x1F40, 0x0301, 0x1F44},
+    {0x1F41, 0x0300, 0x1F43},
+    {0x1F41, 0x0301, 0x1F45},
+    {0x1F48, 0x0300, 0x1F4A},
+    {0x1F48, 0x0301, 0x1F4C},
+    {0x1F49, 0x0300, 0x1F4B},
+    {0x1F49, 0x0301, 0x1F4D},
+    {0x1F50, 0x0300, 0x1F52},
+    {0x1F50, 0x0301, 0x1F54},
+    {0x1F50, 0x0342, 0x1F56},
+    {0x1F51, 0x0300, 0x1F53},
+    {0x1F51, 0x0301, 0x1F55},
+    {0x1F51, 0x0342, 0x1F57},
+    {0x1F59, 0x0300, 0x1F5B},
+    {0x1F59, 0x0301, 0x1F5D},
+    {0x1F59, 0x0342, 0x1F5F},
+    {0x1F60, 0x0300, 0x1F62},
+    {0x1F60, 0x0301, 0x1F64},
+    {0x1F60, 0x0342, 0x1F66},
+    {0x1F60, 0x0345, 0x1FA0},
+    {0x1F61, 0x0300, 0x1F63},
+    {0x1F61, 0x0301, 0x1F65},
+    {0x1F61, 0x0342, 0x1F67},
+    {0x1F61, 0x0345, 0x1FA1},
+    {0x1F62, 0x0345, 0x1FA2},
+    {0x1F63, 0x0345, 0x1FA3},
+    {0x1F64, 0x0345, 0x1FA4},
+    {0x1F65, 0x0345, 0x1FA5},
+    {0x1F66, 0x0345, 0x1FA6},
+    {0x1F67, 0x0345, 0x1FA7},
+    {0x1F68, 0x0300, 0x1F6A},
+    {0x1F68, 0x0301, 0x1F6C},
+    {0x1F68, 0x0342, 0x1F6E},
+    {0x1F68, 0x0345, 0x1FA8},
+    {0x1F69, 0x0300, 0x1F6B},
+    {0x1F69, 0x0301, 0x1F6D},
+    {0x1F69, 0x0342, 0x1F6F},
+    {0x1F69, 0x0345, 0x1FA9},
+    {0x1F6A, 0x0345, 0x1FAA},
+    {0x1F6B, 0x0345, 0x1FAB},
+    {0x1F6C, 0x0345, 0x1FAC},
+    {0x1F6D, 0x0345, 0x1FAD},
+    {0x1F6E, 0x0345, 0x1FAE},
+    {0x1F6F, 0x0345, 0x1FAF},
+    {0x1F70, 0x0345, 0x1FB2},
+    {0x1F74, 0x0345, 0x1FC2},
+    {0x1F7C, 0x0345, 0x1FF2},
+    {0x1FB6, 0x0345, 0x1FB7},
+    {0x1FBF, 0x0300, 0x1FCD},
+    {0x1FBF, 0x0301, 0x1FCE},
+    {0x1FBF, 0x0342, 0x1FCF},
+    {0x1FC6, 0x0345, 0x1FC7},
+    {0x1FF6, 0x0345, 0x1FF7},
+    {0x1FFE, 0x0300, 0x1FDD},
+    {0x1FFE, 0x0301, 0x1FDE},
+    {0x1FFE, 0x0342, 0x1FDF},
+    {0x2190, 0x0338, 0x219A},
+    {0x2192, 0x0338, 0x219B},
+    {0x2194, 0x0338, 0x21AE},
+    {0x21D0, 0x0338, 0x21CD},
+    {0x21D2, 0x0338, 0x21CF},
+    {0x21D4, 0x0338, 0x21CE},
+    {0x2203, 0x0338, 0x2204},
+    {0x2208, 0x0338, 0x2209},
+    {0x220B, 0x0338, 0x220C},
+    {0x2223, 0x0338, 0x2224},
+    {0x2225, 0x0338, 0x2226},
+    {0x223C, 0x0338, 0x2241},
+    {0x2243, 0x0338, 0x2244},
+    {0x2245, 0x0338, 0x2247},
+    {0x2248, 0x0338, 0x2249},
+    {0x224D, 0x0338, 0x226D},
+    {0x2261, 0x0338, 0x2262},
+    {0x2264, 0x0338, 0x2270},
+    {0x2265, 0x0338, 0x2271},
+    {0x2272, 0x0338, 0x2274},
+    {0x2273, 0x0338, 0x2275},
+    {0x2276, 0x0338, 0x2278},
+    {0x2277, 0x0338, 0x2279},
+    {0x227A, 0x0338, 0x2280},
+    {0x227B, 0x0338, 0x2281},
+    {0x227C, 0x0338, 0x22E0},
+    {0x227D, 0x0338, 0x22E1},
+    {0x2282, 0x0338, 0x2284},
+    {0x2283, 0x0338, 0x2285},
+    {0x2286, 0x0338, 0x2288},
+    {0x2287, 0x0338, 0x2289},
+    {0x2291, 0x0338, 0x22E2},
+    {0x2292, 0x0338, 0x22E3},
+    {0x22A2, 0x0338, 0x22AC},
+    {0x22A8, 0x0338, 0x22AD},
+    {0x22A9, 0x0338, 0x22AE},
+    {0x22AB, 0x0338, 0x22AF},
+    {0x22B2, 0x0338, 0x22EA},
+    {0x22B3, 0x0338, 0x22EB},
+    {0x22B4, 0x0338, 0x22EC},
+    {0x22B5, 0x0338, 0x22ED},
+    {0x3046, 0x3099, 0x3094},
+    {0x304B, 0x3099, 0x304C},
+    {0x304D, 0x3099, 0x304E},
+    {0x304F, 0x3099, 0x3050},
+    {0x3051, 0x3099, 0x3052},
+    {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056},
+    {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305A},
+    {0x305B, 0x3099, 0x305C},
+    {0x305D, 0x3099, 0x305E},
+    {0x305F, 0x3099, 0x3060},
+    {0x3061, 0x3099, 0x3062},
+    {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067},
+    {0x3068, 0x3099, 0x3069},
+    {0x306F, 0x3099, 0x3070},
+    {0x306F, 0x309A, 0x3071},
+    {0x3072, 0x3099, 0x3073},
+    {0x3072, 0x309A, 0x3074},
+    {0x3075, 0x3099, 0x3076},
+    {0x3075, 0x309A, 0x3077},
+    {0x3078, 0x3099, 0x3079},
+    {0x3078, 0x309A, 0x307A},
+    {0x307B, 0x3099, 0x307C},
+    {0x307B, 0x309A, 0x307D},
+    {0x309D, 0x3099, 0x309E},
+    {0x30A6, 0x3099, 0x30F4},
+    {0x30AB, 0x3099, 0x30AC},
+    {0x30AD, 0x3099, 0x30AE},
+    {0x30AF, 0x3099, 0x30B0},
+    {0x30B1, 0x3099, 0x30B2},
+    {0x30B3, 0x3099, 0x30B4},
+    {0x30B5, 0x3099, 0x30B6},
+    {0x30B7, 0x3099, 0x30B8},
+    {0x30B9, 0x3099, 0x30BA},
+    {0x30BB, 0x3099, 0x30BC},
+    {0x30BD, 0x3099, 0x30BE},
+    {0x30BF, 0x3099, 0x30C0},
+    {0x30C1, 0x3099, 0x30C2},
+    {0x30C4, 0x3099, 0x30C5},
+    {0x30C6, 0x3099, 0x30C7},
+    {0x30C8, 0x3099, 0x30C9},
+    {0x30CF, 0x3099, 0x30D0},
+    {0x30CF, 0x309A, 0x30D1},
+    {0x30D2, 0x3099, 0x30D3},
+    {0x30D2, 0x309A, 0x30D4},
+    {0x30D5, 0x3099, 0x30D6},
+    {0x30D5, 0x309A, 0x30D7},
+    {0x30D8, 0x3099, 0x30D9},
+    {0x30D8, 0x309A, 0x30DA},
+    {0x30DB, 0x3099, 0x30DC},
+    {0x30DB, 0x309A, 0x30DD},
+    {0x30EF, 0x3099, 0x30F7},
+    {0x30F0, 0x3099, 0x30F8},
+    {0x30F1, 0x3099, 0x30F9},
+    {0x30F2, 0x3099, 0x30FA},
+    {0x30FD, 0x3099, 0x30FE},
+    {0x105D2, 0x0307, 0x105C9},
+    {0x105DA, 0x0307, 0x105E4},
+    {0x11099, 0x110BA, 0x1109A},
+    {0x1109B, 0x110BA, 0x1109C},
+    {0x110A5, 0x110BA, 0x110AB},
+    {0x11131, 0x11127, 0x1112E},
+    {0x11132, 0x11127, 0x1112F},
+    {0x11347, 0x1133E, 0x1134B},
+    {0x11347, 0x11357, 0x1134C},
+    {0x11382, 0x113C9, 0x11383},
+    {0x11384, 0x113BB, 0x11385},
+    {0x1138B, 0x113C2, 0x1138E},
+    {0x11390, 0x113C9, 0x11391},
+    {0x113C2, 0x113B8, 0x113C7},
+    {0x113C2, 0x113C2, 0x113C5},
+    {0x113C2, 0x113C9, 0x113C8},
+    {0x114B9, 0x114B0, 0x114BC},
+    {0x114B9, 0x114BA, 0x114BB},
+    {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA},
+    {0x115B9, 0x115AF, 0x115BB},
+    {0x11935, 0x11930, 0x11938},
+    {0x1611E, 0x1611E, 0x16121},
+    {0x1611E, 0x1611F, 0x16123},
+    {0x1611E, 0x16120, 0x16125},
+    {0x1611E, 0x16129, 0x16122},
+    {0x16121, 0x1611F, 0x16126},
+    {0x16121, 0x16120, 0x16128},
+    {0x16122, 0x1611F, 0x16127},
+    {0x16129, 0x1611F, 0x16124},
+    {0x16D63, 0x16D67, 0x16D69},
+    {0x16D67, 0x16D67, 0x16D68},
+    {0x16D69, 0x16D67, 0x16D6A},
+};
+const size_t norm_compositions_size = 961;
+
+// 3049 block indices, 271 distinct blocks of 64
+const uint16_t norm_stage1[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 0, 0, 18, 19, 20, 21, 0, 22, 23, 24, 0, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 32, 38, 39, 40,
+    36, 41, 36, 42, 43, 44, 0, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 0, 55, 56, 0, 57, 58, 59, 0, 0, 0, 0, 0, 60, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 62,
+    0, 0, 63, 0, 64, 0, 0, 0, 65, 66, 67, 68, 69, 70, 71, 72,
+    73, 0, 0, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+    87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 0, 0, 0,
+    0, 100, 101, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 104, 0, 105, 0, 0, 0, 0,
+    0, 106, 0, 107, 0, 108, 0, 109, 0, 0, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 0, 123, 124, 125, 126, 127, 128, 129, 130,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 132, 133, 0, 134, 0, 135,
+    136, 0, 0, 137, 138, 139, 140, 141, 0, 0, 142, 143, 0, 144, 0, 145,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 147, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    0, 0, 0, 0, 0, 0, 0, 176, 0, 0, 0, 177, 0, 178, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 179, 0, 0, 0, 0, 0, 0, 180, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 181, 0, 0, 182, 0, 0, 0, 0,
+    0, 0, 0, 0, 183, 184, 0, 0, 0, 0, 185, 186, 0, 187, 188, 0,
+    0, 189, 190, 0, 191, 140, 0, 192, 193, 0, 0, 194, 195, 196, 197, 198,
+    0, 199, 200, 201, 0, 0, 202, 203, 204, 0, 205, 0, 206, 0, 0, 0,
+    207, 0, 0, 0, 208, 209, 0, 210, 211, 212, 213, 0, 0, 0, 0, 0,
+    204, 0, 0, 0, 0, 214, 215, 0, 0, 0, 0, 0, 0, 216, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 219, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 224, 225, 226, 0, 227, 0, 0, 0, 0, 0, 0,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    244, 245, 246, 0, 219, 0, 0, 0, 0, 0, 247, 248, 0, 0, 0, 0,
+    0, 0, 0, 249, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 251, 0, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 253, 254, 255, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 257, 258, 0, 259, 260, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    262, 263, 264, 265, 266, 267, 268, 269, 270,
+};
+const size_t norm_stage1_size = 3049;
+
+// decomposition offset << 16 | NORM_* flags << 8 | ccc
+const uint32_t norm_stage2[] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00015800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00045800, 0x00000000, 0x00085800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000B5800,
+    0x00000000, 0x00000000, 0x000F5800, 0x00125800, 0x00155800, 0x00195800, 0x00000000, 0x00000000,
+    0x001C5800, 0x00205800, 0x00235800, 0x00000000, 0x00265800, 0x002B5800, 0x00305800, 0x00000000,
+    0x00350900, 0x00380900, 0x003B0900, 0x003E0900, 0x00410900, 0x00440900, 0x00000000, 0x00470900,
+    0x004A0900, 0x004D0900, 0x00500900, 0x00530900, 0x00560900, 0x00590900, 0x005C0900, 0x005F0900,
+    0x00000000, 0x00620900, 0x00650900, 0x00680900, 0x006B0900, 0x006E0900, 0x00710900, 0x00000000,
+    0x00000000, 0x00740900, 0x00770900, 0x007A0900, 0x007D0900, 0x00800900, 0x00000000, 0x00000000,
+    0x00830900, 0x00860900, 0x00890900, 0x008C0900, 0x008F0900, 0x00920900, 0x00000000, 0x00950900,
+    0x00980900, 0x009B0900, 0x009E0900, 0x00A10900, 0x00A40900, 0x00A70900, 0x00AA0900, 0x00AD0900,
+    0x00000000, 0x00B00900, 0x00B30900, 0x00B60900, 0x00B90900, 0x00BC0900, 0x00BF0900, 0x00000000,
+    0x00000000, 0x00C20900, 0x00C50900, 0x00C80900, 0x00CB0900, 0x00CE0900, 0x00000000, 0x00D10900,
+    0x00D40900, 0x00D70900, 0x00DA0900, 0x00DD0900, 0x00E00900, 0x00E30900, 0x00E60900, 0x00E90900,
+    0x00EC0900, 0x00EF0900, 0x00F20900, 0x00F50900, 0x00F80900, 0x00FB0900, 0x00FE0900, 0x01010900,
+    0x00000000, 0x00000000, 0x01040900, 0x01070900, 0x010A0900, 0x010D0900, 0x01100900, 0x01130900,
+    0x01160900, 0x01190900, 0x011C0900, 0x011F0900, 0x01220900, 0x01250900, 0x01280900, 0x012B0900,
+    0x012E0900, 0x01310900, 0x01340900, 0x01370900, 0x013A0900, 0x013D0900, 0x00000000, 0x00000000,
+    0x01400900, 0x01430900, 0x01460900, 0x01490900, 0x014C0900, 0x014F0900, 0x01520900, 0x01550900,
+    0x01580900, 0x00000000, 0x015B5800, 0x015F5800, 0x01630900, 0x01660900, 0x01690900, 0x016C0900,
+    0x00000000, 0x016F0900, 0x01720900, 0x01750900, 0x01780900, 0x017B0900, 0x017E0900, 0x01815800,
+    0x01855800, 0x00000000, 0x00000000, 0x01890900, 0x018C0900, 0x018F0900, 0x01920900, 0x01950900,
+    0x01980900, 0x019B5800, 0x00000000, 0x00000000, 0x019F0900, 0x01A20900, 0x01A50900, 0x01A80900,
+    0x01AB0900, 0x01AE0900, 0x00000000, 0x00000000, 0x01B10900, 0x01B40900, 0x01B70900, 0x01BA0900,
+    0x01BD0900, 0x01C00900, 0x01C30900, 0x01C60900, 0x01C90900, 0x01CC0900, 0x01CF0900, 0x01D20900,
+    0x01D50900, 0x01D80900, 0x01DB0900, 0x01DE0900, 0x01E10900, 0x01E40900, 0x00000000, 0x00000000,
+    0x01E70900, 0x01EA0900, 0x01ED0900, 0x01F00900, 0x01F30900, 0x01F60900, 0x01F90900, 0x01FC0900,
+    0x01FF0900, 0x02020900, 0x02050900, 0x02080900, 0x020B0900, 0x020E0900, 0x02110900, 0x02140900,
+    0x02170900, 0x021A0900, 0x021D0900, 0x02200900, 0x02230900, 0x02260900, 0x02290900, 0x022C5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x022F0900, 0x02320900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02350900,
+    0x02380900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x023B5800, 0x02405800, 0x02455800, 0x024A5800,
+    0x024E5800, 0x02525800, 0x02565800, 0x025A5800, 0x025E5800, 0x02620900, 0x02650900, 0x02680900,
+    0x026B0900, 0x026E0900, 0x02710900, 0x02740900, 0x02770900, 0x027A0900, 0x027E0900, 0x02820900,
+    0x02860900, 0x028A0900, 0x028E0900, 0x02920900, 0x02960900, 0x00000000, 0x029A0900, 0x029E0900,
+    0x02A20900, 0x02A60900, 0x02AA0900, 0x02AD0900, 0x00000000, 0x00000000, 0x02B00900, 0x02B30900,
+    0x02B60900, 0x02B90900, 0x02BC0900, 0x02BF0900, 0x02C20900, 0x02C60900, 0x02CA0900, 0x02CD0900,
+    0x02D00900, 0x02D35800, 0x02D75800, 0x02DB5800, 0x02DF0900, 0x02E20900, 0x00000000, 0x00000000,
+    0x02E50900, 0x02E80900, 0x02EB0900, 0x02EF0900, 0x02F30900, 0x02F60900, 0x02F90900, 0x02FC0900,
+    0x02FF0900, 0x03020900, 0x03050900, 0x03080900, 0x030B0900, 0x030E0900, 0x03110900, 0x03140900,
+    0x03170900, 0x031A0900, 0x031D0900, 0x03200900, 0x03230900, 0x03260900, 0x03290900, 0x032C0900,
+    0x032F0900, 0x03320900, 0x03350900, 0x03380900, 0x033B0900, 0x033E0900, 0x03410900, 0x03440900,
+    0x03470900, 0x034A0900, 0x034D0900, 0x03500900, 0x00000000, 0x00000000, 0x03530900, 0x03560900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03590900, 0x035C0900,
+    0x035F0900, 0x03620900, 0x03650900, 0x03690900, 0x036D0900, 0x03710900, 0x03750900, 0x03780900,
+    0x037B0900, 0x037F0900, 0x03830900, 0x03860900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x03895800, 0x038C5800, 0x038F5800, 0x03925800, 0x03955800, 0x03985800, 0x039B5800, 0x039E5800,
+    0x03A15800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x03A45800, 0x03A85800, 0x03AC5800, 0x03B05800, 0x03B45800, 0x03B85800, 0x00000000, 0x00000000,
+    0x03BC5800, 0x03BF5800, 0x03C25800, 0x03C55800, 0x03C85800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000024E6, 0x000024E6, 0x000024E6, 0x000024E6, 0x000024E6, 0x000000E6, 0x000024E6, 0x000024E6,
+    0x000024E6, 0x000024E6, 0x000024E6, 0x000024E6, 0x000024E6, 0x000000E6, 0x000000E6, 0x000024E6,
+    0x000000E6, 0x000024E6, 0x000000E6, 0x000024E6, 0x000024E6, 0x000000E8, 0x000000DC, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000E8, 0x000024D8, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000DC, 0x000000CA, 0x000000CA, 0x000024DC, 0x000024DC, 0x000024DC, 0x000024DC, 0x000024CA,
+    0x000024CA, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000024DC, 0x000024DC, 0x000000DC,
+    0x000024DC, 0x000024DC, 0x000000DC, 0x000000DC, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00002401, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x03CB1BE6, 0x03CD1BE6, 0x000024E6, 0x03CF1BE6, 0x03D11BE6, 0x000024F0, 0x000000E6, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000E6,
+    0x000000E8, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E9, 0x000000EA, 0x000000EA, 0x000000E9,
+    0x000000EA, 0x000000EA, 0x000000E9, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03D41B00, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x03D65800, 0x00000000, 0x00000000, 0x00000000, 0x03DA1B00, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03DC5800, 0x03E05900, 0x03E70900, 0x03EA1B00,
+    0x03EC0900, 0x03EF0900, 0x03F20900, 0x00000000, 0x03F50900, 0x00000000, 0x03F80900, 0x03FB0900,
+    0x03FE0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x04020900, 0x04050900, 0x04080900, 0x040B0900, 0x040E0900, 0x04110900,
+    0x04140900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x04180900, 0x041B0900, 0x041E0900, 0x04210900, 0x04240900, 0x00000000,
+    0x04275800, 0x042A5800, 0x042D5800, 0x04305900, 0x04365900, 0x043C5800, 0x043F5800, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x04425800, 0x04455800, 0x04485800, 0x00000000, 0x044B5800, 0x044E5800, 0x00000000, 0x00000000,
+    0x00000000, 0x04515800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x04540900, 0x04570900, 0x00000000, 0x045A0900, 0x00000000, 0x00000000, 0x00000000, 0x045D0900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04600900, 0x04630900, 0x04660900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x04690900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x046C0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x046F0900, 0x04720900, 0x00000000, 0x04750900, 0x00000000, 0x00000000, 0x00000000, 0x04780900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x047B0900, 0x047E0900, 0x04810900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04840900, 0x04870900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x048A0900, 0x048D0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x04900900, 0x04930900, 0x04960900, 0x04990900, 0x00000000, 0x00000000, 0x049C0900, 0x049F0900,
+    0x00000000, 0x00000000, 0x04A20900, 0x04A50900, 0x04A80900, 0x04AB0900, 0x04AE0900, 0x04B10900,
+    0x00000000, 0x00000000, 0x04B40900, 0x04B70900, 0x04BA0900, 0x04BD0900, 0x04C00900, 0x04C30900,
+    0x00000000, 0x00000000, 0x04C60900, 0x04C90900, 0x04CC0900, 0x04CF0900, 0x04D20900, 0x04D50900,
+    0x04D80900, 0x04DB0900, 0x04DE0900, 0x04E10900, 0x04E40900, 0x04E70900, 0x00000000, 0x00000000,
+    0x04EA0900, 0x04ED0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04F05800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DE, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DE, 0x000000E4, 0x000000E6,
+    0x0000000A, 0x0000000B, 0x0000000C, 0x0000000D, 0x0000000E, 0x0000000F, 0x00000010, 0x00000011,
+    0x00000012, 0x00000013, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000000, 0x00000017,
+    0x00000000, 0x00000018, 0x00000019, 0x00000000, 0x000000E6, 0x000000DC, 0x00000000, 0x00000012,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x0000001E, 0x0000001F, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x04F40900, 0x04F70900, 0x04FA0900, 0x04FD0900, 0x05000900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F,
+    0x00000020, 0x00000021, 0x00000022, 0x000024E6, 0x000024E6, 0x000024DC, 0x000000DC, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000023, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05035800, 0x05075800, 0x050B5800,
+    0x050F5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x05130900, 0x00000000, 0x05160900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x05190900, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x00000000, 0x00000000, 0x000000E6,
+    0x000000E6, 0x00000000, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000024, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000DC, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000DC, 0x000000E6,
+    0x000000DC, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000000DC, 0x000000DC, 0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6,
+    0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x00000000, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6,
+    0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x0000001B, 0x0000001C, 0x0000001D, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6,
+    0x000000E6, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x051C0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x051F0900, 0x00000000, 0x00000000, 0x05220900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002407, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x05251B00, 0x05281B00, 0x052B1B00, 0x052E1B00, 0x05311B00, 0x05341B00, 0x05371B00, 0x053A1B00,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00002400, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x053D0900, 0x05400900, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05431B00, 0x05461B00, 0x00000000, 0x05491B00,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x054C1B00, 0x00000000, 0x00000000, 0x054F1B00, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x05521B00, 0x05551B00, 0x05581B00, 0x00000000, 0x00000000, 0x055B1B00, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x055E0900, 0x00000000, 0x00000000, 0x05610900, 0x05640900, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05671B00, 0x056A1B00, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x056D0900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x05700900, 0x05730900, 0x05760900, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x05790900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000054, 0x0000245B, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x057C0900, 0x00000000, 0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x057F0900,
+    0x05820900, 0x00000000, 0x05850900, 0x05880900, 0x00000000, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00002400, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00002400, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x058C0900, 0x058F0900, 0x05920900, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00002409, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x05950900, 0x00000000, 0x05980900, 0x059B0900, 0x059F0900, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x05A25800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000067, 0x00000067, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000006B, 0x0000006B, 0x0000006B, 0x0000006B, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x05A65800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000076, 0x00000076, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000007A, 0x0000007A, 0x0000007A, 0x0000007A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05AA5800, 0x05AE5800, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05B25800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000DC, 0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000, 0x000000DC,
+    0x00000000, 0x000000D8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x05B51B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05B81B00, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x05BB1B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05BE1B00,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05C11B00, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x05C41B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000081, 0x00000082, 0x05C71B00, 0x00000084, 0x05CA1B00, 0x05CD1B00, 0x05D05800,
+    0x05D51B00, 0x05D85800, 0x00000082, 0x00000082, 0x00000082, 0x00000082, 0x00000000, 0x00000000,
+    0x00000082, 0x05DD1B00, 0x000000E6, 0x000000E6, 0x00000009, 0x00000000, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x05E01B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05E31B00, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x05E61B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05E91B00,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05EC1B00, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x05EF1B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05F20900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007,
+    0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05F55800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400,
+    0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400,
+    0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400,
+    0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400,
+    0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400, 0x00002400,
+    0x00002400, 0x00002400, 0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000000E4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000000DE, 0x000000E6, 0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6,
+    0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x000000DC,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC, 0x00000000, 0x000000DC,
+    0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05F80900, 0x00000000,
+    0x05FB0900, 0x00000000, 0x05FE0900, 0x00000000, 0x06010900, 0x00000000, 0x06040900, 0x00000000,
+    0x00000000, 0x00000000, 0x06070900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00002400, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x060A0900, 0x00000000, 0x060D0900, 0x00000000, 0x00000000,
+    0x06100900, 0x06130900, 0x00000000, 0x06160900, 0x00000009, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000001, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000E6, 0x00000000, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06195800, 0x061C5800, 0x061F5800, 0x00000000,
+    0x06225800, 0x06255800, 0x06285800, 0x062B5800, 0x062E5800, 0x06315800, 0x06345800, 0x06375800,
+    0x063A5800, 0x063D5800, 0x06405800, 0x00000000, 0x06435800, 0x06465800, 0x06495800, 0x064C5800,
+    0x064F5800, 0x06525800, 0x06555800, 0x06585800, 0x065B5800, 0x065E5800, 0x06615800, 0x06645800,
+    0x06675800, 0x066A5800, 0x066D5800, 0x06705800, 0x06735800, 0x06765800, 0x00000000, 0x06795800,
+    0x067C5800, 0x067F5800, 0x06825800, 0x06855800, 0x06885800, 0x068B5800, 0x068E5800, 0x06915800,
+    0x06945800, 0x06975800, 0x069A5800, 0x069D5800, 0x06A05800, 0x06A35800, 0x06A65800, 0x06A95800,
+    0x06AC5800, 0x06AF5800, 0x06B25800, 0x06B55800, 0x06B85800, 0x06BB5800, 0x06BE5800, 0x06C15800,
+    0x06C45800, 0x06C75800, 0x06CA5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x06CD5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x06D05800, 0x06D35800, 0x06D65800, 0x06D95800, 0x06DC5800,
+    0x06DF5800, 0x06E25800, 0x06E55800, 0x06E85800, 0x06EB5800, 0x06EE5800, 0x06F15800, 0x06F45800,
+    0x06F75800, 0x06FA5800, 0x06FD5800, 0x07005800, 0x07035800, 0x07065800, 0x07095800, 0x070C5800,
+    0x070F5800, 0x07125800, 0x07155800, 0x07185800, 0x071B5800, 0x071E5800, 0x07215800, 0x07245800,
+    0x07275800, 0x072A5800, 0x072D5800, 0x07305800, 0x07335800, 0x07365800, 0x07395800, 0x073C5800,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000E6, 0x000000EA, 0x000000D6, 0x000000DC,
+    0x000000CA, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E8, 0x000000E4,
+    0x000000E4, 0x000000DC, 0x000000DA, 0x000000E6, 0x000000E9, 0x000000DC, 0x000000E6, 0x000000DC,
+    0x073F0900, 0x07420900, 0x07450900, 0x07480900, 0x074B0900, 0x074E0900, 0x07510900, 0x07540900,
+    0x07570900, 0x075B0900, 0x075F0900, 0x07620900, 0x07650900, 0x07680900, 0x076B0900, 0x076E0900,
+    0x07710900, 0x07740900, 0x07770900, 0x077A0900, 0x077D0900, 0x07810900, 0x07850900, 0x07890900,
+    0x078D0900, 0x07900900, 0x07930900, 0x07960900, 0x07990900, 0x079D0900, 0x07A10900, 0x07A40900,
+    0x07A70900, 0x07AA0900, 0x07AD0900, 0x07B00900, 0x07B30900, 0x07B60900, 0x07B90900, 0x07BC0900,
+    0x07BF0900, 0x07C20900, 0x07C50900, 0x07C80900, 0x07CB0900, 0x07CE0900, 0x07D10900, 0x07D50900,
+    0x07D90900, 0x07DC0900, 0x07DF0900, 0x07E20900, 0x07E50900, 0x07E80900, 0x07EB0900, 0x07EE0900,
+    0x07F10900, 0x07F50900, 0x07F90900, 0x07FC0900, 0x07FF0900, 0x08020900, 0x08050900, 0x08080900,
+    0x080B0900, 0x080E0900, 0x08110900, 0x08140900, 0x08170900, 0x081A0900, 0x081D0900, 0x08200900,
+    0x08230900, 0x08260900, 0x08290900, 0x082C0900, 0x082F0900, 0x08330900, 0x08370900, 0x083B0900,
+    0x083F0900, 0x08430900, 0x08470900, 0x084B0900, 0x084F0900, 0x08520900, 0x08550900, 0x08580900,
+    0x085B0900, 0x085E0900, 0x08610900, 0x08640900, 0x08670900, 0x086B0900, 0x086F0900, 0x08720900,
+    0x08750900, 0x08780900, 0x087B0900, 0x087E0900, 0x08810900, 0x08850900, 0x08890900, 0x088D0900,
+    0x08910900, 0x08950900, 0x08990900, 0x089C0900, 0x089F0900, 0x08A20900, 0x08A50900, 0x08A80900,
+    0x08AB0900, 0x08AE0900, 0x08B10900, 0x08B40900, 0x08B70900, 0x08BA0900, 0x08BD0900, 0x08C00900,
+    0x08C30900, 0x08C70900, 0x08CB0900, 0x08CF0900, 0x08D30900, 0x08D60900, 0x08D90900, 0x08DC0900,
+    0x08DF0900, 0x08E20900, 0x08E50900, 0x08E80900, 0x08EB0900, 0x08EE0900, 0x08F10900, 0x08F40900,
+    0x08F70900, 0x08FA0900, 0x08FD0900, 0x09000900, 0x09030900, 0x09060900, 0x09090900, 0x090C0900,
+    0x090F0900, 0x09120900, 0x09150900, 0x09180900, 0x091B0900, 0x091E0900, 0x09210900, 0x09240900,
+    0x09270900, 0x092A0900, 0x092D5800, 0x09315900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x09370900, 0x093A0900, 0x093D0900, 0x09400900, 0x09430900, 0x09470900, 0x094B0900, 0x094F0900,
+    0x09530900, 0x09570900, 0x095B0900, 0x095F0900, 0x09630900, 0x09670900, 0x096B0900, 0x096F0900,
+    0x09730900, 0x09770900, 0x097B0900, 0x097F0900, 0x09830900, 0x09870900, 0x098B0900, 0x098F0900,
+    0x09930900, 0x09960900, 0x09990900, 0x099C0900, 0x099F0900, 0x09A20900, 0x09A50900, 0x09A90900,
+    0x09AD0900, 0x09B10900, 0x09B50900, 0x09B90900, 0x09BD0900, 0x09C10900, 0x09C50900, 0x09C90900,
+    0x09CD0900, 0x09D00900, 0x09D30900, 0x09D60900, 0x09D90900, 0x09DC0900, 0x09DF0900, 0x09E20900,
+    0x09E50900, 0x09E90900, 0x09ED0900, 0x09F10900, 0x09F50900, 0x09F90900, 0x09FD0900, 0x0A010900,
+    0x0A050900, 0x0A090900, 0x0A0D0900, 0x0A110900, 0x0A150900, 0x0A190900, 0x0A1D0900, 0x0A210900,
+    0x0A250900, 0x0A290900, 0x0A2D0900, 0x0A310900, 0x0A350900, 0x0A380900, 0x0A3B0900, 0x0A3E0900,
+    0x0A410900, 0x0A450900, 0x0A490900, 0x0A4D0900, 0x0A510900, 0x0A550900, 0x0A590900, 0x0A5D0900,
+    0x0A610900, 0x0A650900, 0x0A690900, 0x0A6C0900, 0x0A6F0900, 0x0A720900, 0x0A750900, 0x0A780900,
+    0x0A7B0900, 0x0A7E0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0A810900, 0x0A840900, 0x0A870900, 0x0A8B0900, 0x0A8F0900, 0x0A930900, 0x0A970900, 0x0A9B0900,
+    0x0A9F0900, 0x0AA20900, 0x0AA50900, 0x0AA90900, 0x0AAD0900, 0x0AB10900, 0x0AB50900, 0x0AB90900,
+    0x0ABD0900, 0x0AC00900, 0x0AC30900, 0x0AC70900, 0x0ACB0900, 0x0ACF0900, 0x00000000, 0x00000000,
+    0x0AD30900, 0x0AD60900, 0x0AD90900, 0x0ADD0900, 0x0AE10900, 0x0AE50900, 0x00000000, 0x00000000,
+    0x0AE90900, 0x0AEC0900, 0x0AEF0900, 0x0AF30900, 0x0AF70900, 0x0AFB0900, 0x0AFF0900, 0x0B030900,
+    0x0B070900, 0x0B0A0900, 0x0B0D0900, 0x0B110900, 0x0B150900, 0x0B190900, 0x0B1D0900, 0x0B210900,
+    0x0B250900, 0x0B280900, 0x0B2B0900, 0x0B2F0900, 0x0B330900, 0x0B370900, 0x0B3B0900, 0x0B3F0900,
+    0x0B430900, 0x0B460900, 0x0B490900, 0x0B4D0900, 0x0B510900, 0x0B550900, 0x0B590900, 0x0B5D0900,
+    0x0B610900, 0x0B640900, 0x0B670900, 0x0B6B0900, 0x0B6F0900, 0x0B730900, 0x00000000, 0x00000000,
+    0x0B770900, 0x0B7A0900, 0x0B7D0900, 0x0B810900, 0x0B850900, 0x0B890900, 0x00000000, 0x00000000,
+    0x0B8D0900, 0x0B900900, 0x0B930900, 0x0B970900, 0x0B9B0900, 0x0B9F0900, 0x0BA30900, 0x0BA70900,
+    0x00000000, 0x0BAB0900, 0x00000000, 0x0BAE0900, 0x00000000, 0x0BB20900, 0x00000000, 0x0BB60900,
+    0x0BBA0900, 0x0BBD0900, 0x0BC00900, 0x0BC40900, 0x0BC80900, 0x0BCC0900, 0x0BD00900, 0x0BD40900,
+    0x0BD80900, 0x0BDB0900, 0x0BDE0900, 0x0BE20900, 0x0BE60900, 0x0BEA0900, 0x0BEE0900, 0x0BF20900,
+    0x0BF60900, 0x0BF91B00, 0x0BFC0900, 0x0BFF1B00, 0x0C020900, 0x0C051B00, 0x0C080900, 0x0C0B1B00,
+    0x0C0E0900, 0x0C111B00, 0x0C140900, 0x0C171B00, 0x0C1A0900, 0x0C1D1B00, 0x00000000, 0x00000000,
+    0x0C200900, 0x0C240900, 0x0C280900, 0x0C2D0900, 0x0C320900, 0x0C370900, 0x0C3C0900, 0x0C410900,
+    0x0C460900, 0x0C4A0900, 0x0C4E0900, 0x0C530900, 0x0C580900, 0x0C5D0900, 0x0C620900, 0x0C670900,
+    0x0C6C0900, 0x0C700900, 0x0C740900, 0x0C790900, 0x0C7E0900, 0x0C830900, 0x0C880900, 0x0C8D0900,
+    0x0C920900, 0x0C960900, 0x0C9A0900, 0x0C9F0900, 0x0CA40900, 0x0CA90900, 0x0CAE0900, 0x0CB30900,
+    0x0CB80900, 0x0CBC0900, 0x0CC00900, 0x0CC50900, 0x0CCA0900, 0x0CCF0900, 0x0CD40900, 0x0CD90900,
+    0x0CDE0900, 0x0CE20900, 0x0CE60900, 0x0CEB0900, 0x0CF00900, 0x0CF50900, 0x0CFA0900, 0x0CFF0900,
+    0x0D040900, 0x0D070900, 0x0D0A0900, 0x0D0E0900, 0x0D110900, 0x00000000, 0x0D150900, 0x0D180900,
+    0x0D1C0900, 0x0D1F0900, 0x0D220900, 0x0D251B00, 0x0D280900, 0x0D2B5800, 0x0D2F1B00, 0x0D315800,
+    0x0D355800, 0x0D395900, 0x0D400900, 0x0D440900, 0x0D470900, 0x00000000, 0x0D4B0900, 0x0D4E0900,
+    0x0D520900, 0x0D551B00, 0x0D580900, 0x0D5B1B00, 0x0D5E0900, 0x0D615900, 0x0D685900, 0x0D6F5900,
+    0x0D760900, 0x0D790900, 0x0D7C0900, 0x0D801B00, 0x00000000, 0x00000000, 0x0D840900, 0x0D870900,
+    0x0D8B0900, 0x0D8E0900, 0x0D910900, 0x0D941B00, 0x00000000, 0x0D975900, 0x0D9E5900, 0x0DA55900,
+    0x0DAC0900, 0x0DAF0900, 0x0DB20900, 0x0DB61B00, 0x0DBA0900, 0x0DBD0900, 0x0DC00900, 0x0DC30900,
+    0x0DC70900, 0x0DCA0900, 0x0DCD0900, 0x0DD01B00, 0x0DD30900, 0x0DD65900, 0x0DDD5B00, 0x0DE41B00,
+    0x00000000, 0x00000000, 0x0DE60900, 0x0DEA0900, 0x0DED0900, 0x00000000, 0x0DF10900, 0x0DF40900,
+    0x0DF80900, 0x0DFB1B00, 0x0DFE0900, 0x0E011B00, 0x0E040900, 0x0E075B00, 0x0E0C5800, 0x00000000,
+    0x0E105B00, 0x0E145B00, 0x0E185800, 0x0E1B5800, 0x0E1E5800, 0x0E215800, 0x0E245800, 0x0E275800,
+    0x0E2A5800, 0x0E2D5800, 0x0E305800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0E335800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E365800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E3A5800, 0x0E3D5800, 0x0E415800, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E465800,
+    0x00000000, 0x00000000, 0x00000000, 0x0E495800, 0x0E4D5800, 0x00000000, 0x0E525800, 0x0E565800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E5B5800, 0x00000000, 0x0E5F5800, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E635800,
+    0x0E675800, 0x0E6B5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E6F5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E755800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0E785800, 0x0E7B5800, 0x00000000, 0x00000000, 0x0E7E5800, 0x0E815800, 0x0E845800, 0x0E875800,
+    0x0E8A5800, 0x0E8D5800, 0x0E905800, 0x0E935800, 0x0E965800, 0x0E995800, 0x0E9C5800, 0x0E9F5800,
+    0x0EA25800, 0x0EA55800, 0x0EA85800, 0x0EAB5800, 0x0EAE5800, 0x0EB15800, 0x0EB45800, 0x0EB75800,
+    0x0EBA5800, 0x0EBD5800, 0x0EC05800, 0x0EC35800, 0x0EC65800, 0x0EC95800, 0x0ECC5800, 0x00000000,
+    0x0ECF5800, 0x0ED25800, 0x0ED55800, 0x0ED85800, 0x0EDB5800, 0x0EDE5800, 0x0EE15800, 0x0EE45800,
+    0x0EE75800, 0x0EEA5800, 0x0EED5800, 0x0EF05800, 0x0EF35800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0EF65800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x00000001, 0x00000001, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000001, 0x00000001, 0x00000001, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x000000E6,
+    0x000000DC, 0x000000E6, 0x00000001, 0x00000001, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0EFA5800, 0x0EFF5800, 0x0F045800, 0x0F075800, 0x00000000, 0x0F0B5800, 0x0F105800, 0x0F155800,
+    0x00000000, 0x0F185800, 0x0F1C5800, 0x0F1F5800, 0x0F225800, 0x0F255800, 0x0F285800, 0x0F2B5800,
+    0x0F2E5800, 0x0F315800, 0x0F345800, 0x0F375800, 0x00000000, 0x0F3A5800, 0x0F3D5800, 0x00000000,
+    0x00000000, 0x0F415800, 0x0F445800, 0x0F475800, 0x0F4A5800, 0x0F4D5800, 0x00000000, 0x00000000,
+    0x0F505800, 0x0F545800, 0x0F595800, 0x00000000, 0x0F5D5800, 0x00000000, 0x0F601B00, 0x00000000,
+    0x0F625800, 0x00000000, 0x0F651B00, 0x0F671B00, 0x0F6A5800, 0x0F6D5800, 0x00000000, 0x0F705800,
+    0x0F735800, 0x0F765800, 0x00000000, 0x0F795800, 0x0F7C5800, 0x0F7F5800, 0x0F825800, 0x0F855800,
+    0x0F885800, 0x0F8B5800, 0x00000000, 0x0F8E5800, 0x0F935800, 0x0F965800, 0x0F995800, 0x0F9C5800,
+    0x0F9F5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0FA25800, 0x0FA55800, 0x0FA85800,
+    0x0FAB5800, 0x0FAE5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0FB15800, 0x0FB65800, 0x0FBB5800, 0x0FC15800, 0x0FC65800, 0x0FCB5800, 0x0FD05800, 0x0FD55800,
+    0x0FDA5800, 0x0FDF5800, 0x0FE45800, 0x0FE95800, 0x0FEE5800, 0x0FF35800, 0x0FF85800, 0x0FFD5800,
+    0x10015800, 0x10045800, 0x10085800, 0x100D5800, 0x10115800, 0x10145800, 0x10185800, 0x101D5800,
+    0x10235800, 0x10275800, 0x102A5800, 0x102E5800, 0x10335800, 0x10365800, 0x10395800, 0x103C5800,
+    0x103F5800, 0x10425800, 0x10465800, 0x104B5800, 0x104F5800, 0x10525800, 0x10565800, 0x105B5800,
+    0x10615800, 0x10655800, 0x10685800, 0x106C5800, 0x10715800, 0x10745800, 0x10775800, 0x107A5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x107D5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x10820900, 0x10850900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10880900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x108B0900, 0x108E0900, 0x10910900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10940900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x10970900, 0x00000000, 0x00000000, 0x109A0900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x109D0900, 0x00000000, 0x10A00900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10A35800, 0x10A75800, 0x00000000, 0x10AC5800,
+    0x10B05800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x10B50900, 0x00000000, 0x00000000, 0x10B80900, 0x00000000, 0x00000000, 0x10BB0900,
+    0x00000000, 0x10BE0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x10C10900, 0x00000000, 0x10C40900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10C70900, 0x10CA0900, 0x10CD0900,
+    0x10D00900, 0x10D30900, 0x00000000, 0x00000000, 0x10D60900, 0x10D90900, 0x00000000, 0x00000000,
+    0x10DC0900, 0x10DF0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x10E20900, 0x10E50900, 0x00000000, 0x00000000, 0x10E80900, 0x10EB0900, 0x00000000, 0x00000000,
+    0x10EE0900, 0x10F10900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10F40900, 0x10F70900, 0x10FA0900, 0x10FD0900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x11000900, 0x11030900, 0x11060900, 0x11090900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x110C0900, 0x110F0900, 0x11120900, 0x11150900, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x11181B00, 0x111A1B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x111C5800, 0x111F5800, 0x11225800, 0x11255800, 0x11285800, 0x112B5800, 0x112E5800, 0x11315800,
+    0x11345800, 0x11375800, 0x113B5800, 0x113F5800, 0x11435800, 0x11475800, 0x114B5800, 0x114F5800,
+    0x11535800, 0x11575800, 0x115B5800, 0x115F5800, 0x11635800, 0x11685800, 0x116D5800, 0x11725800,
+    0x11775800, 0x117C5800, 0x11815800, 0x11865800, 0x118B5800, 0x11905800, 0x11965800, 0x119C5800,
+    0x11A25800, 0x11A85800, 0x11AE5800, 0x11B45800, 0x11BA5800, 0x11C05800, 0x11C65800, 0x11CC5800,
+    0x11D25800, 0x11D65800, 0x11DA5800, 0x11DE5800, 0x11E25800, 0x11E65800, 0x11EA5800, 0x11EE5800,
+    0x11F25800, 0x11F65800, 0x11FB5800, 0x12005800, 0x12055800, 0x120A5800, 0x120F5800, 0x12145800,
+    0x12195800, 0x121E5800, 0x12235800, 0x12285800, 0x122D5800, 0x12325800, 0x12375800, 0x123C5800,
+    0x12415800, 0x12465800, 0x124B5800, 0x12505800, 0x12555800, 0x125A5800, 0x125F5800, 0x12645800,
+    0x12695800, 0x126E5800, 0x12735800, 0x12785800, 0x127D5800, 0x12825800, 0x12875800, 0x128C5800,
+    0x12915800, 0x12965800, 0x129B5800, 0x12A05800, 0x12A55800, 0x12AA5800, 0x12AF5800, 0x12B25800,
+    0x12B55800, 0x12B85800, 0x12BB5800, 0x12BE5800, 0x12C15800, 0x12C45800, 0x12C75800, 0x12CA5800,
+    0x12CD5800, 0x12D05800, 0x12D35800, 0x12D65800, 0x12D95800, 0x12DC5800, 0x12DF5800, 0x12E25800,
+    0x12E55800, 0x12E85800, 0x12EB5800, 0x12EE5800, 0x12F15800, 0x12F45800, 0x12F75800, 0x12FA5800,
+    0x12FD5800, 0x13005800, 0x13035800, 0x13065800, 0x13095800, 0x130C5800, 0x130F5800, 0x13125800,
+    0x13155800, 0x13185800, 0x131B5800, 0x131E5800, 0x13215800, 0x13245800, 0x13275800, 0x132A5800,
+    0x132D5800, 0x13305800, 0x13335800, 0x13365800, 0x13395800, 0x133C5800, 0x133F5800, 0x13425800,
+    0x13455800, 0x13485800, 0x134B5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x134E5800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13545800, 0x13595800, 0x135D5800, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13621B00, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13655800, 0x13685800, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x136B5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x136E5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x13715800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x13745800, 0x13775800, 0x137A5800, 0x137D5800, 0x13805800, 0x13835800, 0x13865800, 0x13895800,
+    0x138C5800, 0x138F5800, 0x13925800, 0x13955800, 0x13985800, 0x139B5800, 0x139E5800, 0x13A15800,
+    0x13A45800, 0x13A75800, 0x13AA5800, 0x13AD5800, 0x13B05800, 0x13B35800, 0x13B65800, 0x13B95800,
+    0x13BC5800, 0x13BF5800, 0x13C25800, 0x13C55800, 0x13C85800, 0x13CB5800, 0x13CE5800, 0x13D15800,
+    0x13D45800, 0x13D75800, 0x13DA5800, 0x13DD5800, 0x13E05800, 0x13E35800, 0x13E65800, 0x13E95800,
+    0x13EC5800, 0x13EF5800, 0x13F25800, 0x13F55800, 0x13F85800, 0x13FB5800, 0x13FE5800, 0x14015800,
+    0x14045800, 0x14075800, 0x140A5800, 0x140D5800, 0x14105800, 0x14135800, 0x14165800, 0x14195800,
+    0x141C5800, 0x141F5800, 0x14225800, 0x14255800, 0x14285800, 0x142B5800, 0x142E5800, 0x14315800,
+    0x14345800, 0x14375800, 0x143A5800, 0x143D5800, 0x14405800, 0x14435800, 0x14465800, 0x14495800,
+    0x144C5800, 0x144F5800, 0x14525800, 0x14555800, 0x14585800, 0x145B5800, 0x145E5800, 0x14615800,
+    0x14645800, 0x14675800, 0x146A5800, 0x146D5800, 0x14705800, 0x14735800, 0x14765800, 0x14795800,
+    0x147C5800, 0x147F5800, 0x14825800, 0x14855800, 0x14885800, 0x148B5800, 0x148E5800, 0x14915800,
+    0x14945800, 0x14975800, 0x149A5800, 0x149D5800, 0x14A05800, 0x14A35800, 0x14A65800, 0x14A95800,
+    0x14AC5800, 0x14AF5800, 0x14B25800, 0x14B55800, 0x14B85800, 0x14BB5800, 0x14BE5800, 0x14C15800,
+    0x14C45800, 0x14C75800, 0x14CA5800, 0x14CD5800, 0x14D05800, 0x14D35800, 0x14D65800, 0x14D95800,
+    0x14DC5800, 0x14DF5800, 0x14E25800, 0x14E55800, 0x14E85800, 0x14EB5800, 0x14EE5800, 0x14F15800,
+    0x14F45800, 0x14F75800, 0x14FA5800, 0x14FD5800, 0x15005800, 0x15035800, 0x15065800, 0x15095800,
+    0x150C5800, 0x150F5800, 0x15125800, 0x15155800, 0x15185800, 0x151B5800, 0x151E5800, 0x15215800,
+    0x15245800, 0x15275800, 0x152A5800, 0x152D5800, 0x15305800, 0x15335800, 0x15365800, 0x15395800,
+    0x153C5800, 0x153F5800, 0x15425800, 0x15455800, 0x15485800, 0x154B5800, 0x154E5800, 0x15515800,
+    0x15545800, 0x15575800, 0x155A5800, 0x155D5800, 0x15605800, 0x15635800, 0x15665800, 0x15695800,
+    0x156C5800, 0x156F5800, 0x15725800, 0x15755800, 0x15785800, 0x157B5800, 0x157E5800, 0x15815800,
+    0x15845800, 0x15875800, 0x158A5800, 0x158D5800, 0x15905800, 0x15935800, 0x15965800, 0x15995800,
+    0x159C5800, 0x159F5800, 0x15A25800, 0x15A55800, 0x15A85800, 0x15AB5800, 0x15AE5800, 0x15B15800,
+    0x15B45800, 0x15B75800, 0x15BA5800, 0x15BD5800, 0x15C05800, 0x15C35800, 0x15C65800, 0x15C95800,
+    0x15CC5800, 0x15CF5800, 0x15D25800, 0x15D55800, 0x15D85800, 0x15DB5800, 0x15DE5800, 0x15E15800,
+    0x15E45800, 0x15E75800, 0x15EA5800, 0x15ED5800, 0x15F05800, 0x15F35800, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x15F65800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000000DA, 0x000000E4, 0x000000E8, 0x000000DE, 0x000000E0, 0x000000E0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15F95800, 0x00000000,
+    0x15FC5800, 0x15FF5800, 0x16025800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16050900, 0x00000000, 0x16080900, 0x00000000,
+    0x160B0900, 0x00000000, 0x160E0900, 0x00000000, 0x16110900, 0x00000000, 0x16140900, 0x00000000,
+    0x16170900, 0x00000000, 0x161A0900, 0x00000000, 0x161D0900, 0x00000000, 0x16200900, 0x00000000,
+    0x16230900, 0x00000000, 0x16260900, 0x00000000, 0x00000000, 0x16290900, 0x00000000, 0x162C0900,
+    0x00000000, 0x162F0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x16320900, 0x16350900, 0x00000000, 0x16380900, 0x163B0900, 0x00000000, 0x163E0900, 0x16410900,
+    0x00000000, 0x16440900, 0x16470900, 0x00000000, 0x164A0900, 0x164D0900, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16500900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00002408, 0x00002408, 0x16535800, 0x16575800, 0x00000000, 0x165B0900, 0x165E5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16620900, 0x00000000, 0x16650900, 0x00000000,
+    0x16680900, 0x00000000, 0x166B0900, 0x00000000, 0x166E0900, 0x00000000, 0x16710900, 0x00000000,
+    0x16740900, 0x00000000, 0x16770900, 0x00000000, 0x167A0900, 0x00000000, 0x167D0900, 0x00000000,
+    0x16800900, 0x00000000, 0x16830900, 0x00000000, 0x00000000, 0x16860900, 0x00000000, 0x16890900,
+    0x00000000, 0x168C0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x168F0900, 0x16920900, 0x00000000, 0x16950900, 0x16980900, 0x00000000, 0x169B0900, 0x169E0900,
+    0x00000000, 0x16A10900, 0x16A40900, 0x00000000, 0x16A70900, 0x16AA0900, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16AD0900, 0x00000000, 0x00000000, 0x16B00900,
+    0x16B30900, 0x16B60900, 0x16B90900, 0x00000000, 0x00000000, 0x00000000, 0x16BC0900, 0x16BF5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x16C35800, 0x16C65800, 0x16C95800, 0x16CC5800, 0x16CF5800, 0x16D25800, 0x16D55800,
+    0x16D85800, 0x16DB5800, 0x16DE5800, 0x16E15800, 0x16E45800, 0x16E75800, 0x16EA5800, 0x16ED5800,
+    0x16F05800, 0x16F35800, 0x16F65800, 0x16F95800, 0x16FC5800, 0x16FF5800, 0x17025800, 0x17055800,
+    0x17085800, 0x170B5800, 0x170E5800, 0x17115800, 0x17145800, 0x17175800, 0x171A5800, 0x171D5800,
+    0x17205800, 0x17235800, 0x17265800, 0x17295800, 0x172C5800, 0x172F5800, 0x17325800, 0x17355800,
+    0x17385800, 0x173B5800, 0x173E5800, 0x17415800, 0x17445800, 0x17475800, 0x174A5800, 0x174D5800,
+    0x17505800, 0x17535800, 0x17565800, 0x17595800, 0x175C5800, 0x175F5800, 0x17625800, 0x17655800,
+    0x17685800, 0x176B5800, 0x176E5800, 0x17715800, 0x17745800, 0x17775800, 0x177A5800, 0x177D5800,
+    0x17805800, 0x17835800, 0x17865800, 0x17895800, 0x178C5800, 0x178F5800, 0x17925800, 0x17955800,
+    0x17985800, 0x179B5800, 0x179E5800, 0x17A15800, 0x17A45800, 0x17A75800, 0x17AA5800, 0x17AD5800,
+    0x17B05800, 0x17B35800, 0x17B65800, 0x17B95800, 0x17BC5800, 0x17BF5800, 0x17C25800, 0x17C55800,
+    0x17C85800, 0x17CB5800, 0x17CE5800, 0x17D15800, 0x17D45800, 0x17D75800, 0x17DA5800, 0x00000000,
+    0x00000000, 0x00000000, 0x17DD5800, 0x17E05800, 0x17E35800, 0x17E65800, 0x17E95800, 0x17EC5800,
+    0x17EF5800, 0x17F25800, 0x17F55800, 0x17F85800, 0x17FB5800, 0x17FE5800, 0x18015800, 0x18045800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x18075800, 0x180C5800, 0x18115800, 0x18165800, 0x181B5800, 0x18205800, 0x18255800, 0x182A5800,
+    0x182F5800, 0x18345800, 0x18395800, 0x183E5800, 0x18435800, 0x18485800, 0x184D5800, 0x18535800,
+    0x18595800, 0x185F5800, 0x18655800, 0x186B5800, 0x18715800, 0x18775800, 0x187D5800, 0x18835800,
+    0x18895800, 0x188F5800, 0x18955800, 0x189B5800, 0x18A15800, 0x18A75800, 0x18B05800, 0x00000000,
+    0x18B85800, 0x18BD5800, 0x18C25800, 0x18C75800, 0x18CC5800, 0x18D15800, 0x18D65800, 0x18DB5800,
+    0x18E05800, 0x18E55800, 0x18EA5800, 0x18EF5800, 0x18F45800, 0x18F95800, 0x18FE5800, 0x19035800,
+    0x19085800, 0x190D5800, 0x19125800, 0x19175800, 0x191C5800, 0x19215800, 0x19265800, 0x192B5800,
+    0x19305800, 0x19355800, 0x193A5800, 0x193F5800, 0x19445800, 0x19495800, 0x194E5800, 0x19535800,
+    0x19585800, 0x195D5800, 0x19625800, 0x19675800, 0x196C5800, 0x196F5800, 0x19725800, 0x19755800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x19785800, 0x197D5800, 0x19815800, 0x19855800, 0x19895800, 0x198D5800, 0x19915800, 0x19955800,
+    0x19995800, 0x199D5800, 0x19A15800, 0x19A55800, 0x19A95800, 0x19AD5800, 0x19B15800, 0x19B55800,
+    0x19B95800, 0x19BC5800, 0x19BF5800, 0x19C25800, 0x19C55800, 0x19C85800, 0x19CB5800, 0x19CE5800,
+    0x19D15800, 0x19D45800, 0x19D75800, 0x19DA5800, 0x19DD5800, 0x19E05800, 0x19E35800, 0x19E75800,
+    0x19EB5800, 0x19EF5800, 0x19F35800, 0x19F75800, 0x19FB5800, 0x19FF5800, 0x1A035800, 0x1A075800,
+    0x1A0B5800, 0x1A0F5800, 0x1A135800, 0x1A175800, 0x1A1B5800, 0x1A225800, 0x1A285800, 0x00000000,
+    0x1A2C5800, 0x1A2F5800, 0x1A325800, 0x1A355800, 0x1A385800, 0x1A3B5800, 0x1A3E5800, 0x1A415800,
+    0x1A445800, 0x1A475800, 0x1A4A5800, 0x1A4D5800, 0x1A505800, 0x1A535800, 0x1A565800, 0x1A595800,
+    0x1A5C5800, 0x1A5F5800, 0x1A625800, 0x1A655800, 0x1A685800, 0x1A6B5800, 0x1A6E5800, 0x1A715800,
+    0x1A745800, 0x1A775800, 0x1A7A5800, 0x1A7D5800, 0x1A805800, 0x1A835800, 0x1A865800, 0x1A895800,
+    0x1A8C5800, 0x1A8F5800, 0x1A925800, 0x1A955800, 0x1A985800, 0x1A9B5800, 0x1A9E5800, 0x1AA15800,
+    0x1AA45800, 0x1AA75800, 0x1AAA5800, 0x1AAD5800, 0x1AB05800, 0x1AB35800, 0x1AB65800, 0x1AB95800,
+    0x1ABC5800, 0x1ABF5800, 0x1AC35800, 0x1AC75800, 0x1ACB5800, 0x1ACF5800, 0x1AD35800, 0x1AD75800,
+    0x1ADB5800, 0x1ADF5800, 0x1AE35800, 0x1AE75800, 0x1AEB5800, 0x1AEF5800, 0x1AF35800, 0x1AF75800,
+    0x1AFB5800, 0x1AFF5800, 0x1B035800, 0x1B075800, 0x1B0B5800, 0x1B0F5800, 0x1B135800, 0x1B175800,
+    0x1B1B5800, 0x1B1F5800, 0x1B245800, 0x1B295800, 0x1B2E5800, 0x1B325800, 0x1B375800, 0x1B3B5800,
+    0x1B405800, 0x1B435800, 0x1B465800, 0x1B495800, 0x1B4C5800, 0x1B4F5800, 0x1B525800, 0x1B555800,
+    0x1B585800, 0x1B5B5800, 0x1B5E5800, 0x1B615800, 0x1B645800, 0x1B675800, 0x1B6A5800, 0x1B6D5800,
+    0x1B705800, 0x1B735800, 0x1B765800, 0x1B795800, 0x1B7C5800, 0x1B7F5800, 0x1B825800, 0x1B855800,
+    0x1B885800, 0x1B8B5800, 0x1B8E5800, 0x1B915800, 0x1B945800, 0x1B975800, 0x1B9A5800, 0x1B9D5800,
+    0x1BA05800, 0x1BA35800, 0x1BA65800, 0x1BA95800, 0x1BAC5800, 0x1BAF5800, 0x1BB25800, 0x1BB55800,
+    0x1BB85800, 0x1BBB5800, 0x1BBE5800, 0x1BC15800, 0x1BC45800, 0x1BC75800, 0x1BCA5800, 0x1BCD5800,
+    0x1BD15800, 0x1BD85800, 0x1BDE5800, 0x1BE55800, 0x1BEA5800, 0x1BF15800, 0x1BF65800, 0x1BFB5800,
+    0x1C035800, 0x1C095800, 0x1C0E5800, 0x1C135800, 0x1C185800, 0x1C1E5800, 0x1C245800, 0x1C2A5800,
+    0x1C305800, 0x1C365800, 0x1C3C5800, 0x1C425800, 0x1C4A5800, 0x1C4E5800, 0x1C565800, 0x1C5E5800,
+    0x1C655800, 0x1C6B5800, 0x1C735800, 0x1C7B5800, 0x1C815800, 0x1C865800, 0x1C8B5800, 0x1C915800,
+    0x1C975800, 0x1C9E5800, 0x1CA55800, 0x1CAA5800, 0x1CAF5800, 0x1CB55800, 0x1CBA5800, 0x1CBF5800,
+    0x1CC35800, 0x1CC75800, 0x1CCC5800, 0x1CD15800, 0x1CD95800, 0x1CDF5800, 0x1CE65800, 0x1CEE5800,
+    0x1CF45800, 0x1CF95800, 0x1CFE5800, 0x1D065800, 0x1D0C5800, 0x1D145800, 0x1D195800, 0x1D205800,
+    0x1D255800, 0x1D2B5800, 0x1D305800, 0x1D365800, 0x1D3D5800, 0x1D435800, 0x1D4A5800, 0x1D505800,
+    0x1D545800, 0x1D5B5800, 0x1D605800, 0x1D655800, 0x1D6B5800, 0x1D705800, 0x1D755800, 0x1D7A5800,
+    0x1D815800, 0x1D875800, 0x1D8B5800, 0x1D935800, 0x1D985800, 0x1D9F5800, 0x1DA55800, 0x1DAB5800,
+    0x1DB05800, 0x1DB55800, 0x1DBB5800, 0x1DBF5800, 0x1DC55800, 0x1DCC5800, 0x1DD05800, 0x1DD85800,
+    0x1DDD5800, 0x1DE15800, 0x1DE55800, 0x1DE95800, 0x1DED5800, 0x1DF15800, 0x1DF55800, 0x1DF95800,
+    0x1DFD5800, 0x1E015800, 0x1E055800, 0x1E0A5800, 0x1E0F5800, 0x1E145800, 0x1E195800, 0x1E1E5800,
+    0x1E235800, 0x1E285800, 0x1E2D5800, 0x1E325800, 0x1E375800, 0x1E3C5800, 0x1E415800, 0x1E465800,
+    0x1E4B5800, 0x1E505800, 0x1E555800, 0x1E595800, 0x1E5D5800, 0x1E625800, 0x1E665800, 0x1E6A5800,
+    0x1E6E5800, 0x1E735800, 0x1E785800, 0x1E7C5800, 0x1E805800, 0x1E845800, 0x1E885800, 0x1E8C5800,
+    0x1E925800, 0x1E965800, 0x1E9A5800, 0x1E9E5800, 0x1EA25800, 0x1EA65800, 0x1EAA5800, 0x1EAE5800,
+    0x1EB25800, 0x1EB75800, 0x1EBD5800, 0x1EC15800, 0x1EC55800, 0x1EC95800, 0x1ECD5800, 0x1ED15800,
+    0x1ED55800, 0x1ED95800, 0x1EDE5800, 0x1EE35800, 0x1EE85800, 0x1EED5800, 0x1EF15800, 0x1EF55800,
+    0x1EF95800, 0x1EFD5800, 0x1F015800, 0x1F055800, 0x1F095800, 0x1F0D5800, 0x1F115800, 0x1F155800,
+    0x1F1A5800, 0x1F1F5800, 0x1F235800, 0x1F285800, 0x1F2D5800, 0x1F325800, 0x1F365800, 0x1F3B5800,
+    0x1F405800, 0x1F465800, 0x1F4A5800, 0x1F4F5800, 0x1F545800, 0x1F595800, 0x1F5E5800, 0x1F655800,
+    0x1F6D5800, 0x1F715800, 0x1F755800, 0x1F795800, 0x1F7D5800, 0x1F815800, 0x1F855800, 0x1F895800,
+    0x1F8D5800, 0x1F915800, 0x1F955800, 0x1F995800, 0x1F9D5800, 0x1FA15800, 0x1FA55800, 0x1FA95800,
+    0x1FAD5800, 0x1FB15800, 0x1FB55800, 0x1FBB5800, 0x1FBF5800, 0x1FC35800, 0x1FC75800, 0x1FCD5800,
+    0x1FD25800, 0x1FD65800, 0x1FDA5800, 0x1FDE5800, 0x1FE25800, 0x1FE65800, 0x1FEA5800, 0x1FEE5800,
+    0x1FF25800, 0x1FF65800, 0x1FFA5800, 0x1FFF5800, 0x20035800, 0x20075800, 0x200C5800, 0x20115800,
+    0x20155800, 0x201B5800, 0x20205800, 0x20245800, 0x20285800, 0x202C5800, 0x20305800, 0x20355800,
+    0x203A5800, 0x203E5800, 0x20425800, 0x20465800, 0x204A5800, 0x204E5800, 0x20525800, 0x20565800,
+    0x205A5800, 0x205E5800, 0x20635800, 0x20685800, 0x206D5800, 0x20725800, 0x20775800, 0x207C5800,
+    0x20815800, 0x20865800, 0x208B5800, 0x20905800, 0x20955800, 0x209A5800, 0x209F5800, 0x20A45800,
+    0x20A95800, 0x20AE5800, 0x20B35800, 0x20B85800, 0x20BD5800, 0x20C25800, 0x20C75800, 0x20CC5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20D15800, 0x20D45800, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x20D75800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x20DA5800, 0x20DD5800, 0x20E05800, 0x00000000, 0x00000000, 0x00000000,
+    0x20E35800, 0x20E65800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x000000DC, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x00000000, 0x000000E6, 0x000000E6, 0x000000DC, 0x00000000, 0x00000000, 0x000000E6,
+    0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6,
+    0x00000000, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20E95800, 0x20EC5800, 0x20EF5800, 0x20F25800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x20F55800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+    0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x20F81B00, 0x20FA1B00, 0x20FC1B00, 0x20FE1B00, 0x21001B00, 0x21021B00, 0x21041B00, 0x21061B00,
+    0x21081B00, 0x210A1B00, 0x210C1B00, 0x210E1B00, 0x21101B00, 0x21121B00, 0x21141B00, 0x21161B00,
+    0x21181B00, 0x211A1B00, 0x211C1B00, 0x211E1B00, 0x21201B00, 0x21221B00, 0x21241B00, 0x21261B00,
+    0x21281B00, 0x212A1B00, 0x212C1B00, 0x212E1B00, 0x21301B00, 0x21321B00, 0x21341B00, 0x21361B00,
+    0x21381B00, 0x213A1B00, 0x213C1B00, 0x213E1B00, 0x21401B00, 0x21421B00, 0x21441B00, 0x21461B00,
+    0x21481B00, 0x214A1B00, 0x214C1B00, 0x214E1B00, 0x21501B00, 0x21521B00, 0x21541B00, 0x21561B00,
+    0x21581B00, 0x215A1B00, 0x215C1B00, 0x215E1B00, 0x21601B00, 0x21621B00, 0x21641B00, 0x21661B00,
+    0x21681B00, 0x216A1B00, 0x216C1B00, 0x216E1B00, 0x21701B00, 0x21721B00, 0x21741B00, 0x21761B00,
+    0x21781B00, 0x217A1B00, 0x217C1B00, 0x217E1B00, 0x21801B00, 0x21821B00, 0x21841B00, 0x21861B00,
+    0x21881B00, 0x218A1B00, 0x218C1B00, 0x218E1B00, 0x21901B00, 0x21921B00, 0x21941B00, 0x21961B00,
+    0x21981B00, 0x219A1B00, 0x219C1B00, 0x219E1B00, 0x21A01B00, 0x21A21B00, 0x21A41B00, 0x21A61B00,
+    0x21A81B00, 0x21AA1B00, 0x21AC1B00, 0x21AE1B00, 0x21B01B00, 0x21B21B00, 0x21B41B00, 0x21B61B00,
+    0x21B81B00, 0x21BA1B00, 0x21BC1B00, 0x21BE1B00, 0x21C01B00, 0x21C21B00, 0x21C41B00, 0x21C61B00,
+    0x21C81B00, 0x21CA1B00, 0x21CC1B00, 0x21CE1B00, 0x21D01B00, 0x21D21B00, 0x21D41B00, 0x21D61B00,
+    0x21D81B00, 0x21DA1B00, 0x21DC1B00, 0x21DE1B00, 0x21E01B00, 0x21E21B00, 0x21E41B00, 0x21E61B00,
+    0x21E81B00, 0x21EA1B00, 0x21EC1B00, 0x21EE1B00, 0x21F01B00, 0x21F21B00, 0x21F41B00, 0x21F61B00,
+    0x21F81B00, 0x21FA1B00, 0x21FC1B00, 0x21FE1B00, 0x22001B00, 0x22021B00, 0x22041B00, 0x22061B00,
+    0x22081B00, 0x220A1B00, 0x220C1B00, 0x220E1B00, 0x22101B00, 0x22121B00, 0x22141B00, 0x22161B00,
+    0x22181B00, 0x221A1B00, 0x221C1B00, 0x221E1B00, 0x22201B00, 0x22221B00, 0x22241B00, 0x22261B00,
+    0x22281B00, 0x222A1B00, 0x222C1B00, 0x222E1B00, 0x22301B00, 0x22321B00, 0x22341B00, 0x22361B00,
+    0x22381B00, 0x223A1B00, 0x223C1B00, 0x223E1B00, 0x22401B00, 0x22421B00, 0x22441B00, 0x22461B00,
+    0x22481B00, 0x224A1B00, 0x224C1B00, 0x224E1B00, 0x22501B00, 0x22521B00, 0x22541B00, 0x22561B00,
+    0x22581B00, 0x225A1B00, 0x225C1B00, 0x225E1B00, 0x22601B00, 0x22621B00, 0x22641B00, 0x22661B00,
+    0x22681B00, 0x226A1B00, 0x226C1B00, 0x226E1B00, 0x22701B00, 0x22721B00, 0x22741B00, 0x22761B00,
+    0x22781B00, 0x227A1B00, 0x227C1B00, 0x227E1B00, 0x22801B00, 0x22821B00, 0x22841B00, 0x22861B00,
+    0x22881B00, 0x228A1B00, 0x228C1B00, 0x228E1B00, 0x22901B00, 0x22921B00, 0x22941B00, 0x22961B00,
+    0x22981B00, 0x229A1B00, 0x229C1B00, 0x229E1B00, 0x22A01B00, 0x22A21B00, 0x22A41B00, 0x22A61B00,
+    0x22A81B00, 0x22AA1B00, 0x22AC1B00, 0x22AE1B00, 0x22B01B00, 0x22B21B00, 0x22B41B00, 0x22B61B00,
+    0x22B81B00, 0x22BA1B00, 0x22BC1B00, 0x22BE1B00, 0x22C01B00, 0x22C21B00, 0x22C41B00, 0x22C61B00,
+    0x22C81B00, 0x22CA1B00, 0x22CC1B00, 0x22CE1B00, 0x22D01B00, 0x22D21B00, 0x22D41B00, 0x22D61B00,
+    0x22D81B00, 0x22DA1B00, 0x22DC1B00, 0x22DE1B00, 0x22E01B00, 0x22E21B00, 0x22E41B00, 0x22E61B00,
+    0x22E81B00, 0x22EA1B00, 0x22EC1B00, 0x22EE1B00, 0x22F01B00, 0x22F21B00, 0x22F41B00, 0x22F61B00,
+    0x22F81B00, 0x22FA1B00, 0x22FC1B00, 0x22FE1B00, 0x23001B00, 0x23021B00, 0x23041B00, 0x23061B00,
+    0x23081B00, 0x230A1B00, 0x230C1B00, 0x230E1B00, 0x23101B00, 0x23121B00, 0x00000000, 0x00000000,
+    0x23141B00, 0x00000000, 0x23161B00, 0x00000000, 0x00000000, 0x23181B00, 0x231A1B00, 0x231C1B00,
+    0x231E1B00, 0x23201B00, 0x23221B00, 0x23241B00, 0x23261B00, 0x23281B00, 0x232A1B00, 0x00000000,
+    0x232C1B00, 0x00000000, 0x232E1B00, 0x00000000, 0x00000000, 0x23301B00, 0x23321B00, 0x00000000,
+    0x00000000, 0x00000000, 0x23341B00, 0x23361B00, 0x23381B00, 0x233A1B00, 0x233C1B00, 0x233E1B00,
+    0x23401B00, 0x23421B00, 0x23441B00, 0x23461B00, 0x23481B00, 0x234A1B00, 0x234C1B00, 0x234E1B00,
+    0x23501B00, 0x23521B00, 0x23541B00, 0x23561B00, 0x23581B00, 0x235A1B00, 0x235C1B00, 0x235E1B00,
+    0x23601B00, 0x23621B00, 0x23641B00, 0x23661B00, 0x23681B00, 0x236A1B00, 0x236C1B00, 0x236E1B00,
+    0x23701B00, 0x23721B00, 0x23741B00, 0x23761B00, 0x23781B00, 0x237A1B00, 0x237C1B00, 0x237E1B00,
+    0x23801B00, 0x23821B00, 0x23841B00, 0x23861B00, 0x23881B00, 0x238A1B00, 0x238C1B00, 0x238E1B00,
+    0x23901B00, 0x23921B00, 0x23941B00, 0x23961B00, 0x23981B00, 0x239A1B00, 0x239C1B00, 0x239E1B00,
+    0x23A01B00, 0x23A21B00, 0x23A41B00, 0x23A61B00, 0x23A81B00, 0x23AA1B00, 0x23AC1B00, 0x23AE1B00,
+    0x23B01B00, 0x23B21B00, 0x23B41B00, 0x23B61B00, 0x23B81B00, 0x23BA1B00, 0x00000000, 0x00000000,
+    0x23BC1B00, 0x23BE1B00, 0x23C01B00, 0x23C21B00, 0x23C41B00, 0x23C61B00, 0x23C81B00, 0x23CA1B00,
+    0x23CC1B00, 0x23CE1B00, 0x23D01B00, 0x23D21B00, 0x23D41B00, 0x23D61B00, 0x23D81B00, 0x23DA1B00,
+    0x23DC1B00, 0x23DE1B00, 0x23E01B00, 0x23E21B00, 0x23E41B00, 0x23E61B00, 0x23E81B00, 0x23EA1B00,
+    0x23EC1B00, 0x23EE1B00, 0x23F01B00, 0x23F21B00, 0x23F41B00, 0x23F61B00, 0x23F81B00, 0x23FA1B00,
+    0x23FC1B00, 0x23FE1B00, 0x24001B00, 0x24021B00, 0x24041B00, 0x24061B00, 0x24081B00, 0x240A1B00,
+    0x240C1B00, 0x240E1B00, 0x24101B00, 0x24121B00, 0x24141B00, 0x24161B00, 0x24181B00, 0x241A1B00,
+    0x241C1B00, 0x241E1B00, 0x24201B00, 0x24221B00, 0x24241B00, 0x24261B00, 0x24281B00, 0x242A1B00,
+    0x242C1B00, 0x242E1B00, 0x24301B00, 0x24321B00, 0x24341B00, 0x24361B00, 0x24381B00, 0x243A1B00,
+    0x243C1B00, 0x243E1B00, 0x24401B00, 0x24421B00, 0x24441B00, 0x24461B00, 0x24481B00, 0x244A1B00,
+    0x244C1B00, 0x244E1B00, 0x24501B00, 0x24521B00, 0x24541B00, 0x24561B00, 0x24581B00, 0x245A1B00,
+    0x245C1B00, 0x245E1B00, 0x24601B00, 0x24621B00, 0x24641B00, 0x24661B00, 0x24681B00, 0x246A1B00,
+    0x246C1B00, 0x246E1B00, 0x24701B00, 0x24721B00, 0x24741B00, 0x24761B00, 0x24781B00, 0x247A1B00,
+    0x247C1B00, 0x247E1B00, 0x24801B00, 0x24821B00, 0x24841B00, 0x24861B00, 0x24881B00, 0x248A1B00,
+    0x248C1B00, 0x248E1B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x24905800, 0x24945800, 0x24985800, 0x249C5800, 0x24A15800, 0x24A65800, 0x24AA5800, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x24AE5800, 0x24B25800, 0x24B65800, 0x24BA5800, 0x24BE5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x24C21B00, 0x0000001A, 0x24C51B00,
+    0x24C85800, 0x24CB5800, 0x24CE5800, 0x24D15800, 0x24D45800, 0x24D75800, 0x24DA5800, 0x24DD5800,
+    0x24E05800, 0x24E35800, 0x24E61B00, 0x24E91B00, 0x24EC1B00, 0x24F01B00, 0x24F41B00, 0x24F71B00,
+    0x24FA1B00, 0x24FD1B00, 0x25001B00, 0x25031B00, 0x25061B00, 0x25091B00, 0x250C1B00, 0x00000000,
+    0x250F1B00, 0x25121B00, 0x25151B00, 0x25181B00, 0x251B1B00, 0x00000000, 0x251E1B00, 0x00000000,
+    0x25211B00, 0x25241B00, 0x00000000, 0x25271B00, 0x252A1B00, 0x00000000, 0x252D1B00, 0x25301B00,
+    0x25331B00, 0x25361B00, 0x25391B00, 0x253C1B00, 0x253F1B00, 0x25421B00, 0x25451B00, 0x25485800,
+    0x254C5800, 0x254F5800, 0x25525800, 0x25555800, 0x25585800, 0x255B5800, 0x255E5800, 0x25615800,
+    0x25645800, 0x25675800, 0x256A5800, 0x256D5800, 0x25705800, 0x25735800, 0x25765800, 0x25795800,
+    0x257C5800, 0x257F5800, 0x25825800, 0x25855800, 0x25885800, 0x258B5800, 0x258E5800, 0x25915800,
+    0x25945800, 0x25975800, 0x259A5800, 0x259D5800, 0x25A05800, 0x25A35800, 0x25A65800, 0x25A95800,
+    0x25AC5800, 0x25AF5800, 0x25B25800, 0x25B55800, 0x25B85800, 0x25BB5800, 0x25BE5800, 0x25C15800,
+    0x25C45800, 0x25C75800, 0x25CA5800, 0x25CD5800, 0x25D05800, 0x25D35800, 0x25D65800, 0x25D95800,
+    0x25DC5800, 0x25DF5800, 0x25E25800, 0x25E55800, 0x25E85800, 0x25EB5800, 0x25EE5800, 0x25F15800,
+    0x25F45800, 0x25F75800, 0x25FA5800, 0x25FD5800, 0x26005800, 0x26035800, 0x26065800, 0x26095800,
+    0x260C5800, 0x260F5800, 0x26125800, 0x26155800, 0x26185800, 0x261B5800, 0x261E5800, 0x26215800,
+    0x26245800, 0x26275800, 0x262A5800, 0x262D5800, 0x26305800, 0x26335800, 0x26365800, 0x26395800,
+    0x263C5800, 0x263F5800, 0x26425800, 0x26455800, 0x26485800, 0x264C5800, 0x26505800, 0x26535800,
+    0x26565800, 0x26595800, 0x265C5800, 0x265F5800, 0x26625800, 0x26655800, 0x26685800, 0x266B5800,
+    0x266E5800, 0x26725800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x26765800, 0x26795800, 0x267C5800, 0x267F5800, 0x26825800,
+    0x26855800, 0x26885800, 0x268B5800, 0x268E5800, 0x26915800, 0x26945800, 0x26985800, 0x269B5800,
+    0x269E5800, 0x26A15800, 0x26A45800, 0x26A75800, 0x26AA5800, 0x26AD5800, 0x26B05800, 0x26B35800,
+    0x26B65800, 0x26B95800, 0x26BC5800, 0x26C15800, 0x26C65800, 0x26CB5800, 0x26D05800, 0x26D55800,
+    0x26DA5800, 0x26DF5800, 0x26E45800, 0x26E95800, 0x26EE5800, 0x26F35800, 0x26F85800, 0x26FD5800,
+    0x27025800, 0x27075800, 0x270C5800, 0x27115800, 0x27165800, 0x27195800, 0x271C5800, 0x271F5800,
+    0x27225800, 0x27275800, 0x272C5800, 0x27315800, 0x27365800, 0x273B5800, 0x273F5800, 0x27435800,
+    0x27475800, 0x274B5800, 0x274F5800, 0x27535800, 0x27575800, 0x275B5800, 0x275F5800, 0x27635800,
+    0x27675800, 0x276B5800, 0x276F5800, 0x27735800, 0x27775800, 0x277B5800, 0x277F5800, 0x27835800,
+    0x27875800, 0x278B5800, 0x278F5800, 0x27935800, 0x27975800, 0x279B5800, 0x279F5800, 0x27A35800,
+    0x27A75800, 0x27AB5800, 0x27AF5800, 0x27B35800, 0x27B75800, 0x27BB5800, 0x27BF5800, 0x27C35800,
+    0x27C75800, 0x27CB5800, 0x27CF5800, 0x27D35800, 0x27D75800, 0x27DB5800, 0x27DF5800, 0x27E35800,
+    0x27E75800, 0x27EB5800, 0x27EF5800, 0x27F35800, 0x27F75800, 0x27FB5800, 0x27FF5800, 0x28035800,
+    0x28075800, 0x280B5800, 0x280F5800, 0x28135800, 0x28175800, 0x281B5800, 0x281F5800, 0x28235800,
+    0x28275800, 0x282B5800, 0x282F5800, 0x28335800, 0x28375800, 0x283B5800, 0x283F5800, 0x28435800,
+    0x28475800, 0x284B5800, 0x284F5800, 0x28535800, 0x28575800, 0x285B5800, 0x285F5800, 0x28635800,
+    0x28675800, 0x286B5800, 0x286F5800, 0x28735800, 0x28775800, 0x287B5800, 0x287F5800, 0x28835800,
+    0x28875800, 0x288B5800, 0x288F5800, 0x28935800, 0x28975800, 0x289B5800, 0x289F5800, 0x28A45800,
+    0x28A95800, 0x28AE5800, 0x28B35800, 0x28B85800, 0x28BD5800, 0x28C25800, 0x28C75800, 0x28CC5800,
+    0x28D15800, 0x28D65800, 0x28DB5800, 0x28DF5800, 0x28E35800, 0x28E75800, 0x28EB5800, 0x28EF5800,
+    0x28F35800, 0x28F75800, 0x28FB5800, 0x28FF5800, 0x29035800, 0x29075800, 0x290B5800, 0x290F5800,
+    0x29135800, 0x29175800, 0x291B5800, 0x291F5800, 0x29235800, 0x29275800, 0x292B5800, 0x292F5800,
+    0x29335800, 0x29375800, 0x293B5800, 0x293F5800, 0x29435800, 0x29475800, 0x294B5800, 0x294F5800,
+    0x29535800, 0x29575800, 0x295B5800, 0x295F5800, 0x29635800, 0x29675800, 0x296B5800, 0x296F5800,
+    0x29735800, 0x29775800, 0x297B5800, 0x297F5800, 0x29835800, 0x29875800, 0x298B5800, 0x298F5800,
+    0x29945800, 0x29995800, 0x299E5800, 0x29A35800, 0x29A85800, 0x29AC5800, 0x29B05800, 0x29B45800,
+    0x29B85800, 0x29BC5800, 0x29C05800, 0x29C45800, 0x29C85800, 0x29CC5800, 0x29D05800, 0x29D45800,
+    0x29D85800, 0x29DC5800, 0x29E05800, 0x29E45800, 0x29E85800, 0x29EC5800, 0x29F05800, 0x29F45800,
+    0x29F85800, 0x29FC5800, 0x2A005800, 0x2A045800, 0x2A085800, 0x2A0C5800, 0x2A105800, 0x2A145800,
+    0x2A185800, 0x2A1C5800, 0x2A205800, 0x2A245800, 0x2A285800, 0x2A2C5800, 0x2A305800, 0x2A345800,
+    0x2A385800, 0x2A3C5800, 0x2A405800, 0x2A445800, 0x2A485800, 0x2A4C5800, 0x2A505800, 0x2A545800,
+    0x2A585800, 0x2A5C5800, 0x2A605800, 0x2A645800, 0x2A685800, 0x2A6C5800, 0x2A705800, 0x2A745800,
+    0x2A785800, 0x2A7C5800, 0x2A805800, 0x2A845800, 0x2A885800, 0x2A8C5800, 0x2A905800, 0x2A945800,
+    0x2A985800, 0x2A9C5800, 0x2AA05800, 0x2AA45800, 0x2AA85800, 0x2AAC5800, 0x2AB05800, 0x2AB45800,
+    0x2AB95800, 0x2ABE5800, 0x2AC25800, 0x2AC65800, 0x2ACA5800, 0x2ACE5800, 0x2AD25800, 0x2AD65800,
+    0x2ADA5800, 0x2ADE5800, 0x2AE25800, 0x2AE65800, 0x2AEA5800, 0x2AEE5800, 0x2AF25800, 0x2AF65800,
+    0x2AFA5800, 0x2AFE5800, 0x2B025800, 0x2B075800, 0x2B0C5800, 0x2B115800, 0x2B155800, 0x2B195800,
+    0x2B1D5800, 0x2B215800, 0x2B255800, 0x2B295800, 0x2B2D5800, 0x2B315800, 0x2B355800, 0x2B395800,
+    0x2B3D5800, 0x2B415800, 0x2B455800, 0x2B495800, 0x2B4D5800, 0x2B515800, 0x2B555800, 0x2B595800,
+    0x2B5D5800, 0x2B615800, 0x2B655800, 0x2B695800, 0x2B6D5800, 0x2B715800, 0x2B755800, 0x2B795800,
+    0x2B7D5800, 0x2B815800, 0x2B855800, 0x2B895800, 0x2B8D5800, 0x2B915800, 0x2B955800, 0x2B995800,
+    0x2B9D5800, 0x2BA15800, 0x2BA55800, 0x2BA95800, 0x2BAD5800, 0x2BB15800, 0x2BB55800, 0x2BB95800,
+    0x2BBD5800, 0x2BC15800, 0x2BC55800, 0x2BC95800, 0x2BCD5800, 0x2BD15800, 0x2BD55800, 0x2BD95800,
+    0x2BDD5800, 0x2BE15800, 0x2BE55800, 0x2BE95800, 0x2BED5800, 0x2BF15800, 0x2BF55800, 0x2BF95800,
+    0x2BFD5800, 0x2C015800, 0x2C055800, 0x2C095800, 0x2C0D5800, 0x2C115800, 0x2C155800, 0x2C195800,
+    0x2C1D5800, 0x2C215800, 0x2C255800, 0x2C295800, 0x2C2D5800, 0x2C315800, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x2C355800, 0x2C3A5800, 0x2C3F5800, 0x2C445800, 0x2C495800, 0x2C4E5800, 0x2C535800, 0x2C585800,
+    0x2C5D5800, 0x2C625800, 0x2C675800, 0x2C6C5800, 0x2C715800, 0x2C765800, 0x2C7B5800, 0x2C805800,
+    0x2C855800, 0x2C8A5800, 0x2C8F5800, 0x2C945800, 0x2C995800, 0x2C9E5800, 0x2CA35800, 0x2CA85800,
+    0x2CAD5800, 0x2CB25800, 0x2CB75800, 0x2CBC5800, 0x2CC15800, 0x2CC65800, 0x2CCB5800, 0x2CD05800,
+    0x2CD55800, 0x2CDA5800, 0x2CDF5800, 0x2CE45800, 0x2CE95800, 0x2CEE5800, 0x2CF35800, 0x2CF85800,
+    0x2CFD5800, 0x2D025800, 0x2D075800, 0x2D0C5800, 0x2D115800, 0x2D165800, 0x2D1B5800, 0x2D205800,
+    0x2D255800, 0x2D2A5800, 0x2D2F5800, 0x2D345800, 0x2D395800, 0x2D3E5800, 0x2D435800, 0x2D485800,
+    0x2D4D5800, 0x2D525800, 0x2D575800, 0x2D5C5800, 0x2D615800, 0x2D665800, 0x2D6B5800, 0x2D705800,
+    0x00000000, 0x00000000, 0x2D755800, 0x2D7A5800, 0x2D7F5800, 0x2D845800, 0x2D895800, 0x2D8E5800,
+    0x2D935800, 0x2D985800, 0x2D9D5800, 0x2DA25800, 0x2DA75800, 0x2DAC5800, 0x2DB15800, 0x2DB65800,
+    0x2DBB5800, 0x2DC05800, 0x2DC55800, 0x2DCA5800, 0x2DCF5800, 0x2DD45800, 0x2DD95800, 0x2DDE5800,
+    0x2DE35800, 0x2DE85800, 0x2DED5800, 0x2DF25800, 0x2DF75800, 0x2DFC5800, 0x2E015800, 0x2E065800,
+    0x2E0B5800, 0x2E105800, 0x2E155800, 0x2E1A5800, 0x2E1F5800, 0x2E245800, 0x2E295800, 0x2E2E5800,
+    0x2E335800, 0x2E385800, 0x2E3D5800, 0x2E425800, 0x2E475800, 0x2E4C5800, 0x2E515800, 0x2E565800,
+    0x2E5B5800, 0x2E605800, 0x2E655800, 0x2E6A5800, 0x2E6F5800, 0x2E745800, 0x2E795800, 0x2E7E5800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x2E835800, 0x2E885800, 0x2E8D5800, 0x2E935800, 0x2E995800, 0x2E9F5800, 0x2EA55800, 0x2EAB5800,
+    0x2EB15800, 0x2EB75800, 0x2EBC5800, 0x2ED05800, 0x2EDA5800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x2EE05800, 0x2EE35800, 0x2EE65800, 0x2EE95800, 0x2EEC5800, 0x2EEF5800, 0x2EF25800, 0x2EF55800,
+    0x2EF85800, 0x2EFB5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000E6, 0x000000E6,
+    0x2F005800, 0x2F045800, 0x2F075800, 0x2F0A5800, 0x2F0D5800, 0x2F105800, 0x2F135800, 0x2F165800,
+    0x2F195800, 0x2F1C5800, 0x2F1F5800, 0x2F225800, 0x2F255800, 0x2F285800, 0x2F2B5800, 0x2F2E5800,
+    0x2F315800, 0x2F345800, 0x2F375800, 0x2F3A5800, 0x2F3D5800, 0x00000000, 0x00000000, 0x2F405800,
+    0x2F435800, 0x2F465800, 0x2F4A5800, 0x2F4E5800, 0x2F525800, 0x2F565800, 0x2F595800, 0x2F5C5800,
+    0x2F5F5800, 0x2F625800, 0x2F655800, 0x00000000, 0x2F685800, 0x2F6B5800, 0x2F6E5800, 0x2F715800,
+    0x2F745800, 0x2F775800, 0x2F7A5800, 0x2F7D5800, 0x2F805800, 0x2F835800, 0x2F865800, 0x2F895800,
+    0x2F8C5800, 0x2F8F5800, 0x2F925800, 0x2F955800, 0x2F985800, 0x2F9B5800, 0x2F9E5800, 0x00000000,
+    0x2FA15800, 0x2FA45800, 0x2FA75800, 0x2FAA5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x2FAD5800, 0x2FB15800, 0x2FB55800, 0x00000000, 0x2FB95800, 0x00000000, 0x2FBD5800, 0x2FC15800,
+    0x2FC55800, 0x2FC95800, 0x2FCD5800, 0x2FD15800, 0x2FD55800, 0x2FD95800, 0x2FDD5800, 0x2FE15800,
+    0x2FE55800, 0x2FE85800, 0x2FEC5800, 0x2FF05800, 0x2FF45800, 0x2FF85800, 0x2FFC5800, 0x30005800,
+    0x30045800, 0x30085800, 0x300C5800, 0x30105800, 0x30145800, 0x30185800, 0x301B5800, 0x301E5800,
+    0x30215800, 0x30245800, 0x30275800, 0x302A5800, 0x302D5800, 0x30305800, 0x30335800, 0x30365800,
+    0x30395800, 0x303C5800, 0x303F5800, 0x30425800, 0x30455800, 0x30485800, 0x304B5800, 0x304E5800,
+    0x30515800, 0x30545800, 0x30575800, 0x305A5800, 0x305D5800, 0x30605800, 0x30635800, 0x30665800,
+    0x30695800, 0x306C5800, 0x306F5800, 0x30725800, 0x30755800, 0x30785800, 0x307B5800, 0x307E5800,
+    0x30815800, 0x30845800, 0x30875800, 0x308A5800, 0x308D5800, 0x30905800, 0x30935800, 0x30965800,
+    0x30995800, 0x309C5800, 0x309F5800, 0x30A25800, 0x30A55800, 0x30A85800, 0x30AB5800, 0x30AE5800,
+    0x30B15800, 0x30B45800, 0x30B75800, 0x30BA5800, 0x30BD5800, 0x30C05800, 0x30C35800, 0x30C65800,
+    0x30C95800, 0x30CC5800, 0x30CF5800, 0x30D25800, 0x30D55800, 0x30D85800, 0x30DB5800, 0x30DE5800,
+    0x30E15800, 0x30E45800, 0x30E75800, 0x30EA5800, 0x30ED5800, 0x30F05800, 0x30F35800, 0x30F65800,
+    0x30F95800, 0x30FC5800, 0x30FF5800, 0x31025800, 0x31055800, 0x31085800, 0x310B5800, 0x310E5800,
+    0x31115800, 0x31145800, 0x31175800, 0x311A5800, 0x311D5800, 0x31205800, 0x31235800, 0x31265800,
+    0x31295800, 0x312C5800, 0x312F5800, 0x31325800, 0x31355800, 0x31385800, 0x313B5800, 0x313E5800,
+    0x31415800, 0x31445800, 0x31475800, 0x314A5800, 0x314D5800, 0x31505800, 0x31555800, 0x315A5800,
+    0x315F5800, 0x31645800, 0x31695800, 0x316E5800, 0x31725800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x31765800, 0x31795800, 0x317C5800, 0x317F5800, 0x31825800, 0x31855800, 0x31885800,
+    0x318B5800, 0x318E5800, 0x31915800, 0x31945800, 0x31975800, 0x319A5800, 0x319D5800, 0x31A05800,
+    0x31A35800, 0x31A65800, 0x31A95800, 0x31AC5800, 0x31AF5800, 0x31B25800, 0x31B55800, 0x31B85800,
+    0x31BB5800, 0x31BE5800, 0x31C15800, 0x31C45800, 0x31C75800, 0x31CA5800, 0x31CD5800, 0x31D05800,
+    0x31D35800, 0x31D65800, 0x31D95800, 0x31DC5800, 0x31DF5800, 0x31E25800, 0x31E55800, 0x31E85800,
+    0x31EB5800, 0x31EE5800, 0x31F15800, 0x31F45800, 0x31F75800, 0x31FA5800, 0x31FD5800, 0x32005800,
+    0x32035800, 0x32065800, 0x32095800, 0x320C5800, 0x320F5800, 0x32125800, 0x32155800, 0x32185800,
+    0x321B5800, 0x321E5800, 0x32215800, 0x32245800, 0x32275800, 0x322A5800, 0x322D5800, 0x32305800,
+    0x32335800, 0x32365800, 0x32395800, 0x323C5800, 0x323F5800, 0x32425800, 0x32455800, 0x32485800,
+    0x324B5800, 0x324E5800, 0x32515800, 0x32545800, 0x32575800, 0x325A5800, 0x325D5800, 0x32605800,
+    0x32635800, 0x32665800, 0x32695800, 0x326C5800, 0x326F5800, 0x32725800, 0x32755800, 0x32785800,
+    0x327B5800, 0x327E5800, 0x32815800, 0x32845800, 0x32875800, 0x328A5800, 0x328D5800, 0x32905800,
+    0x32935800, 0x32965800, 0x32995800, 0x329C5800, 0x329F5800, 0x32A25800, 0x32A55800, 0x32A85800,
+    0x32AB5800, 0x32AE5800, 0x32B15800, 0x32B45800, 0x32B75800, 0x32BA5800, 0x32BD5800, 0x32C05800,
+    0x32C35800, 0x32C65800, 0x32C95800, 0x32CC5800, 0x32CF5800, 0x32D25800, 0x32D55800, 0x32D85800,
+    0x32DB5800, 0x32DE5800, 0x32E15800, 0x32E45800, 0x32E75800, 0x32EA5800, 0x32ED5800, 0x32F05800,
+    0x32F35800, 0x32F65800, 0x32F95800, 0x32FC5800, 0x32FF5800, 0x33025800, 0x33055800, 0x33085800,
+    0x330B5800, 0x330E5800, 0x33115800, 0x33145800, 0x33175800, 0x331A5800, 0x331D5800, 0x33205800,
+    0x33235800, 0x33265800, 0x33295800, 0x332C5800, 0x332F5800, 0x33325800, 0x33355800, 0x33385800,
+    0x333B5800, 0x333E5800, 0x33415800, 0x33445800, 0x33475800, 0x334A5800, 0x334D5800, 0x33505800,
+    0x33535800, 0x33565800, 0x33595800, 0x335C5800, 0x335F5800, 0x33625800, 0x33655800, 0x33685800,
+    0x336B5800, 0x336E5800, 0x33715800, 0x33745800, 0x33775800, 0x337A5800, 0x337D5800, 0x33805800,
+    0x33835800, 0x33865800, 0x33895800, 0x338C5800, 0x338F5800, 0x33925800, 0x33955800, 0x33985800,
+    0x339B5800, 0x339E5800, 0x33A15800, 0x33A45800, 0x33A75800, 0x33AA5800, 0x33AD5800, 0x00000000,
+    0x00000000, 0x00000000, 0x33B05800, 0x33B35800, 0x33B65800, 0x33B95800, 0x33BC5800, 0x33BF5800,
+    0x00000000, 0x00000000, 0x33C25800, 0x33C55800, 0x33C85800, 0x33CB5800, 0x33CE5800, 0x33D15800,
+    0x00000000, 0x00000000, 0x33D45800, 0x33D75800, 0x33DA5800, 0x33DD5800, 0x33E05800, 0x33E35800,
+    0x00000000, 0x00000000, 0x33E65800, 0x33E95800, 0x33EC5800, 0x00000000, 0x00000000, 0x00000000,
+    0x33EF5800, 0x33F25800, 0x33F55800, 0x33F85800, 0x33FC5800, 0x33FF5800, 0x34025800, 0x00000000,
+    0x34055800, 0x34085800, 0x340B5800, 0x340E5800, 0x34115800, 0x34145800, 0x34175800, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x341A0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x341D0900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x34205800, 0x34235800, 0x34265800, 0x34295800, 0x342C5800, 0x00000000, 0x342F5800,
+    0x34325800, 0x34355800, 0x34385800, 0x343B5800, 0x343E5800, 0x34415800, 0x34445800, 0x34475800,
+    0x344A5800, 0x344D5800, 0x34505800, 0x34535800, 0x34565800, 0x34595800, 0x345C5800, 0x345F5800,
+    0x34625800, 0x34655800, 0x34685800, 0x346B5800, 0x346E5800, 0x34715800, 0x34745800, 0x34775800,
+    0x347A5800, 0x347D5800, 0x34805800, 0x34835800, 0x34865800, 0x34895800, 0x348C5800, 0x348F5800,
+    0x34925800, 0x34955800, 0x34985800, 0x349B5800, 0x349E5800, 0x34A15800, 0x34A45800, 0x34A75800,
+    0x34AA5800, 0x00000000, 0x34AD5800, 0x34B05800, 0x34B35800, 0x34B65800, 0x34B95800, 0x34BC5800,
+    0x34BF5800, 0x34C25800, 0x34C55800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x00000000, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x00000001, 0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000DC, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x000000DC,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000000E6, 0x000000DC, 0x000000E6, 0x000000DC, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x34C80900, 0x00000000, 0x34CB0900, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x34CE0900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000009, 0x00002407, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34D10900, 0x34D40900,
+    0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000007, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000007, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000007, 0x00000000, 0x00002400, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x34D70900, 0x34DA0900, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x34DD0900, 0x00000000, 0x34E00900, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34E30900, 0x00000000,
+    0x00000000, 0x34E60900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00002400, 0x00000000, 0x00000000, 0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00002400, 0x00000000, 0x00000000, 0x34E92D00, 0x00000000, 0x34EC2D00,
+    0x34EF2D00, 0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000009,
+    0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00002400, 0x34F20900, 0x34F50900, 0x00002400, 0x34F80900, 0x00000000,
+    0x00000000, 0x00000000, 0x00000009, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x34FB0900, 0x34FE0900, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000007,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000009, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x35010900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000009, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000007, 0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000009, 0x00000009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00002400,
+    0x00002400, 0x35042D00, 0x35072D00, 0x350A2D00, 0x350D2D00, 0x35102D00, 0x35132D00, 0x35172D00,
+    0x351B2D00, 0x00002400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000009,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400,
+    0x351F2D00, 0x35220900, 0x35250900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000006, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35295800, 0x352C5800,
+    0x352F5800, 0x35325800, 0x35355800, 0x35385800, 0x353B5800, 0x353E5800, 0x35415800, 0x35445800,
+    0x35475800, 0x354A5800, 0x354D5800, 0x35505800, 0x35535800, 0x35565800, 0x35595800, 0x355C5800,
+    0x355F5800, 0x35625800, 0x35655800, 0x35685800, 0x356B5800, 0x356E5800, 0x35715800, 0x35745800,
+    0x35775800, 0x357A5800, 0x357D5800, 0x35805800, 0x35835800, 0x35865800, 0x35895800, 0x358C5800,
+    0x358F5800, 0x35925800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35951B00, 0x35981B00,
+    0x359B1B00, 0x359F1B00, 0x35A31B00, 0x35A71B00, 0x35AB1B00, 0x000000D8, 0x000000D8, 0x00000001,
+    0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x000000E2, 0x000000D8, 0x000000D8,
+    0x000000D8, 0x000000D8, 0x000000D8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC,
+    0x000000DC, 0x000000DC, 0x000000DC, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000DC, 0x000000DC, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x35AF1B00, 0x35B21B00, 0x35B51B00, 0x35B91B00, 0x35BD1B00,
+    0x35C11B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x35C55800, 0x35C85800, 0x35CB5800, 0x35CE5800, 0x35D15800, 0x35D45800, 0x35D75800, 0x35DA5800,
+    0x35DD5800, 0x35E05800, 0x35E35800, 0x35E65800, 0x35E95800, 0x35EC5800, 0x35EF5800, 0x35F25800,
+    0x35F55800, 0x35F85800, 0x35FB5800, 0x35FE5800, 0x36015800, 0x36045800, 0x36075800, 0x360A5800,
+    0x360D5800, 0x36105800, 0x36135800, 0x36165800, 0x36195800, 0x361C5800, 0x361F5800, 0x36225800,
+    0x36255800, 0x36285800, 0x362B5800, 0x362E5800, 0x36315800, 0x36345800, 0x36375800, 0x363A5800,
+    0x363D5800, 0x36405800, 0x36435800, 0x36465800, 0x36495800, 0x364C5800, 0x364F5800, 0x36525800,
+    0x36555800, 0x36585800, 0x365B5800, 0x365E5800, 0x36615800, 0x36645800, 0x36675800, 0x366A5800,
+    0x366D5800, 0x36705800, 0x36735800, 0x36765800, 0x36795800, 0x367C5800, 0x367F5800, 0x36825800,
+    0x36855800, 0x36885800, 0x368B5800, 0x368E5800, 0x36915800, 0x36945800, 0x36975800, 0x369A5800,
+    0x369D5800, 0x36A05800, 0x36A35800, 0x36A65800, 0x36A95800, 0x36AC5800, 0x36AF5800, 0x36B25800,
+    0x36B55800, 0x36B85800, 0x36BB5800, 0x36BE5800, 0x36C15800, 0x00000000, 0x36C45800, 0x36C75800,
+    0x36CA5800, 0x36CD5800, 0x36D05800, 0x36D35800, 0x36D65800, 0x36D95800, 0x36DC5800, 0x36DF5800,
+    0x36E25800, 0x36E55800, 0x36E85800, 0x36EB5800, 0x36EE5800, 0x36F15800, 0x36F45800, 0x36F75800,
+    0x36FA5800, 0x36FD5800, 0x37005800, 0x37035800, 0x37065800, 0x37095800, 0x370C5800, 0x370F5800,
+    0x37125800, 0x37155800, 0x37185800, 0x371B5800, 0x371E5800, 0x37215800, 0x37245800, 0x37275800,
+    0x372A5800, 0x372D5800, 0x37305800, 0x37335800, 0x37365800, 0x37395800, 0x373C5800, 0x373F5800,
+    0x37425800, 0x37455800, 0x37485800, 0x374B5800, 0x374E5800, 0x37515800, 0x37545800, 0x37575800,
+    0x375A5800, 0x375D5800, 0x37605800, 0x37635800, 0x37665800, 0x37695800, 0x376C5800, 0x376F5800,
+    0x37725800, 0x37755800, 0x37785800, 0x377B5800, 0x377E5800, 0x37815800, 0x37845800, 0x37875800,
+    0x378A5800, 0x378D5800, 0x37905800, 0x37935800, 0x37965800, 0x00000000, 0x37995800, 0x379C5800,
+    0x00000000, 0x00000000, 0x379F5800, 0x00000000, 0x00000000, 0x37A25800, 0x37A55800, 0x00000000,
+    0x00000000, 0x37A85800, 0x37AB5800, 0x37AE5800, 0x37B15800, 0x00000000, 0x37B45800, 0x37B75800,
+    0x37BA5800, 0x37BD5800, 0x37C05800, 0x37C35800, 0x37C65800, 0x37C95800, 0x37CC5800, 0x37CF5800,
+    0x37D25800, 0x37D55800, 0x00000000, 0x37D85800, 0x00000000, 0x37DB5800, 0x37DE5800, 0x37E15800,
+    0x37E45800, 0x37E75800, 0x37EA5800, 0x37ED5800, 0x00000000, 0x37F05800, 0x37F35800, 0x37F65800,
+    0x37F95800, 0x37FC5800, 0x37FF5800, 0x38025800, 0x38055800, 0x38085800, 0x380B5800, 0x380E5800,
+    0x38115800, 0x38145800, 0x38175800, 0x381A5800, 0x381D5800, 0x38205800, 0x38235800, 0x38265800,
+    0x38295800, 0x382C5800, 0x382F5800, 0x38325800, 0x38355800, 0x38385800, 0x383B5800, 0x383E5800,
+    0x38415800, 0x38445800, 0x38475800, 0x384A5800, 0x384D5800, 0x38505800, 0x38535800, 0x38565800,
+    0x38595800, 0x385C5800, 0x385F5800, 0x38625800, 0x38655800, 0x38685800, 0x386B5800, 0x386E5800,
+    0x38715800, 0x38745800, 0x38775800, 0x387A5800, 0x387D5800, 0x38805800, 0x38835800, 0x38865800,
+    0x38895800, 0x388C5800, 0x388F5800, 0x38925800, 0x38955800, 0x38985800, 0x389B5800, 0x389E5800,
+    0x38A15800, 0x38A45800, 0x38A75800, 0x38AA5800, 0x38AD5800, 0x38B05800, 0x00000000, 0x38B35800,
+    0x38B65800, 0x38B95800, 0x38BC5800, 0x00000000, 0x00000000, 0x38BF5800, 0x38C25800, 0x38C55800,
+    0x38C85800, 0x38CB5800, 0x38CE5800, 0x38D15800, 0x38D45800, 0x00000000, 0x38D75800, 0x38DA5800,
+    0x38DD5800, 0x38E05800, 0x38E35800, 0x38E65800, 0x38E95800, 0x00000000, 0x38EC5800, 0x38EF5800,
+    0x38F25800, 0x38F55800, 0x38F85800, 0x38FB5800, 0x38FE5800, 0x39015800, 0x39045800, 0x39075800,
+    0x390A5800, 0x390D5800, 0x39105800, 0x39135800, 0x39165800, 0x39195800, 0x391C5800, 0x391F5800,
+    0x39225800, 0x39255800, 0x39285800, 0x392B5800, 0x392E5800, 0x39315800, 0x39345800, 0x39375800,
+    0x393A5800, 0x393D5800, 0x00000000, 0x39405800, 0x39435800, 0x39465800, 0x39495800, 0x00000000,
+    0x394C5800, 0x394F5800, 0x39525800, 0x39555800, 0x39585800, 0x00000000, 0x395B5800, 0x00000000,
+    0x00000000, 0x00000000, 0x395E5800, 0x39615800, 0x39645800, 0x39675800, 0x396A5800, 0x396D5800,
+    0x39705800, 0x00000000, 0x39735800, 0x39765800, 0x39795800, 0x397C5800, 0x397F5800, 0x39825800,
+    0x39855800, 0x39885800, 0x398B5800, 0x398E5800, 0x39915800, 0x39945800, 0x39975800, 0x399A5800,
+    0x399D5800, 0x39A05800, 0x39A35800, 0x39A65800, 0x39A95800, 0x39AC5800, 0x39AF5800, 0x39B25800,
+    0x39B55800, 0x39B85800, 0x39BB5800, 0x39BE5800, 0x39C15800, 0x39C45800, 0x39C75800, 0x39CA5800,
+    0x39CD5800, 0x39D05800, 0x39D35800, 0x39D65800, 0x39D95800, 0x39DC5800, 0x39DF5800, 0x39E25800,
+    0x39E55800, 0x39E85800, 0x39EB5800, 0x39EE5800, 0x39F15800, 0x39F45800, 0x39F75800, 0x39FA5800,
+    0x39FD5800, 0x3A005800, 0x3A035800, 0x3A065800, 0x3A095800, 0x3A0C5800, 0x3A0F5800, 0x3A125800,
+    0x3A155800, 0x3A185800, 0x3A1B5800, 0x3A1E5800, 0x3A215800, 0x3A245800, 0x3A275800, 0x3A2A5800,
+    0x3A2D5800, 0x3A305800, 0x3A335800, 0x3A365800, 0x3A395800, 0x3A3C5800, 0x3A3F5800, 0x3A425800,
+    0x3A455800, 0x3A485800, 0x3A4B5800, 0x3A4E5800, 0x3A515800, 0x3A545800, 0x3A575800, 0x3A5A5800,
+    0x3A5D5800, 0x3A605800, 0x3A635800, 0x3A665800, 0x3A695800, 0x3A6C5800, 0x3A6F5800, 0x3A725800,
+    0x3A755800, 0x3A785800, 0x3A7B5800, 0x3A7E5800, 0x3A815800, 0x3A845800, 0x3A875800, 0x3A8A5800,
+    0x3A8D5800, 0x3A905800, 0x3A935800, 0x3A965800, 0x3A995800, 0x3A9C5800, 0x3A9F5800, 0x3AA25800,
+    0x3AA55800, 0x3AA85800, 0x3AAB5800, 0x3AAE5800, 0x3AB15800, 0x3AB45800, 0x3AB75800, 0x3ABA5800,
+    0x3ABD5800, 0x3AC05800, 0x3AC35800, 0x3AC65800, 0x3AC95800, 0x3ACC5800, 0x3ACF5800, 0x3AD25800,
+    0x3AD55800, 0x3AD85800, 0x3ADB5800, 0x3ADE5800, 0x3AE15800, 0x3AE45800, 0x3AE75800, 0x3AEA5800,
+    0x3AED5800, 0x3AF05800, 0x3AF35800, 0x3AF65800, 0x3AF95800, 0x3AFC5800, 0x3AFF5800, 0x3B025800,
+    0x3B055800, 0x3B085800, 0x3B0B5800, 0x3B0E5800, 0x3B115800, 0x3B145800, 0x3B175800, 0x3B1A5800,
+    0x3B1D5800, 0x3B205800, 0x3B235800, 0x3B265800, 0x3B295800, 0x3B2C5800, 0x3B2F5800, 0x3B325800,
+    0x3B355800, 0x3B385800, 0x3B3B5800, 0x3B3E5800, 0x3B415800, 0x3B445800, 0x3B475800, 0x3B4A5800,
+    0x3B4D5800, 0x3B505800, 0x3B535800, 0x3B565800, 0x3B595800, 0x3B5C5800, 0x3B5F5800, 0x3B625800,
+    0x3B655800, 0x3B685800, 0x3B6B5800, 0x3B6E5800, 0x3B715800, 0x3B745800, 0x3B775800, 0x3B7A5800,
+    0x3B7D5800, 0x3B805800, 0x3B835800, 0x3B865800, 0x3B895800, 0x3B8C5800, 0x3B8F5800, 0x3B925800,
+    0x3B955800, 0x3B985800, 0x3B9B5800, 0x3B9E5800, 0x3BA15800, 0x3BA45800, 0x3BA75800, 0x3BAA5800,
+    0x3BAD5800, 0x3BB05800, 0x3BB35800, 0x3BB65800, 0x3BB95800, 0x3BBC5800, 0x3BBF5800, 0x3BC25800,
+    0x3BC55800, 0x3BC85800, 0x3BCB5800, 0x3BCE5800, 0x3BD15800, 0x3BD45800, 0x3BD75800, 0x3BDA5800,
+    0x3BDD5800, 0x3BE05800, 0x3BE35800, 0x3BE65800, 0x3BE95800, 0x3BEC5800, 0x3BEF5800, 0x3BF25800,
+    0x3BF55800, 0x3BF85800, 0x3BFB5800, 0x3BFE5800, 0x3C015800, 0x3C045800, 0x3C075800, 0x3C0A5800,
+    0x3C0D5800, 0x3C105800, 0x3C135800, 0x3C165800, 0x3C195800, 0x3C1C5800, 0x3C1F5800, 0x3C225800,
+    0x3C255800, 0x3C285800, 0x3C2B5800, 0x3C2E5800, 0x3C315800, 0x3C345800, 0x3C375800, 0x3C3A5800,
+    0x3C3D5800, 0x3C405800, 0x3C435800, 0x3C465800, 0x3C495800, 0x3C4C5800, 0x3C4F5800, 0x3C525800,
+    0x3C555800, 0x3C585800, 0x3C5B5800, 0x3C5E5800, 0x3C615800, 0x3C645800, 0x3C675800, 0x3C6A5800,
+    0x3C6D5800, 0x3C705800, 0x3C735800, 0x3C765800, 0x3C795800, 0x3C7C5800, 0x3C7F5800, 0x3C825800,
+    0x3C855800, 0x3C885800, 0x3C8B5800, 0x3C8E5800, 0x3C915800, 0x3C945800, 0x3C975800, 0x3C9A5800,
+    0x3C9D5800, 0x3CA05800, 0x3CA35800, 0x3CA65800, 0x3CA95800, 0x3CAC5800, 0x3CAF5800, 0x3CB25800,
+    0x3CB55800, 0x3CB85800, 0x3CBB5800, 0x3CBE5800, 0x3CC15800, 0x3CC45800, 0x3CC75800, 0x3CCA5800,
+    0x3CCD5800, 0x3CD05800, 0x3CD35800, 0x3CD65800, 0x3CD95800, 0x3CDC5800, 0x3CDF5800, 0x3CE25800,
+    0x3CE55800, 0x3CE85800, 0x3CEB5800, 0x3CEE5800, 0x3CF15800, 0x3CF45800, 0x3CF75800, 0x3CFA5800,
+    0x3CFD5800, 0x3D005800, 0x3D035800, 0x3D065800, 0x3D095800, 0x3D0C5800, 0x3D0F5800, 0x3D125800,
+    0x3D155800, 0x3D185800, 0x3D1B5800, 0x3D1E5800, 0x3D215800, 0x3D245800, 0x3D275800, 0x3D2A5800,
+    0x3D2D5800, 0x3D305800, 0x3D335800, 0x3D365800, 0x3D395800, 0x3D3C5800, 0x3D3F5800, 0x3D425800,
+    0x3D455800, 0x3D485800, 0x3D4B5800, 0x3D4E5800, 0x3D515800, 0x3D545800, 0x3D575800, 0x3D5A5800,
+    0x3D5D5800, 0x3D605800, 0x3D635800, 0x3D665800, 0x3D695800, 0x3D6C5800, 0x00000000, 0x00000000,
+    0x3D6F5800, 0x3D725800, 0x3D755800, 0x3D785800, 0x3D7B5800, 0x3D7E5800, 0x3D815800, 0x3D845800,
+    0x3D875800, 0x3D8A5800, 0x3D8D5800, 0x3D905800, 0x3D935800, 0x3D965800, 0x3D995800, 0x3D9C5800,
+    0x3D9F5800, 0x3DA25800, 0x3DA55800, 0x3DA85800, 0x3DAB5800, 0x3DAE5800, 0x3DB15800, 0x3DB45800,
+    0x3DB75800, 0x3DBA5800, 0x3DBD5800, 0x3DC05800, 0x3DC35800, 0x3DC65800, 0x3DC95800, 0x3DCC5800,
+    0x3DCF5800, 0x3DD25800, 0x3DD55800, 0x3DD85800, 0x3DDB5800, 0x3DDE5800, 0x3DE15800, 0x3DE45800,
+    0x3DE75800, 0x3DEA5800, 0x3DED5800, 0x3DF05800, 0x3DF35800, 0x3DF65800, 0x3DF95800, 0x3DFC5800,
+    0x3DFF5800, 0x3E025800, 0x3E055800, 0x3E085800, 0x3E0B5800, 0x3E0E5800, 0x3E115800, 0x3E145800,
+    0x3E175800, 0x3E1A5800, 0x3E1D5800, 0x3E205800, 0x3E235800, 0x3E265800, 0x3E295800, 0x3E2C5800,
+    0x3E2F5800, 0x3E325800, 0x3E355800, 0x3E385800, 0x3E3B5800, 0x3E3E5800, 0x3E415800, 0x3E445800,
+    0x3E475800, 0x3E4A5800, 0x3E4D5800, 0x3E505800, 0x3E535800, 0x3E565800, 0x3E595800, 0x3E5C5800,
+    0x3E5F5800, 0x3E625800, 0x3E655800, 0x3E685800, 0x3E6B5800, 0x3E6E5800, 0x3E715800, 0x3E745800,
+    0x3E775800, 0x3E7A5800, 0x3E7D5800, 0x3E805800, 0x3E835800, 0x3E865800, 0x3E895800, 0x3E8C5800,
+    0x3E8F5800, 0x3E925800, 0x3E955800, 0x3E985800, 0x3E9B5800, 0x3E9E5800, 0x3EA15800, 0x3EA45800,
+    0x3EA75800, 0x3EAA5800, 0x3EAD5800, 0x3EB05800, 0x3EB35800, 0x3EB65800, 0x3EB95800, 0x3EBC5800,
+    0x3EBF5800, 0x3EC25800, 0x3EC55800, 0x3EC85800, 0x3ECB5800, 0x3ECE5800, 0x3ED15800, 0x3ED45800,
+    0x3ED75800, 0x3EDA5800, 0x3EDD5800, 0x3EE05800, 0x3EE35800, 0x3EE65800, 0x3EE95800, 0x3EEC5800,
+    0x3EEF5800, 0x3EF25800, 0x3EF55800, 0x3EF85800, 0x3EFB5800, 0x3EFE5800, 0x3F015800, 0x3F045800,
+    0x3F075800, 0x3F0A5800, 0x3F0D5800, 0x3F105800, 0x3F135800, 0x3F165800, 0x3F195800, 0x3F1C5800,
+    0x3F1F5800, 0x3F225800, 0x3F255800, 0x3F285800, 0x3F2B5800, 0x3F2E5800, 0x3F315800, 0x3F345800,
+    0x3F375800, 0x3F3A5800, 0x3F3D5800, 0x3F405800, 0x3F435800, 0x3F465800, 0x3F495800, 0x3F4C5800,
+    0x3F4F5800, 0x3F525800, 0x3F555800, 0x3F585800, 0x3F5B5800, 0x3F5E5800, 0x3F615800, 0x3F645800,
+    0x3F675800, 0x3F6A5800, 0x3F6D5800, 0x3F705800, 0x3F735800, 0x3F765800, 0x3F795800, 0x3F7C5800,
+    0x3F7F5800, 0x3F825800, 0x3F855800, 0x3F885800, 0x3F8B5800, 0x3F8E5800, 0x3F915800, 0x3F945800,
+    0x3F975800, 0x3F9A5800, 0x3F9D5800, 0x3FA05800, 0x3FA35800, 0x3FA65800, 0x3FA95800, 0x3FAC5800,
+    0x3FAF5800, 0x3FB25800, 0x3FB55800, 0x3FB85800, 0x3FBB5800, 0x3FBE5800, 0x3FC15800, 0x3FC45800,
+    0x3FC75800, 0x3FCA5800, 0x3FCD5800, 0x3FD05800, 0x3FD35800, 0x3FD65800, 0x3FD95800, 0x3FDC5800,
+    0x3FDF5800, 0x3FE25800, 0x3FE55800, 0x3FE85800, 0x3FEB5800, 0x3FEE5800, 0x3FF15800, 0x3FF45800,
+    0x3FF75800, 0x3FFA5800, 0x3FFD5800, 0x40005800, 0x40035800, 0x40065800, 0x40095800, 0x400C5800,
+    0x400F5800, 0x40125800, 0x40155800, 0x40185800, 0x401B5800, 0x401E5800, 0x40215800, 0x40245800,
+    0x40275800, 0x402A5800, 0x402D5800, 0x40305800, 0x40335800, 0x40365800, 0x40395800, 0x403C5800,
+    0x403F5800, 0x40425800, 0x40455800, 0x40485800, 0x404B5800, 0x404E5800, 0x40515800, 0x40545800,
+    0x40575800, 0x405A5800, 0x405D5800, 0x40605800, 0x40635800, 0x40665800, 0x40695800, 0x406C5800,
+    0x406F5800, 0x40725800, 0x40755800, 0x40785800, 0x407B5800, 0x407E5800, 0x40815800, 0x40845800,
+    0x40875800, 0x408A5800, 0x408D5800, 0x40905800, 0x40935800, 0x40965800, 0x40995800, 0x409C5800,
+    0x409F5800, 0x40A25800, 0x40A55800, 0x40A85800, 0x40AB5800, 0x40AE5800, 0x40B15800, 0x40B45800,
+    0x40B75800, 0x40BA5800, 0x40BD5800, 0x40C05800, 0x40C35800, 0x40C65800, 0x40C95800, 0x40CC5800,
+    0x40CF5800, 0x40D25800, 0x40D55800, 0x40D85800, 0x00000000, 0x00000000, 0x40DB5800, 0x40DE5800,
+    0x40E15800, 0x40E45800, 0x40E75800, 0x40EA5800, 0x40ED5800, 0x40F05800, 0x40F35800, 0x40F65800,
+    0x40F95800, 0x40FC5800, 0x40FF5800, 0x41025800, 0x41055800, 0x41085800, 0x410B5800, 0x410E5800,
+    0x41115800, 0x41145800, 0x41175800, 0x411A5800, 0x411D5800, 0x41205800, 0x41235800, 0x41265800,
+    0x41295800, 0x412C5800, 0x412F5800, 0x41325800, 0x41355800, 0x41385800, 0x413B5800, 0x413E5800,
+    0x41415800, 0x41445800, 0x41475800, 0x414A5800, 0x414D5800, 0x41505800, 0x41535800, 0x41565800,
+    0x41595800, 0x415C5800, 0x415F5800, 0x41625800, 0x41655800, 0x41685800, 0x416B5800, 0x416E5800,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x00000000,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x00000000, 0x000000E6, 0x000000E6, 0x00000000, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x000000E6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x41715800, 0x41745800, 0x41775800, 0x417A5800, 0x417D5800, 0x41805800, 0x41835800, 0x41865800,
+    0x41895800, 0x418C5800, 0x418F5800, 0x41925800, 0x41955800, 0x41985800, 0x419B5800, 0x419E5800,
+    0x41A15800, 0x41A45800, 0x41A75800, 0x41AA5800, 0x41AD5800, 0x41B05800, 0x41B35800, 0x41B65800,
+    0x41B95800, 0x41BC5800, 0x41BF5800, 0x41C25800, 0x41C55800, 0x41C85800, 0x41CB5800, 0x41CE5800,
+    0x41D15800, 0x41D45800, 0x41D75800, 0x41DA5800, 0x41DD5800, 0x41E05800, 0x41E35800, 0x41E65800,
+    0x41E95800, 0x41EC5800, 0x41EF5800, 0x41F25800, 0x41F55800, 0x41F85800, 0x41FB5800, 0x41FE5800,
+    0x42015800, 0x42045800, 0x42075800, 0x420A5800, 0x420D5800, 0x42105800, 0x42135800, 0x42165800,
+    0x42195800, 0x421C5800, 0x421F5800, 0x42225800, 0x42255800, 0x42285800, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E8, 0x000000E8, 0x000000DC, 0x000000E6,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000DC,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x000000DC, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E6, 0x000000E6, 0x000000E6, 0x000000E6,
+    0x000000E6, 0x000000E6, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x422B5800, 0x422E5800, 0x42315800, 0x42345800, 0x00000000, 0x42375800, 0x423A5800, 0x423D5800,
+    0x42405800, 0x42435800, 0x42465800, 0x42495800, 0x424C5800, 0x424F5800, 0x42525800, 0x42555800,
+    0x42585800, 0x425B5800, 0x425E5800, 0x42615800, 0x42645800, 0x42675800, 0x426A5800, 0x426D5800,
+    0x42705800, 0x42735800, 0x42765800, 0x42795800, 0x427C5800, 0x427F5800, 0x42825800, 0x42855800,
+    0x00000000, 0x42885800, 0x428B5800, 0x00000000, 0x428E5800, 0x00000000, 0x00000000, 0x42915800,
+    0x00000000, 0x42945800, 0x42975800, 0x429A5800, 0x429D5800, 0x42A05800, 0x42A35800, 0x42A65800,
+    0x42A95800, 0x42AC5800, 0x42AF5800, 0x00000000, 0x42B25800, 0x42B55800, 0x42B85800, 0x42BB5800,
+    0x00000000, 0x42BE5800, 0x00000000, 0x42C15800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x42C45800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42C75800,
+    0x00000000, 0x42CA5800, 0x00000000, 0x42CD5800, 0x00000000, 0x42D05800, 0x42D35800, 0x42D65800,
+    0x00000000, 0x42D95800, 0x42DC5800, 0x00000000, 0x42DF5800, 0x00000000, 0x00000000, 0x42E25800,
+    0x00000000, 0x42E55800, 0x00000000, 0x42E85800, 0x00000000, 0x42EB5800, 0x00000000, 0x42EE5800,
+    0x00000000, 0x42F15800, 0x42F45800, 0x00000000, 0x42F75800, 0x00000000, 0x00000000, 0x42FA5800,
+    0x42FD5800, 0x43005800, 0x43035800, 0x00000000, 0x43065800, 0x43095800, 0x430C5800, 0x430F5800,
+    0x43125800, 0x43155800, 0x43185800, 0x00000000, 0x431B5800, 0x431E5800, 0x43215800, 0x43245800,
+    0x00000000, 0x43275800, 0x432A5800, 0x432D5800, 0x43305800, 0x00000000, 0x43335800, 0x00000000,
+    0x43365800, 0x43395800, 0x433C5800, 0x433F5800, 0x43425800, 0x43455800, 0x43485800, 0x434B5800,
+    0x434E5800, 0x43515800, 0x00000000, 0x43545800, 0x43575800, 0x435A5800, 0x435D5800, 0x43605800,
+    0x43635800, 0x43665800, 0x43695800, 0x436C5800, 0x436F5800, 0x43725800, 0x43755800, 0x43785800,
+    0x437B5800, 0x437E5800, 0x43815800, 0x43845800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x43875800, 0x438A5800, 0x438D5800, 0x00000000, 0x43905800, 0x43935800, 0x43965800,
+    0x43995800, 0x439C5800, 0x00000000, 0x439F5800, 0x43A25800, 0x43A55800, 0x43A85800, 0x43AB5800,
+    0x43AE5800, 0x43B15800, 0x43B45800, 0x43B75800, 0x43BA5800, 0x43BD5800, 0x43C05800, 0x43C35800,
+    0x43C65800, 0x43C95800, 0x43CC5800, 0x43CF5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x43D25800, 0x43D65800, 0x43DA5800, 0x43DE5800, 0x43E25800, 0x43E65800, 0x43EA5800, 0x43EE5800,
+    0x43F25800, 0x43F65800, 0x43FA5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x43FE5800, 0x44035800, 0x44085800, 0x440D5800, 0x44125800, 0x44175800, 0x441C5800, 0x44215800,
+    0x44265800, 0x442B5800, 0x44305800, 0x44355800, 0x443A5800, 0x443F5800, 0x44445800, 0x44495800,
+    0x444E5800, 0x44535800, 0x44585800, 0x445D5800, 0x44625800, 0x44675800, 0x446C5800, 0x44715800,
+    0x44765800, 0x447B5800, 0x44805800, 0x44855800, 0x44885800, 0x448B5800, 0x448F5800, 0x00000000,
+    0x44935800, 0x44965800, 0x44995800, 0x449C5800, 0x449F5800, 0x44A25800, 0x44A55800, 0x44A85800,
+    0x44AB5800, 0x44AE5800, 0x44B15800, 0x44B45800, 0x44B75800, 0x44BA5800, 0x44BD5800, 0x44C05800,
+    0x44C35800, 0x44C65800, 0x44C95800, 0x44CC5800, 0x44CF5800, 0x44D25800, 0x44D55800, 0x44D85800,
+    0x44DB5800, 0x44DE5800, 0x44E15800, 0x44E55800, 0x44E95800, 0x44ED5800, 0x44F15800, 0x44F65800,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x44FA5800, 0x44FE5800, 0x45025800, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45065800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x450A5800, 0x450E5800, 0x45125800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45155800, 0x45185800, 0x451B5800, 0x451E5800, 0x45225800, 0x45255800, 0x45285800, 0x452B5800,
+    0x452E5800, 0x45315800, 0x45345800, 0x45375800, 0x453A5800, 0x453D5800, 0x45405800, 0x45435800,
+    0x45465800, 0x45495800, 0x454C5800, 0x454F5800, 0x45525800, 0x45555800, 0x45585800, 0x455B5800,
+    0x455E5800, 0x45615800, 0x45645800, 0x45675800, 0x456A5800, 0x456D5800, 0x45705800, 0x45735800,
+    0x45765800, 0x45795800, 0x457C5800, 0x457F5800, 0x45825800, 0x45855800, 0x45885800, 0x458B5800,
+    0x458E5800, 0x45915800, 0x45945800, 0x45975800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x459A5800, 0x459F5800, 0x45A45800, 0x45A95800, 0x45AE5800, 0x45B35800, 0x45B85800, 0x45BD5800,
+    0x45C25800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45C75800, 0x45CA5800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45CD5800, 0x45D05800, 0x45D35800, 0x45D65800, 0x45D95800, 0x45DC5800, 0x45DF5800, 0x45E25800,
+    0x45E55800, 0x45E85800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45EB1B00, 0x45ED1B00, 0x45EF1B00, 0x45F11B00, 0x45F31B00, 0x45F51B00, 0x45F71B00, 0x45F91B00,
+    0x45FB1B00, 0x45FD1B00, 0x45FF1B00, 0x46011B00, 0x46031B00, 0x46051B00, 0x46071B00, 0x46091B00,
+    0x460B1B00, 0x460D1B00, 0x460F1B00, 0x46111B00, 0x46131B00, 0x46151B00, 0x46171B00, 0x46191B00,
+    0x461B1B00, 0x461D1B00, 0x461F1B00, 0x46211B00, 0x46231B00, 0x46251B00, 0x46271B00, 0x46291B00,
+    0x462B1B00, 0x462D1B00, 0x462F1B00, 0x46311B00, 0x46331B00, 0x46351B00, 0x46371B00, 0x46391B00,
+    0x463B1B00, 0x463D1B00, 0x463F1B00, 0x46411B00, 0x46431B00, 0x46451B00, 0x46471B00, 0x46491B00,
+    0x464B1B00, 0x464D1B00, 0x464F1B00, 0x46511B00, 0x46531B00, 0x46551B00, 0x46571B00, 0x46591B00,
+    0x465B1B00, 0x465D1B00, 0x465F1B00, 0x46611B00, 0x46631B00, 0x46651B00, 0x46671B00, 0x46691B00,
+    0x466B1B00, 0x466D1B00, 0x466F1B00, 0x46711B00, 0x46731B00, 0x46751B00, 0x46771B00, 0x46791B00,
+    0x467B1B00, 0x467D1B00, 0x467F1B00, 0x46811B00, 0x46831B00, 0x46851B00, 0x46871B00, 0x46891B00,
+    0x468B1B00, 0x468D1B00, 0x468F1B00, 0x46911B00, 0x46931B00, 0x46951B00, 0x46971B00, 0x46991B00,
+    0x469B1B00, 0x469D1B00, 0x469F1B00, 0x46A11B00, 0x46A31B00, 0x46A51B00, 0x46A71B00, 0x46A91B00,
+    0x46AB1B00, 0x46AD1B00, 0x46AF1B00, 0x46B11B00, 0x46B31B00, 0x46B51B00, 0x46B71B00, 0x46B91B00,
+    0x46BB1B00, 0x46BD1B00, 0x46BF1B00, 0x46C11B00, 0x46C31B00, 0x46C51B00, 0x46C71B00, 0x46C91B00,
+    0x46CB1B00, 0x46CD1B00, 0x46CF1B00, 0x46D11B00, 0x46D31B00, 0x46D51B00, 0x46D71B00, 0x46D91B00,
+    0x46DB1B00, 0x46DD1B00, 0x46DF1B00, 0x46E11B00, 0x46E31B00, 0x46E51B00, 0x46E71B00, 0x46E91B00,
+    0x46EB1B00, 0x46ED1B00, 0x46EF1B00, 0x46F11B00, 0x46F31B00, 0x46F51B00, 0x46F71B00, 0x46F91B00,
+    0x46FB1B00, 0x46FD1B00, 0x46FF1B00, 0x47011B00, 0x47031B00, 0x47051B00, 0x47071B00, 0x47091B00,
+    0x470B1B00, 0x470D1B00, 0x470F1B00, 0x47111B00, 0x47131B00, 0x47151B00, 0x47171B00, 0x47191B00,
+    0x471B1B00, 0x471D1B00, 0x471F1B00, 0x47211B00, 0x47231B00, 0x47251B00, 0x47271B00, 0x47291B00,
+    0x472B1B00, 0x472D1B00, 0x472F1B00, 0x47311B00, 0x47331B00, 0x47351B00, 0x47371B00, 0x47391B00,
+    0x473B1B00, 0x473D1B00, 0x473F1B00, 0x47411B00, 0x47431B00, 0x47451B00, 0x47471B00, 0x47491B00,
+    0x474B1B00, 0x474D1B00, 0x474F1B00, 0x47511B00, 0x47531B00, 0x47551B00, 0x47571B00, 0x47591B00,
+    0x475B1B00, 0x475D1B00, 0x475F1B00, 0x47611B00, 0x47631B00, 0x47651B00, 0x47671B00, 0x47691B00,
+    0x476B1B00, 0x476D1B00, 0x476F1B00, 0x47711B00, 0x47731B00, 0x47751B00, 0x47771B00, 0x47791B00,
+    0x477B1B00, 0x477D1B00, 0x477F1B00, 0x47811B00, 0x47831B00, 0x47851B00, 0x47871B00, 0x47891B00,
+    0x478B1B00, 0x478D1B00, 0x478F1B00, 0x47911B00, 0x47931B00, 0x47951B00, 0x47971B00, 0x47991B00,
+    0x479B1B00, 0x479D1B00, 0x479F1B00, 0x47A11B00, 0x47A31B00, 0x47A51B00, 0x47A71B00, 0x47A91B00,
+    0x47AB1B00, 0x47AD1B00, 0x47AF1B00, 0x47B11B00, 0x47B31B00, 0x47B51B00, 0x47B71B00, 0x47B91B00,
+    0x47BB1B00, 0x47BD1B00, 0x47BF1B00, 0x47C11B00, 0x47C31B00, 0x47C51B00, 0x47C71B00, 0x47C91B00,
+    0x47CB1B00, 0x47CD1B00, 0x47CF1B00, 0x47D11B00, 0x47D31B00, 0x47D51B00, 0x47D71B00, 0x47D91B00,
+    0x47DB1B00, 0x47DD1B00, 0x47DF1B00, 0x47E11B00, 0x47E31B00, 0x47E51B00, 0x47E71B00, 0x47E91B00,
+    0x47EB1B00, 0x47ED1B00, 0x47EF1B00, 0x47F11B00, 0x47F31B00, 0x47F51B00, 0x47F71B00, 0x47F91B00,
+    0x47FB1B00, 0x47FD1B00, 0x47FF1B00, 0x48011B00, 0x48031B00, 0x48051B00, 0x48071B00, 0x48091B00,
+    0x480B1B00, 0x480D1B00, 0x480F1B00, 0x48111B00, 0x48131B00, 0x48151B00, 0x48171B00, 0x48191B00,
+    0x481B1B00, 0x481D1B00, 0x481F1B00, 0x48211B00, 0x48231B00, 0x48251B00, 0x48271B00, 0x48291B00,
+    0x482B1B00, 0x482D1B00, 0x482F1B00, 0x48311B00, 0x48331B00, 0x48351B00, 0x48371B00, 0x48391B00,
+    0x483B1B00, 0x483D1B00, 0x483F1B00, 0x48411B00, 0x48431B00, 0x48451B00, 0x48471B00, 0x48491B00,
+    0x484B1B00, 0x484D1B00, 0x484F1B00, 0x48511B00, 0x48531B00, 0x48551B00, 0x48571B00, 0x48591B00,
+    0x485B1B00, 0x485D1B00, 0x485F1B00, 0x48611B00, 0x48631B00, 0x48651B00, 0x48671B00, 0x48691B00,
+    0x486B1B00, 0x486D1B00, 0x486F1B00, 0x48711B00, 0x48731B00, 0x48751B00, 0x48771B00, 0x48791B00,
+    0x487B1B00, 0x487D1B00, 0x487F1B00, 0x48811B00, 0x48831B00, 0x48851B00, 0x48871B00, 0x48891B00,
+    0x488B1B00, 0x488D1B00, 0x488F1B00, 0x48911B00, 0x48931B00, 0x48951B00, 0x48971B00, 0x48991B00,
+    0x489B1B00, 0x489D1B00, 0x489F1B00, 0x48A11B00, 0x48A31B00, 0x48A51B00, 0x48A71B00, 0x48A91B00,
+    0x48AB1B00, 0x48AD1B00, 0x48AF1B00, 0x48B11B00, 0x48B31B00, 0x48B51B00, 0x48B71B00, 0x48B91B00,
+    0x48BB1B00, 0x48BD1B00, 0x48BF1B00, 0x48C11B00, 0x48C31B00, 0x48C51B00, 0x48C71B00, 0x48C91B00,
+    0x48CB1B00, 0x48CD1B00, 0x48CF1B00, 0x48D11B00, 0x48D31B00, 0x48D51B00, 0x48D71B00, 0x48D91B00,
+    0x48DB1B00, 0x48DD1B00, 0x48DF1B00, 0x48E11B00, 0x48E31B00, 0x48E51B00, 0x48E71B00, 0x48E91B00,
+    0x48EB1B00, 0x48ED1B00, 0x48EF1B00, 0x48F11B00, 0x48F31B00, 0x48F51B00, 0x48F71B00, 0x48F91B00,
+    0x48FB1B00, 0x48FD1B00, 0x48FF1B00, 0x49011B00, 0x49031B00, 0x49051B00, 0x49071B00, 0x49091B00,
+    0x490B1B00, 0x490D1B00, 0x490F1B00, 0x49111B00, 0x49131B00, 0x49151B00, 0x49171B00, 0x49191B00,
+    0x491B1B00, 0x491D1B00, 0x491F1B00, 0x49211B00, 0x49231B00, 0x49251B00, 0x49271B00, 0x49291B00,
+    0x492B1B00, 0x492D1B00, 0x492F1B00, 0x49311B00, 0x49331B00, 0x49351B00, 0x49371B00, 0x49391B00,
+    0x493B1B00, 0x493D1B00, 0x493F1B00, 0x49411B00, 0x49431B00, 0x49451B00, 0x49471B00, 0x49491B00,
+    0x494B1B00, 0x494D1B00, 0x494F1B00, 0x49511B00, 0x49531B00, 0x49551B00, 0x49571B00, 0x49591B00,
+    0x495B1B00, 0x495D1B00, 0x495F1B00, 0x49611B00, 0x49631B00, 0x49651B00, 0x49671B00, 0x49691B00,
+    0x496B1B00, 0x496D1B00, 0x496F1B00, 0x49711B00, 0x49731B00, 0x49751B00, 0x49771B00, 0x49791B00,
+    0x497B1B00, 0x497D1B00, 0x497F1B00, 0x49811B00, 0x49831B00, 0x49851B00, 0x49871B00, 0x49891B00,
+    0x498B1B00, 0x498D1B00, 0x498F1B00, 0x49911B00, 0x49931B00, 0x49951B00, 0x49971B00, 0x49991B00,
+    0x499B1B00, 0x499D1B00, 0x499F1B00, 0x49A11B00, 0x49A31B00, 0x49A51B00, 0x49A71B00, 0x49A91B00,
+    0x49AB1B00, 0x49AD1B00, 0x49AF1B00, 0x49B11B00, 0x49B31B00, 0x49B51B00, 0x49B71B00, 0x49B91B00,
+    0x49BB1B00, 0x49BD1B00, 0x49BF1B00, 0x49C11B00, 0x49C31B00, 0x49C51B00, 0x49C71B00, 0x49C91B00,
+    0x49CB1B00, 0x49CD1B00, 0x49CF1B00, 0x49D11B00, 0x49D31B00, 0x49D51B00, 0x49D71B00, 0x49D91B00,
+    0x49DB1B00, 0x49DD1B00, 0x49DF1B00, 0x49E11B00, 0x49E31B00, 0x49E51B00, 0x49E71B00, 0x49E91B00,
+    0x49EB1B00, 0x49ED1B00, 0x49EF1B00, 0x49F11B00, 0x49F31B00, 0x49F51B00, 0x49F71B00, 0x49F91B00,
+    0x49FB1B00, 0x49FD1B00, 0x49FF1B00, 0x4A011B00, 0x4A031B00, 0x4A051B00, 0x4A071B00, 0x4A091B00,
+    0x4A0B1B00, 0x4A0D1B00, 0x4A0F1B00, 0x4A111B00, 0x4A131B00, 0x4A151B00, 0x4A171B00, 0x4A191B00,
+    0x4A1B1B00, 0x4A1D1B00, 0x4A1F1B00, 0x4A211B00, 0x4A231B00, 0x4A251B00, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+} // namespace utf::data
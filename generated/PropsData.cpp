@@ -0,0 +1,2725 @@
+// Auto-generated by generate_tables.py
+// Do not edit manually!
+
+#include "utf/UnicodeData.hpp"
+
+namespace utf::data {
+
+// Distinct records: {lower, upper, fold, accent, aggressive, specialUpper, specialFold, expand, flags}
+const CharProps char_props[] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {32, 0, 32, 0, 0, 0, 0, 0, 0},
+    {0, -32, 0, 0, 0, 0, 0, 0, 0},
+    {0, 743, 775, 0, 0, 0, 0, 0, 0},
+    {32, 0, 32, -127, -127, 0, 0, 0, 0},
+    {32, 0, 32, -128, -128, 0, 0, 0, 0},
+    {32, 0, 32, -129, -129, 0, 0, 0, 0},
+    {32, 0, 32, -130, -130, 0, 0, 0, 0},
+    {32, 0, 32, -131, -131, 0, 0, 0, 0},
+    {32, 0, 32, -132, -132, 0, 0, 0, 0},
+    {32, 0, 32, 0, 0, 0, 0, 1, 0},
+    {32, 0, 32, -133, -133, 0, 0, 0, 0},
+    {32, 0, 32, -134, -134, 0, 0, 0, 0},
+    {32, 0, 32, 0, 0, 0, 0, 2, 0},
+    {32, 0, 32, -135, -135, 0, 0, 0, 0},
+    {32, 0, 32, 0, -137, 0, 0, 0, 0},
+    {32, 0, 32, 0, 0, 0, 0, 3, 0},
+    {0, 0, 0, 0, 0, 1, 1, 4, 0},
+    {0, -32, 0, -127, -127, 0, 0, 0, 0},
+    {0, -32, 0, -128, -128, 0, 0, 0, 0},
+    {0, -32, 0, -129, -129, 0, 0, 0, 0},
+    {0, -32, 0, -130, -130, 0, 0, 0, 0},
+    {0, -32, 0, -131, -131, 0, 0, 0, 0},
+    {0, -32, 0, -132, -132, 0, 0, 0, 0},
+    {0, -32, 0, 0, 0, 0, 0, 5, 0},
+    {0, -32, 0, -133, -133, 0, 0, 0, 0},
+    {0, -32, 0, -134, -134, 0, 0, 0, 0},
+    {0, -32, 0, 0, 0, 0, 0, 6, 0},
+    {0, -32, 0, -135, -135, 0, 0, 0, 0},
+    {0, -32, 0, 0, -137, 0, 0, 0, 0},
+    {0, -32, 0, 0, 0, 0, 0, 7, 0},
+    {0, 121, 0, -134, -134, 0, 0, 0, 0},
+    {1, 0, 1, -191, -191, 0, 0, 0, 0},
+    {0, -1, 0, -160, -160, 0, 0, 0, 0},
+    {1, 0, 1, -193, -193, 0, 0, 0, 0},
+    {0, -1, 0, -162, -162, 0, 0, 0, 0},
+    {1, 0, 1, -195, -195, 0, 0, 0, 0},
+    {0, -1, 0, -164, -164, 0, 0, 0, 0},
+    {1, 0, 1, -197, -197, 0, 0, 0, 0},
+    {0, -1, 0, -166, -166, 0, 0, 0, 0},
+    {1, 0, 1, -199, -199, 0, 0, 0, 0},
+    {0, -1, 0, -168, -168, 0, 0, 0, 0},
+    {1, 0, 1, -201, -201, 0, 0, 0, 0},
+    {0, -1, 0, -170, -170, 0, 0, 0, 0},
+    {1, 0, 1, -202, -202, 0, 0, 0, 0},
+    {0, -1, 0, -171, -171, 0, 0, 0, 0},
+    {1, 0, 1, 0, -204, 0, 0, 0, 0},
+    {0, -1, 0, 0, -173, 0, 0, 0, 0},
+    {1, 0, 1, -205, -205, 0, 0, 0, 0},
+    {0, -1, 0, -174, -174, 0, 0, 0, 0},
+    {1, 0, 1, -207, -207, 0, 0, 0, 0},
+    {0, -1, 0, -176, -176, 0, 0, 0, 0},
+    {1, 0, 1, -209, -209, 0, 0, 0, 0},
+    {0, -1, 0, -178, -178, 0, 0, 0, 0},
+    {1, 0, 1, -211, -211, 0, 0, 0, 0},
+    {0, -1, 0, -180, -180, 0, 0, 0, 0},
+    {1, 0, 1, -213, -213, 0, 0, 0, 0},
+    {0, -1, 0, -182, -182, 0, 0, 0, 0},
+    {1, 0, 1, -215, -215, 0, 0, 0, 0},
+    {0, -1, 0, -184, -184, 0, 0, 0, 0},
+    {1, 0, 1, -217, -217, 0, 0, 0, 0},
+    {0, -1, 0, -186, -186, 0, 0, 0, 0},
+    {1, 0, 1, -219, -219, 0, 0, 0, 0},
+    {0, -1, 0, -188, -188, 0, 0, 0, 0},
+    {1, 0, 1, -220, -220, 0, 0, 0, 0},
+    {0, -1, 0, -189, -189, 0, 0, 0, 0},
+    {1, 0, 1, 0, -222, 0, 0, 0, 0},
+    {0, -1, 0, 0, -191, 0, 0, 0, 0},
+    {1, 0, 1, -223, -223, 0, 0, 0, 0},
+    {0, -1, 0, -192, -192, 0, 0, 0, 0},
+    {1, 0, 1, -225, -225, 0, 0, 0, 0},
+    {0, -1, 0, -194, -194, 0, 0, 0, 0},
+    {1, 0, 1, -227, -227, 0, 0, 0, 0},
+    {0, -1, 0, -196, -196, 0, 0, 0, 0},
+    {1, 0, 1, -229, -229, 0, 0, 0, 0},
+    {0, -1, 0, -198, -198, 0, 0, 0, 0},
+    {-199, 0, 0, -231, -231, 0, 2, 0, 0},
+    {0, -232, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, 0, 0, 0, 0, 0, 0},
+    {0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -234, -234, 0, 0, 0, 0},
+    {0, -1, 0, -203, -203, 0, 0, 0, 0},
+    {1, 0, 1, -235, -235, 0, 0, 0, 0},
+    {0, -1, 0, -204, -204, 0, 0, 0, 0},
+    {1, 0, 1, -237, -237, 0, 0, 0, 0},
+    {0, -1, 0, -206, -206, 0, 0, 0, 0},
+    {1, 0, 1, -239, -239, 0, 0, 0, 0},
+    {0, -1, 0, -208, -208, 0, 0, 0, 0},
+    {1, 0, 1, -241, -241, 0, 0, 0, 0},
+    {0, -1, 0, -210, -210, 0, 0, 0, 0},
+    {1, 0, 1, 0, -245, 0, 0, 0, 0},
+    {0, -1, 0, 0, -214, 0, 0, 0, 0},
+    {1, 0, 1, -245, -245, 0, 0, 0, 0},
+    {0, -1, 0, -214, -214, 0, 0, 0, 0},
+    {1, 0, 1, -247, -247, 0, 0, 0, 0},
+    {0, -1, 0, -216, -216, 0, 0, 0, 0},
+    {1, 0, 1, -249, -249, 0, 0, 0, 0},
+    {0, -1, 0, -218, -218, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 2, 3, 0, 0},
+    {1, 0, 1, 0, -252, 0, 0, 0, 0},
+    {0, -1, 0, 0, -221, 0, 0, 0, 0},
+    {1, 0, 1, -253, -253, 0, 0, 0, 0},
+    {0, -1, 0, -222, -222, 0, 0, 0, 0},
+    {1, 0, 1, -255, -255, 0, 0, 0, 0},
+    {0, -1, 0, -224, -224, 0, 0, 0, 0},
+    {1, 0, 1, -257, -257, 0, 0, 0, 0},
+    {0, -1, 0, -226, -226, 0, 0, 0, 0},
+    {1, 0, 1, 0, 0, 0, 0, 8, 0},
+    {0, -1, 0, 0, 0, 0, 0, 9, 0},
+    {1, 0, 1, -258, -258, 0, 0, 0, 0},
+    {0, -1, 0, -227, -227, 0, 0, 0, 0},
+    {1, 0, 1, -260, -260, 0, 0, 0, 0},
+    {0, -1, 0, -229, -229, 0, 0, 0, 0},
+    {1, 0, 1, -262, -262, 0, 0, 0, 0},
+    {0, -1, 0, -231, -231, 0, 0, 0, 0},
+    {1, 0, 1, -263, -263, 0, 0, 0, 0},
+    {0, -1, 0, -232, -232, 0, 0, 0, 0},
+    {1, 0, 1, -265, -265, 0, 0, 0, 0},
+    {0, -1, 0, -234, -234, 0, 0, 0, 0},
+    {1, 0, 1, -267, -267, 0, 0, 0, 0},
+    {0, -1, 0, -236, -236, 0, 0, 0, 0},
+    {1, 0, 1, -269, -269, 0, 0, 0, 0},
+    {0, -1, 0, -238, -238, 0, 0, 0, 0},
+    {1, 0, 1, -270, -270, 0, 0, 0, 0},
+    {0, -1, 0, -239, -239, 0, 0, 0, 0},
+    {1, 0, 1, -272, -272, 0, 0, 0, 0},
+    {0, -1, 0, -241, -241, 0, 0, 0, 0},
+    {1, 0, 1, 0, -274, 0, 0, 0, 0},
+    {0, -1, 0, 0, -243, 0, 0, 0, 0},
+    {1, 0, 1, -275, -275, 0, 0, 0, 0},
+    {0, -1, 0, -244, -244, 0, 0, 0, 0},
+    {1, 0, 1, -277, -277, 0, 0, 0, 0},
+    {0, -1, 0, -246, -246, 0, 0, 0, 0},
+    {1, 0, 1, -279, -279, 0, 0, 0, 0},
+    {0, -1, 0, -248, -248, 0, 0, 0, 0},
+    {1, 0, 1, -281, -281, 0, 0, 0, 0},
+    {0, -1, 0, -250, -250, 0, 0, 0, 0},
+    {1, 0, 1, -283, -283, 0, 0, 0, 0},
+    {0, -1, 0, -252, -252, 0, 0, 0, 0},
+    {1, 0, 1, -285, -285, 0, 0, 0, 0},
+    {0, -1, 0, -254, -254, 0, 0, 0, 0},
+    {-121, 0, -121, -287, -287, 0, 0, 0, 0},
+    {1, 0, 1, -287, -287, 0, 0, 0, 0},
+    {0, -1, 0, -256, -256, 0, 0, 0, 0},
+    {1, 0, 1, -289, -289, 0, 0, 0, 0},
+    {0, -1, 0, -258, -258, 0, 0, 0, 0},
+    {1, 0, 1, -291, -291, 0, 0, 0, 0},
+    {0, -1, 0, -260, -260, 0, 0, 0, 0},
+    {0, -300, -268, 0, 0, 0, 0, 0, 0},
+    {0, 195, 0, 0, 0, 0, 0, 0, 0},
+    {210, 0, 210, 0, 0, 0, 0, 0, 0},
+    {206, 0, 206, 0, 0, 0, 0, 0, 0},
+    {205, 0, 205, 0, 0, 0, 0, 0, 0},
+    {79, 0, 79, 0, 0, 0, 0, 0, 0},
+    {202, 0, 202, 0, 0, 0, 0, 0, 0},
+    {203, 0, 203, 0, 0, 0, 0, 0, 0},
+    {207, 0, 207, 0, 0, 0, 0, 0, 0},
+    {0, 97, 0, 0, 0, 0, 0, 0, 0},
+    {211, 0, 211, 0, 0, 0, 0, 0, 0},
+    {209, 0, 209, 0, 0, 0, 0, 0, 0},
+    {0, 163, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42561, 0, 0, 0, 0, 0, 0, 0},
+    {213, 0, 213, 0, 0, 0, 0, 0, 0},
+    {0, 130, 0, 0, 0, 0, 0, 0, 0},
+    {214, 0, 214, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -337, -337, 0, 0, 0, 0},
+    {0, -1, 0, -306, -306, 0, 0, 0, 0},
+    {218, 0, 218, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -346, -346, 0, 0, 0, 0},
+    {0, -1, 0, -315, -315, 0, 0, 0, 0},
+    {217, 0, 217, 0, 0, 0, 0, 0, 0},
+    {219, 0, 219, 0, 0, 0, 0, 0, 0},
+    {0, 56, 0, 0, 0, 0, 0, 0, 0},
+    {2, 0, 2, 0, 0, 0, 0, 0, 0},
+    {1, -1, 1, 0, 0, 0, 0, 0, 0},
+    {0, -2, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -396, -396, 0, 0, 0, 0},
+    {0, -1, 0, -365, -365, 0, 0, 0, 0},
+    {1, 0, 1, -390, -390, 0, 0, 0, 0},
+    {0, -1, 0, -359, -359, 0, 0, 0, 0},
+    {1, 0, 1, -386, -386, 0, 0, 0, 0},
+    {0, -1, 0, -355, -355, 0, 0, 0, 0},
+    {1, 0, 1, -382, -382, 0, 0, 0, 0},
+    {0, -1, 0, -351, -351, 0, 0, 0, 0},
+    {1, 0, 1, -251, -251, 0, 0, 0, 0},
+    {0, -1, 0, -220, -220, 0, 0, 0, 0},
+    {0, -79, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -282, -282, 0, 0, 0, 0},
+    {0, -1, 0, -251, -251, 0, 0, 0, 0},
+    {1, 0, 1, 70, 70, 0, 0, 0, 0},
+    {0, -1, 0, 70, 70, 0, 0, 0, 0},
+    {1, 0, 1, -284, -284, 0, 0, 0, 0},
+    {0, -1, 0, -253, -253, 0, 0, 0, 0},
+    {1, 0, 1, -415, -415, 0, 0, 0, 0},
+    {0, -1, 0, -384, -384, 0, 0, 0, 0},
+    {1, 0, 1, -413, -413, 0, 0, 0, 0},
+    {0, -1, 0, -382, -382, 0, 0, 0, 0},
+    {1, 0, 1, -411, -411, 0, 0, 0, 0},
+    {0, -1, 0, -380, -380, 0, 0, 0, 0},
+    {1, 0, 1, -2, -2, 0, 0, 0, 0},
+    {0, -1, 0, -2, -2, 0, 0, 0, 0},
+    {1, 0, 1, -55, -55, 0, 0, 0, 0},
+    {0, -1, 0, 163, 163, 0, 0, 0, 0},
+    {0, 0, 0, -390, -390, 3, 4, 0, 0},
+    {1, 0, 1, -429, -429, 0, 0, 0, 0},
+    {0, -1, 0, -398, -398, 0, 0, 0, 0},
+    {-97, 0, -97, 0, 0, 0, 0, 0, 0},
+    {-56, 0, -56, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -426, -426, 0, 0, 0, 0},
+    {0, -1, 0, -395, -395, 0, 0, 0, 0},
+    {1, 0, 1, -309, -309, 0, 0, 0, 0},
+    {0, -1, 0, -278, -278, 0, 0, 0, 0},
+    {1, 0, 1, -310, -310, 0, 0, 0, 0},
+    {0, -1, 0, -279, -279, 0, 0, 0, 0},
+    {1, 0, 1, -294, -294, 0, 0, 0, 0},
+    {0, -1, 0, -263, -263, 0, 0, 0, 0},
+    {1, 0, 1, -447, -447, 0, 0, 0, 0},
+    {0, -1, 0, -416, -416, 0, 0, 0, 0},
+    {1, 0, 1, -449, -449, 0, 0, 0, 0},
+    {0, -1, 0, -418, -418, 0, 0, 0, 0},
+    {1, 0, 1, -445, -445, 0, 0, 0, 0},
+    {0, -1, 0, -414, -414, 0, 0, 0, 0},
+    {1, 0, 1, -446, -446, 0, 0, 0, 0},
+    {0, -1, 0, -415, -415, 0, 0, 0, 0},
+    {1, 0, 1, -448, -448, 0, 0, 0, 0},
+    {0, -1, 0, -417, -417, 0, 0, 0, 0},
+    {1, 0, 1, -453, -453, 0, 0, 0, 0},
+    {0, -1, 0, -422, -422, 0, 0, 0, 0},
+    {1, 0, 1, -454, -454, 0, 0, 0, 0},
+    {0, -1, 0, -423, -423, 0, 0, 0, 0},
+    {1, 0, 1, -470, -470, 0, 0, 0, 0},
+    {0, -1, 0, -439, -439, 0, 0, 0, 0},
+    {-130, 0, -130, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -485, -485, 0, 0, 0, 0},
+    {0, -1, 0, -454, -454, 0, 0, 0, 0},
+    {1, 0, 1, -483, -483, 0, 0, 0, 0},
+    {0, -1, 0, -452, -452, 0, 0, 0, 0},
+    {1, 0, 1, -340, -340, 0, 0, 0, 0},
+    {0, -1, 0, -309, -309, 0, 0, 0, 0},
+    {1, 0, 1, -343, -343, 0, 0, 0, 0},
+    {0, -1, 0, -312, -312, 0, 0, 0, 0},
+    {1, 0, 1, -479, -479, 0, 0, 0, 0},
+    {0, -1, 0, -448, -448, 0, 0, 0, 0},
+    {1, 0, 1, -473, -473, 0, 0, 0, 0},
+    {0, -1, 0, -442, -442, 0, 0, 0, 0},
+    {10795, 0, 10795, 0, 0, 0, 0, 0, 0},
+    {-163, 0, -163, 0, 0, 0, 0, 0, 0},
+    {10792, 0, 10792, 0, 0, 0, 0, 0, 0},
+    {0, 10815, 0, 0, 0, 0, 0, 0, 0},
+    {-195, 0, -195, 0, 0, 0, 0, 0, 0},
+    {69, 0, 69, 0, 0, 0, 0, 0, 0},
+    {71, 0, 71, 0, 0, 0, 0, 0, 0},
+    {0, 10783, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10780, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10782, 0, 0, 0, 0, 0, 0, 0},
+    {0, -210, 0, 0, 0, 0, 0, 0, 0},
+    {0, -206, 0, 0, 0, 0, 0, 0, 0},
+    {0, -205, 0, 0, 0, 0, 0, 0, 0},
+    {0, -202, 0, 0, 0, 0, 0, 0, 0},
+    {0, -203, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42319, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42315, 0, 0, 0, 0, 0, 0, 0},
+    {0, -207, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42343, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42280, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42308, 0, 0, 0, 0, 0, 0, 0},
+    {0, -209, 0, 0, 0, 0, 0, 0, 0},
+    {0, -211, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10743, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42305, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10749, 0, 0, 0, 0, 0, 0, 0},
+    {0, -213, 0, 0, 0, 0, 0, 0, 0},
+    {0, -214, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10727, 0, 0, 0, 0, 0, 0, 0},
+    {0, -218, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42307, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42282, 0, 0, 0, 0, 0, 0, 0},
+    {0, -69, 0, 0, 0, 0, 0, 0, 0},
+    {0, -217, 0, 0, 0, 0, 0, 0, 0},
+    {0, -71, 0, 0, 0, 0, 0, 0, 0},
+    {0, -219, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42261, 0, 0, 0, 0, 0, 0, 0},
+    {0, 42258, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1},
+    {0, 0, 0, -60, -60, 0, 0, 0, 1},
+    {0, 84, 116, 0, 0, 0, 0, 0, 1},
+    {116, 0, 116, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, -733, -733, 0, 0, 0, 0},
+    {38, 0, 38, 11, 11, 0, 0, 0, 0},
+    {37, 0, 37, 13, 13, 0, 0, 0, 0},
+    {37, 0, 37, 14, 14, 0, 0, 0, 0},
+    {37, 0, 37, 15, 15, 0, 0, 0, 0},
+    {64, 0, 64, 19, 19, 0, 0, 0, 0},
+    {63, 0, 63, 23, 23, 0, 0, 0, 0},
+    {63, 0, 63, 26, 26, 0, 0, 0, 0},
+    {0, 0, 0, 58, 58, 4, 5, 0, 0},
+    {32, 0, 32, -17, -17, 0, 0, 0, 0},
+    {32, 0, 32, -6, -6, 0, 0, 0, 0},
+    {0, -38, 0, 5, 5, 0, 0, 0, 0},
+    {0, -37, 0, 8, 8, 0, 0, 0, 0},
+    {0, -37, 0, 9, 9, 0, 0, 0, 0},
+    {0, -37, 0, 10, 10, 0, 0, 0, 0},
+    {0, 0, 0, 27, 27, 5, 6, 0, 0},
+    {0, -31, 1, 0, 0, 0, 0, 0, 0},
+    {0, -32, 0, -17, -17, 0, 0, 0, 0},
+    {0, -32, 0, -6, -6, 0, 0, 0, 0},
+    {0, -64, 0, -13, -13, 0, 0, 0, 0},
+    {0, -63, 0, -8, -8, 0, 0, 0, 0},
+    {0, -63, 0, -5, -5, 0, 0, 0, 0},
+    {8, 0, 8, 0, 0, 0, 0, 0, 0},
+    {0, -62, -30, 0, 0, 0, 0, 0, 0},
+    {0, -57, -25, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, -1, -1, 0, 0, 0, 0},
+    {0, 0, 0, -2, -2, 0, 0, 0, 0},
+    {0, -47, -15, 0, 0, 0, 0, 0, 0},
+    {0, -54, -22, 0, 0, 0, 0, 0, 0},
+    {0, -8, 0, 0, 0, 0, 0, 0, 0},
+    {0, -86, -54, 0, 0, 0, 0, 0, 0},
+    {0, -80, -48, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, -116, 0, 0, 0, 0, 0, 0, 0},
+    {-60, 0, -60, 0, 0, 0, 0, 0, 0},
+    {0, -96, -64, 0, 0, 0, 0, 0, 0},
+    {-7, 0, -7, 0, 0, 0, 0, 0, 0},
+    {80, 0, 80, 21, 21, 0, 0, 0, 0},
+    {80, 0, 80, 20, 20, 0, 0, 0, 0},
+    {80, 0, 80, 0, 0, 0, 0, 0, 0},
+    {80, 0, 80, 16, 16, 0, 0, 0, 0},
+    {80, 0, 80, -1, -1, 0, 0, 0, 0},
+    {80, 0, 80, 14, 14, 0, 0, 0, 0},
+    {80, 0, 80, 11, 11, 0, 0, 0, 0},
+    {32, 0, 32, -1, -1, 0, 0, 0, 0},
+    {0, -32, 0, -1, -1, 0, 0, 0, 0},
+    {0, -80, 0, -27, -27, 0, 0, 0, 0},
+    {0, -80, 0, -28, -28, 0, 0, 0, 0},
+    {0, -80, 0, 0, 0, 0, 0, 0, 0},
+    {0, -80, 0, -32, -32, 0, 0, 0, 0},
+    {0, -80, 0, -1, -1, 0, 0, 0, 0},
+    {0, -80, 0, -34, -34, 0, 0, 0, 0},
+    {0, -80, 0, -37, -37, 0, 0, 0, 0},
+    {15, 0, 15, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -171, -171, 0, 0, 0, 0},
+    {0, -1, 0, -140, -140, 0, 0, 0, 0},
+    {0, -15, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -192, -192, 0, 0, 0, 0},
+    {0, -1, 0, -161, -161, 0, 0, 0, 0},
+    {1, 0, 1, -194, -194, 0, 0, 0, 0},
+    {0, -1, 0, -163, -163, 0, 0, 0, 0},
+    {1, 0, 1, -198, -198, 0, 0, 0, 0},
+    {0, -1, 0, -167, -167, 0, 0, 0, 0},
+    {1, 0, 1, -204, -204, 0, 0, 0, 0},
+    {0, -1, 0, -173, -173, 0, 0, 0, 0},
+    {1, 0, 1, -200, -200, 0, 0, 0, 0},
+    {0, -1, 0, -169, -169, 0, 0, 0, 0},
+    {1, 0, 1, -203, -203, 0, 0, 0, 0},
+    {0, -1, 0, -172, -172, 0, 0, 0, 0},
+    {48, 0, 48, 0, 0, 0, 0, 0, 0},
+    {0, -48, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 7, 0, 0},
+    {0, 0, 0, 5, 5, 0, 0, 0, 0},
+    {0, 0, 0, 4, 4, 0, 0, 0, 0},
+    {0, 0, 0, 36, 36, 0, 0, 0, 0},
+    {0, 0, 0, 2, 2, 0, 0, 0, 0},
+    {0, 0, 0, 21, 21, 0, 0, 0, 0},
+    {0, 0, 0, -67, -67, 0, 0, 0, 0},
+    {0, 0, 0, -63, -63, 0, 0, 0, 0},
+    {0, 0, 0, -59, -59, 0, 0, 0, 0},
+    {0, 0, 0, -51, -51, 0, 0, 0, 0},
+    {0, 0, 0, -48, -48, 0, 0, 0, 0},
+    {0, 0, 0, -4, -4, 0, 0, 0, 0},
+    {0, 0, 0, -5, -5, 0, 0, 0, 0},
+    {0, 0, 0, -6, -6, 0, 0, 0, 0},
+    {0, 0, 0, -2, -2, 0, 0, 0, 1},
+    {0, 0, 0, -3, -3, 0, 0, 0, 0},
+    {0, 0, 0, -41, -41, 0, 0, 0, 0},
+    {0, 0, 0, -4, -4, 0, 0, 0, 1},
+    {0, 0, 0, 60, 60, 0, 0, 0, 1},
+    {0, 0, 0, 59, 59, 0, 0, 0, 1},
+    {0, 0, 0, -16, -16, 0, 0, 0, 1},
+    {0, 0, 0, -1, -1, 0, 0, 0, 1},
+    {0, 0, 0, -41, -41, 0, 0, 0, 1},
+    {7264, 0, 7264, 0, 0, 0, 0, 0, 0},
+    {0, 3008, 0, 0, 0, 0, 0, 0, 0},
+    {38864, 0, 0, 0, 0, 0, 0, 0, 0},
+    {8, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, -8, -8, 0, 0, 0, 0, 0, 0},
+    {0, -6254, -6222, 0, 0, 0, 0, 0, 0},
+    {0, -6253, -6221, 0, 0, 0, 0, 0, 0},
+    {0, -6244, -6212, 0, 0, 0, 0, 0, 0},
+    {0, -6242, -6210, 0, 0, 0, 0, 0, 0},
+    {0, -6243, -6211, 0, 0, 0, 0, 0, 0},
+    {0, -6236, -6204, 0, 0, 0, 0, 0, 0},
+    {0, -6181, -6180, 0, 0, 0, 0, 0, 0},
+    {0, 35266, 35267, 0, 0, 0, 0, 0, 0},
+    {-3008, 0, -3008, 0, 0, 0, 0, 0, 0},
+    {0, 35332, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3814, 0, 0, 0, 0, 0, 0, 0},
+    {0, 35384, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 1, -7615, -7615, 0, 0, 0, 0},
+    {0, -1, 0, -7584, -7584, 0, 0, 0, 0},
+    {1, 0, 1, -7616, -7616, 0, 0, 0, 0},
+    {0, -1, 0, -7585, -7585, 0, 0, 0, 0},
+    {1, 0, 1, -7618, -7618, 0, 0, 0, 0},
+    {0, -1, 0, -7587, -7587, 0, 0, 0, 0},
+    {1, 0, 1, -7620, -7620, 0, 0, 0, 0},
+    {0, -1, 0, -7589, -7589, 0, 0, 0, 0},
+    {1, 0, 1, -7489, -7489, 0, 0, 0, 0},
+    {0, -1, 0, -7458, -7458, 0, 0, 0, 0},
+    {1, 0, 1, -7622, -7622, 0, 0, 0, 0},
+    {0, -1, 0, -7591, -7591, 0, 0, 0, 0},
+    {1, 0, 1, -7624, -7624, 0, 0, 0, 0},
+    {0, -1, 0, -7593, -7593, 0, 0, 0, 0},
+    {1, 0, 1, -7626, -7626, 0, 0, 0, 0},
+    {0, -1, 0, -7595, -7595, 0, 0, 0, 0},
+    {1, 0, 1, -7628, -7628, 0, 0, 0, 0},
+    {0, -1, 0, -7597, -7597, 0, 0, 0, 0},
+    {1, 0, 1, -7630, -7630, 0, 0, 0, 0},
+    {0, -1, 0, -7599, -7599, 0, 0, 0, 0},
+    {1, 0, 1, -7426, -7426, 0, 0, 0, 0},
+    {0, -1, 0, -7426, -7426, 0, 0, 0, 0},
+    {1, 0, 1, -7428, -7428, 0, 0, 0, 0},
+    {0, -1, 0, -7428, -7428, 0, 0, 0, 0},
+    {1, 0, 1, -7635, -7635, 0, 0, 0, 0},
+    {0, -1, 0, -7604, -7604, 0, 0, 0, 0},
+    {1, 0, 1, -7637, -7637, 0, 0, 0, 0},
+    {0, -1, 0, -7606, -7606, 0, 0, 0, 0},
+    {1, 0, 1, -7156, -7156, 0, 0, 0, 0},
+    {0, -1, 0, -7156, -7156, 0, 0, 0, 0},
+    {1, 0, 1, -7640, -7640, 0, 0, 0, 0},
+    {0, -1, 0, -7609, -7609, 0, 0, 0, 0},
+    {1, 0, 1, -7641, -7641, 0, 0, 0, 0},
+    {0, -1, 0, -7610, -7610, 0, 0, 0, 0},
+    {1, 0, 1, -7642, -7642, 0, 0, 0, 0},
+    {0, -1, 0, -7611, -7611, 0, 0, 0, 0},
+    {1, 0, 1, -7644, -7644, 0, 0, 0, 0},
+    {0, -1, 0, -7613, -7613, 0, 0, 0, 0},
+    {1, 0, 1, -7646, -7646, 0, 0, 0, 0},
+    {0, -1, 0, -7615, -7615, 0, 0, 0, 0},
+    {1, 0, 1, -7648, -7648, 0, 0, 0, 0},
+    {0, -1, 0, -7617, -7617, 0, 0, 0, 0},
+    {1, 0, 1, -7650, -7650, 0, 0, 0, 0},
+    {0, -1, 0, -7619, -7619, 0, 0, 0, 0},
+    {1, 0, 1, -7651, -7651, 0, 0, 0, 0},
+    {0, -1, 0, -7620, -7620, 0, 0, 0, 0},
+    {1, 0, 1, -7519, -7519, 0, 0, 0, 0},
+    {0, -1, 0, -7488, -7488, 0, 0, 0, 0},
+    {1, 0, 1, -7653, -7653, 0, 0, 0, 0},
+    {0, -1, 0, -7622, -7622, 0, 0, 0, 0},
+    {1, 0, 1, -7655, -7655, 0, 0, 0, 0},
+    {0, -1, 0, -7624, -7624, 0, 0, 0, 0},
+    {1, 0, 1, -7657, -7657, 0, 0, 0, 0},
+    {0, -1, 0, -7626, -7626, 0, 0, 0, 0},
+    {1, 0, 1, -7658, -7658, 0, 0, 0, 0},
+    {0, -1, 0, -7627, -7627, 0, 0, 0, 0},
+    {1, 0, 1, -7662, -7662, 0, 0, 0, 0},
+    {0, -1, 0, -7631, -7631, 0, 0, 0, 0},
+    {1, 0, 1, -7664, -7664, 0, 0, 0, 0},
+    {0, -1, 0, -7633, -7633, 0, 0, 0, 0},
+    {1, 0, 1, -7665, -7665, 0, 0, 0, 0},
+    {0, -1, 0, -7634, -7634, 0, 0, 0, 0},
+    {1, 0, 1, -7667, -7667, 0, 0, 0, 0},
+    {0, -1, 0, -7636, -7636, 0, 0, 0, 0},
+    {1, 0, 1, -7669, -7669, 0, 0, 0, 0},
+    {0, -1, 0, -7638, -7638, 0, 0, 0, 0},
+    {1, 0, 1, -7670, -7670, 0, 0, 0, 0},
+    {0, -1, 0, -7639, -7639, 0, 0, 0, 0},
+    {1, 0, 1, -7672, -7672, 0, 0, 0, 0},
+    {0, -1, 0, -7641, -7641, 0, 0, 0, 0},
+    {1, 0, 1, -7674, -7674, 0, 0, 0, 0},
+    {0, -1, 0, -7643, -7643, 0, 0, 0, 0},
+    {1, 0, 1, -7676, -7676, 0, 0, 0, 0},
+    {0, -1, 0, -7645, -7645, 0, 0, 0, 0},
+    {1, 0, 1, -7543, -7543, 0, 0, 0, 0},
+    {0, -1, 0, -7512, -7512, 0, 0, 0, 0},
+    {1, 0, 1, -7545, -7545, 0, 0, 0, 0},
+    {0, -1, 0, -7514, -7514, 0, 0, 0, 0},
+    {1, 0, 1, -7430, -7430, 0, 0, 0, 0},
+    {0, -1, 0, -7430, -7430, 0, 0, 0, 0},
+    {1, 0, 1, -7684, -7684, 0, 0, 0, 0},
+    {0, -1, 0, -7653, -7653, 0, 0, 0, 0},
+    {1, 0, 1, -7686, -7686, 0, 0, 0, 0},
+    {0, -1, 0, -7655, -7655, 0, 0, 0, 0},
+    {1, 0, 1, -7688, -7688, 0, 0, 0, 0},
+    {0, -1, 0, -7657, -7657, 0, 0, 0, 0},
+    {1, 0, 1, -7692, -7692, 0, 0, 0, 0},
+    {0, -1, 0, -7661, -7661, 0, 0, 0, 0},
+    {1, 0, 1, -7693, -7693, 0, 0, 0, 0},
+    {0, -1, 0, -7662, -7662, 0, 0, 0, 0},
+    {1, 0, 1, -7695, -7695, 0, 0, 0, 0},
+    {0, -1, 0, -7664, -7664, 0, 0, 0, 0},
+    {1, 0, 1, -7434, -7434, 0, 0, 0, 0},
+    {0, -1, 0, -7434, -7434, 0, 0, 0, 0},
+    {1, 0, 1, -6, -6, 0, 0, 0, 0},
+    {0, -1, 0, -6, -6, 0, 0, 0, 0},
+    {1, 0, 1, -7702, -7702, 0, 0, 0, 0},
+    {0, -1, 0, -7671, -7671, 0, 0, 0, 0},
+    {1, 0, 1, -7704, -7704, 0, 0, 0, 0},
+    {0, -1, 0, -7673, -7673, 0, 0, 0, 0},
+    {1, 0, 1, -7706, -7706, 0, 0, 0, 0},
+    {0, -1, 0, -7675, -7675, 0, 0, 0, 0},
+    {1, 0, 1, -7708, -7708, 0, 0, 0, 0},
+    {0, -1, 0, -7677, -7677, 0, 0, 0, 0},
+    {1, 0, 1, -7709, -7709, 0, 0, 0, 0},
+    {0, -1, 0, -7678, -7678, 0, 0, 0, 0},
+    {1, 0, 1, -7711, -7711, 0, 0, 0, 0},
+    {0, -1, 0, -7680, -7680, 0, 0, 0, 0},
+    {1, 0, 1, -7713, -7713, 0, 0, 0, 0},
+    {0, -1, 0, -7682, -7682, 0, 0, 0, 0},
+    {1, 0, 1, -7440, -7440, 0, 0, 0, 0},
+    {0, -1, 0, -7440, -7440, 0, 0, 0, 0},
+    {1, 0, 1, -7718, -7718, 0, 0, 0, 0},
+    {0, -1, 0, -7687, -7687, 0, 0, 0, 0},
+    {1, 0, 1, -7720, -7720, 0, 0, 0, 0},
+    {0, -1, 0, -7689, -7689, 0, 0, 0, 0},
+    {1, 0, 1, -7721, -7721, 0, 0, 0, 0},
+    {0, -1, 0, -7690, -7690, 0, 0, 0, 0},
+    {1, 0, 1, -7723, -7723, 0, 0, 0, 0},
+    {0, -1, 0, -7692, -7692, 0, 0, 0, 0},
+    {1, 0, 1, -7725, -7725, 0, 0, 0, 0},
+    {0, -1, 0, -7694, -7694, 0, 0, 0, 0},
+    {1, 0, 1, -7727, -7727, 0, 0, 0, 0},
+    {0, -1, 0, -7696, -7696, 0, 0, 0, 0},
+    {1, 0, 1, -7729, -7729, 0, 0, 0, 0},
+    {0, -1, 0, -7698, -7698, 0, 0, 0, 0},
+    {1, 0, 1, -7730, -7730, 0, 0, 0, 0},
+    {0, -1, 0, -7699, -7699, 0, 0, 0, 0},
+    {1, 0, 1, -7732, -7732, 0, 0, 0, 0},
+    {0, -1, 0, -7701, -7701, 0, 0, 0, 0},
+    {1, 0, 1, -7733, -7733, 0, 0, 0, 0},
+    {0, -1, 0, -7702, -7702, 0, 0, 0, 0},
+    {1, 0, 1, -7734, -7734, 0, 0, 0, 0},
+    {0, -1, 0, -7703, -7703, 0, 0, 0, 0},
+    {1, 0, 1, -7736, -7736, 0, 0, 0, 0},
+    {0, -1, 0, -7705, -7705, 0, 0, 0, 0},
+    {1, 0, 1, -7738, -7738, 0, 0, 0, 0},
+    {0, -1, 0, -7707, -7707, 0, 0, 0, 0},
+    {0, 0, 0, -7726, -7726, 7, 8, 0, 0},
+    {0, 0, 0, -7715, -7715, 8, 9, 0, 0},
+    {0, 0, 0, -7713, -7713, 9, 10, 0, 0},
+    {0, 0, 0, -7712, -7712, 10, 11, 0, 0},
+    {0, 0, 0, 0, 0, 11, 12, 0, 0},
+    {0, -59, -58, -7452, -7452, 0, 0, 0, 0},
+    {-7615, 0, -7615, 0, 0, 0, 13, 0, 0},
+    {1, 0, 1, -7775, -7775, 0, 0, 0, 0},
+    {0, -1, 0, -7744, -7744, 0, 0, 0, 0},
+    {1, 0, 1, -7777, -7777, 0, 0, 0, 0},
+    {0, -1, 0, -7746, -7746, 0, 0, 0, 0},
+    {1, 0, 1, -7652, -7652, 0, 0, 0, 0},
+    {0, -1, 0, -7621, -7621, 0, 0, 0, 0},
+    {1, 0, 1, -7654, -7654, 0, 0, 0, 0},
+    {0, -1, 0, -7623, -7623, 0, 0, 0, 0},
+    {1, 0, 1, -7656, -7656, 0, 0, 0, 0},
+    {0, -1, 0, -7625, -7625, 0, 0, 0, 0},
+    {1, 0, 1, -12, -12, 0, 0, 0, 0},
+    {0, -1, 0, -12, -12, 0, 0, 0, 0},
+    {1, 0, 1, -7596, -7596, 0, 0, 0, 0},
+    {0, -1, 0, -7596, -7596, 0, 0, 0, 0},
+    {1, 0, 1, -7598, -7598, 0, 0, 0, 0},
+    {0, -1, 0, -7598, -7598, 0, 0, 0, 0},
+    {1, 0, 1, -7600, -7600, 0, 0, 0, 0},
+    {0, -1, 0, -7600, -7600, 0, 0, 0, 0},
+    {1, 0, 1, -7602, -7602, 0, 0, 0, 0},
+    {0, -1, 0, -7602, -7602, 0, 0, 0, 0},
+    {1, 0, 1, -22, -22, 0, 0, 0, 0},
+    {0, -1, 0, -22, -22, 0, 0, 0, 0},
+    {1, 0, 1, -7795, -7795, 0, 0, 0, 0},
+    {0, -1, 0, -7764, -7764, 0, 0, 0, 0},
+    {1, 0, 1, -7797, -7797, 0, 0, 0, 0},
+    {0, -1, 0, -7766, -7766, 0, 0, 0, 0},
+    {1, 0, 1, -7799, -7799, 0, 0, 0, 0},
+    {0, -1, 0, -7768, -7768, 0, 0, 0, 0},
+    {1, 0, 1, -7668, -7668, 0, 0, 0, 0},
+    {0, -1, 0, -7637, -7637, 0, 0, 0, 0},
+    {1, 0, 1, -14, -14, 0, 0, 0, 0},
+    {0, -1, 0, -14, -14, 0, 0, 0, 0},
+    {1, 0, 1, -7807, -7807, 0, 0, 0, 0},
+    {0, -1, 0, -7776, -7776, 0, 0, 0, 0},
+    {1, 0, 1, -7809, -7809, 0, 0, 0, 0},
+    {0, -1, 0, -7778, -7778, 0, 0, 0, 0},
+    {1, 0, 1, -7805, -7805, 0, 0, 0, 0},
+    {0, -1, 0, -7774, -7774, 0, 0, 0, 0},
+    {1, 0, 1, -7678, -7678, 0, 0, 0, 0},
+    {0, -1, 0, -7647, -7647, 0, 0, 0, 0},
+    {1, 0, 1, -7680, -7680, 0, 0, 0, 0},
+    {0, -1, 0, -7649, -7649, 0, 0, 0, 0},
+    {1, 0, 1, -7682, -7682, 0, 0, 0, 0},
+    {0, -1, 0, -7651, -7651, 0, 0, 0, 0},
+    {1, 0, 1, -7482, -7482, 0, 0, 0, 0},
+    {0, -1, 0, -7482, -7482, 0, 0, 0, 0},
+    {1, 0, 1, -7484, -7484, 0, 0, 0, 0},
+    {0, -1, 0, -7484, -7484, 0, 0, 0, 0},
+    {1, 0, 1, -7486, -7486, 0, 0, 0, 0},
+    {0, -1, 0, -7486, -7486, 0, 0, 0, 0},
+    {1, 0, 1, -7488, -7488, 0, 0, 0, 0},
+    {1, 0, 1, -7490, -7490, 0, 0, 0, 0},
+    {0, -1, 0, -7490, -7490, 0, 0, 0, 0},
+    {1, 0, 1, -7823, -7823, 0, 0, 0, 0},
+    {0, -1, 0, -7792, -7792, 0, 0, 0, 0},
+    {1, 0, 1, -7825, -7825, 0, 0, 0, 0},
+    {0, -1, 0, -7794, -7794, 0, 0, 0, 0},
+    {1, 0, 1, -7481, -7481, 0, 0, 0, 0},
+    {0, -1, 0, -7481, -7481, 0, 0, 0, 0},
+    {1, 0, 1, -7483, -7483, 0, 0, 0, 0},
+    {0, -1, 0, -7483, -7483, 0, 0, 0, 0},
+    {1, 0, 1, -7485, -7485, 0, 0, 0, 0},
+    {0, -1, 0, -7485, -7485, 0, 0, 0, 0},
+    {1, 0, 1, -7487, -7487, 0, 0, 0, 0},
+    {0, -1, 0, -7487, -7487, 0, 0, 0, 0},
+    {0, -1, 0, -7489, -7489, 0, 0, 0, 0},
+    {1, 0, 1, -7833, -7833, 0, 0, 0, 0},
+    {0, -1, 0, -7802, -7802, 0, 0, 0, 0},
+    {1, 0, 1, -7835, -7835, 0, 0, 0, 0},
+    {0, -1, 0, -7804, -7804, 0, 0, 0, 0},
+    {1, 0, 1, -7837, -7837, 0, 0, 0, 0},
+    {0, -1, 0, -7806, -7806, 0, 0, 0, 0},
+    {1, 0, 1, -7839, -7839, 0, 0, 0, 0},
+    {0, -1, 0, -7808, -7808, 0, 0, 0, 0},
+    {0, 8, 0, -6991, -6991, 0, 0, 0, 0},
+    {0, 8, 0, -6992, -6992, 0, 0, 0, 0},
+    {0, 8, 0, -2, -2, 0, 0, 0, 0},
+    {0, 8, 0, -4, -4, 0, 0, 0, 0},
+    {0, 8, 0, -6, -6, 0, 0, 0, 0},
+    {-8, 0, -8, -7031, -7031, 0, 0, 0, 0},
+    {-8, 0, -8, -7032, -7032, 0, 0, 0, 0},
+    {-8, 0, -8, -2, -2, 0, 0, 0, 0},
+    {-8, 0, -8, -4, -4, 0, 0, 0, 0},
+    {-8, 0, -8, -6, -6, 0, 0, 0, 0},
+    {0, 8, 0, -7003, -7003, 0, 0, 0, 0},
+    {0, 8, 0, -7004, -7004, 0, 0, 0, 0},
+    {-8, 0, -8, -7043, -7043, 0, 0, 0, 0},
+    {-8, 0, -8, -7044, -7044, 0, 0, 0, 0},
+    {0, 8, 0, -7017, -7017, 0, 0, 0, 0},
+    {0, 8, 0, -7018, -7018, 0, 0, 0, 0},
+    {-8, 0, -8, -7057, -7057, 0, 0, 0, 0},
+    {-8, 0, -8, -7058, -7058, 0, 0, 0, 0},
+    {0, 8, 0, -7031, -7031, 0, 0, 0, 0},
+    {0, 8, 0, -7032, -7032, 0, 0, 0, 0},
+    {-8, 0, -8, -7071, -7071, 0, 0, 0, 0},
+    {-8, 0, -8, -7072, -7072, 0, 0, 0, 0},
+    {0, 8, 0, -7041, -7041, 0, 0, 0, 0},
+    {0, 8, 0, -7042, -7042, 0, 0, 0, 0},
+    {-8, 0, -8, -7081, -7081, 0, 0, 0, 0},
+    {-8, 0, -8, -7082, -7082, 0, 0, 0, 0},
+    {0, 0, 0, -7051, -7051, 12, 14, 0, 0},
+    {0, 8, 0, -7052, -7052, 0, 0, 0, 0},
+    {0, 0, 0, -2, -2, 13, 15, 0, 0},
+    {0, 0, 0, -4, -4, 14, 16, 0, 0},
+    {0, 0, 0, -6, -6, 15, 17, 0, 0},
+    {-8, 0, -8, -7092, -7092, 0, 0, 0, 0},
+    {0, 8, 0, -7063, -7063, 0, 0, 0, 0},
+    {0, 8, 0, -7064, -7064, 0, 0, 0, 0},
+    {-8, 0, -8, -7103, -7103, 0, 0, 0, 0},
+    {-8, 0, -8, -7104, -7104, 0, 0, 0, 0},
+    {0, 74, 0, -7103, -7103, 0, 0, 0, 0},
+    {0, 74, 0, 0, 0, 0, 0, 0, 0},
+    {0, 86, 0, -7101, -7101, 0, 0, 0, 0},
+    {0, 86, 0, 0, 0, 0, 0, 0, 0},
+    {0, 100, 0, -7101, -7101, 0, 0, 0, 0},
+    {0, 100, 0, 0, 0, 0, 0, 0, 0},
+    {0, 128, 0, -7097, -7097, 0, 0, 0, 0},
+    {0, 128, 0, 0, 0, 0, 0, 0, 0},
+    {0, 112, 0, -7093, -7093, 0, 0, 0, 0},
+    {0, 112, 0, 0, 0, 0, 0, 0, 0},
+    {0, 126, 0, -7091, -7091, 0, 0, 0, 0},
+    {0, 126, 0, 0, 0, 0, 0, 0, 0},
+    {0, 8, 0, -128, -128, 16, 18, 0, 0},
+    {0, 8, 0, -128, -128, 17, 19, 0, 0},
+    {0, 8, 0, -128, -128, 18, 20, 0, 0},
+    {0, 8, 0, -128, -128, 19, 21, 0, 0},
+    {0, 8, 0, -128, -128, 20, 22, 0, 0},
+    {0, 8, 0, -128, -128, 21, 23, 0, 0},
+    {0, 8, 0, -128, -128, 22, 24, 0, 0},
+    {0, 8, 0, -128, -128, 23, 25, 0, 0},
+    {-8, 0, -8, -128, -128, 24, 26, 0, 0},
+    {-8, 0, -8, -128, -128, 25, 27, 0, 0},
+    {-8, 0, -8, -128, -128, 26, 28, 0, 0},
+    {-8, 0, -8, -128, -128, 27, 29, 0, 0},
+    {-8, 0, -8, -128, -128, 28, 30, 0, 0},
+    {-8, 0, -8, -128, -128, 29, 31, 0, 0},
+    {-8, 0, -8, -128, -128, 30, 32, 0, 0},
+    {-8, 0, -8, -128, -128, 31, 33, 0, 0},
+    {0, 8, 0, -112, -112, 32, 34, 0, 0},
+    {0, 8, 0, -112, -112, 33, 35, 0, 0},
+    {0, 8, 0, -112, -112, 34, 36, 0, 0},
+    {0, 8, 0, -112, -112, 35, 37, 0, 0},
+    {0, 8, 0, -112, -112, 36, 38, 0, 0},
+    {0, 8, 0, -112, -112, 37, 39, 0, 0},
+    {0, 8, 0, -112, -112, 38, 40, 0, 0},
+    {0, 8, 0, -112, -112, 39, 41, 0, 0},
+    {-8, 0, -8, -112, -112, 40, 42, 0, 0},
+    {-8, 0, -8, -112, -112, 41, 43, 0, 0},
+    {-8, 0, -8, -112, -112, 42, 44, 0, 0},
+    {-8, 0, -8, -112, -112, 43, 45, 0, 0},
+    {-8, 0, -8, -112, -112, 44, 46, 0, 0},
+    {-8, 0, -8, -112, -112, 45, 47, 0, 0},
+    {-8, 0, -8, -112, -112, 46, 48, 0, 0},
+    {-8, 0, -8, -112, -112, 47, 49, 0, 0},
+    {0, 8, 0, -64, -64, 48, 50, 0, 0},
+    {0, 8, 0, -64, -64, 49, 51, 0, 0},
+    {0, 8, 0, -64, -64, 50, 52, 0, 0},
+    {0, 8, 0, -64, -64, 51, 53, 0, 0},
+    {0, 8, 0, -64, -64, 52, 54, 0, 0},
+    {0, 8, 0, -64, -64, 53, 55, 0, 0},
+    {0, 8, 0, -64, -64, 54, 56, 0, 0},
+    {0, 8, 0, -64, -64, 55, 57, 0, 0},
+    {-8, 0, -8, -64, -64, 56, 58, 0, 0},
+    {-8, 0, -8, -64, -64, 57, 59, 0, 0},
+    {-8, 0, -8, -64, -64, 58, 60, 0, 0},
+    {-8, 0, -8, -64, -64, 59, 61, 0, 0},
+    {-8, 0, -8, -64, -64, 60, 62, 0, 0},
+    {-8, 0, -8, -64, -64, 61, 63, 0, 0},
+    {-8, 0, -8, -64, -64, 62, 64, 0, 0},
+    {-8, 0, -8, -64, -64, 63, 65, 0, 0},
+    {0, 8, 0, -7167, -7167, 0, 0, 0, 0},
+    {0, 8, 0, -7168, -7168, 0, 0, 0, 0},
+    {0, 0, 0, -66, -66, 64, 66, 0, 0},
+    {0, 9, 0, -7170, -7170, 65, 67, 0, 0},
+    {0, 0, 0, -7176, -7176, 66, 68, 0, 0},
+    {0, 0, 0, -7173, -7173, 67, 69, 0, 0},
+    {0, 0, 0, -1, -1, 68, 70, 0, 0},
+    {-8, 0, -8, -7207, -7207, 0, 0, 0, 0},
+    {-8, 0, -8, -7208, -7208, 0, 0, 0, 0},
+    {-74, 0, -74, -7209, -7209, 0, 0, 0, 0},
+    {-74, 0, -74, 0, 0, 0, 0, 0, 0},
+    {-9, 0, -9, -7211, -7211, 69, 71, 0, 0},
+    {0, -7205, -7173, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, -7961, -7961, 0, 0, 0, 0},
+    {0, 0, 0, -78, -78, 70, 72, 0, 0},
+    {0, 9, 0, -7180, -7180, 71, 73, 0, 0},
+    {0, 0, 0, -7190, -7190, 72, 74, 0, 0},
+    {0, 0, 0, -7183, -7183, 73, 75, 0, 0},
+    {0, 0, 0, -1, -1, 74, 76, 0, 0},
+    {-86, 0, -86, -7219, -7219, 0, 0, 0, 0},
+    {-86, 0, -86, 0, 0, 0, 0, 0, 0},
+    {-9, 0, -9, -7221, -7221, 75, 77, 0, 0},
+    {0, 0, 0, -14, -14, 0, 0, 0, 0},
+    {0, 0, 0, -15, -15, 0, 0, 0, 0},
+    {0, 0, 0, -16, -16, 0, 0, 0, 0},
+    {0, 8, 0, -7191, -7191, 0, 0, 0, 0},
+    {0, 8, 0, -7192, -7192, 0, 0, 0, 0},
+    {0, 0, 0, -7176, -7176, 76, 78, 0, 0},
+    {0, 0, 0, 0, 0, 77, 79, 0, 0},
+    {0, 0, 0, -7197, -7197, 78, 80, 0, 0},
+    {0, 0, 0, -7181, -7181, 79, 81, 0, 0},
+    {-8, 0, -8, -7231, -7231, 0, 0, 0, 0},
+    {-8, 0, -8, -7232, -7232, 0, 0, 0, 0},
+    {-100, 0, -100, -7233, -7233, 0, 0, 0, 0},
+    {-100, 0, -100, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 33, 33, 0, 0, 0, 0},
+    {0, 0, 0, 32, 32, 0, 0, 0, 0},
+    {0, 0, 0, 31, 31, 0, 0, 0, 0},
+    {0, 8, 0, -7195, -7195, 0, 0, 0, 0},
+    {0, 8, 0, -7196, -7196, 0, 0, 0, 0},
+    {0, 0, 0, -7191, -7191, 80, 82, 0, 0},
+    {0, 0, 0, 0, 0, 81, 83, 0, 0},
+    {0, 0, 0, -7203, -7203, 82, 84, 0, 0},
+    {0, 7, 0, -7204, -7204, 0, 0, 0, 0},
+    {0, 0, 0, -7201, -7201, 83, 85, 0, 0},
+    {0, 0, 0, -7196, -7196, 84, 86, 0, 0},
+    {-8, 0, -8, -7235, -7235, 0, 0, 0, 0},
+    {-8, 0, -8, -7236, -7236, 0, 0, 0, 0},
+    {-112, 0, -112, -7237, -7237, 0, 0, 0, 0},
+    {-112, 0, -112, 0, 0, 0, 0, 0, 0},
+    {-7, 0, -7, -7243, -7243, 0, 0, 0, 0},
+    {0, 0, 0, -8005, -8005, 0, 0, 0, 0},
+    {0, 0, 0, -118, -118, 85, 87, 0, 0},
+    {0, 9, 0, -7210, -7210, 86, 88, 0, 0},
+    {0, 0, 0, -7206, -7206, 87, 89, 0, 0},
+    {0, 0, 0, -7213, -7213, 88, 90, 0, 0},
+    {0, 0, 0, -1, -1, 89, 91, 0, 0},
+    {-128, 0, -128, -7257, -7257, 0, 0, 0, 0},
+    {-128, 0, -128, 0, 0, 0, 0, 0, 0},
+    {-126, 0, -126, -7249, -7249, 0, 0, 0, 0},
+    {-126, 0, -126, 0, 0, 0, 0, 0, 0},
+    {-9, 0, -9, -7251, -7251, 90, 92, 0, 0},
+    {-7517, 0, -7517, 0, 0, 0, 0, 0, 0},
+    {-8383, 0, -8383, 0, 0, 0, 0, 0, 0},
+    {-8262, 0, -8262, 0, 0, 0, 0, 0, 0},
+    {28, 0, 28, 0, 0, 0, 0, 0, 0},
+    {0, -28, 0, 0, 0, 0, 0, 0, 0},
+    {16, 0, 16, 0, 0, 0, 0, 0, 0},
+    {0, -16, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, -10, -10, 0, 0, 0, 0},
+    {0, 0, 0, -9, -9, 0, 0, 0, 0},
+    {0, 0, 0, -26, -26, 0, 0, 0, 0},
+    {0, 0, 0, 3, 3, 0, 0, 0, 0},
+    {0, 0, 0, 6, 6, 0, 0, 0, 0},
+    {0, 0, 0, -8739, -8739, 0, 0, 0, 0},
+    {0, 0, 0, -32, -32, 0, 0, 0, 0},
+    {0, 0, 0, -8754, -8754, 0, 0, 0, 0},
+    {0, 0, 0, -8753, -8753, 0, 0, 0, 0},
+    {0, 0, 0, -12, -12, 0, 0, 0, 0},
+    {0, 0, 0, -100, -100, 0, 0, 0, 0},
+    {0, 0, 0, -81, -81, 0, 0, 0, 0},
+    {0, 0, 0, -56, -56, 0, 0, 0, 0},
+    {26, 0, 26, 0, 0, 0, 0, 0, 0},
+    {0, -26, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 1, 1, 0, 0, 0, 0},
+    {-10743, 0, -10743, 0, 0, 0, 0, 0, 0},
+    {-3814, 0, -3814, 0, 0, 0, 0, 0, 0},
+    {-10727, 0, -10727, 0, 0, 0, 0, 0, 0},
+    {0, -10795, 0, 0, 0, 0, 0, 0, 0},
+    {0, -10792, 0, 0, 0, 0, 0, 0, 0},
+    {-10780, 0, -10780, 0, 0, 0, 0, 0, 0},
+    {-10749, 0, -10749, 0, 0, 0, 0, 0, 0},
+    {-10783, 0, -10783, 0, 0, 0, 0, 0, 0},
+    {-10782, 0, -10782, 0, 0, 0, 0, 0, 0},
+    {-10815, 0, -10815, 0, 0, 0, 0, 0, 0},
+    {0, -7264, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, -78, -78, 0, 0, 0, 0},
+    {0, 0, 0, -8, -8, 0, 0, 0, 0},
+    {-35332, 0, -35332, 0, 0, 0, 0, 0, 0},
+    {-42280, 0, -42280, 0, 0, 0, 0, 0, 0},
+    {0, 48, 0, 0, 0, 0, 0, 0, 0},
+    {-42308, 0, -42308, 0, 0, 0, 0, 0, 0},
+    {-42319, 0, -42319, 0, 0, 0, 0, 0, 0},
+    {-42315, 0, -42315, 0, 0, 0, 0, 0, 0},
+    {-42305, 0, -42305, 0, 0, 0, 0, 0, 0},
+    {-42258, 0, -42258, 0, 0, 0, 0, 0, 0},
+    {-42282, 0, -42282, 0, 0, 0, 0, 0, 0},
+    {-42261, 0, -42261, 0, 0, 0, 0, 0, 0},
+    {928, 0, 928, 0, 0, 0, 0, 0, 0},
+    {-48, 0, -48, 0, 0, 0, 0, 0, 0},
+    {-42307, 0, -42307, 0, 0, 0, 0, 0, 0},
+    {-35384, 0, -35384, 0, 0, 0, 0, 0, 0},
+    {-42343, 0, -42343, 0, 0, 0, 0, 0, 0},
+    {-42561, 0, -42561, 0, 0, 0, 0, 0, 0},
+    {0, -928, 0, 0, 0, 0, 0, 0, 0},
+    {0, -38864, -38864, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 91, 93, 0, 0},
+    {0, 0, 0, 0, 0, 92, 94, 0, 0},
+    {0, 0, 0, 0, 0, 93, 95, 0, 0},
+    {0, 0, 0, 0, 0, 94, 96, 0, 0},
+    {0, 0, 0, 0, 0, 95, 97, 0, 0},
+    {0, 0, 0, 0, 0, 96, 98, 0, 0},
+    {0, 0, 0, 0, 0, 97, 99, 0, 0},
+    {0, 0, 0, 0, 0, 98, 100, 0, 0},
+    {0, 0, 0, 0, 0, 99, 101, 0, 0},
+    {0, 0, 0, 0, 0, 100, 102, 0, 0},
+    {0, 0, 0, 0, 0, 101, 103, 0, 0},
+    {0, 0, 0, 0, 0, 102, 104, 0, 0},
+    {0, 0, 0, -62788, -62788, 0, 0, 0, 0},
+    {0, 0, 0, -62765, -62765, 0, 0, 0, 0},
+    {0, 0, 0, -62785, -62785, 0, 0, 0, 0},
+    {0, 0, 0, -62786, -62786, 0, 0, 0, 0},
+    {0, 0, 0, 29, 29, 0, 0, 0, 0},
+    {0, 0, 0, 28, 28, 0, 0, 0, 0},
+    {0, 0, 0, -62814, -62814, 0, 0, 0, 0},
+    {0, 0, 0, -62815, -62815, 0, 0, 0, 0},
+    {0, 0, 0, -62816, -62816, 0, 0, 0, 0},
+    {0, 0, 0, -62838, -62838, 0, 0, 0, 0},
+    {0, 0, 0, -62843, -62843, 0, 0, 0, 0},
+    {0, 0, 0, -62834, -62834, 0, 0, 0, 0},
+    {0, 0, 0, -62826, -62826, 0, 0, 0, 0},
+    {40, 0, 40, 0, 0, 0, 0, 0, 0},
+    {0, -40, 0, 0, 0, 0, 0, 0, 0},
+    {39, 0, 39, 0, 0, 0, 0, 0, 0},
+    {0, -39, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 9, 9, 0, 0, 0, 0},
+    {64, 0, 64, 0, 0, 0, 0, 0, 0},
+    {0, -64, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 3, 3, 0, 0, 0, 1},
+    {0, 0, 0, -3, -3, 0, 0, 0, 1},
+    {0, 0, 0, -5, -5, 0, 0, 0, 1},
+    {0, 0, 0, -6, -6, 0, 0, 0, 1},
+    {0, 0, 0, 5, 5, 0, 0, 0, 1},
+    {0, 0, 0, -7, -7, 0, 0, 0, 1},
+    {27, 0, 27, 0, 0, 0, 0, 0, 0},
+    {0, -27, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, -7, -7, 0, 0, 0, 0},
+    {34, 0, 34, 0, 0, 0, 0, 0, 0},
+    {0, -34, 0, 0, 0, 0, 0, 0, 0},
+};
+
+// 14344 block indices, 234 distinct blocks of 64
+const uint8_t props_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 0, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 42, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60,
+    61, 62, 63, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 66, 67,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 69, 70, 71,
+    72, 0, 73, 0, 74, 0, 0, 0, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 0, 84, 85, 0, 86, 87, 11, 88, 89, 90, 91, 92, 93, 94, 95,
+    0, 0, 0, 96, 97, 98, 99, 100, 101, 102, 103, 104, 0, 0, 0, 0,
+    0, 0, 105, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0,
+    108, 109, 110, 111, 112, 113, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0,
+    115, 116, 117, 118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 120, 121, 122, 123, 124, 125,
+    126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 134, 135, 0, 136, 137, 138,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 140, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 141, 0, 0, 0, 142, 143, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 0, 145, 0, 146, 0, 0,
+    147, 148, 149, 150, 0, 151, 152, 153, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 155, 0, 0, 0, 0,
+    0, 0, 156, 157, 158, 159, 160, 0, 0, 0, 161, 162, 0, 163, 164, 0,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 51, 0, 174, 49, 175, 176, 177,
+    178, 179, 180, 181, 0, 0, 182, 183, 184, 185, 186, 0, 187, 0, 0, 0,
+    188, 0, 189, 190, 191, 192, 0, 193, 194, 195, 196, 0, 0, 0, 0, 0,
+    197, 0, 198, 0, 199, 200, 201, 0, 0, 0, 0, 202, 203, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 207, 208, 0, 0, 0,
+    0, 0, 0, 0, 0, 209, 0, 0, 0, 210, 211, 212, 0, 213, 214, 215,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 217, 218, 0, 0,
+    0, 0, 0, 0, 0, 219, 220, 221, 0, 222, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 223, 224, 225, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    226, 0, 213, 0, 208, 0, 0, 0, 0, 0, 227, 228, 0, 0, 0, 0,
+    0, 0, 0, 228, 0, 0, 0, 229, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 231, 232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 11, 11, 11, 233,
+};
+const size_t props_stage1_size = 14344;
+
+const uint16_t props_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 5, 6, 7, 8, 9, 10, 9, 8, 9, 11, 12, 8, 9, 11, 12,
+    13, 8, 8, 9, 11, 12, 14, 0, 15, 9, 11, 12, 14, 9, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 23, 22, 23, 25, 26, 22, 23, 25, 26,
+    27, 22, 22, 23, 25, 26, 28, 0, 29, 23, 25, 26, 28, 23, 30, 31,
+    32, 33, 34, 35, 36, 37, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 0, 84, 85, 86, 87, 88, 89, 78,
+    79, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+    137, 138, 139, 140, 139, 140, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 78, 79, 78, 79, 151, 78, 79, 152, 152, 78, 79, 0, 153, 154,
+    155, 78, 79, 152, 156, 157, 158, 159, 78, 79, 160, 161, 158, 162, 163, 164,
+    165, 166, 78, 79, 78, 79, 167, 78, 79, 167, 0, 0, 78, 79, 167, 168,
+    169, 170, 170, 78, 79, 78, 79, 171, 78, 79, 0, 0, 78, 79, 0, 172,
+    0, 0, 0, 0, 173, 174, 175, 173, 174, 175, 173, 174, 175, 176, 177, 178,
+    179, 180, 181, 182, 183, 96, 97, 184, 185, 101, 102, 103, 104, 186, 187, 188,
+    189, 190, 191, 192, 78, 79, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202,
+    203, 173, 174, 175, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 216, 217, 218, 219, 216, 217, 218, 219, 220, 221, 216, 217,
+    222, 223, 224, 225, 216, 217, 218, 219, 226, 227, 228, 229, 78, 79, 230, 231,
+    232, 0, 78, 79, 78, 79, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242,
+    199, 200, 243, 244, 0, 0, 0, 0, 0, 0, 245, 78, 79, 246, 247, 248,
+    248, 78, 79, 249, 250, 251, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    252, 253, 254, 255, 256, 0, 257, 257, 0, 258, 0, 259, 260, 0, 0, 0,
+    257, 261, 0, 262, 263, 264, 265, 0, 266, 267, 265, 268, 269, 0, 0, 267,
+    0, 270, 271, 0, 0, 272, 0, 0, 0, 0, 0, 0, 0, 273, 0, 0,
+    274, 0, 275, 274, 0, 0, 0, 276, 274, 277, 278, 278, 279, 0, 0, 0,
+    0, 0, 280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 281, 282, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 284, 285, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    78, 79, 78, 79, 0, 0, 78, 79, 0, 0, 0, 163, 163, 163, 0, 286,
+    0, 0, 0, 0, 0, 287, 288, 0, 289, 290, 291, 0, 292, 0, 293, 294,
+    295, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 296, 297, 298, 299, 300, 301,
+    302, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 303, 2, 2, 2, 2, 2, 2, 2, 304, 305, 306, 307, 308, 309,
+    310, 311, 0, 312, 313, 314, 315, 316, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    317, 318, 319, 320, 321, 322, 0, 78, 79, 323, 78, 79, 0, 232, 232, 232,
+    324, 325, 326, 327, 326, 326, 326, 328, 326, 326, 326, 326, 329, 330, 324, 326,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 331, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 332, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    333, 334, 335, 336, 335, 335, 335, 337, 335, 335, 335, 335, 338, 339, 333, 335,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 199, 200, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 0, 283, 283, 283, 283, 283, 283, 283, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    340, 341, 342, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 343,
+    344, 345, 346, 347, 78, 79, 34, 35, 78, 79, 199, 200, 348, 349, 40, 41,
+    78, 79, 44, 45, 350, 351, 352, 353, 78, 79, 199, 200, 32, 33, 354, 355,
+    48, 49, 50, 51, 48, 49, 78, 79, 48, 49, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    0, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    356, 356, 356, 356, 356, 356, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    357, 357, 357, 357, 357, 357, 357, 358, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 283,
+    0, 283, 283, 0, 283, 283, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 359, 360, 361, 362, 361, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    363, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 312, 0, 0, 283, 283, 283, 283, 283, 283, 283, 0, 0, 283,
+    283, 283, 283, 283, 283, 0, 0, 283, 283, 0, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 0, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 0, 283, 283, 283, 0, 283, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0, 0, 0, 0, 0, 0,
+    0, 312, 0, 0, 312, 0, 0, 0, 0, 0, 283, 0, 283, 0, 0, 0,
+    0, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 283, 0, 0,
+    0, 283, 283, 283, 283, 283, 283, 283, 364, 364, 364, 365, 366, 366, 367, 368,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+    0, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 369, 370, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 366, 0, 368,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0,
+    0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 312, 0, 0, 362, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+    0, 283, 283, 0, 0, 0, 0, 283, 283, 0, 0, 283, 283, 283, 0, 0,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 364, 364, 365, 0, 0, 367, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+    0, 283, 283, 283, 283, 283, 0, 283, 283, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 283,
+    0, 283, 283, 283, 283, 0, 0, 0, 312, 0, 0, 369, 370, 283, 0, 0,
+    0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 366, 366, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 313, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 369, 369, 371, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 283, 283,
+    283, 0, 0, 0, 0, 0, 283, 283, 372, 0, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    312, 0, 0, 0, 0, 0, 283, 312, 313, 0, 369, 312, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0, 0,
+    0, 283, 283, 283, 283, 0, 0, 0, 0, 0, 369, 369, 371, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 0, 283, 0, 0, 0, 312, 0, 373, 312, 370, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 0, 0, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 0, 283, 0, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0, 0,
+    0, 0, 312, 0, 0, 0, 0, 312, 0, 0, 0, 0, 312, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 374, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 372, 283, 375, 376, 283, 377, 283, 283, 283, 283, 283, 283, 0,
+    283, 378, 283, 283, 283, 0, 283, 283, 0, 0, 0, 0, 0, 283, 283, 283,
+    283, 283, 283, 379, 283, 283, 283, 283, 0, 283, 283, 283, 283, 379, 283, 283,
+    283, 283, 379, 283, 283, 283, 283, 379, 283, 283, 283, 283, 379, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 380, 283, 283, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 312, 0, 0, 0, 0, 0, 0, 283, 283, 283,
+    283, 0, 283, 283, 283, 283, 283, 283, 0, 283, 283, 0, 0, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 283, 283,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0,
+    381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+    381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+    381, 381, 381, 381, 381, 381, 0, 381, 0, 0, 0, 0, 0, 381, 0, 0,
+    382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+    382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+    382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 0, 0, 382, 382, 382,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    384, 384, 384, 384, 384, 384, 0, 0, 385, 385, 385, 385, 385, 385, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 283, 0, 283, 283, 283, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 0, 0, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 0, 0, 0, 0, 0, 0, 283, 283, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 0, 283, 283, 283, 283, 283, 283, 283, 0,
+    283, 0, 283, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0,
+    0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 0, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0,
+    0, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 0, 283, 283, 283, 283, 283, 312, 283, 312, 0, 0,
+    313, 313, 283, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 283, 0, 0, 283, 283, 0, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 0, 283, 283, 0, 0, 0, 283, 0, 283,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283,
+    283, 283, 283, 283, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    386, 387, 388, 389, 389, 390, 391, 392, 393, 78, 79, 0, 0, 0, 0, 0,
+    394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+    394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+    394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 0, 0, 394, 394, 394,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 0, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 283, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 395, 0, 0, 0, 396, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+    414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+    430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
+    446, 447, 448, 449, 450, 451, 452, 453, 199, 200, 454, 455, 456, 457, 458, 459,
+    460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+    420, 421, 476, 477, 478, 479, 480, 481, 480, 481, 482, 483, 199, 200, 484, 485,
+    486, 487, 488, 489, 490, 491, 476, 477, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 0, 0, 542, 0,
+    543, 544, 545, 546, 440, 441, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556,
+    557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572,
+    464, 465, 466, 467, 468, 469, 573, 574, 575, 576, 577, 578, 579, 580, 575, 576,
+    470, 471, 581, 582, 583, 584, 585, 586, 553, 554, 587, 588, 589, 590, 591, 592,
+    593, 445, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    406, 608, 609, 610, 611, 612, 613, 614, 615, 616, 78, 79, 78, 79, 78, 79,
+    617, 618, 619, 619, 620, 620, 621, 621, 622, 623, 624, 624, 625, 625, 626, 626,
+    627, 628, 619, 619, 620, 620, 0, 0, 629, 630, 624, 624, 625, 625, 0, 0,
+    631, 632, 619, 619, 620, 620, 621, 621, 633, 634, 624, 624, 625, 625, 626, 626,
+    635, 636, 619, 619, 620, 620, 621, 621, 637, 638, 624, 624, 625, 625, 626, 626,
+    639, 640, 619, 619, 620, 620, 0, 0, 641, 642, 624, 624, 625, 625, 0, 0,
+    643, 644, 645, 619, 646, 620, 647, 621, 0, 648, 0, 624, 0, 625, 0, 626,
+    649, 650, 619, 619, 620, 620, 621, 621, 651, 652, 624, 624, 625, 625, 626, 626,
+    653, 654, 655, 656, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 0, 0,
+    665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680,
+    681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696,
+    697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712,
+    713, 714, 715, 716, 717, 0, 718, 719, 720, 721, 722, 723, 724, 0, 725, 0,
+    0, 726, 727, 728, 729, 0, 730, 731, 732, 733, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 0, 0, 742, 743, 744, 745, 746, 747, 0, 748, 749, 750,
+    751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 0, 0,
+    0, 0, 765, 766, 767, 0, 768, 769, 770, 771, 772, 773, 774, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 775, 0, 0, 0, 776, 777, 0, 0, 0, 0,
+    0, 0, 778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 779, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780,
+    781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781,
+    0, 0, 0, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 782, 783, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 784, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 785, 786, 785,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 312, 0, 0, 0, 0, 312, 0, 0, 312, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 312, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 370, 0, 0, 312, 0, 0, 313, 0, 312, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    787, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 788, 789, 790,
+    791, 791, 0, 0, 313, 313, 0, 0, 313, 313, 0, 0, 0, 0, 0, 0,
+    371, 371, 0, 0, 313, 313, 0, 0, 313, 313, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 782, 370, 370, 369,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    792, 792, 793, 793, 0, 0, 0, 0, 0, 0, 794, 794, 794, 794, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+    795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+    796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796,
+    796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 797, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    78, 79, 798, 799, 800, 801, 802, 78, 79, 78, 79, 78, 79, 803, 804, 805,
+    806, 0, 78, 79, 0, 78, 79, 0, 0, 0, 0, 0, 0, 0, 807, 807,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 0, 0, 0, 0, 0, 0, 0, 78, 79, 78, 79, 283,
+    283, 283, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808,
+    808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808,
+    808, 808, 808, 808, 808, 808, 0, 808, 0, 0, 0, 0, 0, 808, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0, 312, 0,
+    312, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0,
+    312, 0, 312, 0, 0, 312, 0, 312, 0, 312, 0, 0, 0, 0, 0, 0,
+    312, 313, 0, 312, 313, 0, 312, 313, 0, 312, 313, 0, 312, 313, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 809, 0, 0, 0, 0, 283, 283, 0, 0, 0, 312, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0, 312, 0,
+    312, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0, 312, 0,
+    312, 0, 312, 0, 0, 312, 0, 312, 0, 312, 0, 0, 0, 0, 0, 0,
+    312, 313, 0, 312, 313, 0, 312, 313, 0, 312, 313, 0, 312, 313, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 809, 0, 0, 810, 810, 810, 810, 0, 0, 0, 312, 0,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 0, 283,
+    283, 283, 283, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 0, 0, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    0, 0, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 78, 79, 811, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 0, 0, 0, 78, 79, 812, 0, 0,
+    78, 79, 78, 79, 813, 0, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 814, 815, 816, 817, 814, 0,
+    818, 819, 820, 821, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79,
+    78, 79, 78, 79, 822, 823, 824, 78, 79, 78, 79, 825, 78, 79, 78, 79,
+    78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 78, 79, 826, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 0, 0, 0, 283, 0, 0, 0, 0, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 0, 0, 283, 283, 283, 283, 0, 0, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 0,
+    0, 283, 283, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 283, 283, 283, 0, 0, 283, 283, 0, 0, 0, 0, 0, 283, 283,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 827, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+    828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+    828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+    828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+    828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 0, 0, 283, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    829, 830, 831, 832, 833, 834, 835, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 836, 837, 838, 839, 840, 0, 0, 0, 0, 0, 841, 283, 842,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 843, 844, 845, 846, 847, 848,
+    849, 849, 849, 849, 849, 849, 849, 0, 849, 849, 849, 849, 849, 0, 849, 0,
+    849, 849, 0, 849, 849, 0, 849, 849, 849, 849, 849, 850, 851, 852, 853, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854,
+    854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854,
+    854, 854, 854, 854, 854, 854, 854, 854, 855, 855, 855, 855, 855, 855, 855, 855,
+    855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+    855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854,
+    854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854,
+    854, 854, 854, 854, 0, 0, 0, 0, 855, 855, 855, 855, 855, 855, 855, 855,
+    855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+    855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    856, 856, 856, 856, 856, 856, 856, 856, 856, 856, 856, 0, 856, 856, 856, 856,
+    856, 856, 856, 856, 856, 856, 856, 856, 856, 856, 856, 0, 856, 856, 856, 856,
+    856, 856, 856, 0, 856, 856, 0, 857, 857, 857, 857, 857, 857, 857, 857, 857,
+    857, 857, 0, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857,
+    857, 857, 0, 857, 857, 857, 857, 857, 857, 857, 0, 857, 857, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 858, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 782, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 283, 0, 283, 283, 0, 0, 0, 0, 0, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 0, 0, 0, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859,
+    859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859,
+    859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859, 859,
+    859, 859, 859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860,
+    860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860,
+    860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860,
+    860, 860, 860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 283, 283, 283, 283, 283, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0, 312, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 371, 0, 0, 0, 0,
+    0, 0, 0, 283, 283, 283, 283, 0, 0, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 0, 283, 861, 861,
+    283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 0, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    283, 283, 0, 0, 283, 0, 283, 283, 0, 0, 0, 0, 0, 0, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 369, 370, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0,
+    283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 312, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 373, 0,
+    0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 283, 283, 283, 283, 283,
+    283, 0, 283, 0, 0, 862, 0, 863, 864, 283, 0, 0, 0, 0, 283, 283,
+    283, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 283, 283, 283, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 283, 283, 283, 283, 283, 0, 283, 313, 373, 0, 370, 283,
+    283, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 283, 0, 0, 0, 0, 313, 313, 283, 283, 0, 283,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 283, 0, 283,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 283, 0, 0,
+    283, 283, 283, 283, 283, 283, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283,
+    0, 0, 283, 283, 283, 283, 0, 283, 283, 283, 283, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 0, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 373, 0, 0, 283, 283, 0, 283, 0,
+    0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 283, 283, 283, 0, 0, 283, 283, 0, 0, 0, 0,
+    283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 283, 283, 283, 283, 283, 0, 0, 283, 283, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 283, 283, 283, 283, 0, 0, 283, 283, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 0, 283, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 0, 283, 283, 283, 283, 283, 283, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 283, 283, 283, 283, 283, 283,
+    283, 0, 283, 283, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 283, 283, 283, 283, 283, 283, 0, 0, 0, 283, 0, 283, 283, 0, 283,
+    283, 283, 283, 283, 283, 283, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 283, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283,
+    283, 862, 375, 863, 865, 866, 863, 863, 866, 283, 0, 0, 0, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 312, 371, 312, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867,
+    867, 867, 867, 867, 867, 867, 867, 867, 867, 0, 0, 868, 868, 868, 868, 868,
+    868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868,
+    868, 868, 868, 868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283,
+    283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 869, 869,
+    312, 313, 373, 369, 370, 0, 0, 283, 283, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283,
+    283, 283, 283, 0, 0, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 313, 313, 313, 313, 369,
+    369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0,
+    0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283, 283,
+    0, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 0, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 0, 283, 283, 283, 283, 283,
+    283, 283, 0, 283, 283, 0, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870,
+    870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870,
+    870, 870, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 283, 283, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+} // namespace utf::data
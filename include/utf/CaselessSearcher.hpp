@@ -0,0 +1,45 @@
+#pragma once
+// CaselessSearcher - substring search in UTF-8 with full case folding (or accent folding)
+// Two-Way (Crochemore-Perrin) over the folded bytes: linear time in the worst case and constant
+// extra space besides a ring buffer of needle length; the haystack is folded on the fly
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "UTF.hpp"
+
+namespace utf {
+
+class CaselessSearcher {
+public:
+    explicit CaselessSearcher(std::string_view needle, ::UTF::Folding folding = ::UTF::Folding::Case);
+
+    // First match at or after byte offset from (a code point boundary), as UTF::findFolded:
+    // matches cover whole code points of the haystack; an empty needle matches at from
+    ::UTF::FoldedMatch find(std::string_view haystack, int64_t from = 0) const;
+
+    // All non-overlapping matches; none for an empty needle
+    std::vector<::UTF::FoldedMatch> findAll(std::string_view haystack) const;
+
+    bool contains(std::string_view haystack) const { return (bool) find(haystack); }
+
+    // Folded needle as UTF-8
+    const std::string &folded() const { return m_needle; }
+
+private:
+    // Skips alignments inside an ASCII run whose first or last byte cannot match, eight at a time;
+    // returns the new alignment of the folded text, start at source byte source
+    int64_t prefilter(const char *source, const char *asciiEnd, int64_t start) const;
+
+    ::UTF::Folding m_folding;
+    std::string m_needle;      // folded
+    size_t m_critical = 0;     // critical factorization: m_needle = u v, |u| = m_critical
+    size_t m_period = 1;       // shift after a match or a mismatch in u
+    bool m_periodic = false;   // u is a suffix of v's period: remember the matched prefix
+};
+
+// First caseless occurrence of needle in haystack, e.g. findCaseless("Ein STRASSE", "straße") is {4, 11}
+::UTF::FoldedMatch findCaseless(std::string_view haystack, std::string_view needle, int64_t from = 0);
+
+} // namespace utf
@@ -0,0 +1,56 @@
+#pragma once
+// FuzzyMatcher - edit distance in code points between a query and many candidates
+// Bit-parallel (Myers/Hyyrö): one pass over the candidate with the query's bitmasks
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "UTF.hpp"
+
+namespace utf {
+
+struct FuzzyOptions {
+    bool damerau = false; // a transposition of adjacent code points costs 1 (optimal string alignment)
+    bool fold = false;    // compare folded code points
+    ::UTF::Folding folding = ::UTF::Folding::Case;
+};
+
+class FuzzyMatcher {
+public:
+    explicit FuzzyMatcher(std::string_view query, FuzzyOptions options = {});
+    explicit FuzzyMatcher(std::u32string_view query, FuzzyOptions options = {});
+
+    // Levenshtein (or Damerau) distance to candidate; UTF-8 is decoded on the fly
+    // With maxDistance >= 0 the computation stops as soon as the distance must exceed it
+    // and returns maxDistance + 1
+    int64_t distance(std::string_view candidate, int64_t maxDistance = -1) const;
+    int64_t distance(std::u32string_view candidate, int64_t maxDistance = -1) const;
+
+    // distance for each candidate, reusing the query bitmasks
+    std::vector<int64_t> distances(const std::vector<std::string_view>& candidates, int64_t maxDistance = -1) const;
+
+    // Code points of the (folded) query
+    int64_t length() const { return m_length; }
+
+private:
+    void build(const std::u32string& query);
+
+    // Bitmask words of code point cp: bit i set if query[i] == cp; nullptr if none
+    const uint64_t* masks(char32_t cp) const;
+
+    template<typename Source>
+    int64_t compute(Source& source, int64_t maxDistance) const;
+
+    FuzzyOptions m_options;
+    int64_t m_length = 0;
+    size_t m_words = 0;                  // 64-bit words per bitmask
+    std::vector<uint64_t> m_ascii;       // 128 bitmasks
+    std::vector<char32_t> m_codePoints;  // other code points of the query, sorted
+    std::vector<uint64_t> m_masks;       // their bitmasks
+};
+
+// Edit distance of two strings in code points
+int64_t editDistance(std::string_view a, std::string_view b, FuzzyOptions options = {});
+
+} // namespace utf
@@ -0,0 +1,58 @@
+#pragma once
+// KeywordMatcher - multi-pattern search (Aho-Corasick) over folded UTF-8
+// Keywords are folded once when the automaton is built; the text is folded on the fly
+// in a single pass and matches are reported as byte ranges of the original text
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "UTF.hpp"
+
+namespace utf {
+
+struct KeywordMatch {
+    int64_t begin = 0;  // byte offsets in the text
+    int64_t end = 0;
+    size_t keyword = 0; // index in the keyword list
+};
+
+class KeywordMatcher {
+public:
+    // Empty keywords are ignored; folding as in UTF::findFolded
+    explicit KeywordMatcher(const std::vector<std::string>& keywords,
+                            ::UTF::Folding folding = ::UTF::Folding::Accents);
+
+    // All matches, overlapping ones included, ordered by end
+    // Matches start and end on whole code points of the text
+    std::vector<KeywordMatch> findAll(std::string_view text) const;
+
+    // True if any keyword occurs in text (stops at the first match)
+    bool contains(std::string_view text) const;
+
+    size_t keywordCount() const { return m_keywordLength.size(); }
+    size_t stateCount() const { return m_fail.size(); }
+
+private:
+    // Calls onMatch(KeywordMatch) for each match until it returns false
+    template<typename OnMatch>
+    void scan(std::string_view text, OnMatch onMatch) const;
+
+    // Transition of state by a folded byte, following failure links
+    uint32_t step(uint32_t state, uint8_t byte) const;
+
+    ::UTF::Folding m_folding;
+    // States are numbered in breadth-first order, 0 is the root
+    uint32_t m_root[256];                 // dense transitions of the root
+    std::vector<uint32_t> m_edgeStart;    // sparse transitions of state s: [m_edgeStart[s], m_edgeStart[s + 1])
+    std::vector<uint8_t> m_edgeBytes;     // sorted within a state
+    std::vector<uint32_t> m_edgeTargets;
+    std::vector<uint32_t> m_fail;
+    std::vector<int32_t> m_output;        // keyword ending in the state, -1 if none
+    std::vector<uint32_t> m_outputLink;   // nearest state on the failure chain with output, 0 if none
+    std::vector<uint32_t> m_keywordLength; // folded bytes; 0 for ignored keywords
+    std::vector<int32_t> m_sameKeyword;   // next keyword with the same folded text, -1 if none
+    uint32_t m_ringMask = 0;              // ring of recent folded positions, longer than every keyword
+};
+
+} // namespace utf
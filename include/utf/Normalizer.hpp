@@ -0,0 +1,60 @@
+#pragma once
+// Normalizer - Unicode normalization forms NFC, NFD, NFKC and NFKD (UAX #15)
+// Text already in the requested form is returned as is, without copying
+
+#include <string>
+#include <string_view>
+
+namespace utf {
+
+enum class NormalizationForm {
+    NFC,  // canonical decomposition followed by canonical composition
+    NFD,  // canonical decomposition
+    NFKC, // compatibility decomposition followed by canonical composition (ﬁ -> fi, ① -> 1)
+    NFKD  // compatibility decomposition
+};
+
+// True if text is in the normalization form
+// Invalid UTF-8 is never normalized (normalize replaces it with U+FFFD)
+bool isNormalized(std::string_view text, NormalizationForm form);
+bool isNormalized(std::u32string_view text, NormalizationForm form);
+
+// Normalize text: returns text itself when it is already normalized,
+// otherwise a view of buffer holding the normalized text
+// Only spans between stable starters that fail the quick check are decomposed and recomposed
+std::string_view normalize(std::string_view text, NormalizationForm form, std::string& buffer);
+std::u32string_view normalize(std::u32string_view text, NormalizationForm form, std::u32string& buffer);
+
+inline std::string_view normalizeNFC(std::string_view text, std::string& buffer) {
+    return normalize(text, NormalizationForm::NFC, buffer);
+}
+
+inline std::u32string_view normalizeNFC(std::u32string_view text, std::u32string& buffer) {
+    return normalize(text, NormalizationForm::NFC, buffer);
+}
+
+inline std::string_view normalizeNFD(std::string_view text, std::string& buffer) {
+    return normalize(text, NormalizationForm::NFD, buffer);
+}
+
+inline std::u32string_view normalizeNFD(std::u32string_view text, std::u32string& buffer) {
+    return normalize(text, NormalizationForm::NFD, buffer);
+}
+
+inline std::string_view normalizeNFKC(std::string_view text, std::string& buffer) {
+    return normalize(text, NormalizationForm::NFKC, buffer);
+}
+
+inline std::u32string_view normalizeNFKC(std::u32string_view text, std::u32string& buffer) {
+    return normalize(text, NormalizationForm::NFKC, buffer);
+}
+
+inline std::string_view normalizeNFKD(std::string_view text, std::string& buffer) {
+    return normalize(text, NormalizationForm::NFKD, buffer);
+}
+
+inline std::u32string_view normalizeNFKD(std::u32string_view text, std::u32string& buffer) {
+    return normalize(text, NormalizationForm::NFKD, buffer);
+}
+
+} // namespace utf
@@ -0,0 +1,106 @@
+#pragma once
+// PatternMatcher - SQL LIKE and glob patterns over UTF-8, compiled once and evaluated per row
+// Wildcards match whole code points; literals are compared as bytes (of folded text if requested)
+// and the longest one is searched before anything else is matched
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "UTF.hpp"
+
+namespace utf {
+
+enum class PatternSyntax {
+    Like, // % any sequence, _ one code point; the escape character makes the next one literal
+    Glob  // * any sequence, ? one code point, classes [abc] [a-z] [!a-z] or [^a-z], \ escapes
+};
+
+struct PatternOptions {
+    PatternSyntax syntax = PatternSyntax::Like;
+    bool fold = false;     // compare folded text: literals and classes ignore case (and accents)
+    ::UTF::Folding folding = ::UTF::Folding::Case;
+    char32_t escape = '\\'; // LIKE escape character, 0 for none
+};
+
+class PatternMatcher {
+public:
+    explicit PatternMatcher(std::string_view pattern, PatternOptions options = {});
+
+    // True if the whole text matches the pattern
+    bool matches(std::string_view text) const;
+
+    // 1 for each row of a column (count + 1 offsets, Arrow style) that matches, 0 otherwise;
+    // folding reuses one buffer for all rows
+    template<typename Offset>
+    std::vector<uint8_t> matchColumn(const char *data, const Offset *offsets, size_t count) const {
+        std::vector<uint8_t> result(count);
+        Scratch scratch;
+        for (size_t i = 0; i < count; i++)
+            result[i] = matches(std::string_view(data + offsets[i], offsets[i + 1] - offsets[i]), scratch);
+        return result;
+    }
+
+    std::vector<uint8_t> matchColumn(const ::UTF::StringColumn &column) const {
+        return matchColumn(column.data.data(), column.offsets.data(), column.size());
+    }
+
+private:
+    enum class TokenKind : uint8_t { Literal, One, Class };
+
+    struct Token {
+        TokenKind kind;
+        uint32_t index; // literal or class
+    };
+
+    // Tokens between two % (or *); minimal length in bytes and number of One and Class tokens
+    struct Segment {
+        std::vector<Token> tokens;
+        size_t minBytes = 0;
+        size_t units = 0;
+    };
+
+    struct CharClass {
+        bool negated = false;
+        uint64_t ascii[2] = {};                             // ASCII members
+        std::vector<std::pair<char32_t, char32_t>> ranges;  // sorted closed ranges, with the foldings of members
+        std::vector<std::string> sequences;                 // sorted foldings of members to several code points
+
+        // cp is a code point of the text, folded if folding
+        bool contains(char32_t cp) const;
+    };
+
+    // Folded text of a row and its code point boundaries
+    struct Scratch {
+        std::string folded;
+        std::vector<uint8_t> boundary; // folded.size() + 1 entries
+    };
+
+    bool matches(std::string_view text, Scratch &scratch) const;
+
+    template<typename View>
+    bool matchView(const View &view) const;
+
+    // End of segment matched at pos (a code point boundary), -1 if it does not match there
+    template<typename View>
+    int64_t matchAt(const Segment &segment, const View &view, int64_t pos) const;
+
+    // End of the leftmost match of segment at or after pos, -1 if none
+    template<typename View>
+    int64_t findSegment(const Segment &segment, const View &view, int64_t pos) const;
+
+    // True if segment matches the end of the text starting at or after pos
+    template<typename View>
+    bool matchSuffix(const Segment &segment, const View &view, int64_t pos) const;
+
+    PatternOptions m_options;
+    std::vector<std::string> m_literals; // folded if folding
+    std::vector<CharClass> m_classes;
+    std::vector<Segment> m_segments;     // one more than the number of % (consecutive ones count once)
+    int32_t m_required = -1;             // longest literal
+    size_t m_minBytes = 0;
+    bool m_matchAll = false;             // only % in the pattern
+};
+
+} // namespace utf
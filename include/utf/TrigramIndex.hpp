@@ -0,0 +1,68 @@
+#pragma once
+// TrigramIndex - inverted index of folded code point trigrams for substring search
+// Posting lists are delta + varint compressed; candidates are verified with UTF::findFolded
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "UTF.hpp"
+
+namespace utf {
+
+struct TrigramHit {
+    uint32_t document = 0;
+    ::UTF::FoldedMatch match; // first match, byte offsets in the document
+};
+
+class TrigramIndex {
+public:
+    explicit TrigramIndex(::UTF::Folding folding = ::UTF::Folding::Accents) : m_folding(folding) {}
+
+    // Bulk build: document ids are positions in documents
+    TrigramIndex(const std::vector<std::string_view>& documents, ::UTF::Folding folding = ::UTF::Folding::Accents);
+
+    // Adds a copy of text and returns its id; it is searchable after commit()
+    uint32_t add(std::string_view text);
+
+    // Merges postings of documents added since the last commit into the compressed lists
+    void commit();
+
+    // Appends the documents of other (same folding, committed), their ids shifted by documentCount()
+    void merge(const TrigramIndex& other);
+
+    // Documents containing needle after folding, with their first match
+    std::vector<TrigramHit> search(std::string_view needle) const;
+
+    // Documents having every trigram of the folded needle, sorted; all committed documents for
+    // needles shorter than three code points
+    std::vector<uint32_t> candidates(std::string_view needle) const;
+
+    size_t documentCount() const { return m_documents.size(); }
+    std::string_view document(uint32_t id) const { return m_documents[id]; }
+    size_t trigramCount() const { return m_keys.size(); }
+    size_t postingBytes() const { return m_postings.size(); }
+
+    // Three code points in 21 bits each
+    static uint64_t trigramKey(char32_t a, char32_t b, char32_t c) {
+        return (uint64_t) a << 42 | (uint64_t) b << 21 | c;
+    }
+
+private:
+    // Sorted, unique trigram keys of the folded text
+    std::vector<uint64_t> trigrams(std::string_view text) const;
+
+    // Decoded posting list of the key at index
+    std::vector<uint32_t> postings(size_t index) const;
+
+    ::UTF::Folding m_folding;
+    ::UTF::StringColumn m_documents;
+    std::vector<uint64_t> m_keys;       // sorted
+    std::vector<uint64_t> m_listStart;  // posting list of m_keys[i]: m_postings[m_listStart[i]..m_listStart[i + 1])
+    std::vector<uint32_t> m_listSize;   // documents in each list
+    std::vector<uint8_t> m_postings;    // increasing document ids: first id, then gaps, as varints
+    std::vector<std::pair<uint64_t, uint32_t>> m_pending; // {key, document} not committed yet
+    uint32_t m_committed = 0;           // documents searchable: ids below this
+};
+
+} // namespace utf
@@ -1,6 +1,7 @@
 //see license (Apache)
 #pragma once
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
@@ -711,6 +712,27 @@ struct UTF {
             return w1;
     }
 
+    // Like codePointAt16, but a pair must end before eos;
+    // unpaired surrogates are returned as they are
+    static char32_t codePointAt16(const char16_t *s, const char16_t *eos, const char16_t **end) {
+        if (isSurrogate1(*s) && eos - s >= 2 && isSurrogate2(s[1])) {
+            *end = s + 2;
+            return 0x400 * ((char32_t) s[0] - 0xD800) + ((char32_t) s[1] - 0xDC00) + 0x10000;
+        }
+        *end = s + 1;
+        return *s;
+    }
+
+    // Appends cp as UTF-16; a lone surrogate is kept as one unit
+    static void appendUnits16(char32_t cp, std::u16string &d) {
+        if (cp < 0x10000)
+            d.push_back((char16_t) cp);
+        else {
+            d.push_back((char16_t) ((cp - 0x10000) / 0x400 + 0xD800));
+            d.push_back((char16_t) ((cp - 0x10000) % 0x400 + 0xDC00));
+        }
+    }
+
     static std::u32string toUTF32(const u16string_view wstr) {
         const char16_t *cws = wstr.data();
         std::u32string result;
@@ -896,29 +918,42 @@ struct UTF {
         return cp; // not found, return unchanged
     }
 
+    // Case and accent folding properties of cp (two-stage table lookup)
+    static const utf::data::CharProps &charProps(char32_t cp) {
+        size_t block = cp >> utf::data::PROPS_SHIFT;
+        if (block >= utf::data::props_stage1_size)
+            return utf::data::char_props[0];
+        size_t index = (size_t(utf::data::props_stage1[block]) << utf::data::PROPS_SHIFT)
+                       | (cp & ((1u << utf::data::PROPS_SHIFT) - 1));
+        return utf::data::char_props[utf::data::props_stage2[index]];
+    }
+
     // Convert single code point to lowercase
     static char32_t toLowerCodePoint(char32_t cp) {
-        return lookupInPairMap(cp, utf::data::lower_map, utf::data::lower_map_size);
+        return char32_t(cp + charProps(cp).lower);
     }
 
     // Convert single code point to uppercase (simple 1:1 mapping)
     static char32_t toUpperCodePoint(char32_t cp) {
-        return lookupInPairMap(cp, utf::data::upper_map, utf::data::upper_map_size);
+        return char32_t(cp + charProps(cp).upper);
     }
 
     // Check if there's a special (1:N) uppercase mapping
     static const utf::data::SpecialCase* findSpecialUpper(char32_t cp) {
-        size_t lo = 0, hi = utf::data::special_upper_size;
-        while (lo < hi) {
-            size_t mid = lo + (hi - lo) / 2;
-            if (utf::data::special_upper[mid].from == cp)
-                return &utf::data::special_upper[mid];
-            if (utf::data::special_upper[mid].from < cp)
-                lo = mid + 1;
-            else
-                hi = mid;
-        }
-        return nullptr;
+        uint8_t index = charProps(cp).specialUpper;
+        return index ? &utf::data::special_upper[index - 1] : nullptr;
+    }
+
+    // Simple case folding (1:1): caseless matching key of a code point
+    // Differs from toLowerCodePoint e.g. for ς→σ, ẞ→ß, Cherokee ꭰ→Ꭰ
+    static char32_t foldCaseCodePoint(char32_t cp) {
+        return char32_t(cp + charProps(cp).fold);
+    }
+
+    // Check if there's a full (1:N) case folding, e.g. ß→ss, ﬁ→fi
+    static const utf::data::SpecialCase* findSpecialFold(char32_t cp) {
+        uint8_t index = charProps(cp).specialFold;
+        return index ? &utf::data::special_fold[index - 1] : nullptr;
     }
 
     // Convert u32string to lowercase
@@ -936,30 +971,384 @@ struct UTF {
         std::u32string result;
         result.reserve(str.size());
         for (char32_t cp : str) {
-            const utf::data::SpecialCase* special = findSpecialUpper(cp);
+            const utf::data::CharProps& props = charProps(cp);
+            if (props.specialUpper) {
+                const utf::data::SpecialCase& special = utf::data::special_upper[props.specialUpper - 1];
+                for (uint8_t i = 0; i < special.len; i++) {
+                    result.push_back(special.to[i]);
+                }
+            } else {
+                result.push_back(cp + props.upper);
+            }
+        }
+        return result;
+    }
+
+    // Case folding of u32string; full: use 1:N foldings (ß→ss), otherwise only simple ones
+    std::u32string foldCase(const u32string_view& str, bool full = true) {
+        std::u32string result;
+        result.reserve(str.size());
+        for (char32_t cp : str) {
+            const utf::data::SpecialCase* special = full ? findSpecialFold(cp) : nullptr;
             if (special) {
                 for (uint8_t i = 0; i < special->len; i++) {
                     result.push_back(special->to[i]);
                 }
             } else {
-                result.push_back(toUpperCodePoint(cp));
+                result.push_back(foldCaseCodePoint(cp));
             }
         }
         return result;
     }
 
+    enum class CaseMapping {
+        Lower,
+        Upper,      // with special_upper (1:N)
+        Fold,       // full case folding (1:N)
+        FoldSimple  // simple case folding (1:1)
+    };
+
+    // Simple mapping of cp; special is set if the mapping is 1:N
+    static char32_t mapCase(char32_t cp, CaseMapping mapping, const utf::data::SpecialCase *&special) {
+        const utf::data::CharProps &props = charProps(cp);
+        special = nullptr;
+        switch (mapping) {
+            case CaseMapping::Lower:
+                return cp + props.lower;
+            case CaseMapping::Upper:
+                if (props.specialUpper)
+                    special = &utf::data::special_upper[props.specialUpper - 1];
+                return cp + props.upper;
+            case CaseMapping::Fold:
+                if (props.specialFold)
+                    special = &utf::data::special_fold[props.specialFold - 1];
+                return cp + props.fold;
+            default:
+                return cp + props.fold;
+        }
+    }
+
+    std::u32string caseMap(const u32string_view& str, CaseMapping mapping) {
+        switch (mapping) {
+            case CaseMapping::Lower:
+                return toLower(str);
+            case CaseMapping::Upper:
+                return toUpper(str);
+            default:
+                return foldCase(str, mapping == CaseMapping::Fold);
+        }
+    }
+
+    // Copies ASCII bytes [s, eos) to d switching case of letters in [lo, lo+25], eight at a time
+    static void copyAsciiCase(const char *s, const char *eos, char *d, char lo) {
+        while (eos - s >= 8) {
+            uint64_t word;
+            std::memcpy(&word, s, 8);
+            word ^= asciiInRange(word, lo, lo + 25) >> 2; // 0x80 >> 2 is the case bit
+            std::memcpy(d, &word, 8);
+            s += 8;
+            d += 8;
+        }
+        for (; s < eos; s++, d++)
+            *d = *s >= lo && *s <= lo + 25 ? *s ^ 0x20 : *s;
+    }
+
+    // Case mapping directly on UTF-8: unchanged code points are copied in runs,
+    // only mapped ones are re-encoded; invalid sequences become REPLACEMENT
+    std::string caseMap8(const std::string_view &str, CaseMapping mapping) {
+        std::string result;
+        result.reserve(str.size());
+        errors = errambig = 0;
+        appendCaseMap8(result, str, mapping);
+        return result;
+    }
+
+    // caseMap8 appending to result; errors are added to the counters
+    void appendCaseMap8(std::string &result, const std::string_view &str, CaseMapping mapping) {
+        const char *s = str.data();
+        const char *eos = s + str.size();
+        while (s < eos) {
+            const char *run = skipAscii(s, eos);
+            if (run > s) {
+                size_t len = result.size();
+                result.resize(len + (run - s));
+                copyAsciiCase(s, run, &result[len], mapping == CaseMapping::Upper ? 'a' : 'A');
+                s = run;
+            }
+            const char *copied = s;
+            while (s < eos && ((uint8_t) *s & 0x80)) {
+                int before = errors;
+                const char *next;
+                char32_t cp = codePointAt(s, eos, &next);
+                const utf::data::SpecialCase *special;
+                char32_t mapped = mapCase(cp, mapping, special);
+                if (mapped == cp && !special && errors == before && !isSurrogate(cp) && cp <= MaxCP) {
+                    s = next;
+                    continue;
+                }
+                result.append(copied, s - copied);
+                char buf[4];
+                if (special) {
+                    for (uint8_t i = 0; i < special->len; i++)
+                        result.append(buf, appendCodePoint(special->to[i], buf));
+                } else
+                    result.append(buf, appendCodePoint(mapped, buf));
+                s = copied = next;
+            }
+            result.append(copied, s - copied);
+        }
+    }
+
     // UTF-8 convenience: toLower
     std::string toLower8(const std::string_view& str) {
-        std::u32string u32 = toUTF32(str);
-        std::u32string lower = toLower(u32);
-        return fromUTF32(lower);
+        return caseMap8(str, CaseMapping::Lower);
     }
 
     // UTF-8 convenience: toUpper
     std::string toUpper8(const std::string_view& str) {
-        std::u32string u32 = toUTF32(str);
-        std::u32string upper = toUpper(u32);
-        return fromUTF32(upper);
+        return caseMap8(str, CaseMapping::Upper);
+    }
+
+    // UTF-8 convenience: foldCase
+    std::string foldCase8(const std::string_view& str, bool full = true) {
+        return caseMap8(str, full ? CaseMapping::Fold : CaseMapping::FoldSimple);
+    }
+
+    // ===== UTF-16 case mapping and accent folding =====
+
+    // Appends the mapping of every code point of str to result with append(cp, result);
+    // BMP code units are used directly, surrogate pairs decoded inline,
+    // unpaired surrogates passed as they are
+    template<typename Append>
+    static std::u16string map16(const u16string_view &str, Append append) {
+        std::u16string result;
+        result.reserve(str.size());
+        const char16_t *s = str.data();
+        const char16_t *eos = s + str.size();
+        while (s < eos) {
+            if (!isSurrogate(*s)) {
+                append(*s++, result);
+                continue;
+            }
+            const char16_t *next;
+            append(codePointAt16(s, eos, &next), result);
+            s = next;
+        }
+        return result;
+    }
+
+    std::u16string caseMap16(const u16string_view &str, CaseMapping mapping) {
+        char32_t lo = mapping == CaseMapping::Upper ? 'a' : 'A';
+        return map16(str, [mapping, lo](char32_t cp, std::u16string &d) {
+            if (cp < 0x80) {
+                d.push_back(cp >= lo && cp <= lo + 25 ? cp ^ 0x20 : cp);
+                return;
+            }
+            const utf::data::SpecialCase *special;
+            char32_t mapped = mapCase(cp, mapping, special);
+            if (special) {
+                for (uint8_t i = 0; i < special->len; i++)
+                    appendUnits16(special->to[i], d);
+            } else
+                appendUnits16(mapped, d);
+        });
+    }
+
+    std::u16string toLower16(const u16string_view &str) {
+        return caseMap16(str, CaseMapping::Lower);
+    }
+
+    std::u16string toUpper16(const u16string_view &str) {
+        return caseMap16(str, CaseMapping::Upper);
+    }
+
+    std::u16string foldCase16(const u16string_view &str, bool full = true) {
+        return caseMap16(str, full ? CaseMapping::Fold : CaseMapping::FoldSimple);
+    }
+
+    // Standard accent folding of UTF-16 text, as foldAccents
+    std::u16string foldAccents16(const u16string_view &str) {
+        return map16(str, [](char32_t cp, std::u16string &d) {
+            appendUnits16(cp + charProps(cp).accent, d);
+        });
+    }
+
+    // Aggressive accent folding of UTF-16 text, as foldAccentsAggressive
+    std::u16string foldAccents16Aggressive(const u16string_view &str) {
+        return map16(str, [](char32_t cp, std::u16string &d) {
+            const utf::data::CharProps &props = charProps(cp);
+            if (props.expand) {
+                for (const char *p = utf::data::aggressive_expand[props.expand - 1].to; *p; ++p)
+                    d.push_back((char16_t) *p);
+            } else
+                appendUnits16(cp + props.aggressive, d);
+        });
+    }
+
+    // ===== In-place case mapping =====
+    // Code points are rewritten in place while their encoded length stays the same;
+    // from the first one that changes length (ß→SS) the rest is mapped into a new tail
+
+    void caseMapInPlace(std::u32string &str, CaseMapping mapping) {
+        for (size_t i = 0; i < str.size(); i++) {
+            const utf::data::SpecialCase *special;
+            char32_t mapped = mapCase(str[i], mapping, special);
+            if (special) {
+                std::u32string tail = caseMap(u32string_view(str).substr(i), mapping);
+                str.resize(i);
+                str += tail;
+                return;
+            }
+            str[i] = mapped;
+        }
+    }
+
+    void caseMapInPlace(std::u16string &str, CaseMapping mapping) {
+        char16_t lo = mapping == CaseMapping::Upper ? 'a' : 'A';
+        const char16_t *begin = str.data();
+        const char16_t *eos = begin + str.size();
+        for (const char16_t *s = begin; s < eos;) {
+            char16_t *d = &str[s - begin];
+            if (*s < 0x80) {
+                if (*s >= lo && *s <= lo + 25)
+                    *d ^= 0x20;
+                s++;
+                continue;
+            }
+            const char16_t *next;
+            const utf::data::SpecialCase *special;
+            char32_t mapped = mapCase(codePointAt16(s, eos, &next), mapping, special);
+            if (special || one16len(mapped) != next - s) {
+                std::u16string tail;
+                tail.reserve((eos - s) + 8);
+                for (; s < eos; s = next) {
+                    mapped = mapCase(codePointAt16(s, eos, &next), mapping, special);
+                    if (special) {
+                        for (uint8_t i = 0; i < special->len; i++)
+                            appendUnits16(special->to[i], tail);
+                    } else
+                        appendUnits16(mapped, tail);
+                }
+                str.resize(d - str.data());
+                str += tail;
+                return;
+            }
+            if (next - s == 1)
+                *d = (char16_t) mapped;
+            else
+                appendCodePoint16(mapped, d);
+            s = next;
+        }
+    }
+
+    void caseMapInPlace(std::string &str, CaseMapping mapping) {
+        errors = errambig = 0;
+        char *begin = &str[0];
+        char *s = begin;
+        char *eos = begin + str.size();
+        while (s < eos) {
+            char *run = begin + (skipAscii(s, eos) - begin);
+            copyAsciiCase(s, run, s, mapping == CaseMapping::Upper ? 'a' : 'A');
+            s = run;
+            while (s < eos && ((uint8_t) *s & 0x80)) {
+                int errorsBefore = errors;
+                int errambigBefore = errambig;
+                const char *next;
+                char32_t cp = codePointAt(s, eos, &next);
+                const utf::data::SpecialCase *special;
+                char32_t mapped = mapCase(cp, mapping, special);
+                if (special || errors != errorsBefore || isSurrogate(cp) || cp > MaxCP || one8len(mapped) != next - s) {
+                    // caseMap8 counts errors of the tail again
+                    std::string tail = caseMap8(std::string_view(s, eos - s), mapping);
+                    errors += errorsBefore;
+                    errambig += errambigBefore;
+                    str.resize(s - begin);
+                    str += tail;
+                    return;
+                }
+                if (mapped != cp)
+                    appendCodePoint(mapped, s);
+                s = begin + (next - begin);
+            }
+        }
+    }
+
+    void toLowerInPlace(std::string &str) {
+        caseMapInPlace(str, CaseMapping::Lower);
+    }
+
+    void toLowerInPlace(std::u16string &str) {
+        caseMapInPlace(str, CaseMapping::Lower);
+    }
+
+    void toLowerInPlace(std::u32string &str) {
+        caseMapInPlace(str, CaseMapping::Lower);
+    }
+
+    void toUpperInPlace(std::string &str) {
+        caseMapInPlace(str, CaseMapping::Upper);
+    }
+
+    void toUpperInPlace(std::u16string &str) {
+        caseMapInPlace(str, CaseMapping::Upper);
+    }
+
+    void toUpperInPlace(std::u32string &str) {
+        caseMapInPlace(str, CaseMapping::Upper);
+    }
+
+    // ===== Batch case mapping =====
+
+    // Strings stored back to back in one buffer: string i is data[offsets[i], offsets[i + 1])
+    struct StringColumn {
+        std::string data;
+        std::vector<int64_t> offsets{0};
+
+        size_t size() const { return offsets.size() - 1; }
+
+        std::string_view operator[](size_t i) const {
+            return std::string_view(data.data() + offsets[i], offsets[i + 1] - offsets[i]);
+        }
+
+        void push_back(const std::string_view str) {
+            data.append(str);
+            offsets.push_back((int64_t) data.size());
+        }
+    };
+
+    // Case mapping of a column given as offsets (count + 1 entries, Arrow style) and data;
+    // all results go to one arena, allocated once unless mappings make the text longer
+    template<typename Offset>
+    StringColumn caseMapColumn(const char *data, const Offset *offsets, size_t count, CaseMapping mapping) {
+        StringColumn result;
+        errors = errambig = 0;
+        result.data.reserve(count ? offsets[count] - offsets[0] : 0);
+        result.offsets.reserve(count + 1);
+        for (size_t i = 0; i < count; i++) {
+            appendCaseMap8(result.data, std::string_view(data + offsets[i], offsets[i + 1] - offsets[i]), mapping);
+            result.offsets.push_back((int64_t) result.data.size());
+        }
+        return result;
+    }
+
+    // Case mapping of count strings into one arena
+    StringColumn caseMapColumn(const std::string_view *strings, size_t count, CaseMapping mapping) {
+        StringColumn result;
+        errors = errambig = 0;
+        size_t total = 0;
+        for (size_t i = 0; i < count; i++)
+            total += strings[i].size();
+        result.data.reserve(total);
+        result.offsets.reserve(count + 1);
+        for (size_t i = 0; i < count; i++) {
+            appendCaseMap8(result.data, strings[i], mapping);
+            result.offsets.push_back((int64_t) result.data.size());
+        }
+        return result;
+    }
+
+    StringColumn caseMapColumn(const StringColumn &column, CaseMapping mapping) {
+        return caseMapColumn(column.data.data(), column.offsets.data(), column.size(), mapping);
     }
 
     // ===== Accent folding =====
@@ -982,47 +1371,18 @@ struct UTF {
     // Standard accent folding: returns base character from canonical decomposition
     // ą→a, é→e, but ł→ł (ł is a separate letter, not a+combining)
     static char32_t foldAccent(char32_t cp) {
-        const utf::data::Decomposition* decomp = findDecomp(cp);
-        if (decomp && decomp->combining != 0) {
-            // Has combining mark - return base character
-            return decomp->base;
-        }
-        return cp; // No decomposition or no combining mark
+        return char32_t(cp + charProps(cp).accent);
     }
 
     // Aggressive accent folding: also folds ł→l, ø→o, etc.
     static char32_t foldAccentAggressive(char32_t cp) {
-        // First try standard decomposition
-        char32_t folded = foldAccent(cp);
-        if (folded != cp) return folded;
-
-        // Check aggressive folding table (ł→l, ø→o, etc.)
-        size_t lo = 0, hi = utf::data::aggressive_fold_size;
-        while (lo < hi) {
-            size_t mid = lo + (hi - lo) / 2;
-            if (utf::data::aggressive_fold[mid].first == cp)
-                return utf::data::aggressive_fold[mid].second;
-            if (utf::data::aggressive_fold[mid].first < cp)
-                lo = mid + 1;
-            else
-                hi = mid;
-        }
-        return cp;
+        return char32_t(cp + charProps(cp).aggressive);
     }
 
     // Find aggressive expand (ß→ss, æ→ae)
     static const utf::data::AggressiveExpand* findAggressiveExpand(char32_t cp) {
-        size_t lo = 0, hi = utf::data::aggressive_expand_size;
-        while (lo < hi) {
-            size_t mid = lo + (hi - lo) / 2;
-            if (utf::data::aggressive_expand[mid].from == cp)
-                return &utf::data::aggressive_expand[mid];
-            if (utf::data::aggressive_expand[mid].from < cp)
-                lo = mid + 1;
-            else
-                hi = mid;
-        }
-        return nullptr;
+        uint8_t index = charProps(cp).expand;
+        return index ? &utf::data::aggressive_expand[index - 1] : nullptr;
     }
 
     // Standard folding for string
@@ -1041,29 +1401,1265 @@ struct UTF {
         result.reserve(str.size());
         for (char32_t cp : str) {
             // Check for expansions first (ß→ss, æ→ae)
-            const utf::data::AggressiveExpand* expand = findAggressiveExpand(cp);
-            if (expand) {
-                for (const char* p = expand->to; *p; ++p) {
+            const utf::data::CharProps& props = charProps(cp);
+            if (props.expand) {
+                for (const char* p = utf::data::aggressive_expand[props.expand - 1].to; *p; ++p) {
                     result.push_back(static_cast<char32_t>(*p));
                 }
             } else {
-                result.push_back(foldAccentAggressive(cp));
+                result.push_back(cp + props.aggressive);
+            }
+        }
+        return result;
+    }
+
+    // Accent folding directly on UTF-8: 2-byte Latin letters by byte-pair table,
+    // other code points by charProps; unchanged text is copied in runs
+    std::string accentFold8(const std::string_view& str, bool aggressive) {
+        using namespace utf::data;
+        const uint8_t (*latin)[3] = aggressive ? latin_fold8_aggressive : latin_fold8;
+        std::string result;
+        result.reserve(str.size());
+        errors = errambig = 0;
+        const char* s = str.data();
+        const char* eos = s + str.size();
+        const char* copied = s;
+        while (s < eos) {
+            s = skipAscii(s, eos);
+            if (s == eos)
+                break;
+            uint8_t lead = *s;
+            if (lead >= LATIN_FOLD_FIRST_LEAD && lead <= LATIN_FOLD_LAST_LEAD && eos - s >= 2
+                && ((uint8_t) s[1] & 0xc0) == 0x80) {
+                const uint8_t* folded = latin[(lead - LATIN_FOLD_FIRST_LEAD) * 64 + (s[1] & 0x3f)];
+                if (folded[0] == 1 || folded[1] != lead || folded[2] != (uint8_t) s[1]) {
+                    result.append(copied, s - copied);
+                    result.append((const char*) folded + 1, folded[0]);
+                    copied = s + 2;
+                }
+                s += 2;
+                continue;
+            }
+            int before = errors;
+            const char* next;
+            char32_t cp = codePointAt(s, eos, &next);
+            const CharProps& props = charProps(cp);
+            int32_t delta = aggressive ? props.aggressive : props.accent;
+            bool expand = aggressive && props.expand;
+            if (delta || expand || errors != before || isSurrogate(cp) || cp > MaxCP) {
+                result.append(copied, s - copied);
+                if (expand)
+                    result.append(aggressive_expand[props.expand - 1].to);
+                else {
+                    char buf[4];
+                    result.append(buf, appendCodePoint(cp + delta, buf));
+                }
+                copied = next;
             }
+            s = next;
         }
+        result.append(copied, s - copied);
         return result;
     }
 
     // UTF-8 convenience: standard folding
     std::string foldAccents8(const std::string_view& str) {
-        std::u32string u32 = toUTF32(str);
-        std::u32string folded = foldAccents(u32);
-        return fromUTF32(folded);
+        return accentFold8(str, false);
     }
 
     // UTF-8 convenience: aggressive folding
     std::string foldAccents8Aggressive(const std::string_view& str) {
-        std::u32string u32 = toUTF32(str);
-        std::u32string folded = foldAccentsAggressive(u32);
-        return fromUTF32(folded);
+        return accentFold8(str, true);
+    }
+
+    // ===== Normalization pipeline =====
+
+    // Steps of normalize8, combined with |
+    struct Norm {
+        enum : unsigned {
+            Lower = 1,       // simple lowercase mapping
+            FoldCase = 2,    // full case folding, replaces Lower
+            FoldAccents = 4, // foldAccent: ą→a
+            Aggressive = 8,  // foldAccentAggressive and expansions: ł→l, ß→ss, æ→ae
+            StripMarks = 16  // drop combining marks (Mn, Me)
+        };
+    };
+
+    static bool isCombiningMark(char32_t cp) {
+        return charProps(cp).flags & utf::data::PROPS_MARK;
+    }
+
+    // Appends cp to d after the case step of flags; with StripMarks, marks the case step makes
+    // (e.g. the dot of İ folded to i̇) are dropped too
+    template<unsigned flags>
+    void appendCaseStep(std::string &d, char32_t cp) {
+        char buf[4];
+        auto append = [&](char32_t c) {
+            if ((flags & Norm::StripMarks) && (charProps(c).flags & utf::data::PROPS_MARK))
+                return;
+            d.append(buf, appendCodePoint(c, buf));
+        };
+        if constexpr ((flags & Norm::FoldCase) != 0) {
+            const utf::data::CharProps &props = charProps(cp);
+            if (props.specialFold) {
+                const utf::data::SpecialCase &special = utf::data::special_fold[props.specialFold - 1];
+                for (uint8_t i = 0; i < special.len; i++)
+                    append(special.to[i]);
+                return;
+            }
+            cp += props.fold;
+        } else if constexpr ((flags & Norm::Lower) != 0)
+            cp += charProps(cp).lower;
+        append(cp);
+    }
+
+    // Search key normalization in one pass over UTF-8, steps chosen at compile time, e.g.
+    // normalize8<Norm::FoldCase | Norm::Aggressive | Norm::StripMarks>(query)
+    // Accents are folded before case; code points no step changes are copied in runs,
+    // ASCII eight bytes at a time; invalid sequences become REPLACEMENT
+    template<unsigned flags>
+    std::string normalize8(const std::string_view &str) {
+        constexpr bool foldCaseStep = (flags & Norm::FoldCase) != 0;
+        constexpr bool lowerStep = (flags & Norm::Lower) != 0 && !foldCaseStep;
+        std::string result;
+        result.reserve(str.size());
+        errors = errambig = 0;
+        const char *s = str.data();
+        const char *eos = s + str.size();
+        while (s < eos) {
+            const char *run = skipAscii(s, eos);
+            if (run > s) {
+                size_t len = result.size();
+                result.resize(len + (run - s));
+                if constexpr (foldCaseStep || lowerStep)
+                    copyAsciiCase(s, run, &result[len], 'A');
+                else
+                    std::memcpy(&result[len], s, run - s);
+                s = run;
+            }
+            const char *copied = s;
+            while (s < eos && ((uint8_t) *s & 0x80)) {
+                int before = errors;
+                const char *next;
+                char32_t cp = codePointAt(s, eos, &next);
+                const utf::data::CharProps &props = charProps(cp);
+                bool strip = (flags & Norm::StripMarks) && (props.flags & utf::data::PROPS_MARK);
+                bool expand = (flags & Norm::Aggressive) && props.expand;
+                int32_t accent = (flags & Norm::Aggressive) ? props.aggressive
+                                 : (flags & Norm::FoldAccents) ? props.accent : 0;
+                bool caseChanges = foldCaseStep ? props.fold || props.specialFold
+                                   : lowerStep && props.lower;
+                if (!strip && !expand && !accent && !caseChanges && errors == before && !isSurrogate(cp) && cp <= MaxCP) {
+                    s = next;
+                    continue;
+                }
+                result.append(copied, s - copied);
+                s = copied = next;
+                if (strip)
+                    continue;
+                if (expand) {
+                    for (const char *p = utf::data::aggressive_expand[props.expand - 1].to; *p; ++p)
+                        appendCaseStep<flags>(result, (char32_t) *p);
+                } else
+                    appendCaseStep<flags>(result, cp + accent);
+            }
+            result.append(copied, s - copied);
+        }
+        return result;
+    }
+
+    // ===== Caseless comparison =====
+
+    // What comparison and hashing ignore
+    enum class Folding {
+        Case,      // full case folding, as foldCase8
+        Accents,   // accents (foldAccent) and case
+        Aggressive // accents as foldAccentAggressive (ł -> l, æ -> ae) and case
+    };
+
+    // Reads UTF-8 text as folded code points, one at a time, without allocation
+    struct FoldCursor {
+        const char *s;
+        const char *eos;
+        char32_t pending[2] = {}; // rest of a 1:N folding
+        uint8_t pendingPos = 0;
+        uint8_t pendingLen = 0;
+
+        explicit FoldCursor(const std::string_view str) : s(str.data()), eos(str.data() + str.size()) {}
+
+        bool hasPending() const { return pendingPos < pendingLen; }
+
+        bool done() const { return s == eos && !hasPending(); }
+    };
+
+    // Folding of one code point into out (up to 3 code points); returns their number
+    static uint8_t foldCodePoint(char32_t cp, Folding folding, char32_t *out) {
+        if (folding == Folding::Accents)
+            cp = foldAccent(cp);
+        else if (folding == Folding::Aggressive) {
+            if (const utf::data::AggressiveExpand *expand = findAggressiveExpand(cp)) {
+                uint8_t len = 0;
+                for (const char *t = expand->to; *t; t++)
+                    out[len++] = lowerAscii(*t);
+                return len;
+            }
+            cp = foldAccentAggressive(cp);
+        }
+        const utf::data::SpecialCase *special = findSpecialFold(cp);
+        if (!special) {
+            out[0] = foldCaseCodePoint(cp);
+            return 1;
+        }
+        std::copy(special->to, special->to + special->len, out);
+        return special->len;
+    }
+
+    // Next folded code point; cursor must not be done
+    char32_t nextFolded(FoldCursor &c, Folding folding) {
+        if (c.hasPending())
+            return c.pending[c.pendingPos++];
+        char32_t folded[3];
+        uint8_t len = foldCodePoint(codePointAt(c.s, c.eos, &c.s), folding, folded);
+        std::copy(folded + 1, folded + len, c.pending);
+        c.pendingPos = 0;
+        c.pendingLen = len - 1;
+        return folded[0];
+    }
+
+    // Appends the folding of cp as UTF-8 to out (room for 3 * MAXCHARLEN bytes); returns its length
+    uint8_t appendFolded(char32_t cp, Folding folding, char *out) {
+        if (cp < 0x80) {
+            out[0] = lowerAscii((char) cp);
+            return 1;
+        }
+        char32_t folded[3];
+        uint8_t n = foldCodePoint(cp, folding, folded);
+        uint8_t len = 0;
+        for (uint8_t i = 0; i < n; i++)
+            len += appendCodePoint(folded[i], out + len);
+        return len;
+    }
+
+    static char lowerAscii(char c) {
+        return c >= 'A' && c <= 'Z' ? c + 32 : c;
+    }
+
+    // Advances a and b past bytes that are equal or differ only in case of ASCII letters,
+    // eight at a time; stops at a code point boundary
+    static void skipCaselessPrefix(const char *&a, const char *aEnd, const char *&b, const char *bEnd) {
+        const char *start = a;
+        while (aEnd - a >= 8 && bEnd - b >= 8) {
+            uint64_t x, y;
+            std::memcpy(&x, a, 8);
+            std::memcpy(&y, b, 8);
+            if (x != y) {
+                if ((x | y) & 0x8080808080808080ULL)
+                    break;
+                if ((x | asciiInRange(x, 'A', 'Z') >> 2) != (y | asciiInRange(y, 'A', 'Z') >> 2))
+                    break;
+            }
+            a += 8;
+            b += 8;
+        }
+        // equal words may end inside a multibyte sequence: go back to its lead byte
+        if (a > start && ((uint8_t) a[-1] & 0x80)) {
+            while (a > start && ((uint8_t) a[-1] & 0xc0) == 0x80) {
+                a--;
+                b--;
+            }
+            if (a > start && (uint8_t) a[-1] >= 0xc0) {
+                a--;
+                b--;
+            }
+        }
+    }
+
+    // Compares folded code point sequences of a and b: <0, 0 or >0
+    // Both are folded in lockstep and the comparison stops at the first difference
+    int compareFolded(const std::string_view a, const std::string_view b, Folding folding) {
+        FoldCursor ca(a), cb(b);
+        while (true) {
+            if (!ca.hasPending() && !cb.hasPending()) {
+                skipCaselessPrefix(ca.s, ca.eos, cb.s, cb.eos);
+                while (ca.s < ca.eos && cb.s < cb.eos && !((uint8_t) (*ca.s | *cb.s) & 0x80)) {
+                    char x = lowerAscii(*ca.s++);
+                    char y = lowerAscii(*cb.s++);
+                    if (x != y)
+                        return x < y ? -1 : 1;
+                }
+            }
+            if (ca.done() || cb.done())
+                return (int) !ca.done() - (int) !cb.done();
+            char32_t x = nextFolded(ca, folding);
+            char32_t y = nextFolded(cb, folding);
+            if (x != y)
+                return x < y ? -1 : 1;
+        }
+    }
+
+    // Equal after full case folding: "Straße" == "STRASSE"
+    bool equalsIgnoreCase(const std::string_view a, const std::string_view b) {
+        return compareFolded(a, b, Folding::Case) == 0;
+    }
+
+    int compareIgnoreCase(const std::string_view a, const std::string_view b) {
+        return compareFolded(a, b, Folding::Case);
+    }
+
+    // Equal after accent and case folding: "Łódź" == "łodz"
+    bool equalsIgnoreAccents(const std::string_view a, const std::string_view b) {
+        return compareFolded(a, b, Folding::Accents) == 0;
+    }
+
+    int compareIgnoreAccents(const std::string_view a, const std::string_view b) {
+        return compareFolded(a, b, Folding::Accents);
+    }
+
+    // ===== Caseless hashing =====
+
+    static uint64_t mixHash(uint64_t h, uint64_t v) {
+        h = (h ^ v) * 0x9e3779b97f4a7c15ULL;
+        return h ^ (h >> 29);
+    }
+
+    // Hash of the folded code point sequence: strings equal by compareFolded hash equally
+    // Folded ASCII is hashed in words of 8 code points, whichever way they were produced,
+    // so ASCII input can be lowercased and hashed eight bytes at a time
+    uint64_t hashFolded(const std::string_view str, Folding folding) {
+        const uint64_t high = 0x8080808080808080ULL;
+        uint64_t h = 0x243f6a8885a308d3ULL;
+        char ascii[8]; // folded ASCII code points waiting for a full word
+        int n = 0;
+        uint64_t word;
+        FoldCursor c(str);
+        while (!c.done()) {
+            if (n == 0 && !c.hasPending()) {
+                while (c.eos - c.s >= 8) {
+                    std::memcpy(&word, c.s, 8);
+                    if (word & high)
+                        break;
+                    h = mixHash(h, word | asciiInRange(word, 'A', 'Z') >> 2);
+                    c.s += 8;
+                }
+                if (c.done())
+                    break;
+            }
+            char32_t cp;
+            if (!c.hasPending() && !((uint8_t) *c.s & 0x80))
+                cp = lowerAscii(*c.s++);
+            else
+                cp = nextFolded(c, folding);
+            if (cp < 0x80) {
+                ascii[n++] = (char) cp;
+                if (n == 8) {
+                    std::memcpy(&word, ascii, 8);
+                    h = mixHash(h, word);
+                    n = 0;
+                }
+                continue;
+            }
+            if (n > 0) {
+                std::memset(ascii + n, 0, 8 - n);
+                std::memcpy(&word, ascii, 8);
+                h = mixHash(h, word ^ (uint64_t) (0x80 | n) << 56); // bit 63 is never set in full words
+                n = 0;
+            }
+            h = mixHash(h, cp | 0xc0ULL << 56);
+        }
+        if (n > 0) {
+            std::memset(ascii + n, 0, 8 - n);
+            std::memcpy(&word, ascii, 8);
+            h = mixHash(h, word ^ (uint64_t) (0x80 | n) << 56);
+        }
+        return h ^ (h >> 32);
+    }
+
+    // Functors for unordered containers keyed by folded strings, e.g.
+    // std::unordered_map<std::string, int, UTF::CaselessHash, UTF::CaselessEqual>
+    template<Folding folding>
+    struct FoldedHash {
+        size_t operator()(const std::string_view str) const {
+            UTF utf;
+            return (size_t) utf.hashFolded(str, folding);
+        }
+    };
+
+    template<Folding folding>
+    struct FoldedEqual {
+        bool operator()(const std::string_view a, const std::string_view b) const {
+            UTF utf;
+            return utf.compareFolded(a, b, folding) == 0;
+        }
+    };
+
+    using CaselessHash = FoldedHash<Folding::Case>;
+    using CaselessEqual = FoldedEqual<Folding::Case>;
+    using AccentlessHash = FoldedHash<Folding::Accents>;
+    using AccentlessEqual = FoldedEqual<Folding::Accents>;
+
+    // ===== Caseless substring search =====
+
+    // Byte offsets of a match in the haystack
+    struct FoldedMatch {
+        int64_t begin = -1; // -1 if not found
+        int64_t end = -1;
+
+        explicit operator bool() const { return begin >= 0; }
+    };
+
+    // Folded needle with its Horspool shift table (indexed by the low byte of a code point)
+    struct FoldedNeedle {
+        std::u32string cps;
+        size_t shift[256];
+    };
+
+    // Folded code point of the haystack and the code point it was folded from
+    struct FoldedUnit {
+        char32_t cp;
+        bool first; // first of the folding of the source code point
+        bool last;
+        int64_t begin; // source code point
+        int64_t end;
+    };
+
+    FoldedNeedle foldNeedle(const std::string_view needle, Folding folding) {
+        FoldedNeedle result;
+        for (FoldCursor c(needle); !c.done();)
+            result.cps.push_back(nextFolded(c, folding));
+        size_t m = result.cps.size();
+        std::fill(result.shift, result.shift + 256, m ? m : 1);
+        for (size_t i = 0; i + 1 < m; i++)
+            result.shift[result.cps[i] & 0xff] = m - 1 - i;
+        return result;
+    }
+
+    // First match of a folded needle at or after byte offset from (a code point boundary)
+    // The haystack is folded lazily into a sliding window; Horspool skips over folded code points
+    FoldedMatch findFolded(const std::string_view haystack, const FoldedNeedle &needle, Folding folding,
+                           int64_t from = 0) {
+        const size_t m = needle.cps.size();
+        if (from < 0)
+            from = 0;
+        if (from > (int64_t) haystack.size())
+            return {};
+        if (m == 0)
+            return {from, from};
+        FoldCursor c(haystack.substr(from));
+        std::vector<FoldedUnit> window;
+        size_t pos = 0;    // window index of the current alignment
+        int64_t begin = 0; // source offset of the code point being folded
+        while (true) {
+            while (window.size() < pos + m && !c.done()) {
+                bool first = !c.hasPending();
+                if (first)
+                    begin = c.s - haystack.data();
+                char32_t cp;
+                if (first && !((uint8_t) *c.s & 0x80))
+                    cp = lowerAscii(*c.s++);
+                else
+                    cp = nextFolded(c, folding);
+                window.push_back({cp, first, !c.hasPending(), begin, c.s - haystack.data()});
+            }
+            if (window.size() < pos + m)
+                return {};
+            const FoldedUnit *w = window.data() + pos;
+            char32_t last = w[m - 1].cp;
+            // matches must cover whole source code points: ß is not found by "s"
+            if (last == needle.cps[m - 1] && w[0].first && w[m - 1].last
+                && std::equal(needle.cps.begin(), needle.cps.end() - 1, w,
+                              [](char32_t cp, const FoldedUnit &unit) { return cp == unit.cp; }))
+                return {w[0].begin, w[m - 1].end};
+            pos += needle.shift[last & 0xff];
+            if (pos >= 1024) { // shifts never pass the end of the window
+                window.erase(window.begin(), window.begin() + pos);
+                pos = 0;
+            }
+        }
+    }
+
+    // First occurrence of needle in haystack comparing folded text, without folded copies of the haystack:
+    // findFolded("Żółw", "zolw", Folding::Aggressive) is {0, 7}
+    FoldedMatch findFolded(const std::string_view haystack, const std::string_view needle, Folding folding,
+                           int64_t from = 0) {
+        return findFolded(haystack, foldNeedle(needle, folding), folding, from);
+    }
+
+    // All non-overlapping occurrences, e.g. for highlighting; none for an empty needle
+    std::vector<FoldedMatch> findAllFolded(const std::string_view haystack, const std::string_view needle,
+                                           Folding folding) {
+        std::vector<FoldedMatch> result;
+        FoldedNeedle folded = foldNeedle(needle, folding);
+        if (folded.cps.empty())
+            return result;
+        for (FoldedMatch match = findFolded(haystack, folded, folding); match;
+             match = findFolded(haystack, folded, folding, match.end))
+            result.push_back(match);
+        return result;
+    }
+
+    // ===== Folded text with source offsets =====
+
+    // Run of the offset map, starting at folded position folded
+    struct OffsetRun {
+        int64_t folded;
+        int64_t source;
+        bool linear; // positions map one to one (ASCII, same-length mappings);
+                     // otherwise the run is the folding of a single source code point
+    };
+
+    // Folded text and a run-length map of folded positions (bytes or code points) to the source
+    template<typename String>
+    struct FoldedText {
+        String text;
+        std::vector<OffsetRun> runs; // sorted by folded, first at 0
+        int64_t sourceSize = 0;
+
+        // Source position where the code point at folded position pos starts; O(log runs)
+        int64_t sourceBegin(int64_t pos) const {
+            const OffsetRun *run = findRun(pos);
+            if (!run)
+                return sourceSize;
+            return run->linear ? run->source + pos - run->folded : run->source;
+        }
+
+        // Source position after the code point ending at folded position pos
+        // (inside an expansion, like the first s of ß -> ss, it is after the whole ß)
+        int64_t sourceEnd(int64_t pos) const {
+            const OffsetRun *run = findRun(pos);
+            if (!run)
+                return sourceSize;
+            if (run->linear || pos == run->folded)
+                return run->source + pos - run->folded;
+            return run + 1 < runs.data() + runs.size() ? run[1].source : sourceSize;
+        }
+
+    private:
+        const OffsetRun *findRun(int64_t pos) const {
+            if (pos >= (int64_t) text.size())
+                return nullptr;
+            auto it = std::upper_bound(runs.begin(), runs.end(), pos,
+                                       [](int64_t p, const OffsetRun &run) { return p < run.folded; });
+            return &it[-1];
+        }
+    };
+
+    // Appends a run unless the previous linear run continues
+    static void addOffsetRun(std::vector<OffsetRun> &runs, int64_t folded, int64_t source, bool linear) {
+        if (linear && !runs.empty() && runs.back().linear
+            && runs.back().source - runs.back().folded == source - folded)
+            return;
+        runs.push_back({folded, source, linear});
+    }
+
+    // Folded UTF-8 with offsets into str, e.g. for an indexer that highlights hits in the source:
+    // "Æsir ß" folds to "aesir ss" with runs {0, 0, map} {2, 2, linear} {6, 6, map}
+    FoldedText<std::string> foldWithOffsets8(const std::string_view str, Folding folding) {
+        FoldedText<std::string> result;
+        result.sourceSize = (int64_t) str.size();
+        result.text.reserve(str.size());
+        const char *data = str.data();
+        const char *s = data;
+        const char *eos = data + str.size();
+        while (s < eos) {
+            const char *run = skipAscii(s, eos);
+            if (run != s) {
+                addOffsetRun(result.runs, (int64_t) result.text.size(), s - data, true);
+                size_t len = result.text.size();
+                result.text.resize(len + (run - s));
+                copyAsciiCase(s, run, &result.text[len], 'A');
+                s = run;
+                if (s == eos)
+                    break;
+            }
+            const char *next;
+            char32_t folded[3];
+            uint8_t n = foldCodePoint(codePointAt(s, eos, &next), folding, folded);
+            int64_t start = (int64_t) result.text.size();
+            for (uint8_t i = 0; i < n; i++) {
+                char buf[MAXCHARLEN];
+                result.text.append(buf, appendCodePoint(folded[i], buf));
+            }
+            addOffsetRun(result.runs, start, s - data, n == 1 && (int64_t) result.text.size() - start == next - s);
+            s = next;
+        }
+        return result;
+    }
+
+    // Folded UTF-32 with offsets in code points
+    FoldedText<std::u32string> foldWithOffsets(const std::u32string_view str, Folding folding) {
+        FoldedText<std::u32string> result;
+        result.sourceSize = (int64_t) str.size();
+        result.text.reserve(str.size());
+        for (size_t i = 0; i < str.size(); i++) {
+            char32_t folded[3];
+            uint8_t n = foldCodePoint(str[i], folding, folded);
+            addOffsetRun(result.runs, (int64_t) result.text.size(), (int64_t) i, n == 1);
+            result.text.append(folded, n);
+        }
+        return result;
+    }
+
+    // ===== Code point search =====
+
+    // High bit set in every byte of word equal to b, without false positives:
+    // a byte of t is zero iff neither its high bit nor the carry of (low 7 bits + 0x7f) is set
+    static uint64_t equalBytes(uint64_t word, uint8_t b) {
+        const uint64_t low = 0x7f7f7f7f7f7f7f7fULL;
+        uint64_t t = word ^ (b * 0x0101010101010101ULL);
+        return ~(((t & low) + low) | t) & ~low;
+    }
+
+    // The same for the four 16-bit units of word
+    static uint64_t equalUnits(uint64_t word, char16_t unit) {
+        const uint64_t low = 0x7fff7fff7fff7fffULL;
+        uint64_t t = word ^ (unit * 0x0001000100010001ULL);
+        return ~(((t & low) + low) | t) & ~low;
+    }
+
+    // First occurrence of the encoded needle [needle, needle + len) in [s, eos), or eos:
+    // words without its lead byte are skipped, eight bytes at a time
+    static const char *findEncoded(const char *s, const char *eos, const char *needle, uint8_t len) {
+        const auto lead = (uint8_t) needle[0];
+        while (s < eos) {
+            while (eos - s >= 8) {
+                uint64_t word;
+                std::memcpy(&word, s, 8);
+                if (equalBytes(word, lead))
+                    break;
+                s += 8;
+            }
+            const char *stop = s + std::min<ptrdiff_t>(8, eos - s);
+            for (; s < stop; s++)
+                if ((uint8_t) *s == lead && eos - s >= len && std::memcmp(s + 1, needle + 1, len - 1) == 0)
+                    return s;
+        }
+        return eos;
+    }
+
+    // True if the code point decoded at s (as by codePointAt16) has units lead (== *s) and trail;
+    // trail is 0 for a single unit, which matches a surrogate only if it is unpaired
+    static bool isCodePoint16(const char16_t *begin, const char16_t *s, const char16_t *eos, char16_t trail) {
+        if (trail)
+            return s + 1 < eos && s[1] == trail;
+        if (isSurrogate1(*s))
+            return s + 1 == eos || !isSurrogate2(s[1]);
+        if (isSurrogate2(*s))
+            return s == begin || !isSurrogate1(s[-1]);
+        return true;
+    }
+
+    // First unit of the code point lead, trail in [s, eos), or eos; words without lead
+    // are skipped, four units at a time
+    static const char16_t *findEncoded16(const char16_t *begin, const char16_t *s, const char16_t *eos,
+                                         char16_t lead, char16_t trail) {
+        while (s < eos) {
+            while (eos - s >= 4) {
+                uint64_t word;
+                std::memcpy(&word, s, 8);
+                if (equalUnits(word, lead))
+                    break;
+                s += 4;
+            }
+            const char16_t *stop = s + std::min<ptrdiff_t>(4, eos - s);
+            for (; s < stop; s++)
+                if (*s == lead && isCodePoint16(begin, s, eos, trail))
+                    return s;
+        }
+        return eos;
+    }
+
+    // Units of cp in UTF-16: lead, and trail for supplementary code points (0 otherwise)
+    static void splitUnits16(char32_t cp, char16_t &lead, char16_t &trail) {
+        if (cp < 0x10000) {
+            lead = (char16_t) cp;
+            trail = 0;
+        } else {
+            lead = (char16_t) ((cp - 0x10000) / 0x400 + 0xD800);
+            trail = (char16_t) ((cp - 0x10000) % 0x400 + 0xDC00);
+        }
+    }
+
+    // Byte offset of the first cp in str at or after from, -1 if none;
+    // surrogates and code points above MaxCP are never found in UTF-8, nor does
+    // REPLACEMENT match invalid sequences
+    static int64_t find(const std::string_view str, char32_t cp, int64_t from = 0) {
+        if (from < 0)
+            from = 0;
+        if (isSurrogate(cp) || cp > MaxCP || from >= (int64_t) str.size())
+            return -1;
+        char needle[MAXCHARLEN];
+        uint8_t len = UTF().appendCodePoint(cp, needle);
+        const char *eos = str.data() + str.size();
+        const char *found = findEncoded(str.data() + from, eos, needle, len);
+        return found == eos ? -1 : found - str.data();
+    }
+
+    // Unit offset of the first cp in str at or after from, -1 if none; a supplementary cp
+    // is matched as its surrogate pair, a surrogate cp only as an unpaired surrogate
+    static int64_t find(const u16string_view str, char32_t cp, int64_t from = 0) {
+        if (from < 0)
+            from = 0;
+        if (cp > MaxCP || from >= (int64_t) str.size())
+            return -1;
+        char16_t lead, trail;
+        splitUnits16(cp, lead, trail);
+        const char16_t *eos = str.data() + str.size();
+        const char16_t *found = findEncoded16(str.data(), str.data() + from, eos, lead, trail);
+        return found == eos ? -1 : found - str.data();
+    }
+
+    // Number of occurrences of cp in str
+    static int64_t count(const std::string_view str, char32_t cp) {
+        if (isSurrogate(cp) || cp > MaxCP)
+            return 0;
+        char needle[MAXCHARLEN];
+        uint8_t len = UTF().appendCodePoint(cp, needle);
+        int64_t result = 0;
+        const char *eos = str.data() + str.size();
+        for (const char *s = findEncoded(str.data(), eos, needle, len); s < eos;
+             s = findEncoded(s + len, eos, needle, len))
+            result++;
+        return result;
+    }
+
+    static int64_t count(const u16string_view str, char32_t cp) {
+        if (cp > MaxCP)
+            return 0;
+        char16_t lead, trail;
+        splitUnits16(cp, lead, trail);
+        int64_t result = 0;
+        const char16_t *begin = str.data();
+        const char16_t *eos = begin + str.size();
+        for (const char16_t *s = findEncoded16(begin, begin, eos, lead, trail); s < eos;
+             s = findEncoded16(begin, s + (trail ? 2 : 1), eos, lead, trail))
+            result++;
+        return result;
+    }
+
+    // Code points searched by findAny, e.g. delimiters; built once for many scans
+    struct CodePointSet {
+        uint64_t ascii[2] = {};           // bitmap of ASCII members
+        uint64_t leads[4] = {};           // bitmap of the first UTF-8 bytes of members
+        std::vector<uint8_t> leadBytes;   // the same bytes listed; up to 8 are compared a word at a time
+        std::vector<char16_t> leadUnits;  // first UTF-16 units of members, sorted
+        std::vector<char32_t> other;      // non-ASCII members, sorted
+
+        CodePointSet() = default;
+
+        explicit CodePointSet(const u32string_view members) {
+            for (char32_t cp: members) {
+                if (cp > MaxCP)
+                    continue;
+                if (cp < 0x80)
+                    ascii[cp >> 6] |= 1ULL << (cp & 63);
+                else
+                    other.push_back(cp);
+                char16_t lead, trail;
+                splitUnits16(cp, lead, trail);
+                leadUnits.push_back(lead);
+                if (!isSurrogate(cp)) {
+                    char buf[MAXCHARLEN];
+                    UTF().appendCodePoint(cp, buf);
+                    leads[(uint8_t) buf[0] >> 6] |= 1ULL << (buf[0] & 63);
+                }
+            }
+            std::sort(other.begin(), other.end());
+            other.erase(std::unique(other.begin(), other.end()), other.end());
+            std::sort(leadUnits.begin(), leadUnits.end());
+            leadUnits.erase(std::unique(leadUnits.begin(), leadUnits.end()), leadUnits.end());
+            for (int b = 0; b < 256; b++)
+                if (hasLead((uint8_t) b))
+                    leadBytes.push_back((uint8_t) b);
+        }
+
+        bool contains(char32_t cp) const {
+            if (cp < 0x80)
+                return ascii[cp >> 6] >> (cp & 63) & 1;
+            return std::binary_search(other.begin(), other.end(), cp);
+        }
+
+        bool hasLead(uint8_t b) const {
+            return leads[b >> 6] >> (b & 63) & 1;
+        }
+    };
+
+    // Byte offset of the first member of set in str at or after from, -1 if none;
+    // with few distinct lead bytes words holding none of them are skipped
+    static int64_t findAny(const std::string_view str, const CodePointSet &set, int64_t from = 0) {
+        if (from < 0)
+            from = 0;
+        if (set.leadBytes.empty() || from >= (int64_t) str.size())
+            return -1;
+        const bool swar = set.leadBytes.size() <= 8;
+        const char *s = str.data() + from;
+        const char *eos = str.data() + str.size();
+        while (s < eos) {
+            const char *stop = eos;
+            if (swar) {
+                while (eos - s >= 8) {
+                    uint64_t word;
+                    std::memcpy(&word, s, 8);
+                    uint64_t hits = 0;
+                    for (uint8_t b: set.leadBytes)
+                        hits |= equalBytes(word, b);
+                    if (hits)
+                        break;
+                    s += 8;
+                }
+                stop = s + std::min<ptrdiff_t>(8, eos - s);
+            }
+            for (; s < stop; s++) {
+                auto b = (uint8_t) *s;
+                if (!set.hasLead(b))
+                    continue;
+                if (b < 0x80)
+                    return s - str.data();
+                // members are non-ASCII here: lead bytes of 2-4 byte sequences
+                uint8_t len = determineU8Len(b);
+                if (eos - s < len)
+                    continue;
+                char32_t cp = b & (0x7f >> len);
+                uint8_t i = 1;
+                for (; i < len && insideU8code(s[i]); i++)
+                    cp = (cp << 6) | (s[i] & 0x3f);
+                if (i == len && one8len(cp) == len && !isSurrogate(cp) && set.contains(cp))
+                    return s - str.data();
+            }
+        }
+        return -1;
+    }
+
+    static int64_t findAny(const std::string_view str, const u32string_view members, int64_t from = 0) {
+        return findAny(str, CodePointSet(members), from);
+    }
+
+    // Unit offset of the first member of set in str at or after from, -1 if none;
+    // code points are decoded as by codePointAt16
+    static int64_t findAny(const u16string_view str, const CodePointSet &set, int64_t from = 0) {
+        if (from < 0)
+            from = 0;
+        const std::vector<char16_t> &units = set.leadUnits;
+        if (units.empty() || from >= (int64_t) str.size())
+            return -1;
+        const bool swar = units.size() <= 8;
+        const char16_t *begin = str.data();
+        const char16_t *s = begin + from;
+        const char16_t *eos = begin + str.size();
+        while (s < eos) {
+            const char16_t *stop = eos;
+            if (swar) {
+                while (eos - s >= 4) {
+                    uint64_t word;
+                    std::memcpy(&word, s, 8);
+                    uint64_t hits = 0;
+                    for (char16_t unit: units)
+                        hits |= equalUnits(word, unit);
+                    if (hits)
+                        break;
+                    s += 4;
+                }
+                stop = s + std::min<ptrdiff_t>(4, eos - s);
+            }
+            for (; s < stop; s++) {
+                char32_t cp = *s;
+                if (cp < 0x80) {
+                    if (set.contains(cp))
+                        return s - begin;
+                    continue;
+                }
+                if (!std::binary_search(units.begin(), units.end(), *s))
+                    continue;
+                if (isSurrogate1(cp) && s + 1 < eos && isSurrogate2(s[1]))
+                    cp = (cp - 0xD800) * 0x400 + (s[1] - 0xDC00) + 0x10000;
+                else if (isSurrogate2(cp) && s > begin && isSurrogate1(s[-1]))
+                    continue;
+                if (set.contains(cp))
+                    return s - begin;
+            }
+        }
+        return -1;
+    }
+
+    static int64_t findAny(const u16string_view str, const u32string_view members, int64_t from = 0) {
+        return findAny(str, CodePointSet(members), from);
+    }
+
+    // ===== Grapheme clusters (UAX #29) =====
+
+    // Skips ASCII bytes, eight at a time; returns first non-ASCII byte or eos
+    static const char *skipAscii(const char *s, const char *eos) {
+        while (eos - s >= 8) {
+            uint64_t word;
+            std::memcpy(&word, s, 8);
+            if (word & 0x8080808080808080ULL)
+                break;
+            s += 8;
+        }
+        while (s < eos && !((uint8_t) *s & 0x80))
+            s++;
+        return s;
+    }
+
+    // High bit set in every byte of word (all bytes ASCII) that lies in [lo, hi]:
+    // adding (0x80 - lo) sets it when byte >= lo, adding (0x7f - hi) when byte > hi;
+    // no carries cross bytes since all bytes are < 0x80
+    static uint64_t asciiInRange(uint64_t word, uint8_t lo, uint8_t hi) {
+        const uint64_t ones = 0x0101010101010101ULL;
+        return (word + (0x80 - lo) * ones) & ~(word + (0x7f - hi) * ones) & (0x80 * ones);
+    }
+
+    // Skips ASCII letters and digits, eight at a time; returns first other byte or eos
+    static const char *skipAsciiAlnum(const char *s, const char *eos) {
+        const uint64_t high = 0x8080808080808080ULL;
+        while (eos - s >= 8) {
+            uint64_t word;
+            std::memcpy(&word, s, 8);
+            if (word & high)
+                break;
+            uint64_t alnum = asciiInRange(word | 0x2020202020202020ULL, 'a', 'z') | asciiInRange(word, '0', '9');
+            if (alnum != high)
+                break;
+            s += 8;
+        }
+        while (s < eos && ((*s >= 'a' && *s <= 'z') || (*s >= 'A' && *s <= 'Z') || (*s >= '0' && *s <= '9')))
+            s++;
+        return s;
+    }
+
+    // Skips printable ASCII (0x20..0x7e), eight at a time; returns first other byte or eos
+    static const char *skipAsciiPrintable(const char *s, const char *eos) {
+        const uint64_t high = 0x8080808080808080ULL;
+        while (eos - s >= 8) {
+            uint64_t word;
+            std::memcpy(&word, s, 8);
+            if ((word & high) || asciiInRange(word, 0x20, 0x7e) != high)
+                break;
+            s += 8;
+        }
+        while (s < eos && *s >= 0x20 && *s <= 0x7e)
+            s++;
+        return s;
+    }
+
+    // Grapheme_Cluster_Break in low bits, GRAPHEME_* flags above
+    static uint8_t graphemeProperty(char32_t cp) {
+        using namespace utf::data;
+        if (cp > MaxCP)
+            return GB_Other;
+        const uint32_t mask = (1u << GRAPHEME_SHIFT) - 1;
+        return grapheme_stage2[(grapheme_stage1[cp >> GRAPHEME_SHIFT] << GRAPHEME_SHIFT) | (cp & mask)];
+    }
+
+    // Word_Break in low bits, WORD_* flags above
+    static uint8_t wordProperty(char32_t cp) {
+        using namespace utf::data;
+        if (cp > MaxCP)
+            return WB_Other;
+        const uint32_t mask = (1u << WORD_SHIFT) - 1;
+        return word_stage2[(word_stage1[cp >> WORD_SHIFT] << WORD_SHIFT) | (cp & mask)];
+    }
+
+    // State carried between consecutive code points by the break rules
+    struct GraphemeBreakState {
+        uint8_t prev = utf::data::GB_Other;
+        bool emoji = false;    // GB11: ExtPict Extend* so far
+        bool emojiZwj = false; // GB11: ExtPict Extend* ZWJ just seen
+        bool riOdd = false;    // GB12/13: odd run of Regional_Indicator
+        uint8_t incb = 0;      // GB9c: 1 after Consonant, 2 after Consonant ... Linker
+
+        // Returns true if there is a boundary before a code point with property next
+        bool advance(uint8_t next) {
+            using namespace utf::data;
+            const uint8_t a = prev & GRAPHEME_BREAK_MASK;
+            const uint8_t b = next & GRAPHEME_BREAK_MASK;
+            bool isBreak;
+            if (a == GB_CR && b == GB_LF)
+                isBreak = false; // GB3
+            else if (a == GB_CR || a == GB_LF || a == GB_Control)
+                isBreak = true; // GB4
+            else if (b == GB_CR || b == GB_LF || b == GB_Control)
+                isBreak = true; // GB5
+            else if (a == GB_L && (b == GB_L || b == GB_V || b == GB_LV || b == GB_LVT))
+                isBreak = false; // GB6
+            else if ((a == GB_LV || a == GB_V) && (b == GB_V || b == GB_T))
+                isBreak = false; // GB7
+            else if ((a == GB_LVT || a == GB_T) && b == GB_T)
+                isBreak = false; // GB8
+            else if (b == GB_Extend || b == GB_ZWJ || b == GB_SpacingMark || a == GB_Prepend)
+                isBreak = false; // GB9, GB9a, GB9b
+            else if (incb == 2 && (next & GRAPHEME_INCB_MASK) == GRAPHEME_INCB_CONSONANT)
+                isBreak = false; // GB9c
+            else if (emojiZwj && (next & GRAPHEME_EXT_PICT))
+                isBreak = false; // GB11
+            else if (a == GB_RegionalIndicator && b == GB_RegionalIndicator && riOdd)
+                isBreak = false; // GB12, GB13
+            else
+                isBreak = true; // GB999
+
+            emojiZwj = emoji && b == GB_ZWJ;
+            emoji = (next & GRAPHEME_EXT_PICT) || (emoji && b == GB_Extend);
+            riOdd = b == GB_RegionalIndicator && !(a == GB_RegionalIndicator && riOdd);
+            const uint8_t conjunct = next & GRAPHEME_INCB_MASK;
+            if (conjunct == GRAPHEME_INCB_CONSONANT)
+                incb = 1;
+            else if (conjunct == GRAPHEME_INCB_LINKER && incb)
+                incb = 2;
+            else if (conjunct != GRAPHEME_INCB_EXTEND)
+                incb = 0;
+            prev = next;
+            return isBreak;
+        }
+    };
+
+    // End of the grapheme cluster starting at s
+    const char *nextGrapheme(const char *s, const char *eos) {
+        if (s >= eos)
+            return eos;
+        // two ASCII bytes are always separate clusters, except CR LF
+        if (!((uint8_t) s[0] & 0x80) && (s + 1 == eos || !((uint8_t) s[1] & 0x80))) {
+            if (s[0] == '\r' && s + 1 < eos && s[1] == '\n')
+                return s + 2;
+            return s + 1;
+        }
+        GraphemeBreakState state;
+        const char *next;
+        state.advance(graphemeProperty(codePointAt(s, eos, &next)));
+        s = next;
+        while (s < eos) {
+            if (state.advance(graphemeProperty(codePointAt(s, eos, &next))))
+                return s;
+            s = next;
+        }
+        return eos;
+    }
+
+    // Like forwardNcodes, but steps over whole grapheme clusters
+    const char *forwardNgraphemes(const char *s, int64_t N, const char *send, int64_t &actual) {
+        assert(s <= send);
+        actual = 0;
+        while (s < send && actual < N) {
+            // inside an ASCII run every byte but the last ends a cluster (CR LF excepted);
+            // the last one may still take combining marks that follow
+            const char *run = skipAscii(s, send);
+            if (run - s > 1) {
+                const char *last = run - 1;
+                while (s < last && actual < N) {
+                    auto cr = (const char *) std::memchr(s, '\r', last - s);
+                    const char *stop = cr ? cr : last;
+                    int64_t step = std::min((int64_t) (stop - s), N - actual);
+                    s += step;
+                    actual += step;
+                    if (s == cr && actual < N) {
+                        s += s[1] == '\n' ? 2 : 1;
+                        actual++;
+                    }
+                }
+            }
+            if (s < send && actual < N) {
+                s = nextGrapheme(s, send);
+                actual++;
+            }
+        }
+        return s;
+    }
+
+    int64_t countGraphemes(const std::string_view str) {
+        int64_t result;
+        forwardNgraphemes(str.data(), INT64_MAX, str.data() + str.length(), result);
+        return result;
+    }
+
+    // Like subview8, but start and subLen count grapheme clusters
+    std::string_view subviewGraphemes8(const std::string_view view, int64_t start, int64_t subLen) {
+        if (start < 0) {
+            subLen += start;
+            start = 0;
+        }
+        if (subLen <= 0) return {};
+        const char *eos = view.data() + view.length();
+        int64_t actual;
+        const char *startView = forwardNgraphemes(view.data(), start, eos, actual);
+        if (actual < start) return {};
+        const char *endView = forwardNgraphemes(startView, subLen, eos, actual);
+        return std::string_view(startView, endView - startView);
+    }
+
+    std::string substrGraphemes8(const std::string_view strView, int64_t start, int64_t subLen) {
+        return std::string(subviewGraphemes8(strView, start, subLen));
+    }
+
+    // Longest prefix of str with at most maxGraphemes grapheme clusters
+    std::string_view truncateGraphemes8(const std::string_view str, int64_t maxGraphemes) {
+        if (maxGraphemes <= 0) return {};
+        int64_t actual;
+        const char *end = forwardNgraphemes(str.data(), maxGraphemes, str.data() + str.length(), actual);
+        return std::string_view(str.data(), end - str.data());
+    }
+
+    // ===== Display width =====
+
+    // Terminal columns of a single code point: 0 (combining, control), 1 or 2 (wide, fullwidth)
+    // ambiguousWide: East_Asian_Width=A characters (e.g. ±, Greek) take 2 columns, as in CJK locales
+    static uint8_t codePointWidth(char32_t cp, bool ambiguousWide = false) {
+        using namespace utf::data;
+        if (cp > MaxCP)
+            return 1;
+        const uint32_t mask = (1u << WIDTH_SHIFT) - 1;
+        uint8_t width = width_stage2[(width_stage1[cp >> WIDTH_SHIFT] << WIDTH_SHIFT) | (cp & mask)];
+        if (width == WIDTH_AMBIGUOUS)
+            return ambiguousWide ? 2 : 1;
+        return width;
+    }
+
+    // Columns of the grapheme cluster starting at s, *end set past it.
+    // A cluster is as wide as its first code point; emoji presentation (VS16)
+    // and regional indicator pairs (flags) take 2 columns.
+    uint8_t graphemeWidth(const char *s, const char *eos, const char **end, bool ambiguousWide = false) {
+        GraphemeBreakState state;
+        const char *next;
+        char32_t cp = codePointAt(s, eos, &next);
+        uint8_t width = codePointWidth(cp, ambiguousWide);
+        state.advance(graphemeProperty(cp));
+        s = next;
+        while (s < eos) {
+            cp = codePointAt(s, eos, &next);
+            uint8_t prop = graphemeProperty(cp);
+            if (state.advance(prop))
+                break;
+            if (cp == 0xFE0F || (prop & utf::data::GRAPHEME_BREAK_MASK) == utf::data::GB_RegionalIndicator)
+                width = 2;
+            s = next;
+        }
+        *end = s;
+        return width;
+    }
+
+    // Steps over whole grapheme clusters while they fit in maxWidth columns
+    const char *forwardWidth(const char *s, const char *send, int64_t maxWidth, int64_t &width, bool ambiguousWide = false) {
+        assert(s <= send);
+        width = 0;
+        while (s < send) {
+            // printable ASCII is one column per byte; the last byte of a run
+            // may start a longer cluster (e.g. keycap), so it goes the slow way
+            const char *run = skipAsciiPrintable(s, send);
+            if (run - s > 1) {
+                const char *last = run - 1;
+                int64_t step = std::min((int64_t) (last - s), maxWidth - width);
+                s += step;
+                width += step;
+                if (s < last)
+                    return s;
+            }
+            const char *next;
+            uint8_t w = graphemeWidth(s, send, &next, ambiguousWide);
+            if (width + w > maxWidth)
+                return s;
+            width += w;
+            s = next;
+        }
+        return s;
+    }
+
+    // Columns needed to display str in a terminal or fixed-width font
+    int64_t displayWidth(const std::string_view str, bool ambiguousWide = false) {
+        int64_t width;
+        forwardWidth(str.data(), str.data() + str.length(), INT64_MAX, width, ambiguousWide);
+        return width;
+    }
+
+    // Longest prefix of str that fits in maxWidth columns, never splits a grapheme cluster
+    std::string_view truncateToWidth(const std::string_view str, int64_t maxWidth, bool ambiguousWide = false) {
+        if (maxWidth <= 0) return {};
+        int64_t width;
+        const char *end = forwardWidth(str.data(), str.data() + str.length(), maxWidth, width, ambiguousWide);
+        return std::string_view(str.data(), end - str.data());
+    }
+
+    // ===== One-pass truncation =====
+
+    enum class LengthUnit {
+        Bytes,      // UTF-8 bytes
+        Units16,    // UTF-16 code units
+        CodePoints,
+        Columns     // display width, see displayWidth
+    };
+
+    // Length of a UTF-8 string in every unit
+    struct Lengths {
+        int64_t bytes = 0;
+        int64_t units16 = 0;
+        int64_t codePoints = 0;
+        int64_t columns = 0;
+
+        int64_t in(LengthUnit unit) const {
+            switch (unit) {
+                case LengthUnit::Bytes: return bytes;
+                case LengthUnit::Units16: return units16;
+                case LengthUnit::CodePoints: return codePoints;
+                default: return columns;
+            }
+        }
+    };
+
+    // Longest prefix of str whose length in unit is at most budget, found in a single pass.
+    // Never splits a code point; with LengthUnit::Columns never splits a grapheme cluster.
+    // If lengths is given, it receives the length of the prefix in all units.
+    std::string_view truncate8(const std::string_view str, int64_t budget, LengthUnit unit,
+                               Lengths *lengths = nullptr, bool ambiguousWide = false) {
+        const char *s = str.data();
+        const char *eos = str.data() + str.length();
+        Lengths cur;
+        Lengths atCluster;             // lengths at start of current grapheme cluster
+        const char *clusterStart = s;
+        uint8_t clusterWidth = 0;
+        GraphemeBreakState state;
+        bool started = false;
+        while (s < eos && budget >= 0) {
+            // printable ASCII adds one to every unit per byte; the last byte of
+            // a run may take following combining marks, so it goes the slow way
+            const char *run = skipAsciiPrintable(s, eos);
+            if (run - s > 1) {
+                const char *last = run - 1;
+                int64_t step = std::min((int64_t) (last - s), budget - cur.in(unit));
+                cur.bytes += step;
+                cur.units16 += step;
+                cur.codePoints += step;
+                cur.columns += step;
+                s += step;
+                if (s < last)
+                    break;
+                state = GraphemeBreakState();
+            }
+            const char *next;
+            char32_t cp = codePointAt(s, eos, &next);
+            uint8_t prop = graphemeProperty(cp);
+            Lengths after = cur;
+            after.bytes += next - s;
+            after.units16 += one16len(cp);
+            after.codePoints++;
+            bool newCluster = state.advance(prop) || !started;
+            if (newCluster) {
+                clusterStart = s;
+                atCluster = cur;
+                clusterWidth = codePointWidth(cp, ambiguousWide);
+                after.columns += clusterWidth;
+            } else if (clusterWidth < 2 && (cp == 0xFE0F || (prop & utf::data::GRAPHEME_BREAK_MASK) == utf::data::GB_RegionalIndicator)) {
+                after.columns += 2 - clusterWidth;
+                clusterWidth = 2;
+            }
+            if (after.in(unit) > budget) {
+                if (unit == LengthUnit::Columns && !newCluster) {
+                    s = clusterStart;
+                    cur = atCluster;
+                }
+                break;
+            }
+            started = true;
+            cur = after;
+            s = next;
+        }
+        if (lengths)
+            *lengths = cur;
+        return std::string_view(str.data(), s - str.data());
     }
 };
@@ -31,6 +31,10 @@ extern const size_t special_upper_size;
 extern const SpecialCase special_lower[];
 extern const size_t special_lower_size;
 
+// Full case folding (CaseFolding.txt status F)
+extern const SpecialCase special_fold[];
+extern const size_t special_fold_size;
+
 // ===== Decomposition data =====
 
 struct Decomposition {
@@ -54,4 +58,147 @@ struct AggressiveExpand {
 extern const AggressiveExpand aggressive_expand[];
 extern const size_t aggressive_expand_size;
 
+// Accent folding of 2-byte UTF-8 sequences U+00C0..U+027F (lead bytes 0xC3..0xC9):
+// latin_fold8[(lead - 0xC3) * 64 + (trail & 0x3F)] = {length, byte, byte} of the folded text
+const uint8_t LATIN_FOLD_FIRST_LEAD = 0xC3;
+const uint8_t LATIN_FOLD_LAST_LEAD = 0xC9;
+extern const uint8_t latin_fold8[][3];
+extern const uint8_t latin_fold8_aggressive[][3];
+
+// ===== Per-code-point properties =====
+
+// Case mapping and accent folding of one code point; mappings are deltas: lowercase of cp is cp + lower
+struct CharProps {
+    int32_t lower;
+    int32_t upper;
+    int32_t fold;         // simple case folding (CaseFolding.txt status C and S)
+    int32_t accent;       // foldAccent: base of canonical decomposition with combining mark
+    int32_t aggressive;   // foldAccentAggressive
+    uint8_t specialUpper; // 1 + index in special_upper, 0 if none
+    uint8_t specialFold;  // 1 + index in special_fold
+    uint8_t expand;       // 1 + index in aggressive_expand
+    uint8_t flags;        // PROPS_*
+};
+
+const uint8_t PROPS_MARK = 0x01; // combining mark (general category Mn or Me)
+
+extern const CharProps char_props[]; // char_props[0]: no mappings
+
+// Two-stage table: char_props[props_stage2[props_stage1[cp >> 6] * 64 + (cp & 63)]]
+// Code points past props_stage1_size blocks have no mappings
+const unsigned PROPS_SHIFT = 6;
+extern const uint8_t props_stage1[];
+extern const size_t props_stage1_size;
+extern const uint16_t props_stage2[];
+
+// ===== Normalization data =====
+
+// Flags stored above ccc in norm_stage2 entries (quick check properties, UAX #15)
+const uint8_t NORM_NFD_NO = 0x01;    // NFD_QC=No: has canonical decomposition
+const uint8_t NORM_NFC_NO = 0x02;    // NFC_QC=No
+const uint8_t NORM_NFC_MAYBE = 0x04; // NFC_QC=Maybe: may compose with a preceding character
+const uint8_t NORM_NFKD_NO = 0x08;   // NFKD_QC=No: has canonical or compatibility decomposition
+const uint8_t NORM_NFKC_NO = 0x10;   // NFKC_QC=No
+const uint8_t NORM_NFKC_MAYBE = 0x20;
+const uint8_t NORM_COMPAT = 0x40;    // compatibility decomposition differs from the canonical one
+
+// Full canonical decomposition at norm_decomp[offset]: length (0 if none), then code points;
+// with NORM_COMPAT the full compatibility decomposition follows in the same layout
+// Hangul syllables U+AC00..U+D7A3 are decomposed algorithmically
+extern const char32_t norm_decomp[];
+
+// Primary composite (canonical pair not excluded from composition)
+struct Composition {
+    char32_t first;
+    char32_t second;
+    char32_t composite;
+};
+
+extern const Composition norm_compositions[]; // sorted by {first, second}
+extern const size_t norm_compositions_size;
+
+// Two-stage table: norm_stage2[norm_stage1[cp >> 6] * 64 + (cp & 63)]
+// Entry: decomposition offset << 16 | NORM_* flags << 8 | ccc
+// Code points past norm_stage1_size blocks are 0 (starters, normalized in every form)
+const unsigned NORM_SHIFT = 6;
+extern const uint16_t norm_stage1[];
+extern const size_t norm_stage1_size;
+extern const uint32_t norm_stage2[];
+
+// ===== Segmentation data =====
+
+// Grapheme_Cluster_Break property values (UAX #29)
+enum GraphemeBreak : uint8_t {
+    GB_Other,
+    GB_CR,
+    GB_LF,
+    GB_Control,
+    GB_Extend,
+    GB_ZWJ,
+    GB_RegionalIndicator,
+    GB_Prepend,
+    GB_SpacingMark,
+    GB_L,
+    GB_V,
+    GB_T,
+    GB_LV,
+    GB_LVT
+};
+
+// Bits stored above GraphemeBreak in grapheme_stage2 entries
+const uint8_t GRAPHEME_BREAK_MASK = 0x0f;
+const uint8_t GRAPHEME_EXT_PICT = 0x10;       // Extended_Pictographic
+const uint8_t GRAPHEME_INCB_MASK = 0x60;      // Indic_Conjunct_Break
+const uint8_t GRAPHEME_INCB_LINKER = 0x20;
+const uint8_t GRAPHEME_INCB_CONSONANT = 0x40;
+const uint8_t GRAPHEME_INCB_EXTEND = 0x60;
+
+// Two-stage table: grapheme_stage2[grapheme_stage1[cp >> 7] * 128 + (cp & 127)]
+const unsigned GRAPHEME_SHIFT = 7;
+extern const uint8_t grapheme_stage1[];
+extern const uint8_t grapheme_stage2[];
+
+// Word_Break property values (UAX #29)
+enum WordBreak : uint8_t {
+    WB_Other,
+    WB_CR,
+    WB_LF,
+    WB_Newline,
+    WB_Extend,
+    WB_ZWJ,
+    WB_RegionalIndicator,
+    WB_Format,
+    WB_Katakana,
+    WB_HebrewLetter,
+    WB_ALetter,
+    WB_SingleQuote,
+    WB_DoubleQuote,
+    WB_MidNumLet,
+    WB_MidLetter,
+    WB_MidNum,
+    WB_Numeric,
+    WB_ExtendNumLet,
+    WB_WSegSpace
+};
+
+// Bits stored above WordBreak in word_stage2 entries
+const uint8_t WORD_BREAK_MASK = 0x1f;
+const uint8_t WORD_EXT_PICT = 0x20; // Extended_Pictographic
+const uint8_t WORD_ALNUM = 0x40;    // letter or number with Word_Break=Other (ideographs, Thai, ...)
+
+// Two-stage table: word_stage2[word_stage1[cp >> 8] * 256 + (cp & 255)]
+const unsigned WORD_SHIFT = 8;
+extern const uint8_t word_stage1[];
+extern const uint8_t word_stage2[];
+
+// ===== Display width data =====
+
+// width_stage2 entries: 0, 1, 2 or WIDTH_AMBIGUOUS (East_Asian_Width=A, 1 or 2 by context)
+const uint8_t WIDTH_AMBIGUOUS = 3;
+
+// Two-stage table: width_stage2[width_stage1[cp >> 8] * 256 + (cp & 255)]
+const unsigned WIDTH_SHIFT = 8;
+extern const uint8_t width_stage1[];
+extern const uint8_t width_stage2[];
+
 } // namespace utf::data
@@ -0,0 +1,43 @@
+#pragma once
+// WordTokenizer - word segmentation of UTF-8 text (UAX #29)
+// Tokens are views into the tokenized buffer, nothing is copied
+
+#include <cstdint>
+#include <string_view>
+
+namespace utf {
+
+// Single segment of the input
+struct WordToken {
+    std::string_view text;       // points into the tokenized buffer
+    int64_t byteOffset = 0;      // offset of text in the input
+    int64_t codePointOffset = 0; // code points before text
+    int64_t codePoints = 0;      // code points in text
+    bool isWord = false;         // has a letter, digit, ideograph... (not space or punctuation)
+};
+
+class WordTokenizer {
+public:
+    // wordsOnly: skip segments without letters and digits (spaces, punctuation, emoji)
+    explicit WordTokenizer(std::string_view text, bool wordsOnly = true)
+        : m_text(text), m_pos(text.data()), m_wordsOnly(wordsOnly) {}
+
+    // Fill token with the next segment
+    // Returns false at end of text
+    bool next(WordToken& token);
+
+    // Number of invalid UTF-8 sequences seen so far
+    int errors() const { return m_errors; }
+
+private:
+    // End of the segment starting at s (rules WB3-WB999)
+    const char* nextBoundary(const char* s, const char* eos, int64_t& codePoints, bool& isWord);
+
+    std::string_view m_text;
+    const char* m_pos;
+    int64_t m_codePointOffset = 0;
+    int m_errors = 0;
+    bool m_wordsOnly;
+};
+
+} // namespace utf
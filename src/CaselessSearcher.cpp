@@ -0,0 +1,224 @@
+// CaselessSearcher implementation
+
+#include "utf/CaselessSearcher.hpp"
+#include <algorithm>
+
+namespace utf {
+
+namespace {
+
+// Byte of the folded haystack and the source code point it comes from
+struct FoldedByte {
+    uint8_t byte;
+    bool first; // first byte of the folding of the source code point
+    bool last;
+    int64_t begin;
+    int64_t end;
+};
+
+// Folded bytes of the haystack, produced on demand; the last mask + 1 of them are kept in a ring
+class FoldedStream {
+public:
+    FoldedStream(std::string_view haystack, int64_t from, UTF::Folding folding, FoldedByte* ring, size_t mask)
+        : m_data(haystack.data()), m_s(haystack.data() + from), m_eos(haystack.data() + haystack.size()),
+          m_folding(folding), m_ring(ring), m_mask(mask) {}
+
+    // Folds the haystack up to folded position upto; false if it ends before
+    bool fill(int64_t upto) {
+        while (m_loaded < upto) {
+            if (m_s == m_eos)
+                return false;
+            int64_t begin = m_s - m_data;
+            if (!((uint8_t) *m_s & 0x80)) {
+                push({(uint8_t) UTF::lowerAscii(*m_s++), true, true, begin, begin + 1});
+                continue;
+            }
+            char bytes[3 * UTF::MAXCHARLEN];
+            int n = m_utf.appendFolded(m_utf.codePointAt(m_s, m_eos, &m_s), m_folding, bytes);
+            int64_t end = m_s - m_data;
+            for (int i = 0; i < n; i++)
+                push({(uint8_t) bytes[i], i == 0, i == n - 1, begin, end});
+        }
+        return true;
+    }
+
+    // Continues at folded position pos, source byte source: both past the loaded part
+    // of an ASCII run, where folded and source positions advance together
+    void jump(int64_t pos, const char* source) {
+        m_loaded = pos;
+        m_s = source;
+    }
+
+    int64_t loaded() const { return m_loaded; }
+
+    const FoldedByte& operator[](int64_t pos) const { return m_ring[pos & m_mask]; }
+
+private:
+    void push(const FoldedByte& unit) { m_ring[m_loaded++ & m_mask] = unit; }
+
+    UTF m_utf;
+    const char* m_data;
+    const char* m_s;
+    const char* m_eos;
+    UTF::Folding m_folding;
+    FoldedByte* m_ring;
+    size_t m_mask;
+    int64_t m_loaded = 0;
+};
+
+// Start of the maximal suffix of needle for the byte order (or the reversed one), and its period
+size_t maximalSuffix(const std::string& needle, bool reversed, size_t& period) {
+    const size_t m = needle.size();
+    size_t suffix = 0; // start of the candidate suffix, 1 + the usual "-1" convention
+    size_t j = 1;      // start of the compared factor
+    size_t k = 1;
+    period = 1;
+    while (j + k <= m) {
+        auto a = (uint8_t) needle[j + k - 1];
+        auto b = (uint8_t) needle[suffix + k - 1];
+        if (reversed ? a > b : a < b) {
+            j += k;
+            k = 1;
+            period = j - suffix;
+        } else if (a == b) {
+            if (k != period)
+                k++;
+            else {
+                j += period;
+                k = 1;
+            }
+        } else {
+            suffix = j++;
+            k = period = 1;
+        }
+    }
+    return suffix;
+}
+
+} // namespace
+
+CaselessSearcher::CaselessSearcher(std::string_view needle, ::UTF::Folding folding) : m_folding(folding) {
+    UTF utf;
+    const char* s = needle.data();
+    const char* eos = s + needle.size();
+    m_needle.reserve(needle.size());
+    while (s < eos) {
+        char bytes[3 * UTF::MAXCHARLEN];
+        m_needle.append(bytes, utf.appendFolded(utf.codePointAt(s, eos, &s), folding, bytes));
+    }
+    const size_t m = m_needle.size();
+    if (m == 0)
+        return;
+    // Critical factorization (Crochemore-Perrin): the later of the two maximal suffixes
+    size_t period;
+    size_t periodReversed;
+    size_t suffix = maximalSuffix(m_needle, false, period);
+    size_t suffixReversed = maximalSuffix(m_needle, true, periodReversed);
+    if (suffixReversed >= suffix) {
+        suffix = suffixReversed;
+        period = periodReversed;
+    }
+    m_critical = suffix;
+    if (std::equal(m_needle.begin(), m_needle.begin() + suffix, m_needle.begin() + period)) {
+        m_periodic = true;
+        m_period = period;
+    } else
+        m_period = std::max(suffix, m - suffix) + 1;
+}
+
+int64_t CaselessSearcher::prefilter(const char* source, const char* asciiEnd, int64_t start) const {
+    const size_t m = m_needle.size();
+    const auto first = (uint8_t) m_needle[0];
+    const auto last = (uint8_t) m_needle[m - 1];
+    // source is ASCII up to asciiEnd: alignments source..source + 7 need bytes up to source + m + 6
+    while (asciiEnd - source >= (ptrdiff_t) (m + 7)) {
+        uint64_t head;
+        uint64_t tail;
+        std::memcpy(&head, source, 8);
+        std::memcpy(&tail, source + m - 1, 8);
+        head |= UTF::asciiInRange(head, 'A', 'Z') >> 2;
+        tail |= UTF::asciiInRange(tail, 'A', 'Z') >> 2;
+        if (UTF::equalBytes(head, first) & UTF::equalBytes(tail, last))
+            break;
+        source += 8;
+        start += 8;
+    }
+    return start;
+}
+
+UTF::FoldedMatch CaselessSearcher::find(std::string_view haystack, int64_t from) const {
+    const size_t m = m_needle.size();
+    if (from < 0)
+        from = 0;
+    if (from > (int64_t) haystack.size())
+        return {};
+    if (m == 0)
+        return {from, from};
+    // the stream runs ahead of the alignment by m bytes and the folding of one code point
+    size_t capacity = 64;
+    while (capacity < m + 3 * UTF::MAXCHARLEN)
+        capacity *= 2;
+    FoldedByte local[64];
+    std::vector<FoldedByte> heap;
+    FoldedByte* ring = local;
+    if (capacity > 64) {
+        heap.resize(capacity);
+        ring = heap.data();
+    }
+    FoldedStream text(haystack, from, m_folding, ring, capacity - 1);
+    const auto* needle = (const uint8_t*) m_needle.data();
+    const char* eos = haystack.data() + haystack.size();
+    const char* asciiEnd = nullptr; // bytes from the last checked alignment to here are ASCII
+    int64_t j = 0;                  // alignment in the folded haystack
+    size_t memory = 0;              // prefix of the needle known to match (periodic needles)
+    while (text.fill(j + (int64_t) m)) {
+        const FoldedByte& start = text[j];
+        if (memory == 0 && start.byte < 0x80 && start.end - start.begin == 1) {
+            const char* source = haystack.data() + start.begin;
+            if (source >= asciiEnd)
+                asciiEnd = UTF::skipAscii(source, eos);
+            int64_t next = prefilter(source, asciiEnd, j);
+            if (next != j) {
+                if (next > text.loaded())
+                    text.jump(next, source + (next - j));
+                j = next;
+                continue;
+            }
+        }
+        size_t i = std::max(m_critical, memory);
+        while (i < m && needle[i] == text[j + i].byte)
+            i++;
+        if (i < m) {
+            j += i - m_critical + 1;
+            memory = 0;
+            continue;
+        }
+        i = m_critical;
+        while (i > memory && needle[i - 1] == text[j + i - 1].byte)
+            i--;
+        if (i <= memory) {
+            // a match of the bytes; it must also cover whole code points of the haystack
+            const FoldedByte& end = text[j + m - 1];
+            if (start.first && end.last)
+                return {start.begin, end.end};
+        }
+        j += m_period;
+        memory = m_periodic ? m - m_period : 0;
+    }
+    return {};
+}
+
+std::vector<UTF::FoldedMatch> CaselessSearcher::findAll(std::string_view haystack) const {
+    std::vector<UTF::FoldedMatch> result;
+    if (m_needle.empty())
+        return result;
+    for (UTF::FoldedMatch match = find(haystack); match; match = find(haystack, match.end))
+        result.push_back(match);
+    return result;
+}
+
+UTF::FoldedMatch findCaseless(std::string_view haystack, std::string_view needle, int64_t from) {
+    return CaselessSearcher(needle).find(haystack, from);
+}
+
+} // namespace utf
@@ -0,0 +1,204 @@
+// FuzzyMatcher implementation
+
+#include "utf/FuzzyMatcher.hpp"
+#include <algorithm>
+
+namespace utf {
+
+namespace {
+
+// Code points of a UTF-8 candidate, folded or not
+struct Utf8Source {
+    UTF utf;
+    UTF::FoldCursor cursor;
+    const FuzzyOptions& options;
+
+    Utf8Source(std::string_view text, const FuzzyOptions& options) : cursor(text), options(options) {}
+
+    bool done() const { return cursor.done(); }
+
+    char32_t next() {
+        if (options.fold)
+            return utf.nextFolded(cursor, options.folding);
+        return utf.codePointAt(cursor.s, cursor.eos, &cursor.s);
+    }
+
+    // Bounds of the number of code points left: a code point takes 1-4 bytes
+    // and folds to at most 3 code points (2 per byte)
+    int64_t remainingMin() const {
+        return (cursor.pendingLen - cursor.pendingPos) + (cursor.eos - cursor.s + 3) / 4;
+    }
+
+    int64_t remainingMax() const {
+        return (cursor.pendingLen - cursor.pendingPos) + (cursor.eos - cursor.s) * (options.fold ? 2 : 1);
+    }
+};
+
+struct Utf32Source {
+    const char32_t* s;
+    const char32_t* eos;
+    const FuzzyOptions& options;
+    char32_t pending[3] = {};
+    uint8_t pendingPos = 0;
+    uint8_t pendingLen = 0;
+
+    Utf32Source(std::u32string_view text, const FuzzyOptions& options)
+        : s(text.data()), eos(text.data() + text.size()), options(options) {}
+
+    bool done() const { return s == eos && pendingPos == pendingLen; }
+
+    char32_t next() {
+        if (pendingPos < pendingLen)
+            return pending[pendingPos++];
+        if (!options.fold)
+            return *s++;
+        pendingLen = UTF::foldCodePoint(*s++, options.folding, pending);
+        pendingPos = 1;
+        return pending[0];
+    }
+
+    int64_t remainingMin() const { return (pendingLen - pendingPos) + (eos - s); }
+
+    int64_t remainingMax() const { return (pendingLen - pendingPos) + (eos - s) * (options.fold ? 3 : 1); }
+};
+
+} // namespace
+
+FuzzyMatcher::FuzzyMatcher(std::string_view query, FuzzyOptions options) : m_options(options) {
+    std::u32string cps;
+    for (Utf8Source source(query, m_options); !source.done();)
+        cps.push_back(source.next());
+    build(cps);
+}
+
+FuzzyMatcher::FuzzyMatcher(std::u32string_view query, FuzzyOptions options) : m_options(options) {
+    std::u32string cps;
+    for (Utf32Source source(query, m_options); !source.done();)
+        cps.push_back(source.next());
+    build(cps);
+}
+
+void FuzzyMatcher::build(const std::u32string& query) {
+    m_length = (int64_t) query.size();
+    m_words = (query.size() + 63) / 64;
+    m_ascii.assign(128 * m_words, 0);
+    for (char32_t cp: query)
+        if (cp >= 0x80)
+            m_codePoints.push_back(cp);
+    std::sort(m_codePoints.begin(), m_codePoints.end());
+    m_codePoints.erase(std::unique(m_codePoints.begin(), m_codePoints.end()), m_codePoints.end());
+    m_masks.assign(m_codePoints.size() * m_words, 0);
+    for (size_t i = 0; i < query.size(); i++) {
+        char32_t cp = query[i];
+        size_t index = cp < 0x80 ? cp * m_words
+            : (std::lower_bound(m_codePoints.begin(), m_codePoints.end(), cp) - m_codePoints.begin()) * m_words;
+        (cp < 0x80 ? m_ascii : m_masks)[index + i / 64] |= 1ULL << (i % 64);
+    }
+}
+
+const uint64_t* FuzzyMatcher::masks(char32_t cp) const {
+    if (cp < 0x80)
+        return m_ascii.data() + cp * m_words;
+    auto it = std::lower_bound(m_codePoints.begin(), m_codePoints.end(), cp);
+    if (it == m_codePoints.end() || *it != cp)
+        return nullptr;
+    return m_masks.data() + (it - m_codePoints.begin()) * m_words;
+}
+
+// Hyyrö's formulation of Myers' algorithm: vertical deltas of the DP column in VP/VN,
+// the last row (the distance) tracked through the top bit; words are chained by
+// the horizontal carries. Damerau adds the transposition term TR (Hyyrö 2003)
+template<typename Source>
+int64_t FuzzyMatcher::compute(Source& source, int64_t maxDistance) const {
+    const int64_t m = m_length;
+    const bool limited = maxDistance >= 0;
+    if (limited && (source.remainingMin() - m > maxDistance || m - source.remainingMax() > maxDistance))
+        return maxDistance + 1;
+    if (m == 0) {
+        int64_t n = 0;
+        while (!source.done()) {
+            source.next();
+            if (++n > maxDistance && limited)
+                return maxDistance + 1;
+        }
+        return n;
+    }
+    const size_t words = m_words;
+    const uint64_t last = 1ULL << ((m - 1) % 64);
+    const bool damerau = m_options.damerau;
+    // VP, VN, D0 and previous PM of each word; queries up to 256 code points need no allocation
+    uint64_t local[4 * 4];
+    std::vector<uint64_t> heap;
+    uint64_t* vectors = local;
+    if (words > 4) {
+        heap.resize(4 * words);
+        vectors = heap.data();
+    }
+    uint64_t* vp = vectors;
+    uint64_t* vn = vectors + words;
+    uint64_t* d0 = vectors + 2 * words;
+    uint64_t* pmOld = vectors + 3 * words;
+    std::fill(vp, vp + words, ~0ULL);
+    std::fill(vn, vectors + 4 * words, 0);
+    int64_t dist = m;
+    while (!source.done()) {
+        const uint64_t* pm = masks(source.next());
+        uint64_t hpCarry = 1; // the first row grows by one per column
+        uint64_t hnCarry = 0;
+        uint64_t d0Below = 0; // previous column's D0 and current PM of the word below, for TR
+        uint64_t pmBelow = 0;
+        for (size_t w = 0; w < words; w++) {
+            uint64_t eq = pm ? pm[w] : 0;
+            uint64_t x = eq | hnCarry;
+            uint64_t d = (((x & vp[w]) + vp[w]) ^ vp[w]) | x | vn[w];
+            if (damerau) {
+                d |= ((((~d0[w]) & eq) << 1) | (((~d0Below) & pmBelow) >> 63)) & pmOld[w];
+                d0Below = d0[w];
+                pmBelow = eq;
+                pmOld[w] = eq;
+                d0[w] = d;
+            }
+            uint64_t hp = vn[w] | ~(d | vp[w]);
+            uint64_t hn = d & vp[w];
+            uint64_t top = w + 1 < words ? 1ULL << 63 : last;
+            uint64_t hpOut = (hp & top) != 0;
+            uint64_t hnOut = (hn & top) != 0;
+            hp = (hp << 1) | hpCarry;
+            hn = (hn << 1) | hnCarry;
+            hpCarry = hpOut;
+            hnCarry = hnOut;
+            vp[w] = hn | ~(d | hp);
+            vn[w] = hp & d;
+        }
+        dist += (int64_t) hpCarry - (int64_t) hnCarry;
+        // each remaining column lowers the distance by at most one
+        if (limited && dist - source.remainingMax() > maxDistance)
+            return maxDistance + 1;
+    }
+    return limited && dist > maxDistance ? maxDistance + 1 : dist;
+}
+
+int64_t FuzzyMatcher::distance(std::string_view candidate, int64_t maxDistance) const {
+    Utf8Source source(candidate, m_options);
+    return compute(source, maxDistance);
+}
+
+int64_t FuzzyMatcher::distance(std::u32string_view candidate, int64_t maxDistance) const {
+    Utf32Source source(candidate, m_options);
+    return compute(source, maxDistance);
+}
+
+std::vector<int64_t> FuzzyMatcher::distances(const std::vector<std::string_view>& candidates,
+                                             int64_t maxDistance) const {
+    std::vector<int64_t> result;
+    result.reserve(candidates.size());
+    for (std::string_view candidate: candidates)
+        result.push_back(distance(candidate, maxDistance));
+    return result;
+}
+
+int64_t editDistance(std::string_view a, std::string_view b, FuzzyOptions options) {
+    return FuzzyMatcher(a, options).distance(b);
+}
+
+} // namespace utf
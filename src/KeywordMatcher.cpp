@@ -0,0 +1,178 @@
+// KeywordMatcher implementation
+
+#include "utf/KeywordMatcher.hpp"
+#include <algorithm>
+
+namespace utf {
+
+namespace {
+
+// Trie node used while building the automaton
+struct TrieNode {
+    std::vector<std::pair<uint8_t, uint32_t>> next; // sorted by byte
+    int32_t keyword = -1;
+
+    uint32_t child(uint8_t byte) const {
+        auto it = std::lower_bound(next.begin(), next.end(), std::make_pair(byte, uint32_t(0)));
+        return it != next.end() && it->first == byte ? it->second : 0;
+    }
+};
+
+} // namespace
+
+KeywordMatcher::KeywordMatcher(const std::vector<std::string>& keywords, UTF::Folding folding)
+    : m_folding(folding) {
+    UTF utf;
+    std::vector<TrieNode> trie(1);
+    m_keywordLength.assign(keywords.size(), 0);
+    m_sameKeyword.assign(keywords.size(), -1);
+    uint32_t maxLength = 0;
+    for (size_t k = 0; k < keywords.size(); k++) {
+        std::string_view keyword = keywords[k];
+        const char* s = keyword.data();
+        const char* eos = s + keyword.size();
+        uint32_t node = 0;
+        uint32_t length = 0;
+        while (s < eos) {
+            char bytes[3 * UTF::MAXCHARLEN];
+            int n = utf.appendFolded(utf.codePointAt(s, eos, &s), folding, bytes);
+            for (int i = 0; i < n; i++) {
+                uint8_t byte = (uint8_t) bytes[i];
+                uint32_t child = trie[node].child(byte);
+                if (!child) {
+                    child = (uint32_t) trie.size();
+                    auto& next = trie[node].next;
+                    next.insert(std::lower_bound(next.begin(), next.end(), std::make_pair(byte, uint32_t(0))),
+                                {byte, child});
+                    trie.emplace_back();
+                }
+                node = child;
+            }
+            length += n;
+        }
+        if (!length)
+            continue;
+        m_keywordLength[k] = length;
+        maxLength = std::max(maxLength, length);
+        // keywords with the same folded text share the state: chain them in keyword order
+        int32_t* last = &trie[node].keyword;
+        while (*last >= 0)
+            last = &m_sameKeyword[*last];
+        *last = (int32_t) k;
+    }
+    uint32_t ring = 1;
+    while (ring <= maxLength)
+        ring <<= 1;
+    m_ringMask = ring - 1;
+
+    // Breadth-first numbering, so that shallow states (visited most often) are adjacent
+    std::vector<uint32_t> order{0};
+    std::vector<uint32_t> id(trie.size(), 0);
+    for (size_t i = 0; i < order.size(); i++)
+        for (auto& edge: trie[order[i]].next) {
+            id[edge.second] = (uint32_t) order.size();
+            order.push_back(edge.second);
+        }
+
+    size_t count = order.size();
+    m_fail.assign(count, 0);
+    m_output.assign(count, -1);
+    m_outputLink.assign(count, 0);
+    m_edgeStart.assign(count + 1, 0);
+    std::fill(m_root, m_root + 256, 0);
+    for (auto& edge: trie[0].next)
+        m_root[edge.first] = id[edge.second];
+    for (size_t i = 0; i < count; i++) {
+        const TrieNode& node = trie[order[i]];
+        m_output[i] = node.keyword;
+        m_edgeStart[i] = (uint32_t) m_edgeBytes.size();
+        if (i == 0)
+            continue; // root transitions are dense
+        for (auto& edge: node.next) {
+            m_edgeBytes.push_back(edge.first);
+            m_edgeTargets.push_back(id[edge.second]);
+        }
+    }
+    m_edgeStart[count] = (uint32_t) m_edgeBytes.size();
+
+    // Failure links in breadth-first order: the failure of a child is the transition
+    // of the parent's failure by the same byte (children of the root fail to the root)
+    for (size_t i = 1; i < count; i++)
+        for (uint32_t e = m_edgeStart[i]; e < m_edgeStart[i + 1]; e++) {
+            uint32_t child = m_edgeTargets[e];
+            uint32_t fail = step(m_fail[i], m_edgeBytes[e]);
+            m_fail[child] = fail;
+            m_outputLink[child] = m_output[fail] >= 0 ? fail : m_outputLink[fail];
+        }
+}
+
+uint32_t KeywordMatcher::step(uint32_t state, uint8_t byte) const {
+    while (state) {
+        const uint8_t* first = m_edgeBytes.data() + m_edgeStart[state];
+        const uint8_t* last = m_edgeBytes.data() + m_edgeStart[state + 1];
+        for (const uint8_t* e = first; e < last && *e <= byte; e++)
+            if (*e == byte)
+                return m_edgeTargets[e - m_edgeBytes.data()];
+        state = m_fail[state];
+    }
+    return m_root[byte];
+}
+
+template<typename OnMatch>
+void KeywordMatcher::scan(std::string_view text, OnMatch onMatch) const {
+    UTF utf;
+    // Source offset of each recent folded byte that starts the folding of a code point, -1 inside
+    std::vector<int64_t> starts(m_ringMask + 1, -1);
+    uint64_t folded = 0; // folded bytes so far
+    uint32_t state = 0;
+    const char* data = text.data();
+    const char* s = data;
+    const char* eos = data + text.size();
+    while (s < eos) {
+        const char* next;
+        char bytes[3 * UTF::MAXCHARLEN];
+        int n;
+        if (!((uint8_t) *s & 0x80)) {
+            bytes[0] = UTF::lowerAscii(*s);
+            next = s + 1;
+            n = 1;
+        } else
+            n = utf.appendFolded(utf.codePointAt(s, eos, &next), m_folding, bytes);
+        for (int i = 0; i < n; i++) {
+            starts[folded & m_ringMask] = i == 0 ? s - data : -1;
+            state = step(state, (uint8_t) bytes[i]);
+            folded++;
+        }
+        // matches end with the folding of a whole code point
+        for (uint32_t out = m_output[state] >= 0 ? state : m_outputLink[state]; out; out = m_outputLink[out]) {
+            uint32_t length = m_keywordLength[m_output[out]];
+            int64_t begin = starts[(folded - length) & m_ringMask];
+            if (begin < 0)
+                continue;
+            for (int32_t k = m_output[out]; k >= 0; k = m_sameKeyword[k])
+                if (!onMatch(KeywordMatch{begin, next - data, (size_t) k}))
+                    return;
+        }
+        s = next;
+    }
+}
+
+std::vector<KeywordMatch> KeywordMatcher::findAll(std::string_view text) const {
+    std::vector<KeywordMatch> result;
+    scan(text, [&result](const KeywordMatch& match) {
+        result.push_back(match);
+        return true;
+    });
+    return result;
+}
+
+bool KeywordMatcher::contains(std::string_view text) const {
+    bool found = false;
+    scan(text, [&found](const KeywordMatch&) {
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+} // namespace utf
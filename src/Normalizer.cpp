@@ -0,0 +1,269 @@
+// Normalizer implementation
+
+#include <algorithm>
+
+#include "utf/UTF.hpp"
+#include "utf/Normalizer.hpp"
+
+namespace utf {
+
+using namespace data;
+
+namespace {
+
+// Hangul syllable composition (Unicode 3.12)
+const char32_t S_BASE = 0xAC00;
+const char32_t L_BASE = 0x1100;
+const char32_t V_BASE = 0x1161;
+const char32_t T_BASE = 0x11A7;
+const char32_t L_COUNT = 19;
+const char32_t V_COUNT = 21;
+const char32_t T_COUNT = 28;
+const char32_t N_COUNT = V_COUNT * T_COUNT;
+const char32_t S_COUNT = L_COUNT * N_COUNT;
+
+// Parameters of one normalization form
+struct Form {
+    uint8_t unstable; // NORM_* flags failing the quick check
+    char32_t inert;   // code points below are starters that pass the quick check
+    bool compose;
+    bool compat;      // compatibility decomposition
+};
+
+Form formOf(NormalizationForm form) {
+    switch (form) {
+        case NormalizationForm::NFC:
+            return {NORM_NFC_NO | NORM_NFC_MAYBE, 0x300, true, false};
+        case NormalizationForm::NFD:
+            return {NORM_NFD_NO, 0xC0, false, false};
+        case NormalizationForm::NFKC:
+            return {NORM_NFKC_NO | NORM_NFKC_MAYBE, 0xA0, true, true};
+        default:
+            return {NORM_NFKD_NO, 0xA0, false, true};
+    }
+}
+
+// Decomposition offset << 16 | NORM_* flags << 8 | ccc
+uint32_t normProperty(char32_t cp) {
+    if ((cp >> NORM_SHIFT) >= norm_stage1_size)
+        return 0;
+    const uint32_t mask = (1u << NORM_SHIFT) - 1;
+    return norm_stage2[(norm_stage1[cp >> NORM_SHIFT] << NORM_SHIFT) | (cp & mask)];
+}
+
+uint8_t combiningClass(char32_t cp) {
+    return normProperty(cp) & 0xff;
+}
+
+// Starter that passes the quick check: nothing before it can reorder or compose with what follows
+bool isStable(uint32_t prop, const Form& form) {
+    return (prop & 0xff) == 0 && !((prop >> 8) & form.unstable);
+}
+
+// Next code point; false for an invalid sequence (decoded as U+FFFD)
+bool decode(const char*& s, const char* eos, char32_t& cp) {
+    UTF utf;
+    cp = utf.codePointAt(s, eos, &s);
+    return utf.errors == 0;
+}
+
+bool decode(const char32_t*& s, const char32_t*, char32_t& cp) {
+    cp = *s++;
+    return true;
+}
+
+void encode(std::string& d, char32_t cp) {
+    UTF utf;
+    char buf[UTF::MAXCHARLEN];
+    d.append(buf, utf.appendCodePoint(cp, buf));
+}
+
+void encode(std::u32string& d, char32_t cp) {
+    d.push_back(cp);
+}
+
+// End of the run of code points below limit (SWAR over ASCII in UTF-8)
+const char* skipInert(const char* s, const char* eos, char32_t) {
+    return UTF::skipAscii(s, eos);
+}
+
+const char32_t* skipInert(const char32_t* s, const char32_t* eos, char32_t limit) {
+    while (s < eos && *s < limit)
+        s++;
+    return s;
+}
+
+void decompose(char32_t cp, bool compat, std::u32string& d) {
+    if (cp - S_BASE < S_COUNT) {
+        char32_t index = cp - S_BASE;
+        d.push_back(L_BASE + index / N_COUNT);
+        d.push_back(V_BASE + index % N_COUNT / T_COUNT);
+        if (index % T_COUNT)
+            d.push_back(T_BASE + index % T_COUNT);
+        return;
+    }
+    uint32_t prop = normProperty(cp);
+    const char32_t* decomp = norm_decomp + (prop >> 16);
+    if (compat && ((prop >> 8) & NORM_COMPAT))
+        decomp += *decomp + 1;
+    if (!*decomp) {
+        d.push_back(cp);
+        return;
+    }
+    d.append(decomp + 1, *decomp);
+}
+
+// Canonical ordering: stable sort of each run of non-starters by ccc
+void reorder(std::u32string& s) {
+    for (size_t i = 1; i < s.size(); i++) {
+        char32_t cp = s[i];
+        uint8_t ccc = combiningClass(cp);
+        if (!ccc)
+            continue;
+        size_t j = i;
+        while (j > 0 && combiningClass(s[j - 1]) > ccc) {
+            s[j] = s[j - 1];
+            j--;
+        }
+        s[j] = cp;
+    }
+}
+
+// Primary composite of a pair, 0 if none
+char32_t composePair(char32_t first, char32_t second) {
+    if (first - L_BASE < L_COUNT && second - V_BASE < V_COUNT)
+        return S_BASE + ((first - L_BASE) * V_COUNT + second - V_BASE) * T_COUNT;
+    if (first - S_BASE < S_COUNT && (first - S_BASE) % T_COUNT == 0 && second - T_BASE - 1 < T_COUNT - 1)
+        return first + second - T_BASE;
+    if (!((normProperty(second) >> 8) & NORM_NFC_MAYBE))
+        return 0;
+    const Composition* end = norm_compositions + norm_compositions_size;
+    const Composition* it = std::lower_bound(norm_compositions, end, Composition{first, second, 0},
+        [](const Composition& a, const Composition& b) {
+            return a.first < b.first || (a.first == b.first && a.second < b.second);
+        });
+    return it != end && it->first == first && it->second == second ? it->composite : 0;
+}
+
+// Canonical composition of a decomposed, reordered span
+void compose(std::u32string& s) {
+    if (s.empty())
+        return;
+    size_t starter = 0;
+    bool hasStarter = combiningClass(s[0]) == 0;
+    uint8_t lastCcc = combiningClass(s[0]); // of the last code point kept
+    size_t w = 1;
+    for (size_t i = 1; i < s.size(); i++) {
+        char32_t cp = s[i];
+        uint8_t ccc = combiningClass(cp);
+        // Not blocked: nothing kept since the starter, or only marks of lower class
+        if (hasStarter && (lastCcc < ccc || lastCcc == 0)) {
+            char32_t composite = composePair(s[starter], cp);
+            if (composite) {
+                s[starter] = composite;
+                continue;
+            }
+        }
+        if (!ccc) {
+            starter = w;
+            hasStarter = true;
+        }
+        lastCcc = ccc;
+        s[w++] = cp;
+    }
+    s.resize(w);
+}
+
+// Quick check with span repair: returns true if text is normalized
+// Otherwise, when out is given, it receives the normalized text
+template<typename Char>
+bool normalizeText(const Char* text, const Char* eos, const Form& form, std::basic_string<Char>* out) {
+    const Char* s = text;
+    const Char* flushed = text;  // text before flushed is already in out
+    const Char* boundary = text; // last stable starter
+    uint8_t lastCcc = 0;
+    bool changed = false;
+    std::u32string span;
+    std::basic_string<Char> encoded;
+    while (s < eos) {
+        const Char* run = skipInert(s, eos, form.inert);
+        if (run != s) {
+            boundary = run - 1;
+            lastCcc = 0;
+            s = run;
+            if (s == eos)
+                break;
+        }
+        const Char* next = s;
+        char32_t cp;
+        bool valid = decode(next, eos, cp);
+        uint32_t prop = normProperty(cp);
+        uint8_t ccc = prop & 0xff;
+        if (valid && !(ccc && lastCcc > ccc) && !((prop >> 8) & form.unstable)) {
+            if (!ccc)
+                boundary = s;
+            lastCcc = ccc;
+            s = next;
+            continue;
+        }
+
+        // Quick check failed: normalize from the last stable starter to the next one
+        const Char* end = next;
+        while (end < eos) {
+            const Char* after = end;
+            if (decode(after, eos, cp) && isStable(normProperty(cp), form))
+                break;
+            end = after;
+        }
+        span.clear();
+        for (const Char* p = boundary; p < end;) {
+            decode(p, end, cp);
+            decompose(cp, form.compat, span);
+        }
+        reorder(span);
+        if (form.compose)
+            compose(span);
+        encoded.clear();
+        for (char32_t c : span)
+            encode(encoded, c);
+        if (std::basic_string_view<Char>(boundary, end - boundary) != encoded) {
+            if (!out)
+                return false;
+            out->append(flushed, boundary - flushed);
+            out->append(encoded);
+            flushed = end;
+            changed = true;
+        }
+        s = boundary = end;
+        lastCcc = 0;
+    }
+    if (changed)
+        out->append(flushed, eos - flushed);
+    return !changed;
+}
+
+} // namespace
+
+bool isNormalized(std::string_view text, NormalizationForm form) {
+    return normalizeText<char>(text.data(), text.data() + text.size(), formOf(form), nullptr);
+}
+
+bool isNormalized(std::u32string_view text, NormalizationForm form) {
+    return normalizeText<char32_t>(text.data(), text.data() + text.size(), formOf(form), nullptr);
+}
+
+std::string_view normalize(std::string_view text, NormalizationForm form, std::string& buffer) {
+    buffer.clear();
+    if (normalizeText(text.data(), text.data() + text.size(), formOf(form), &buffer))
+        return text;
+    return buffer;
+}
+
+std::u32string_view normalize(std::u32string_view text, NormalizationForm form, std::u32string& buffer) {
+    buffer.clear();
+    if (normalizeText(text.data(), text.data() + text.size(), formOf(form), &buffer))
+        return text;
+    return buffer;
+}
+
+} // namespace utf
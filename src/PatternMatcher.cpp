@@ -0,0 +1,342 @@
+// PatternMatcher implementation
+
+#include "utf/PatternMatcher.hpp"
+#include <algorithm>
+
+namespace utf {
+
+namespace {
+
+// ranges sorted and disjoint
+bool inRanges(const std::vector<std::pair<char32_t, char32_t>>& ranges, char32_t cp) {
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), cp,
+                               [](char32_t c, const std::pair<char32_t, char32_t>& range) { return c < range.first; });
+    return it != ranges.begin() && cp <= (it - 1)->second;
+}
+
+// Sorts ranges and joins the overlapping or adjacent ones
+void joinRanges(std::vector<std::pair<char32_t, char32_t>>& ranges) {
+    std::sort(ranges.begin(), ranges.end());
+    size_t n = 0;
+    for (const auto& range: ranges) {
+        if (n > 0 && range.first <= ranges[n - 1].second + 1)
+            ranges[n - 1].second = std::max(ranges[n - 1].second, range.second);
+        else
+            ranges[n++] = range;
+    }
+    ranges.resize(n);
+}
+
+// UTF-8 text as it is; code points are stepped as by UTF::findNextUtf8AtHeader,
+// so invalid bytes count as code points too
+struct RawView {
+    std::string_view text;
+    static const int64_t maxUnit = UTF::MAXCHARLEN; // bytes of one code point
+
+    int64_t size() const { return (int64_t) text.size(); }
+
+    bool boundary(int64_t pos) const {
+        if (pos == size() || !UTF::insideU8code(text[pos]))
+            return true;
+        // steps as next() from the last byte before that is not a continuation (within one code point);
+        // after 0xFE or 0xFF a continuation byte is a code point of its own
+        int64_t start = pos;
+        while (start > 0 && pos - start < UTF::MAXCHARLEN && UTF::insideU8code(text[start]))
+            start--;
+        while (start < pos)
+            start = next(start);
+        return start == pos;
+    }
+
+    int64_t next(int64_t pos) const {
+        return UTF::findNextUtf8AtHeader(text.data() + pos, text.data() + text.size()) - text.data();
+    }
+
+    // Code point [pos, end), REPLACEMENT if invalid; whole is false if it is a sequence of several
+    char32_t codePoint(int64_t pos, int64_t end, bool& whole) const {
+        whole = true;
+        if (!((uint8_t) text[pos] & 0x80))
+            return (uint8_t) text[pos];
+        UTF utf;
+        const char* next;
+        return utf.codePointAt(text.data() + pos, text.data() + end, &next);
+    }
+};
+
+// Folded text; a code point of the source may be folded to several
+struct FoldedView {
+    std::string_view text;
+    const uint8_t* marks; // boundaries of source code points
+    static const int64_t maxUnit = 3 * 4;
+
+    int64_t size() const { return (int64_t) text.size(); }
+
+    bool boundary(int64_t pos) const { return marks[pos]; }
+
+    int64_t next(int64_t pos) const {
+        while (!marks[++pos]);
+        return pos;
+    }
+
+    char32_t codePoint(int64_t pos, int64_t end, bool& whole) const {
+        if (!((uint8_t) text[pos] & 0x80)) {
+            whole = end == pos + 1;
+            return (uint8_t) text[pos];
+        }
+        UTF utf;
+        const char* next;
+        char32_t cp = utf.codePointAt(text.data() + pos, text.data() + end, &next);
+        whole = next == text.data() + end;
+        return cp;
+    }
+};
+
+} // namespace
+
+bool PatternMatcher::CharClass::contains(char32_t cp) const {
+    bool in = cp < 0x80 ? ascii[cp >> 6] >> (cp & 63) & 1 : inRanges(ranges, cp);
+    return in != negated;
+}
+
+PatternMatcher::PatternMatcher(std::string_view pattern, PatternOptions options) : m_options(options) {
+    UTF utf;
+    const bool glob = options.syntax == PatternSyntax::Glob;
+    const char32_t escape = glob ? '\\' : options.escape;
+    const char32_t many = glob ? '*' : '%';
+    const char32_t one = glob ? '?' : '_';
+    const std::u32string cps = utf.toUTF32(pattern);
+    const size_t n = cps.size();
+
+    m_segments.emplace_back();
+    std::string literal;
+    auto flushLiteral = [&]() {
+        if (literal.empty())
+            return;
+        Segment& segment = m_segments.back();
+        segment.tokens.push_back({TokenKind::Literal, (uint32_t) m_literals.size()});
+        segment.minBytes += literal.size();
+        m_literals.push_back(literal);
+        literal.clear();
+    };
+    auto addUnit = [&](TokenKind kind, uint32_t index) {
+        flushLiteral();
+        Segment& segment = m_segments.back();
+        segment.tokens.push_back({kind, index});
+        segment.minBytes++;
+        segment.units++;
+    };
+    bool afterMany = false;
+    for (size_t i = 0; i < n; i++) {
+        char32_t cp = cps[i];
+        if (cp == many) {
+            flushLiteral();
+            if (!afterMany)
+                m_segments.emplace_back();
+            afterMany = true;
+            continue;
+        }
+        afterMany = false;
+        if (escape && cp == escape && i + 1 < n)
+            cp = cps[++i];
+        else if (cp == one) {
+            addUnit(TokenKind::One, 0);
+            continue;
+        } else if (glob && cp == '[') {
+            // [!...] or [^...] negates; ] right after [ or the negation is a member
+            CharClass c;
+            std::vector<std::pair<char32_t, char32_t>> members;
+            size_t j = i + 1;
+            if (j < n && (cps[j] == '!' || cps[j] == '^')) {
+                c.negated = true;
+                j++;
+            }
+            bool closed = false;
+            for (bool first = true; j < n; first = false) {
+                char32_t lo = cps[j++];
+                if (lo == ']' && !first) {
+                    closed = true;
+                    break;
+                }
+                if (lo == '\\' && j < n)
+                    lo = cps[j++];
+                char32_t hi = lo;
+                if (j + 1 < n && cps[j] == '-' && cps[j + 1] != ']') {
+                    hi = cps[j + 1];
+                    j += 2;
+                    if (hi == '\\' && j < n)
+                        hi = cps[j++];
+                }
+                if (lo <= hi)
+                    members.push_back({lo, hi});
+            }
+            if (closed) {
+                c.ranges = members;
+                // the text is folded: a code point is in the class if its folding is the folding of a member
+                for (const auto& member: members) {
+                    const char32_t last = std::min(member.second, (char32_t) UTF::MaxCP);
+                    for (char32_t m = member.first; options.fold && m <= last; m++) {
+                        char32_t folded[3];
+                        uint8_t len = UTF::foldCodePoint(m, options.folding, folded);
+                        if (len == 1 && folded[0] != m)
+                            c.ranges.push_back({folded[0], folded[0]});
+                        else if (len > 1) {
+                            char bytes[3 * UTF::MAXCHARLEN];
+                            c.sequences.emplace_back(bytes, utf.appendFolded(m, options.folding, bytes));
+                        }
+                    }
+                }
+                joinRanges(c.ranges);
+                std::sort(c.sequences.begin(), c.sequences.end());
+                c.sequences.erase(std::unique(c.sequences.begin(), c.sequences.end()), c.sequences.end());
+                for (char32_t a = 0; a < 0x80; a++)
+                    if (inRanges(c.ranges, a))
+                        c.ascii[a >> 6] |= 1ULL << (a & 63);
+                m_classes.push_back(std::move(c));
+                addUnit(TokenKind::Class, (uint32_t) m_classes.size() - 1);
+                i = j - 1; // at the closing ]
+                continue;
+            }
+        }
+        char bytes[3 * UTF::MAXCHARLEN];
+        if (options.fold)
+            literal.append(bytes, utf.appendFolded(cp, options.folding, bytes));
+        else
+            literal.append(bytes, utf.appendCodePoint(cp, bytes));
+    }
+    flushLiteral();
+
+    m_matchAll = m_segments.size() > 1;
+    for (const Segment& segment: m_segments) {
+        m_minBytes += segment.minBytes;
+        m_matchAll = m_matchAll && segment.tokens.empty();
+    }
+    for (size_t i = 0; i < m_literals.size(); i++)
+        if (m_required < 0 || m_literals[i].size() > m_literals[m_required].size())
+            m_required = (int32_t) i;
+}
+
+template<typename View>
+int64_t PatternMatcher::matchAt(const Segment& segment, const View& view, int64_t pos) const {
+    const int64_t n = view.size();
+    for (const Token& token: segment.tokens) {
+        if (token.kind == TokenKind::Literal) {
+            const std::string& literal = m_literals[token.index];
+            auto len = (int64_t) literal.size();
+            if (n - pos < len || std::memcmp(view.text.data() + pos, literal.data(), len) != 0
+                || !view.boundary(pos + len))
+                return -1;
+            pos += len;
+            continue;
+        }
+        if (pos >= n)
+            return -1;
+        int64_t end = view.next(pos);
+        if (token.kind == TokenKind::Class) {
+            const CharClass& c = m_classes[token.index];
+            bool whole;
+            char32_t cp = view.codePoint(pos, end, whole);
+            bool in = whole ? c.contains(cp)
+                : std::binary_search(c.sequences.begin(), c.sequences.end(), view.text.substr(pos, end - pos))
+                  != c.negated;
+            if (!in)
+                return -1;
+        }
+        pos = end;
+    }
+    return pos;
+}
+
+template<typename View>
+int64_t PatternMatcher::findSegment(const Segment& segment, const View& view, int64_t pos) const {
+    if (segment.tokens.empty())
+        return pos;
+    if (segment.tokens[0].kind == TokenKind::Literal) {
+        // candidates are the occurrences of the first literal
+        const std::string& literal = m_literals[segment.tokens[0].index];
+        for (size_t found = view.text.find(literal, pos); found != std::string_view::npos;
+             found = view.text.find(literal, found + 1)) {
+            if (!view.boundary((int64_t) found))
+                continue;
+            int64_t end = matchAt(segment, view, (int64_t) found);
+            if (end >= 0)
+                return end;
+        }
+        return -1;
+    }
+    for (; pos + (int64_t) segment.minBytes <= view.size(); pos = view.next(pos)) {
+        int64_t end = matchAt(segment, view, pos);
+        if (end >= 0)
+            return end;
+    }
+    return -1;
+}
+
+template<typename View>
+bool PatternMatcher::matchSuffix(const Segment& segment, const View& view, int64_t pos) const {
+    // the segment takes minBytes plus at most maxUnit - 1 more for each One or Class
+    const int64_t n = view.size();
+    int64_t last = n - (int64_t) segment.minBytes;
+    int64_t first = std::max(pos, last - (int64_t) segment.units * (View::maxUnit - 1));
+    for (int64_t start = last; start >= first; start--)
+        if (view.boundary(start) && matchAt(segment, view, start) == n)
+            return true;
+    return false;
+}
+
+template<typename View>
+bool PatternMatcher::matchView(const View& view) const {
+    const int64_t n = view.size();
+    if ((size_t) n < m_minBytes)
+        return false;
+    if (m_required >= 0 && view.text.find(m_literals[m_required]) == std::string_view::npos)
+        return false;
+    if (m_segments.size() == 1)
+        return matchAt(m_segments[0], view, 0) == n;
+    // % between segments: the leftmost match of each middle segment leaves the most text to the rest
+    int64_t pos = matchAt(m_segments.front(), view, 0);
+    for (size_t i = 1; pos >= 0 && i + 1 < m_segments.size(); i++)
+        pos = findSegment(m_segments[i], view, pos);
+    return pos >= 0 && matchSuffix(m_segments.back(), view, pos);
+}
+
+bool PatternMatcher::matches(std::string_view text) const {
+    Scratch scratch;
+    return matches(text, scratch);
+}
+
+bool PatternMatcher::matches(std::string_view text, Scratch& scratch) const {
+    if (m_matchAll)
+        return true;
+    if (!m_options.fold)
+        return matchView(RawView{text});
+    UTF utf;
+    std::string& folded = scratch.folded;
+    std::vector<uint8_t>& boundary = scratch.boundary;
+    folded.clear();
+    boundary.clear();
+    const char* s = text.data();
+    const char* eos = s + text.size();
+    while (s < eos) {
+        const char* run = UTF::skipAscii(s, eos);
+        if (run != s) {
+            size_t len = folded.size();
+            folded.resize(len + (run - s));
+            UTF::copyAsciiCase(s, run, &folded[len], 'A');
+            boundary.resize(folded.size(), 1);
+            s = run;
+            if (s == eos)
+                break;
+        }
+        char bytes[3 * UTF::MAXCHARLEN];
+        size_t len = folded.size();
+        folded.append(bytes, utf.appendFolded(utf.codePointAt(s, eos, &s), m_options.folding, bytes));
+        if (folded.size() > len) {
+            boundary.push_back(1);
+            boundary.resize(folded.size(), 0);
+        }
+    }
+    boundary.push_back(1);
+    return matchView(FoldedView{folded, boundary.data()});
+}
+
+} // namespace utf
@@ -0,0 +1,248 @@
+// TrigramIndex implementation
+
+#include "utf/TrigramIndex.hpp"
+#include <algorithm>
+#include <cassert>
+
+namespace utf {
+
+namespace {
+
+void appendVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t) value);
+}
+
+uint32_t readVarint(const uint8_t*& p) {
+    uint32_t value = 0;
+    for (int shift = 0;; shift += 7) {
+        uint8_t byte = *p++;
+        value |= (uint32_t) (byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+}
+
+// Posting lists store doc - previous - 1 for increasing documents, previous of the first is -1
+void appendPostings(std::vector<uint8_t>& out, const uint32_t* docs, size_t count, int64_t previous) {
+    for (size_t i = 0; i < count; i++) {
+        appendVarint(out, (uint32_t) (docs[i] - previous - 1));
+        previous = docs[i];
+    }
+}
+
+// Last document of an encoded list, -1 if empty
+int64_t lastPosting(const uint8_t* p, const uint8_t* end) {
+    int64_t doc = -1;
+    while (p < end)
+        doc += readVarint(p) + 1;
+    return doc;
+}
+
+// Sorted intersection, in place
+void intersect(std::vector<uint32_t>& docs, const std::vector<uint32_t>& other) {
+    auto end = std::set_intersection(docs.begin(), docs.end(), other.begin(), other.end(), docs.begin());
+    docs.erase(end, docs.end());
+}
+
+} // namespace
+
+TrigramIndex::TrigramIndex(const std::vector<std::string_view>& documents, ::UTF::Folding folding)
+    : m_folding(folding) {
+    size_t bytes = 0;
+    for (std::string_view document: documents)
+        bytes += document.size();
+    m_documents.data.reserve(bytes);
+    m_documents.offsets.reserve(documents.size() + 1);
+    m_pending.reserve(bytes);
+    for (std::string_view document: documents)
+        add(document);
+    commit();
+}
+
+std::vector<uint64_t> TrigramIndex::trigrams(std::string_view text) const {
+    UTF utf;
+    std::vector<uint64_t> keys;
+    char32_t a = 0;
+    char32_t b = 0;
+    int count = 0;
+    for (UTF::FoldCursor c(text); !c.done(); count++) {
+        char32_t cp;
+        if (!c.hasPending() && !((uint8_t) *c.s & 0x80))
+            cp = UTF::lowerAscii(*c.s++);
+        else
+            cp = utf.nextFolded(c, m_folding);
+        if (count >= 2)
+            keys.push_back(trigramKey(a, b, cp));
+        a = b;
+        b = cp;
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
+uint32_t TrigramIndex::add(std::string_view text) {
+    uint32_t id = (uint32_t) m_documents.size();
+    m_documents.push_back(text);
+    for (uint64_t key: trigrams(text))
+        m_pending.push_back({key, id});
+    return id;
+}
+
+void TrigramIndex::commit() {
+    m_committed = (uint32_t) m_documents.size();
+    if (m_pending.empty())
+        return;
+    std::sort(m_pending.begin(), m_pending.end());
+
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> listStart;
+    std::vector<uint32_t> listSize;
+    std::vector<uint8_t> postings;
+    keys.reserve(m_keys.size() + m_pending.size() / 4);
+    postings.reserve(m_postings.size() + m_pending.size());
+    std::vector<uint32_t> docs;
+    size_t i = 0; // existing key
+    size_t p = 0; // pending pair
+    while (i < m_keys.size() || p < m_pending.size()) {
+        uint64_t key = p == m_pending.size() || (i < m_keys.size() && m_keys[i] <= m_pending[p].first)
+            ? m_keys[i] : m_pending[p].first;
+        keys.push_back(key);
+        listStart.push_back(postings.size());
+        uint32_t size = 0;
+        int64_t last = -1;
+        if (i < m_keys.size() && m_keys[i] == key) {
+            // pending documents are newer: the old list is copied as is and continued
+            const uint8_t* first = m_postings.data() + m_listStart[i];
+            const uint8_t* end = m_postings.data() + m_listStart[i + 1];
+            postings.insert(postings.end(), first, end);
+            size = m_listSize[i];
+            last = lastPosting(first, end);
+            i++;
+        }
+        docs.clear();
+        for (; p < m_pending.size() && m_pending[p].first == key; p++)
+            docs.push_back(m_pending[p].second);
+        appendPostings(postings, docs.data(), docs.size(), last);
+        listSize.push_back(size + (uint32_t) docs.size());
+    }
+    listStart.push_back(postings.size());
+    m_keys.swap(keys);
+    m_listStart.swap(listStart);
+    m_listSize.swap(listSize);
+    m_postings.swap(postings);
+    m_pending.clear();
+    m_pending.shrink_to_fit();
+}
+
+void TrigramIndex::merge(const TrigramIndex& other) {
+    assert(m_folding == other.m_folding && other.m_pending.empty());
+    if (&other == this) {
+        // the loops below read other while appending to this
+        TrigramIndex copy(other);
+        merge(copy);
+        return;
+    }
+    commit();
+    const uint32_t shift = (uint32_t) m_documents.size();
+    m_documents.data.append(other.m_documents.data);
+    for (size_t d = 1; d < other.m_documents.offsets.size(); d++)
+        m_documents.offsets.push_back(m_documents.offsets[shift] + other.m_documents.offsets[d]);
+    m_committed = (uint32_t) m_documents.size();
+
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> listStart;
+    std::vector<uint32_t> listSize;
+    std::vector<uint8_t> postings;
+    keys.reserve(m_keys.size() + other.m_keys.size());
+    postings.reserve(m_postings.size() + other.m_postings.size());
+    size_t i = 0;
+    size_t j = 0;
+    while (i < m_keys.size() || j < other.m_keys.size()) {
+        bool mine = j == other.m_keys.size() || (i < m_keys.size() && m_keys[i] <= other.m_keys[j]);
+        uint64_t key = mine ? m_keys[i] : other.m_keys[j];
+        keys.push_back(key);
+        listStart.push_back(postings.size());
+        uint32_t size = 0;
+        int64_t last = -1;
+        if (mine) {
+            const uint8_t* first = m_postings.data() + m_listStart[i];
+            const uint8_t* end = m_postings.data() + m_listStart[i + 1];
+            postings.insert(postings.end(), first, end);
+            size = m_listSize[i];
+            last = lastPosting(first, end);
+            i++;
+        }
+        if (j < other.m_keys.size() && other.m_keys[j] == key) {
+            // only the first id changes: the gaps after it stay the same
+            const uint8_t* p = other.m_postings.data() + other.m_listStart[j];
+            const uint8_t* end = other.m_postings.data() + other.m_listStart[j + 1];
+            uint32_t firstDoc = readVarint(p) + shift;
+            appendPostings(postings, &firstDoc, 1, last);
+            postings.insert(postings.end(), p, end);
+            size += other.m_listSize[j];
+            j++;
+        }
+        listSize.push_back(size);
+    }
+    listStart.push_back(postings.size());
+    m_keys.swap(keys);
+    m_listStart.swap(listStart);
+    m_listSize.swap(listSize);
+    m_postings.swap(postings);
+}
+
+std::vector<uint32_t> TrigramIndex::postings(size_t index) const {
+    std::vector<uint32_t> docs;
+    docs.reserve(m_listSize[index]);
+    const uint8_t* p = m_postings.data() + m_listStart[index];
+    const uint8_t* end = m_postings.data() + m_listStart[index + 1];
+    int64_t doc = -1;
+    while (p < end) {
+        doc += readVarint(p) + 1;
+        docs.push_back((uint32_t) doc);
+    }
+    return docs;
+}
+
+std::vector<uint32_t> TrigramIndex::candidates(std::string_view needle) const {
+    std::vector<uint64_t> keys = trigrams(needle);
+    std::vector<uint32_t> docs;
+    if (keys.empty()) {
+        docs.resize(m_committed);
+        for (size_t d = 0; d < docs.size(); d++)
+            docs[d] = (uint32_t) d;
+        return docs;
+    }
+    // shortest lists first: the intersection only shrinks
+    std::vector<size_t> lists;
+    for (uint64_t key: keys) {
+        auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+        if (it == m_keys.end() || *it != key)
+            return docs;
+        lists.push_back(it - m_keys.begin());
+    }
+    std::sort(lists.begin(), lists.end(), [this](size_t a, size_t b) { return m_listSize[a] < m_listSize[b]; });
+    docs = postings(lists[0]);
+    for (size_t k = 1; k < lists.size() && !docs.empty(); k++)
+        intersect(docs, postings(lists[k]));
+    return docs;
+}
+
+std::vector<TrigramHit> TrigramIndex::search(std::string_view needle) const {
+    UTF utf;
+    UTF::FoldedNeedle folded = utf.foldNeedle(needle, m_folding);
+    std::vector<TrigramHit> hits;
+    for (uint32_t doc: candidates(needle)) {
+        UTF::FoldedMatch match = utf.findFolded(m_documents[doc], folded, m_folding);
+        if (match)
+            hits.push_back({doc, match});
+    }
+    return hits;
+}
+
+} // namespace utf
@@ -0,0 +1,160 @@
+// WordTokenizer implementation
+
+#include "utf/UTF.hpp"
+#include "utf/WordTokenizer.hpp"
+
+namespace utf {
+
+using namespace data;
+
+namespace {
+
+// Past end of text in lookahead
+const uint8_t WB_EOT = 0xff;
+
+bool isAHLetter(uint8_t wb) {
+    return wb == WB_ALetter || wb == WB_HebrewLetter;
+}
+
+bool isMidLetterQ(uint8_t wb) {
+    return wb == WB_MidLetter || wb == WB_MidNumLet || wb == WB_SingleQuote;
+}
+
+bool isMidNumQ(uint8_t wb) {
+    return wb == WB_MidNum || wb == WB_MidNumLet || wb == WB_SingleQuote;
+}
+
+// WB4: Extend, Format and ZWJ attach to the preceding character
+bool isIgnored(uint8_t wb) {
+    return wb == WB_Extend || wb == WB_Format || wb == WB_ZWJ;
+}
+
+bool isWordLike(uint8_t prop) {
+    uint8_t wb = prop & WORD_BREAK_MASK;
+    return (prop & WORD_ALNUM) || isAHLetter(wb) || wb == WB_Numeric || wb == WB_Katakana;
+}
+
+// Word_Break of the first character at or after s that is not ignored by WB4
+uint8_t lookahead(const char* s, const char* eos) {
+    UTF utf;
+    while (s < eos) {
+        uint8_t wb = UTF::wordProperty(utf.codePointAt(s, eos, &s)) & WORD_BREAK_MASK;
+        if (!isIgnored(wb))
+            return wb;
+    }
+    return WB_EOT;
+}
+
+// Rules WB5-WB999 between last and next (both not ignored)
+bool isWordBreak(uint8_t beforeLast, uint8_t last, uint8_t next, bool riOdd, const char* rest, const char* eos) {
+    if (isAHLetter(last) && isAHLetter(next))
+        return false; // WB5
+    if (isAHLetter(last) && isMidLetterQ(next) && isAHLetter(lookahead(rest, eos)))
+        return false; // WB6
+    if (isAHLetter(beforeLast) && isMidLetterQ(last) && isAHLetter(next))
+        return false; // WB7
+    if (last == WB_HebrewLetter && next == WB_SingleQuote)
+        return false; // WB7a
+    if (last == WB_HebrewLetter && next == WB_DoubleQuote && lookahead(rest, eos) == WB_HebrewLetter)
+        return false; // WB7b
+    if (beforeLast == WB_HebrewLetter && last == WB_DoubleQuote && next == WB_HebrewLetter)
+        return false; // WB7c
+    if ((last == WB_Numeric || isAHLetter(last)) && (next == WB_Numeric || isAHLetter(next)))
+        return false; // WB8, WB9, WB10
+    if (beforeLast == WB_Numeric && isMidNumQ(last) && next == WB_Numeric)
+        return false; // WB11
+    if (last == WB_Numeric && isMidNumQ(next) && lookahead(rest, eos) == WB_Numeric)
+        return false; // WB12
+    if (last == WB_Katakana && next == WB_Katakana)
+        return false; // WB13
+    if ((isAHLetter(last) || last == WB_Numeric || last == WB_Katakana || last == WB_ExtendNumLet)
+        && next == WB_ExtendNumLet)
+        return false; // WB13a
+    if (last == WB_ExtendNumLet && (isAHLetter(next) || next == WB_Numeric || next == WB_Katakana))
+        return false; // WB13b
+    if (last == WB_RegionalIndicator && next == WB_RegionalIndicator && riOdd)
+        return false; // WB15, WB16
+    return true; // WB999
+}
+
+} // namespace
+
+const char* WordTokenizer::nextBoundary(const char* s, const char* eos, int64_t& codePoints, bool& isWord) {
+    UTF utf;
+    const char* next;
+    uint8_t prop = UTF::wordProperty(utf.codePointAt(s, eos, &next));
+    uint8_t raw = prop & WORD_BREAK_MASK; // previous code point
+    uint8_t last = raw;                   // previous code point not ignored by WB4
+    uint8_t beforeLast = WB_Other;        // the one before last
+    bool riOdd = raw == WB_RegionalIndicator;
+    codePoints = 1;
+    isWord = isWordLike(prop);
+    s = next;
+    while (s < eos) {
+        // ASCII letters and digits never break after a letter or digit (WB5, WB8-WB10)
+        if (isAHLetter(last) || last == WB_Numeric) {
+            const char* run = UTF::skipAsciiAlnum(s, eos);
+            if (run != s) {
+                codePoints += run - s;
+                isWord = true;
+                last = raw = run[-1] <= '9' ? WB_Numeric : WB_ALetter;
+                s = run;
+                if (s == eos)
+                    break;
+            }
+        }
+        prop = UTF::wordProperty(utf.codePointAt(s, eos, &next));
+        uint8_t wb = prop & WORD_BREAK_MASK;
+        bool isBreak;
+        if (raw == WB_CR && wb == WB_LF)
+            isBreak = false; // WB3
+        else if (raw == WB_CR || raw == WB_LF || raw == WB_Newline)
+            isBreak = true; // WB3a
+        else if (wb == WB_CR || wb == WB_LF || wb == WB_Newline)
+            isBreak = true; // WB3b
+        else if (raw == WB_ZWJ && (prop & WORD_EXT_PICT))
+            isBreak = false; // WB3c
+        else if (raw == WB_WSegSpace && wb == WB_WSegSpace)
+            isBreak = false; // WB3d
+        else if (isIgnored(wb))
+            isBreak = false; // WB4
+        else
+            isBreak = isWordBreak(beforeLast, last, wb, riOdd, next, eos);
+        if (isBreak)
+            break;
+
+        codePoints++;
+        if (isWordLike(prop))
+            isWord = true;
+        if (!isIgnored(wb)) {
+            riOdd = wb == WB_RegionalIndicator && !(last == WB_RegionalIndicator && riOdd);
+            beforeLast = last;
+            last = wb;
+        }
+        raw = wb;
+        s = next;
+    }
+    m_errors += utf.errors;
+    return s;
+}
+
+bool WordTokenizer::next(WordToken& token) {
+    const char* eos = m_text.data() + m_text.size();
+    while (m_pos < eos) {
+        int64_t codePoints;
+        bool isWord;
+        const char* end = nextBoundary(m_pos, eos, codePoints, isWord);
+        token.text = std::string_view(m_pos, end - m_pos);
+        token.byteOffset = m_pos - m_text.data();
+        token.codePointOffset = m_codePointOffset;
+        token.codePoints = codePoints;
+        token.isWord = isWord;
+        m_codePointOffset += codePoints;
+        m_pos = end;
+        if (isWord || !m_wordsOnly)
+            return true;
+    }
+    return false;
+}
+
+} // namespace utf
@@ -3,7 +3,15 @@
 //
 #include <gtest/gtest.h>
 #include "utf/UTF.hpp"
+#include "utf/CaselessSearcher.hpp"
 #include "utf/Collator.hpp"
+#include "utf/FuzzyMatcher.hpp"
+#include "utf/KeywordMatcher.hpp"
+#include "utf/Normalizer.hpp"
+#include "utf/PatternMatcher.hpp"
+#include "utf/TrigramIndex.hpp"
+#include "utf/WordTokenizer.hpp"
+#include <unordered_map>
 
 bool skipHard = false;
 
@@ -524,6 +532,32 @@ TEST(CaseMapping, UTF8Convenience) {
     EXPECT_EQ(back, lower);
 }
 
+TEST(CaseMapping, UTF8Direct) {
+    UTF utf;
+    EXPECT_EQ(utf.toUpper8("Straße, Mixed ASCII text [@`{] and ŉ"), "STRASSE, MIXED ASCII TEXT [@`{] AND ʼN");
+    EXPECT_EQ(utf.toLower8("ŁÓDŹ 123 \U00010400 ΑΣ"), "łódź 123 \U00010428 ασ");
+    // same result as the UTF-32 round trip, also for invalid sequences
+    std::string text = "Ab\xff Żółw\xc0\xaf \xed\xa0\x80 ß\xe2\x82 end";
+    EXPECT_EQ(utf.toLower8(text), utf.fromUTF32(utf.toLower(utf.toUTF32(text))));
+    EXPECT_EQ(utf.toUpper8(text), utf.fromUTF32(utf.toUpper(utf.toUTF32(text))));
+    EXPECT_GT(utf.errors, 0);
+}
+
+TEST(CaseMapping, Folding) {
+    UTF utf;
+    // final sigma, capital sharp s, Cherokee fold where toLower does not
+    EXPECT_EQ(UTF::foldCaseCodePoint(U'ς'), U'σ');
+    EXPECT_EQ(UTF::foldCaseCodePoint(U'Σ'), U'σ');
+    EXPECT_EQ(UTF::foldCaseCodePoint(U'ẞ'), U'ß');
+    EXPECT_EQ(UTF::foldCaseCodePoint(0xAB70), 0x13A0);
+    EXPECT_EQ(UTF::foldCaseCodePoint(0x13A0), 0x13A0);
+    EXPECT_EQ(utf.foldCase(U"Straße ẞ ﬁ", true), U"strasse ss fi");
+    EXPECT_EQ(utf.foldCase(U"Straße ẞ ﬁ", false), U"straße ß ﬁ");
+    EXPECT_EQ(utf.foldCase8("ΌΣΟΣ όσος"), "όσοσ όσοσ");
+    EXPECT_EQ(utf.foldCase8("MASSE"), utf.foldCase8("Maße"));
+    EXPECT_EQ(utf.foldCase8("Zażółć GĘŚLĄ", false), "zażółć gęślą");
+}
+
 TEST(CaseMapping, NoChange) {
     // Numbers and symbols should not change
     EXPECT_EQ(UTF::toUpperCodePoint(U'0'), U'0');
@@ -561,6 +595,29 @@ TEST(CaseMapping, SpecialCases) {
     EXPECT_EQ(FL, U"FL");
 }
 
+TEST(CaseMapping, PropsMatchSortedTables) {
+    using namespace utf::data;
+    bool same = true;
+    for (char32_t cp = 0; cp <= UTF::MaxCP && same; cp++) {
+        same = UTF::toLowerCodePoint(cp) == UTF::lookupInPairMap(cp, lower_map, lower_map_size)
+               && UTF::toUpperCodePoint(cp) == UTF::lookupInPairMap(cp, upper_map, upper_map_size);
+        const Decomposition *decomp = UTF::findDecomp(cp);
+        char32_t accent = decomp && decomp->combining ? decomp->base : cp;
+        same = same && UTF::foldAccent(cp) == accent
+               && UTF::foldAccentAggressive(cp) == (accent != cp ? accent : UTF::lookupInPairMap(cp, aggressive_fold, aggressive_fold_size));
+        const SpecialCase *upper = std::find_if(special_upper, special_upper + special_upper_size,
+                                                [cp](const SpecialCase &sc) { return sc.from == cp; });
+        same = same && UTF::findSpecialUpper(cp) == (upper == special_upper + special_upper_size ? nullptr : upper);
+        const AggressiveExpand *expand = std::find_if(aggressive_expand, aggressive_expand + aggressive_expand_size,
+                                                      [cp](const AggressiveExpand &ae) { return ae.from == cp; });
+        same = same && UTF::findAggressiveExpand(cp) == (expand == aggressive_expand + aggressive_expand_size ? nullptr : expand);
+    }
+    EXPECT_TRUE(same);
+    EXPECT_EQ(UTF::toLowerCodePoint(0x1E921), 0x1E943); // Adlam, last mapped block
+    EXPECT_EQ(UTF::toUpperCodePoint(0x10FFFF), 0x10FFFF);
+    EXPECT_EQ(UTF::findSpecialFold(U'ß')->len, 2);
+}
+
 // ===== Accent folding tests =====
 
 TEST(AccentFolding, StandardPolish) {
@@ -650,6 +707,20 @@ TEST(AccentFolding, UTF8Convenience) {
     EXPECT_EQ(aggressive, "zazolc gesla jazn"); // ł → l
 }
 
+TEST(AccentFolding, LatinByteTable) {
+    UTF utf;
+    // byte-pair table gives the same result as folding code points
+    for (char32_t cp = 0xC0; cp <= 0x27F; cp++) {
+        std::string s = utf.fromUTF32(std::u32string(1, cp));
+        EXPECT_EQ(utf.foldAccents8(s), utf.fromUTF32(utf.foldAccents(std::u32string(1, cp)))) << (int) cp;
+        EXPECT_EQ(utf.foldAccents8Aggressive(s), utf.fromUTF32(utf.foldAccentsAggressive(std::u32string(1, cp)))) << (int) cp;
+    }
+    EXPECT_EQ(utf.foldAccents8Aggressive("Příliš žluťoučký kůň, Æbleskiver, Straße, Ελλάδα"),
+              "Prilis zlutoucky kun, AEbleskiver, Strasse, Ελλαδα");
+    EXPECT_EQ(utf.foldAccents8("ó\xc3"), "o\xef\xbf\xbd");
+    EXPECT_EQ(utf.errors, 1);
+}
+
 TEST(AccentFolding, NoChange) {
     // ASCII letters should not change
     EXPECT_EQ(UTF::foldAccent(U'a'), U'a');
@@ -752,3 +823,875 @@ TEST(Collation, PolishWords) {
     EXPECT_LT(pl.compare("cena", "ćma"), 0);     // c < ć
     EXPECT_LT(pl.compare("żaba", "żółw"), 0);    // same start, shorter first
 }
+
+// ===== Grapheme cluster tests =====
+
+TEST(Grapheme, ASCII) {
+    UTF utf;
+    EXPECT_EQ(utf.countGraphemes(""), 0);
+    EXPECT_EQ(utf.countGraphemes("hello world, long enough for words"), 34);
+    // CR LF is a single cluster
+    EXPECT_EQ(utf.countGraphemes("a\r\nb\r\n"), 4);
+    EXPECT_EQ(utf.countGraphemes("\r\r\n\n"), 3);
+}
+
+TEST(Grapheme, CombiningMarks) {
+    UTF utf;
+    // a + U+0328 (ogonek) is one cluster, like precomposed ą
+    EXPECT_EQ(utf.countGraphemes("za\xcc\xa8\xcc\x81 \xc4\x85"), 4);
+    EXPECT_EQ(utf.subviewGraphemes8("xa\xcc\xa8y", 1, 1), "a\xcc\xa8");
+    // Hangul jamo L V T form one syllable
+    EXPECT_EQ(utf.countGraphemes("각ᄀ"), 2);
+    // Devanagari conjunct: ka + virama + ssa (GB9c)
+    EXPECT_EQ(utf.countGraphemes("क्ष"), 1);
+}
+
+TEST(Grapheme, Emoji) {
+    UTF utf;
+    // family: man ZWJ woman ZWJ girl
+    std::string family = "\U0001F468‍\U0001F469‍\U0001F467";
+    EXPECT_EQ(utf.countGraphemes(family), 1);
+    EXPECT_EQ(utf.countGraphemes("a" + family + "b"), 3);
+    // thumbs up + skin tone modifier
+    EXPECT_EQ(utf.countGraphemes("\U0001F44D\U0001F3FD"), 1);
+    // flags pair regional indicators: PL DE + lone indicator
+    EXPECT_EQ(utf.countGraphemes("\U0001F1F5\U0001F1F1\U0001F1E9\U0001F1EA\U0001F1F5"), 3);
+}
+
+TEST(Grapheme, Substr) {
+    UTF utf;
+    std::string family = "\U0001F468‍\U0001F469‍\U0001F467";
+    std::string text = "ab" + family + "e\xcc\x81z";
+    EXPECT_EQ(utf.subviewGraphemes8(text, 2, 1), family);
+    EXPECT_EQ(utf.substrGraphemes8(text, 2, 2), family + "e\xcc\x81");
+    EXPECT_EQ(utf.substrGraphemes8(text, -1, 2), "a");
+    EXPECT_EQ(utf.substrGraphemes8(text, 4, 10), "z");
+    EXPECT_EQ(utf.substrGraphemes8(text, 5, 1), "");
+    int64_t actual;
+    const char *end = utf.forwardNgraphemes(text.data(), 3, text.data() + text.size(), actual);
+    EXPECT_EQ(actual, 3);
+    EXPECT_EQ(end - text.data(), 2 + (int64_t) family.size());
+}
+
+TEST(Grapheme, Truncate) {
+    UTF utf;
+    std::string family = "\U0001F468‍\U0001F469‍\U0001F467";
+    std::string text = "ab" + family + "e\xcc\x81z";
+    EXPECT_EQ(utf.truncateGraphemes8(text, 3), "ab" + family);
+    // never drops the combining mark of the last cluster
+    EXPECT_EQ(utf.truncateGraphemes8(text, 4), "ab" + family + "e\xcc\x81");
+    EXPECT_EQ(utf.truncateGraphemes8(text, 9), text);
+    EXPECT_EQ(utf.truncateGraphemes8(text, 0), "");
+    EXPECT_EQ(utf.truncateGraphemes8("abc\r\nd", 4), "abc\r\n");
+}
+
+// ===== Word tokenizer tests =====
+
+static std::vector<std::string> words(std::string_view text, bool wordsOnly = true) {
+    std::vector<std::string> result;
+    utf::WordTokenizer tokenizer(text, wordsOnly);
+    utf::WordToken token;
+    while (tokenizer.next(token))
+        result.emplace_back(token.text);
+    return result;
+}
+
+TEST(WordTokenizer, Basic) {
+    EXPECT_EQ(words("The quick (\"brown\") fox can't jump 32.3 feet, right?"),
+              (std::vector<std::string>{"The", "quick", "brown", "fox", "can't", "jump", "32.3", "feet", "right"}));
+    EXPECT_EQ(words("a, b", false), (std::vector<std::string>{"a", ",", " ", "b"}));
+    EXPECT_TRUE(words("").empty());
+    EXPECT_TRUE(words(" ,;  ").empty());
+}
+
+TEST(WordTokenizer, Unicode) {
+    EXPECT_EQ(words("Zażółć gęślą jaźń"), (std::vector<std::string>{"Zażółć", "gęślą", "jaźń"}));
+    // combining mark stays inside the word
+    EXPECT_EQ(words("cafe\xcc\x81 ok"), (std::vector<std::string>{"cafe\xcc\x81", "ok"}));
+    // ideographs are separate words, katakana runs are kept together
+    EXPECT_EQ(words("東京 カタカナ"), (std::vector<std::string>{"東", "京", "カタカナ"}));
+    // emoji are not words
+    EXPECT_EQ(words("hi \U0001F44D\U0001F3FD there"), (std::vector<std::string>{"hi", "there"}));
+}
+
+TEST(WordTokenizer, Offsets) {
+    std::string text = "Żółw i\r\nkot_7";
+    utf::WordTokenizer tokenizer(text);
+    utf::WordToken token;
+    ASSERT_TRUE(tokenizer.next(token));
+    EXPECT_EQ(token.text, "Żółw");
+    EXPECT_EQ(token.byteOffset, 0);
+    EXPECT_EQ(token.codePointOffset, 0);
+    EXPECT_EQ(token.codePoints, 4);
+    ASSERT_TRUE(tokenizer.next(token));
+    EXPECT_EQ(token.text, "i");
+    EXPECT_EQ(token.byteOffset, 8);
+    EXPECT_EQ(token.codePointOffset, 5);
+    ASSERT_TRUE(tokenizer.next(token));
+    EXPECT_EQ(token.text, "kot_7");
+    EXPECT_EQ(token.byteOffset, 11);
+    EXPECT_EQ(token.codePointOffset, 8);
+    EXPECT_EQ(token.text.data(), text.data() + 11);
+    EXPECT_FALSE(tokenizer.next(token));
+    EXPECT_EQ(tokenizer.errors(), 0);
+}
+
+TEST(WordTokenizer, Normalize) {
+    UTF utf;
+    std::vector<std::string> keys;
+    utf::WordTokenizer tokenizer("Łódź ŻÓŁW");
+    utf::WordToken token;
+    while (tokenizer.next(token))
+        keys.push_back(utf.foldAccents8Aggressive(utf.toLower8(token.text)));
+    EXPECT_EQ(keys, (std::vector<std::string>{"lodz", "zolw"}));
+}
+
+// ===== Display width tests =====
+
+TEST(DisplayWidth, CodePoints) {
+    EXPECT_EQ(UTF::codePointWidth(U'a'), 1);
+    EXPECT_EQ(UTF::codePointWidth(U'ł'), 1);
+    EXPECT_EQ(UTF::codePointWidth(U'中'), 2);
+    EXPECT_EQ(UTF::codePointWidth(U'Ａ'), 2);       // fullwidth
+    EXPECT_EQ(UTF::codePointWidth(0x0301), 0);      // combining acute
+    EXPECT_EQ(UTF::codePointWidth(0x200B), 0);      // zero width space
+    EXPECT_EQ(UTF::codePointWidth(U'\t'), 0);
+    EXPECT_EQ(UTF::codePointWidth(0x1F600), 2);     // emoji
+    EXPECT_EQ(UTF::codePointWidth(U'±'), 1);        // ambiguous
+    EXPECT_EQ(UTF::codePointWidth(U'±', true), 2);
+}
+
+TEST(DisplayWidth, Strings) {
+    UTF utf;
+    EXPECT_EQ(utf.displayWidth(""), 0);
+    EXPECT_EQ(utf.displayWidth("plain ASCII text, one column per byte"), 37);
+    EXPECT_EQ(utf.displayWidth("zażółć"), 6);
+    EXPECT_EQ(utf.displayWidth("e\xcc\x81"), 1);
+    EXPECT_EQ(utf.displayWidth("日本語 text"), 11);
+    EXPECT_EQ(utf.displayWidth("\U0001F468‍\U0001F469‍\U0001F467!"), 3);   // ZWJ family
+    EXPECT_EQ(utf.displayWidth("\U0001F1F5\U0001F1F1"), 2);              // flag
+    EXPECT_EQ(utf.displayWidth("#\xef\xb8\x8f\xe2\x83\xa3"), 2);         // keycap #
+    EXPECT_EQ(utf.displayWidth("각"), 2);
+}
+
+TEST(DisplayWidth, Truncate) {
+    UTF utf;
+    EXPECT_EQ(utf.truncateToWidth("hello world", 5), "hello");
+    EXPECT_EQ(utf.truncateToWidth("hello", 10), "hello");
+    EXPECT_EQ(utf.truncateToWidth("hello", 0), "");
+    // wide character does not fit in the last column
+    EXPECT_EQ(utf.truncateToWidth("ab日本", 3), "ab");
+    EXPECT_EQ(utf.truncateToWidth("ab日本", 4), "ab日");
+    // combining mark stays with its base
+    EXPECT_EQ(utf.truncateToWidth("abe\xcc\x81z", 3), "abe\xcc\x81");
+    EXPECT_EQ(utf.truncateToWidth("x\U0001F468‍\U0001F469‍\U0001F467", 2), "x");
+}
+
+// ===== One-pass truncation tests =====
+
+TEST(Truncate, Units) {
+    UTF utf;
+    std::string text = "zażółć \U0001F600 日本";
+    UTF::Lengths len;
+    // bytes: ż is 2 bytes and is not split
+    EXPECT_EQ(utf.truncate8(text, 3, UTF::LengthUnit::Bytes, &len), "za");
+    EXPECT_EQ(len.bytes, 2);
+    EXPECT_EQ(utf.truncate8(text, 5, UTF::LengthUnit::Bytes, &len), "zaż");
+    EXPECT_EQ(len.codePoints, 3);
+    // UTF-16: emoji takes a surrogate pair
+    EXPECT_EQ(utf.truncate8(text, 8, UTF::LengthUnit::Units16, &len), "zażółć ");
+    EXPECT_EQ(len.units16, 7);
+    EXPECT_EQ(utf.truncate8(text, 9, UTF::LengthUnit::Units16, &len), "zażółć \U0001F600");
+    EXPECT_EQ(len.bytes, 15);
+    EXPECT_EQ(len.codePoints, 8);
+    EXPECT_EQ(len.columns, 9);
+    // code points
+    EXPECT_EQ(utf.truncate8(text, 10, UTF::LengthUnit::CodePoints, &len), "zażółć \U0001F600 日");
+    EXPECT_EQ(len.units16, 11);
+    // columns: wide characters are not split
+    EXPECT_EQ(utf.truncate8(text, 11, UTF::LengthUnit::Columns, &len), "zażółć \U0001F600 ");
+    EXPECT_EQ(len.columns, 10);
+    EXPECT_EQ(utf.truncate8(text, 12, UTF::LengthUnit::Columns, &len), "zażółć \U0001F600 日");
+    EXPECT_EQ(len.bytes, 19);
+}
+
+TEST(Truncate, Whole) {
+    UTF utf;
+    std::string text = "plain ASCII text that fits\twith a tab";
+    UTF::Lengths len;
+    EXPECT_EQ(utf.truncate8(text, 1000, UTF::LengthUnit::Bytes, &len), text);
+    EXPECT_EQ(len.bytes, (int64_t) text.size());
+    EXPECT_EQ(len.units16, (int64_t) text.size());
+    EXPECT_EQ(len.codePoints, (int64_t) text.size());
+    EXPECT_EQ(len.columns, (int64_t) text.size() - 1);
+    EXPECT_EQ(utf.truncate8(text, 5, UTF::LengthUnit::CodePoints), "plain");
+    EXPECT_EQ(utf.truncate8(text, 0, UTF::LengthUnit::Bytes), "");
+    EXPECT_EQ(utf.truncate8("", 3, UTF::LengthUnit::Columns), "");
+}
+
+TEST(Truncate, Clusters) {
+    UTF utf;
+    UTF::Lengths len;
+    // byte budget may stop inside a cluster, but not inside a code point
+    EXPECT_EQ(utf.truncate8("abe\xcc\x81", 4, UTF::LengthUnit::Bytes), "abe");
+    // column budget keeps the combining mark with its base
+    EXPECT_EQ(utf.truncate8("abe\xcc\x81z", 3, UTF::LengthUnit::Columns, &len), "abe\xcc\x81");
+    EXPECT_EQ(len.codePoints, 4);
+    // keycap: # + VS16 becomes 2 columns wide, so it does not fit in 1
+    EXPECT_EQ(utf.truncate8("a#\xef\xb8\x8f\xe2\x83\xa3", 2, UTF::LengthUnit::Columns, &len), "a");
+    EXPECT_EQ(len.columns, 1);
+    EXPECT_EQ(utf.truncate8("a#\xef\xb8\x8f\xe2\x83\xa3", 3, UTF::LengthUnit::Columns, &len), "a#\xef\xb8\x8f\xe2\x83\xa3");
+    EXPECT_EQ(len.columns, 3);
+}
+
+// ===== Caseless comparison tests =====
+
+TEST(Caseless, Equals) {
+    UTF utf;
+    EXPECT_TRUE(utf.equalsIgnoreCase("Straße", "STRASSE"));
+    EXPECT_TRUE(utf.equalsIgnoreCase("ZAŻÓŁĆ gęślą jaźń", "zażółć GĘŚLĄ JAŹŃ"));
+    EXPECT_TRUE(utf.equalsIgnoreCase("K", "k")); // Kelvin sign
+    EXPECT_TRUE(utf.equalsIgnoreCase("", ""));
+    EXPECT_FALSE(utf.equalsIgnoreCase("Łódź", "łodz"));
+    EXPECT_FALSE(utf.equalsIgnoreCase("abc", "abcd"));
+    EXPECT_TRUE(utf.equalsIgnoreAccents("Łódź", "łodz"));
+    EXPECT_TRUE(utf.equalsIgnoreAccents("Crème Brûlée", "CREME BRULEE"));
+    EXPECT_FALSE(utf.equalsIgnoreAccents("Łódź", "lodz")); // ł is a letter, not l with accent
+}
+
+TEST(Caseless, LongPrefixes) {
+    UTF utf;
+    std::string a = "The Quick Brown Fox Jumps Over The Lazy Dog, zażółć ";
+    std::string b = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, ZAŻÓŁĆ ";
+    EXPECT_TRUE(utf.equalsIgnoreCase(a + "x", b + "X"));
+    EXPECT_LT(utf.compareIgnoreCase(a + "a", b + "B"), 0);
+    // equal words ending inside ą vs ć
+    EXPECT_LT(utf.compareIgnoreCase("1234567\xc4\x85", "1234567\xc4\x87"), 0);
+    EXPECT_GT(utf.compareIgnoreCase("1234567\xc4\x87x", "1234567\xc4\x87"), 0);
+    EXPECT_LT(utf.compareIgnoreCase("1234567\xc4\x87", "1234567\xc4"), 0); // invalid is REPLACEMENT
+    EXPECT_LT(utf.compareIgnoreAccents("abcdefgh", "ABCDEFGHI"), 0);
+    EXPECT_EQ(utf.compareIgnoreAccents("ŚĆIEŻKA", "sciezka"), 0);
+}
+
+TEST(Caseless, MatchesFoldedStrings) {
+    UTF utf;
+    std::vector<std::string> words = {"straße", "STRASSE", "strasse", "Straßen", "ǅ", "ǆ", "ﬁ", "FI",
+                                      "Ωmega", "ωMEGA", "Łódź", "łodz", "lodz", "é", "E", "\xff", ""};
+    for (auto &a: words)
+        for (auto &b: words) {
+            int expected = utf.toUTF32(utf.foldCase8(a)).compare(utf.toUTF32(utf.foldCase8(b)));
+            EXPECT_EQ(utf.compareIgnoreCase(a, b) < 0, expected < 0) << a << " " << b;
+            EXPECT_EQ(utf.compareIgnoreCase(a, b) == 0, expected == 0) << a << " " << b;
+        }
+}
+
+TEST(Caseless, Hash) {
+    UTF utf;
+    std::vector<std::pair<std::string, std::string>> equal = {
+        {"Straße", "STRASSE"},
+        {"ﬁle name with a long ASCII tail", "FILE NAME WITH A LONG ascii tail"},
+        {"K", "k"},
+        {"ZAŻÓŁĆ GĘŚLĄ JAŹŃ", "zażółć gęślą jaźń"},
+        {"", ""},
+    };
+    for (auto &[a, b]: equal)
+        EXPECT_EQ(utf.hashFolded(a, UTF::Folding::Case), utf.hashFolded(b, UTF::Folding::Case)) << a;
+    EXPECT_EQ(utf.hashFolded("Crème Brûlée", UTF::Folding::Accents), utf.hashFolded("CREME BRULEE", UTF::Folding::Accents));
+    EXPECT_NE(utf.hashFolded("Crème Brûlée", UTF::Folding::Case), utf.hashFolded("CREME BRULEE", UTF::Folding::Case));
+    EXPECT_NE(utf.hashFolded("abcdefgh", UTF::Folding::Case), utf.hashFolded("abcdefghi", UTF::Folding::Case));
+    EXPECT_NE(utf.hashFolded("ab", UTF::Folding::Case), utf.hashFolded(std::string("ab\0", 3), UTF::Folding::Case));
+
+    std::unordered_map<std::string, int, UTF::AccentlessHash, UTF::AccentlessEqual> cities;
+    cities["Łódź"] = 1;
+    cities["Kraków"] = 2;
+    EXPECT_EQ(cities.count("ŁODZ"), 1);
+    EXPECT_EQ(cities["krakow"], 2);
+    EXPECT_EQ(cities.size(), 2);
+}
+
+// ===== In-place case mapping tests =====
+
+TEST(CaseInPlace, UTF8) {
+    UTF utf;
+    std::string s = "Zażółć Gęślą Jaźń, a long ASCII run 0123456789";
+    const char *data = s.data();
+    utf.toUpperInPlace(s);
+    EXPECT_EQ(s, "ZAŻÓŁĆ GĘŚLĄ JAŹŃ, A LONG ASCII RUN 0123456789");
+    EXPECT_EQ(s.data(), data);
+    utf.toLowerInPlace(s);
+    EXPECT_EQ(s, "zażółć gęślą jaźń, a long ascii run 0123456789");
+    // length changes: ß→SS, ı (2 bytes) → I (1 byte), invalid byte
+    s = "Straße ıi \xff end";
+    utf.toUpperInPlace(s);
+    EXPECT_EQ(s, "STRASSE II \xef\xbf\xbd END");
+    EXPECT_EQ(utf.errors, 1);
+    s = "ȺȾ";  // lowercase is 3 bytes long
+    utf.toLowerInPlace(s);
+    EXPECT_EQ(s, "ⱥⱦ");
+}
+
+TEST(CaseInPlace, UTF16and32) {
+    UTF utf;
+    std::u16string w = u"Zażółć \U00010400 Straße";
+    utf.toLowerInPlace(w);
+    EXPECT_EQ(w, u"zażółć \U00010428 straße");
+    utf.toUpperInPlace(w);
+    EXPECT_EQ(w, u"ZAŻÓŁĆ \U00010400 STRASSE");
+    std::u16string lone = u"a\xd800" u"b";
+    utf.toUpperInPlace(lone);
+    EXPECT_EQ(lone, u"A\xd800" u"B");
+    std::u32string d = U"ǆungla ß";
+    utf.toUpperInPlace(d);
+    EXPECT_EQ(d, U"ǄUNGLA SS");
+    utf.toLowerInPlace(d);
+    EXPECT_EQ(d, U"ǆungla ss");
+}
+
+// ===== Batch case mapping tests =====
+
+TEST(CaseColumn, Offsets) {
+    UTF utf;
+    std::string data = "ZażółćStraßeABC";
+    std::vector<int32_t> offsets = {0, 10, 10, 17, 20};
+    UTF::StringColumn lower = utf.caseMapColumn(data.data(), offsets.data(), 4, UTF::CaseMapping::Lower);
+    ASSERT_EQ(lower.size(), 4);
+    EXPECT_EQ(lower[0], "zażółć");
+    EXPECT_EQ(lower[1], "");
+    EXPECT_EQ(lower[2], "straße");
+    EXPECT_EQ(lower[3], "abc");
+    UTF::StringColumn upper = utf.caseMapColumn(lower, UTF::CaseMapping::Upper);
+    EXPECT_EQ(upper[2], "STRASSE");
+    EXPECT_EQ(upper.offsets, (std::vector<int64_t>{0, 10, 10, 17, 20}));
+    EXPECT_EQ(upper.data, "ZAŻÓŁĆSTRASSEABC");
+}
+
+TEST(CaseColumn, Views) {
+    UTF utf;
+    std::vector<std::string_view> strings = {"Kraków", "\xff", "ŁÓDŹ", ""};
+    UTF::StringColumn folded = utf.caseMapColumn(strings.data(), strings.size(), UTF::CaseMapping::Fold);
+    ASSERT_EQ(folded.size(), 4);
+    EXPECT_EQ(folded[0], "kraków");
+    EXPECT_EQ(folded[1], "\xef\xbf\xbd");
+    EXPECT_EQ(folded[2], "łódź");
+    EXPECT_EQ(folded[3], "");
+    EXPECT_EQ(utf.errors, 1);
+    EXPECT_EQ(utf.caseMapColumn(strings.data(), 0, UTF::CaseMapping::Lower).size(), 0);
+}
+
+// ===== UTF-16 case mapping tests =====
+
+TEST(CaseMapping16, Basic) {
+    UTF utf;
+    EXPECT_EQ(utf.toUpper16(u"zażółć gęślą jaźń"), u"ZAŻÓŁĆ GĘŚLĄ JAŹŃ");
+    EXPECT_EQ(utf.toLower16(u"ZAŻÓŁĆ \U00010400 Ω"), u"zażółć \U00010428 ω");
+    EXPECT_EQ(utf.toUpper16(u"Straße ﬁ"), u"STRASSE FI");
+    EXPECT_EQ(utf.foldCase16(u"ΌΣΟΣ ẞ"), u"όσοσ ss");
+    std::u16string lone = u"a\xdc00Ą\xd800";
+    EXPECT_EQ(utf.toUpper16(lone), u"A\xdc00Ą\xd800");
+}
+
+TEST(CaseMapping16, Accents) {
+    UTF utf;
+    EXPECT_EQ(utf.foldAccents16(u"Zażółć Łódź \U0001D400"), u"Zazołc Łodz \U0001D400");
+    EXPECT_EQ(utf.foldAccents16Aggressive(u"Łódź Straße Æsir"), u"Lodz Strasse AEsir");
+    std::u16string text = u"Crème brûlée, ǖ, \U00010400";
+    EXPECT_EQ(utf.foldAccents16(text), utf.fromUTF32to16(utf.foldAccents(utf.toUTF32(text))));
+}
+
+// ===== Normalization pipeline tests =====
+
+TEST(Normalize, Steps) {
+    UTF utf;
+    using Norm = UTF::Norm;
+    std::string text = "Zażółć Gęślą Jaźń, Straße, Ærøskøbing, Cafe\xcc\x81";
+    EXPECT_EQ(utf.normalize8<Norm::Lower>(text), "zażółć gęślą jaźń, straße, ærøskøbing, cafe\xcc\x81");
+    EXPECT_EQ(utf.normalize8<Norm::FoldCase>(text), "zażółć gęślą jaźń, strasse, ærøskøbing, cafe\xcc\x81");
+    EXPECT_EQ(utf.normalize8<Norm::FoldAccents>(text), "Zazołc Gesla Jazn, Straße, Ærøskøbing, Cafe\xcc\x81");
+    EXPECT_EQ(utf.normalize8<Norm::Lower | Norm::Aggressive | Norm::StripMarks>(text),
+              "zazolc gesla jazn, strasse, aeroskobing, cafe");
+    EXPECT_EQ(utf.normalize8<Norm::StripMarks>(text), "Zażółć Gęślą Jaźń, Straße, Ærøskøbing, Cafe");
+    // İ folds to i + U+0307: the mark the folding makes is stripped as well
+    EXPECT_EQ(utf.normalize8<Norm::FoldCase>("İx"), "i\xcc\x87x");
+    EXPECT_EQ(utf.normalize8<Norm::FoldCase | Norm::StripMarks>("İx"), "ix");
+    EXPECT_EQ(utf.normalize8<Norm::Lower | Norm::StripMarks>("İx"), "ix");
+    EXPECT_EQ(utf.normalize8<0>("a\xff"), "a\xef\xbf\xbd");
+    EXPECT_EQ(utf.errors, 1);
+}
+
+TEST(Normalize, MatchesChain) {
+    UTF utf;
+    using Norm = UTF::Norm;
+    std::vector<std::string> texts = {"Zażółć GĘŚLĄ jaźń", "ǅungla ΌΣΟΣ ﬁ", "Łódź Øresund Þórr", "ẞ İ K Ω", ""};
+    for (auto &text: texts) {
+        EXPECT_EQ(utf.normalize8<Norm::Lower | Norm::FoldAccents>(text), utf.toLower8(utf.foldAccents8(text)));
+        EXPECT_EQ(utf.normalize8<Norm::FoldCase | Norm::Aggressive>(text), utf.foldCase8(utf.foldAccents8Aggressive(text)));
+    }
+}
+
+// ===== Unicode normalization tests =====
+
+TEST(NormalizationForms, Composition) {
+    std::string buffer;
+    // e + COMBINING ACUTE, A + RING ABOVE, ANGSTROM SIGN, Hangul jamo
+    std::string decomposed = "Cafe\xcc\x81 A\xcc\x8a \xe2\x84\xab \xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8";
+    EXPECT_EQ(utf::normalizeNFC(decomposed, buffer), "Café Å Å 각");
+    EXPECT_EQ(utf::normalizeNFD("Café Å 각", buffer),
+              "Cafe\xcc\x81 A\xcc\x8a \xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8");
+    // canonical ordering: dot below (220) before acute (230), then composed
+    EXPECT_EQ(utf::normalizeNFD("e\xcc\x81\xcc\xa3", buffer), "e\xcc\xa3\xcc\x81");
+    EXPECT_EQ(utf::normalizeNFC("e\xcc\x81\xcc\xa3", buffer), "\xe1\xba\xb9\xcc\x81");
+    // composition exclusion: U+0958 stays decomposed
+    EXPECT_EQ(utf::normalizeNFC("\xe0\xa5\x98", buffer), "\xe0\xa4\x95\xe0\xa4\xbc");
+    EXPECT_EQ(utf::normalizeNFC("a\xff", buffer), "a\xef\xbf\xbd");
+}
+
+TEST(NormalizationForms, UnchangedInput) {
+    std::string buffer;
+    std::vector<std::string> texts = {"", "plain ASCII", "Zażółć gęślą jaźń", "x\xcc\x81", "한국어 日本語"};
+    for (auto &text: texts) {
+        EXPECT_TRUE(utf::isNormalized(text, utf::NormalizationForm::NFC)) << text;
+        EXPECT_EQ(utf::normalizeNFC(text, buffer).data(), text.data()) << text;
+    }
+    std::string ascii = "only ascii here";
+    EXPECT_EQ(utf::normalizeNFD(ascii, buffer).data(), ascii.data());
+    EXPECT_FALSE(utf::isNormalized(std::string_view("Zażółć"), utf::NormalizationForm::NFD));
+    EXPECT_FALSE(utf::isNormalized(std::string_view("e\xcc\x81"), utf::NormalizationForm::NFC));
+    EXPECT_FALSE(utf::isNormalized(std::string_view("a\xff"), utf::NormalizationForm::NFC));
+}
+
+TEST(NormalizationForms, UTF32) {
+    std::u32string buffer;
+    std::u32string text = U"Ångström Å ẹ́ 각";
+    EXPECT_EQ(utf::normalizeNFC(text, buffer), U"Ångström Å ẹ́ 각");
+    EXPECT_EQ(utf::normalizeNFD(text, buffer),
+              U"Ångström Å ẹ́ 각");
+    std::u32string composed = U"Ångström";
+    EXPECT_EQ(utf::normalizeNFC(composed, buffer).data(), composed.data());
+    EXPECT_TRUE(utf::isNormalized(std::u32string_view(U"ẹ́"), utf::NormalizationForm::NFD));
+}
+
+TEST(NormalizationForms, Compatibility) {
+    std::string buffer;
+    EXPECT_EQ(utf::normalizeNFKC("\xef\xac\x81le \xef\xbc\xa1\xef\xbc\xa2\xef\xbc\xa3 x\xc2\xb2 \xe2\x91\xa0 \xe2\x84\xab", buffer),
+              "file ABC x2 1 Å");
+    EXPECT_EQ(utf::normalizeNFKD("\xef\xac\x81 \xe2\x84\xab \xc2\xbd", buffer), "fi A\xcc\x8a 1\xe2\x81\x84" "2");
+    // canonical forms keep compatibility characters
+    EXPECT_EQ(utf::normalizeNFC("\xef\xac\x81", buffer), "\xef\xac\x81");
+    EXPECT_FALSE(utf::isNormalized(std::string_view("\xef\xac\x81"), utf::NormalizationForm::NFKC));
+    std::string text = "Zażółć gęślą jaźń";
+    EXPECT_EQ(utf::normalizeNFKC(text, buffer).data(), text.data());
+    std::u32string buffer32;
+    EXPECT_EQ(utf::normalizeNFKC(std::u32string_view(U"ｶﾞ ㈱"), buffer32), U"ガ (株)");
+}
+
+// ===== Folded substring search tests =====
+
+TEST(FoldedSearch, Offsets) {
+    UTF utf;
+    std::string text = "Mój Żółw i ŻÓŁW";
+    UTF::FoldedMatch match = utf.findFolded(text, "zolw", UTF::Folding::Aggressive);
+    ASSERT_TRUE(match);
+    EXPECT_EQ(text.substr(match.begin, match.end - match.begin), "Żółw");
+    EXPECT_FALSE(utf.findFolded(text, "zolw", UTF::Folding::Accents)); // ł is not l with accent
+    EXPECT_TRUE(utf.findFolded(text, "żołw", UTF::Folding::Accents));
+    match = utf.findFolded(text, "żółw", UTF::Folding::Case, match.end);
+    EXPECT_EQ(text.substr(match.begin), "ŻÓŁW");
+    EXPECT_FALSE(utf.findFolded(text, "żółwie", UTF::Folding::Case));
+
+    // matches cover whole code points of the haystack
+    EXPECT_EQ(utf.findFolded("Straße", "SS", UTF::Folding::Case).begin, 4);
+    EXPECT_FALSE(utf.findFolded("Straße", "as", UTF::Folding::Case));
+    EXPECT_EQ(utf.findFolded("Encyclopædia", "AEDIA", UTF::Folding::Aggressive).begin, 8);
+    EXPECT_FALSE(utf.findFolded("abc", "c", UTF::Folding::Case, 4));
+    EXPECT_EQ(utf.findFolded("abc", "A", UTF::Folding::Case, -2).begin, 0);
+}
+
+TEST(FoldedSearch, LongWindow) {
+    UTF utf;
+    // the window is trimmed while the folding of a ß is half consumed
+    std::string text = "a";
+    for (int i = 0; i < 2000; i++)
+        text += "ß";
+    text += "xyz";
+    UTF::FoldedMatch match = utf.findFolded(text, "xyz", UTF::Folding::Case);
+    EXPECT_EQ(match.begin, 4001);
+    EXPECT_EQ(match.end, 4004);
+    match = utf.findFolded(text, "SSXYZ", UTF::Folding::Case);
+    EXPECT_EQ(match.begin, 3999);
+    EXPECT_EQ(match.end, 4004);
+}
+
+TEST(FoldedSearch, All) {
+    UTF utf;
+    std::string text;
+    for (int i = 0; i < 300; i++)
+        text += i % 50 == 7 ? "Łódź " : "lodowisko ";
+    std::vector<UTF::FoldedMatch> matches = utf.findAllFolded(text, "LODZ", UTF::Folding::Aggressive);
+    ASSERT_EQ(matches.size(), 6);
+    for (auto &match: matches)
+        EXPECT_EQ(text.substr(match.begin, match.end - match.begin), "Łódź");
+    EXPECT_EQ(utf.findAllFolded(text, "lodowisko łódź", UTF::Folding::Aggressive).size(), 6);
+    EXPECT_TRUE(utf.findAllFolded(text, "", UTF::Folding::Case).empty());
+}
+
+TEST(FoldedSearch, OffsetMap) {
+    UTF utf;
+    UTF::FoldedText<std::string> folded = utf.foldWithOffsets8("Æsir ß", UTF::Folding::Aggressive);
+    EXPECT_EQ(folded.text, "aesir ss");
+    ASSERT_EQ(folded.runs.size(), 3);
+    EXPECT_EQ(folded.runs[1].folded, 2);
+    EXPECT_TRUE(folded.runs[1].linear);
+    EXPECT_EQ(folded.sourceBegin(1), 0);  // e of Æ
+    EXPECT_EQ(folded.sourceBegin(3), 3);  // i
+    EXPECT_EQ(folded.sourceBegin(7), 6);  // second s of ß
+    EXPECT_EQ(folded.sourceEnd(7), 8);
+    EXPECT_EQ(folded.sourceEnd(8), 8);
+
+    std::string text = "Zażółć GĘŚLĄ jaźń, Straße";
+    folded = utf.foldWithOffsets8(text, UTF::Folding::Aggressive);
+    EXPECT_EQ(folded.text, "zazolc gesla jazn, strasse");
+    UTF::FoldedMatch match = utf.findFolded(folded.text, "gesla", UTF::Folding::Case);
+    EXPECT_EQ(text.substr(folded.sourceBegin(match.begin), folded.sourceEnd(match.end) - folded.sourceBegin(match.begin)),
+              "GĘŚLĄ");
+    EXPECT_EQ(folded.sourceBegin(folded.text.size() - 2), text.size() - 3); // ß -> ss
+
+    UTF::FoldedText<std::u32string> folded32 = utf.foldWithOffsets(U"ǅ ﬁx ß", UTF::Folding::Case);
+    EXPECT_EQ(folded32.text, U"ǆ fix ss");
+    EXPECT_EQ(folded32.sourceBegin(3), 2); // i of ﬁ
+    EXPECT_EQ(folded32.sourceEnd(3), 3);
+    EXPECT_EQ(folded32.sourceBegin(4), 3);
+    EXPECT_EQ(folded32.sourceBegin(7), 5);
+}
+
+// ===== Keyword matcher tests =====
+
+TEST(KeywordMatcher, Matches) {
+    std::vector<std::string> keywords = {"żółw", "he", "she", "hers", "ŁÓDŹ", "Zolw"};
+    utf::KeywordMatcher matcher(keywords, UTF::Folding::Accents);
+    std::string text = "USHERS w Łodzi? ŻÓŁW z łodz";
+    std::vector<std::pair<std::string, size_t>> found;
+    for (auto &match: matcher.findAll(text))
+        found.push_back({text.substr(match.begin, match.end - match.begin), match.keyword});
+    std::vector<std::pair<std::string, size_t>> expected = {
+        {"SHE", 2}, {"HE", 1}, {"HERS", 3}, {"Łodz", 4}, {"ŻÓŁW", 0}, {"łodz", 4}};
+    EXPECT_EQ(found, expected);
+    EXPECT_TRUE(matcher.contains("ushers"));
+    EXPECT_FALSE(matcher.contains("Lodz")); // Ł is not L with accent
+
+    utf::KeywordMatcher aggressive(keywords, UTF::Folding::Aggressive);
+    std::vector<utf::KeywordMatch> matches = aggressive.findAll("ZÓŁW");
+    ASSERT_EQ(matches.size(), 2); // żółw and Zolw fold to the same text
+    EXPECT_EQ(matches[0].keyword, 0);
+    EXPECT_EQ(matches[1].keyword, 5);
+    EXPECT_EQ(matches[1].end, 6);
+}
+
+TEST(KeywordMatcher, WholeCodePoints) {
+    utf::KeywordMatcher matcher({"s", "ss", "ae", "", "ﬁle"}, UTF::Folding::Aggressive);
+    std::string text = "Straße Æ file";
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    for (auto &match: matcher.findAll(text))
+        ranges.push_back({match.begin, match.end});
+    // S of "Straße", ß as ss but not its halves, Æ as ae, "file" as ﬁle
+    std::vector<std::pair<int64_t, int64_t>> expected = {{0, 1}, {4, 6}, {8, 10}, {11, 15}};
+    EXPECT_EQ(ranges, expected);
+    EXPECT_EQ(matcher.keywordCount(), 5);
+    EXPECT_EQ(utf::KeywordMatcher({}, UTF::Folding::Case).findAll(text).size(), 0);
+}
+
+// ===== Fuzzy matching tests =====
+
+TEST(FuzzyMatcher, Distance) {
+    EXPECT_EQ(utf::editDistance("kitten", "sitting"), 3);
+    EXPECT_EQ(utf::editDistance("", "żółw"), 4); // code points, not bytes
+    EXPECT_EQ(utf::editDistance("żółw", "zolw"), 3);
+    EXPECT_EQ(utf::editDistance("ca", "ac"), 2);
+    utf::FuzzyOptions damerau;
+    damerau.damerau = true;
+    EXPECT_EQ(utf::editDistance("ca", "ac", damerau), 1);
+    EXPECT_EQ(utf::editDistance("Łódż", "Łdóż", damerau), 1);
+    utf::FuzzyOptions folded;
+    folded.fold = true;
+    folded.folding = UTF::Folding::Aggressive;
+    EXPECT_EQ(utf::editDistance("ŻÓŁW", "zolw", folded), 0);
+    EXPECT_EQ(utf::editDistance("Straße", "strasse", folded), 0);
+
+    utf::FuzzyMatcher matcher(U"Świętochłowice", folded);
+    EXPECT_EQ(matcher.length(), 14);
+    EXPECT_EQ(matcher.distance(std::u32string_view(U"swietochlowice")), 0);
+    EXPECT_EQ(matcher.distance(std::string_view("swiętohłowce")), 2);
+}
+
+TEST(FuzzyMatcher, LongAndLimited) {
+    UTF utf;
+    std::u32string query;
+    for (int i = 0; i < 30; i++)
+        query += U"zażółć ";
+    std::u32string candidate = query;
+    candidate[100] = U'x';
+    candidate.insert(150, U"ą");
+    candidate.erase(candidate.size() - 2);
+    utf::FuzzyMatcher matcher(query);
+    EXPECT_EQ(matcher.length(), 210);
+    EXPECT_EQ(matcher.distance(std::u32string_view(candidate)), 4);
+    EXPECT_EQ(matcher.distance(utf.fromUTF32(candidate)), 4);
+    EXPECT_EQ(matcher.distance(utf.fromUTF32(candidate), 4), 4);
+    EXPECT_EQ(matcher.distance(utf.fromUTF32(candidate), 2), 3); // maxDistance + 1
+    EXPECT_EQ(matcher.distance(std::string_view("zażółć"), 10), 11);
+
+    utf::FuzzyMatcher word("warszawa");
+    std::vector<std::string_view> candidates = {"Warszawa", "warszawa", "warsaw", "wrszawa", "kraków"};
+    std::vector<int64_t> expected = {1, 0, 2, 1, 3};
+    EXPECT_EQ(word.distances(candidates, 2), expected);
+}
+
+// ===== Trigram index tests =====
+
+TEST(TrigramIndex, Search) {
+    std::vector<std::string_view> documents = {"Zażółć gęślą jaźń", "Pchnąć w tę łódź jeża", "ŁÓDŹ KALISKA",
+                                               "lodowisko"};
+    utf::TrigramIndex index(documents, UTF::Folding::Aggressive);
+    EXPECT_EQ(index.documentCount(), 4u);
+    EXPECT_EQ(index.document(2), "ŁÓDŹ KALISKA");
+
+    std::vector<utf::TrigramHit> hits = index.search("lodz");
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_EQ(hits[0].document, 1u);
+    EXPECT_EQ(hits[0].match.begin, 15);
+    EXPECT_EQ(hits[0].match.end, 22);
+    EXPECT_EQ(hits[1].document, 2u);
+    EXPECT_EQ(hits[1].match.begin, 0);
+    EXPECT_EQ(hits[1].match.end, 7);
+
+    // candidates share every trigram, search verifies the order
+    std::vector<uint32_t> expected = {1, 2, 3};
+    EXPECT_EQ(index.candidates("lod"), expected);
+    EXPECT_TRUE(index.candidates("odl").empty());
+    EXPECT_TRUE(index.search("dzl").empty());
+    // shorter needles have no trigrams: every document is verified
+    EXPECT_EQ(index.candidates("ą").size(), 4u);
+    hits = index.search("ą");
+    ASSERT_EQ(hits.size(), 3u);
+    EXPECT_EQ(hits[2].document, 2u);
+    EXPECT_EQ(hits[2].match.begin, 9);
+}
+
+TEST(TrigramIndex, AddAndMerge) {
+    utf::TrigramIndex index(UTF::Folding::Case);
+    EXPECT_EQ(index.add("Kraków"), 0u);
+    EXPECT_EQ(index.add("krakowiak"), 1u);
+    EXPECT_TRUE(index.search("krak").empty()); // not committed
+    EXPECT_TRUE(index.search("ó").empty());
+    index.commit();
+    EXPECT_EQ(index.search("KRAK").size(), 2u);
+    EXPECT_EQ(index.search("krakow").size(), 1u); // case folding keeps accents
+
+    std::vector<std::string> names;
+    for (int i = 0; i < 300; i++)
+        names.push_back("miasto " + std::to_string(i));
+    std::vector<std::string_view> views(names.begin(), names.end());
+    utf::TrigramIndex other(views, UTF::Folding::Case);
+    EXPECT_EQ(index.add("Miasto Kraków"), 2u);
+    EXPECT_EQ(index.candidates("ó").size(), 2u);
+    index.merge(other);
+    EXPECT_EQ(index.documentCount(), 303u);
+    EXPECT_EQ(index.document(3), "miasto 0");
+
+    std::vector<utf::TrigramHit> hits = index.search("MIASTO");
+    ASSERT_EQ(hits.size(), 301u);
+    EXPECT_EQ(hits[0].document, 2u);
+    EXPECT_EQ(hits[300].document, 302u);
+    hits = index.search("to 299");
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].document, 302u);
+    EXPECT_EQ(hits[0].match.begin, 4);
+    EXPECT_EQ(index.search("kraków").size(), 2u);
+    // ids 3..302 share most trigrams: small gaps take one byte each
+    EXPECT_LT(index.postingBytes(), 4000u);
+
+    index.merge(index);
+    EXPECT_EQ(index.documentCount(), 606u);
+    hits = index.search("to 299");
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_EQ(hits[1].document, 605u);
+    EXPECT_EQ(index.search("ó").size(), 4u);
+}
+
+// ===== Code point search tests =====
+
+TEST(CodePointSearch, Find) {
+    std::string text = "Pchnąć w tę łódź jeża — i ośm skrzyń fig — 😀";
+    EXPECT_EQ(UTF::find(text, U'ł'), 15);
+    EXPECT_EQ(UTF::find(text, U'—'), 29);
+    EXPECT_EQ(UTF::find(text, U'—', 30), 52);
+    EXPECT_EQ(UTF::find(text, U'😀'), 56);
+    EXPECT_EQ(UTF::find(text, U'ę'), 12);
+    EXPECT_EQ(UTF::find(text, U'x'), -1);
+    EXPECT_EQ(UTF::count(text, U'—'), 2);
+    EXPECT_EQ(UTF::count(text, U' '), 11);
+    EXPECT_EQ(UTF::count("\xC5\x82\xC5", U'ł'), 1); // truncated second ł
+
+    UTF utf;
+    std::u16string text16 = utf.toUTF16(text);
+    EXPECT_EQ(UTF::find(text16, U'ł'), 12);
+    EXPECT_EQ(UTF::find(text16, U'😀'), 43);
+    EXPECT_EQ(UTF::count(text16, U'—'), 2);
+    // surrogate pair needles, unpaired surrogates match only themselves
+    std::u16string pairs = u"𝄞a\xD834";
+    EXPECT_EQ(UTF::find(pairs, U'𝄞'), 0);
+    EXPECT_EQ(UTF::find(pairs, 0xD834), 3);
+    EXPECT_EQ(UTF::count(pairs, 0xD834), 1);
+    EXPECT_EQ(UTF::find(pairs, 0xDD1E), -1);
+}
+
+TEST(CodePointSearch, FindAny) {
+    std::string csv = "Łódź;Kraków — Gdańsk,Toruń";
+    UTF::CodePointSet delimiters(U";,—");
+    std::vector<int64_t> found;
+    for (int64_t pos = UTF::findAny(csv, delimiters); pos >= 0; pos = UTF::findAny(csv, delimiters, pos + 1))
+        found.push_back(pos);
+    std::vector<int64_t> expected = {7, 16, 27};
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(UTF::findAny(csv, U"ńx"), 23);
+    EXPECT_EQ(UTF::findAny(csv, U"xyz"), -1);
+    // more than eight lead bytes: scanned without the word filter
+    EXPECT_EQ(UTF::findAny(csv, U"ąćęńśźżó😀—"), 2);
+
+    UTF utf;
+    std::u16string text16 = utf.toUTF16("abc, ab😀c;");
+    EXPECT_EQ(UTF::findAny(text16, U"😀;"), 7);
+    EXPECT_EQ(UTF::findAny(text16, delimiters, 4), 10);
+    EXPECT_EQ(UTF::findAny(u16string_view(u"ab\xDE00"), U"\xDE00"), 2);
+}
+
+// ===== Caseless searcher tests =====
+
+TEST(CaselessSearcher, Find) {
+    utf::CaselessSearcher straße("straße");
+    EXPECT_EQ(straße.folded(), "strasse");
+    UTF::FoldedMatch match = straße.find("Ein STRASSE, eine Straße");
+    EXPECT_EQ(match.begin, 4);
+    EXPECT_EQ(match.end, 11);
+    match = straße.find("Ein STRASSE, eine Straße", 5);
+    EXPECT_EQ(match.begin, 18);
+    EXPECT_EQ(match.end, 25);
+    EXPECT_EQ(straße.findAll("STRAẞE straße strasse").size(), 3u);
+    EXPECT_FALSE(straße.contains("strase"));
+
+    // matches cover whole code points: "s" is not found inside ß
+    EXPECT_FALSE(utf::findCaseless("groß", "gros"));
+    EXPECT_TRUE(utf::findCaseless("GROẞ", "groß"));
+    // Kelvin sign folds to ASCII k
+    match = utf::findCaseless("0 Kelvin", "kelvin");
+    EXPECT_EQ(match.begin, 2);
+    EXPECT_EQ(match.end, 10);
+    EXPECT_EQ(utf::findCaseless("abc", "").begin, 0);
+
+    utf::CaselessSearcher accents("GES", UTF::Folding::Accents);
+    EXPECT_EQ(accents.find("duża gęś").begin, 6);
+}
+
+TEST(CaselessSearcher, Periodic) {
+    // long ASCII runs go through the word prefilter, periodic needles keep the matched prefix
+    std::string text(5000, 'a');
+    text += "AAAAB ";
+    text += std::string(100, 'b');
+    utf::CaselessSearcher periodic(std::string(300, 'a') + "b");
+    UTF::FoldedMatch match = periodic.find(text);
+    EXPECT_EQ(match.begin, 4704);
+    EXPECT_EQ(match.end, 5005);
+    EXPECT_FALSE(periodic.find(text, 4705));
+
+    std::string words;
+    for (int i = 0; i < 1000; i++)
+        words += i % 7 ? "lorem ipsum " : "Zażółć GĘŚLĄ jaźń ";
+    utf::CaselessSearcher needle("zażółć gęślą JAŹŃ");
+    std::vector<UTF::FoldedMatch> all = needle.findAll(words);
+    ASSERT_EQ(all.size(), 143u);
+    EXPECT_EQ(all[1].begin, 27 + 6 * 12);
+    EXPECT_EQ(all[1].end - all[1].begin, 26);
+}
+
+// ===== Pattern matcher tests =====
+
+TEST(PatternMatcher, Like) {
+    utf::PatternMatcher city("_ód_");
+    EXPECT_TRUE(city.matches("Łódź")); // _ is one code point, not one byte
+    EXPECT_FALSE(city.matches("Lodz"));
+    EXPECT_FALSE(city.matches("Łódźka"));
+
+    utf::PatternMatcher street("ul. %ługa%, %ó%");
+    EXPECT_TRUE(street.matches("ul. Długa 12, Kraków"));
+    EXPECT_FALSE(street.matches("ul. Długa 12, Gdańsk"));
+    EXPECT_FALSE(street.matches("al. Długa 12, Kraków"));
+
+    EXPECT_TRUE(utf::PatternMatcher("100\\%").matches("100%"));
+    EXPECT_FALSE(utf::PatternMatcher("100\\%").matches("1000"));
+    utf::PatternOptions bang;
+    bang.escape = '!';
+    EXPECT_TRUE(utf::PatternMatcher("a!_%", bang).matches("a_b"));
+    EXPECT_FALSE(utf::PatternMatcher("a!_%", bang).matches("ab"));
+    EXPECT_TRUE(utf::PatternMatcher("%").matches(""));
+    EXPECT_TRUE(utf::PatternMatcher("").matches(""));
+    EXPECT_FALSE(utf::PatternMatcher("_").matches(""));
+    EXPECT_TRUE(utf::PatternMatcher("a_b").matches("a\xFF" "b")); // an invalid byte is one code point
+    // a continuation byte after 0xFF is one too, whichever side it is matched from
+    EXPECT_TRUE(utf::PatternMatcher("__").matches("\xFF\x80"));
+    EXPECT_TRUE(utf::PatternMatcher("%__").matches("\xFF\x80"));
+    EXPECT_TRUE(utf::PatternMatcher("%_").matches("\xFF\x80"));
+
+    utf::PatternOptions folded;
+    folded.fold = true;
+    EXPECT_TRUE(utf::PatternMatcher("STRASSE%", folded).matches("Straße 5"));
+    EXPECT_TRUE(utf::PatternMatcher("gro_", folded).matches("GROẞ")); // _ is ß, folded to ss
+    EXPECT_FALSE(utf::PatternMatcher("%s", folded).matches("groß")); // s inside ß
+    folded.folding = UTF::Folding::Aggressive;
+    EXPECT_TRUE(utf::PatternMatcher("%LODZ%", folded).matches("Uniwersytet Łódzki"));
+}
+
+TEST(PatternMatcher, GlobAndColumn) {
+    utf::PatternOptions glob;
+    glob.syntax = utf::PatternSyntax::Glob;
+    utf::PatternMatcher report("raport-[0-9][0-9]?.*", glob);
+    EXPECT_TRUE(report.matches("raport-12a.pdf"));
+    EXPECT_TRUE(report.matches("raport-12ą.txt"));
+    EXPECT_FALSE(report.matches("raport-1x.pdf"));
+    EXPECT_FALSE(report.matches("raport-12.pdf"));
+
+    EXPECT_TRUE(utf::PatternMatcher("[ąęó]*", glob).matches("ósemka"));
+    EXPECT_TRUE(utf::PatternMatcher("[!ąęó]*", glob).matches("osiem"));
+    EXPECT_FALSE(utf::PatternMatcher("[!ąęó]*", glob).matches("ósemka"));
+    EXPECT_TRUE(utf::PatternMatcher("[]a]\\*", glob).matches("]*"));
+    EXPECT_TRUE(utf::PatternMatcher("[abc", glob).matches("[abc")); // not a class
+    glob.fold = true;
+    EXPECT_FALSE(utf::PatternMatcher("[A-Z]*", glob).matches("żółw"));
+    EXPECT_TRUE(utf::PatternMatcher("[A-Z]ółw", glob).matches("mółw"));
+    EXPECT_TRUE(utf::PatternMatcher("[Ż]ÓŁW", glob).matches("żółw"));
+    EXPECT_TRUE(utf::PatternMatcher("[ß-ÿ]", glob).matches("ẞ")); // both fold to ss
+    // members match through their foldings: é folds to e like the text does
+    glob.folding = UTF::Folding::Accents;
+    EXPECT_TRUE(utf::PatternMatcher("[à-ÿ]", glob).matches("é"));
+    EXPECT_TRUE(utf::PatternMatcher("[à-ÿ]", glob).matches("É"));
+    EXPECT_FALSE(utf::PatternMatcher("[!à-ÿ]", glob).matches("é"));
+    EXPECT_FALSE(utf::PatternMatcher("[à-ÿ]", glob).matches("ł"));
+
+    std::vector<std::string> rows = {"Zażółć gęślą jaźń", "ZAŻÓŁĆ", "zazolc", "", "Pchnąć w tę łódź"};
+    std::vector<int32_t> offsets = {0};
+    std::string data;
+    for (const std::string& row: rows) {
+        data += row;
+        offsets.push_back((int32_t) data.size());
+    }
+    utf::PatternOptions options;
+    options.fold = true;
+    utf::PatternMatcher prefix("zażółć%", options);
+    std::vector<uint8_t> expected = {1, 1, 0, 0, 0};
+    EXPECT_EQ(prefix.matchColumn(data.data(), offsets.data(), rows.size()), expected);
+    options.folding = UTF::Folding::Aggressive;
+    utf::PatternMatcher loose("za_o%", options);
+    UTF::StringColumn column;
+    for (const std::string& row: rows)
+        column.push_back(row);
+    expected = {1, 1, 1, 0, 0};
+    EXPECT_EQ(loose.matchColumn(column), expected);
+}
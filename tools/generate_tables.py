@@ -21,7 +21,7 @@ OUTPUT_DIR = SCRIPT_DIR.parent / "generated"
 def parse_unicode_data(filepath):
     """
     Parsuje UnicodeData.txt
-    Zwraca słownik: code_point -> {name, category, upper, lower, title, decomp}
+    Zwraca słownik: code_point -> {name, category, ccc, upper, lower, title, decomp}
     """
     data = {}
     with open(filepath, 'r', encoding='utf-8') as f:
@@ -36,6 +36,7 @@ def parse_unicode_data(filepath):
             cp = int(fields[0], 16)
             name = fields[1]
             category = fields[2]
+            ccc = int(fields[3])  # Canonical_Combining_Class
             decomp = fields[5]  # Decomposition mapping
             upper = int(fields[12], 16) if fields[12] else 0
             lower = int(fields[13], 16) if fields[13] else 0
@@ -44,6 +45,7 @@ def parse_unicode_data(filepath):
             data[cp] = {
                 'name': name,
                 'category': category,
+                'ccc': ccc,
                 'upper': upper,
                 'lower': lower,
                 'title': title,
@@ -80,21 +82,302 @@ def parse_special_casing(filepath):
     return special
 
 
-def generate_case_data(unicode_data, special_casing):
+def parse_case_folding(filepath):
     """
-    Generuje plik CaseData.cpp z tablicami case mapping.
+    Parsuje CaseFolding.txt
+    Zwraca (simple, full): simple = {code_point: target} ze statusów C i S,
+    full = {code_point: [targets]} ze statusu F. Status T (turecki) jest pomijany.
     """
-    # Simple case mappings (1:1)
-    upper_map = []
-    lower_map = []
+    simple = {}
+    full = {}
+    with open(filepath, 'r', encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line:
+                continue
+            fields = [f.strip() for f in line.split(';')]
+            cp = int(fields[0], 16)
+            targets = [int(x, 16) for x in fields[2].split()]
+            if fields[1] in ('C', 'S'):
+                simple[cp] = targets[0]
+            elif fields[1] == 'F':
+                full[cp] = targets
+    return simple, full
+
 
+def parse_property_ranges(filepath):
+    """
+    Parsuje pliki właściwości UCD w formacie "XXXX..YYYY ; Wartość [; Wartość] # komentarz"
+    Zwraca listę: [(first, last, [pola])]
+    """
+    ranges = []
+    with open(filepath, 'r', encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line:
+                continue
+            fields = [f.strip() for f in line.split(';')]
+            if '..' in fields[0]:
+                first, last = (int(x, 16) for x in fields[0].split('..'))
+            else:
+                first = last = int(fields[0], 16)
+            ranges.append((first, last, fields[1:]))
+    return ranges
+
+
+def build_two_stage(values, shift):
+    """
+    Buduje dwustopniową tablicę lookup: stage2[stage1[cp >> shift] << shift | (cp & mask)]
+    Identyczne bloki są współdzielone.
+    Zwraca (stage1, stage2)
+    """
+    block_size = 1 << shift
+    stage1 = []
+    stage2 = []
+    blocks = {}
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def emit_array(output, ctype, name, values, per_line=16, fmt="0x{:02X}"):
+    """
+    Dopisuje tablicę liczb do wyjścia C++ (per_line wartości w wierszu)
+    """
+    output.append(f"const {ctype} {name}[] = {{")
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        output.append("    " + ", ".join(fmt.format(v) for v in chunk) + ",")
+    output.append("};")
+
+
+# Grapheme_Cluster_Break values, order must match utf::data::GraphemeBreak
+GRAPHEME_BREAK_VALUES = [
+    'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator',
+    'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT',
+]
+GRAPHEME_EXT_PICT = 0x10
+INCB_VALUES = {'Linker': 0x20, 'Consonant': 0x40, 'Extend': 0x60}
+GRAPHEME_SHIFT = 7
+
+# Word_Break values, order must match utf::data::WordBreak
+WORD_BREAK_VALUES = [
+    'Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator',
+    'Format', 'Katakana', 'Hebrew_Letter', 'ALetter', 'Single_Quote',
+    'Double_Quote', 'MidNumLet', 'MidLetter', 'MidNum', 'Numeric',
+    'ExtendNumLet', 'WSegSpace',
+]
+WORD_EXT_PICT = 0x20
+WORD_ALNUM = 0x40
+WORD_SHIFT = 8
+
+PROPS_SHIFT = 6
+PROPS_MARK = 0x01
+
+# Normalization (UAX #15): bits of norm_stage2 entries above ccc
+NORM_NFD_NO = 0x01
+NORM_NFC_NO = 0x02
+NORM_NFC_MAYBE = 0x04
+NORM_NFKD_NO = 0x08
+NORM_NFKC_NO = 0x10
+NORM_NFKC_MAYBE = 0x20
+NORM_COMPAT = 0x40
+NORM_SHIFT = 6
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+# Lead bytes of 2-byte UTF-8 sequences U+00C0..U+027F in latin_fold8 tables
+LATIN_FOLD_FIRST_LEAD = 0xC3
+LATIN_FOLD_LAST_LEAD = 0xC9
+
+# Aggressive folding (ł->l, ø->o, etc.)
+AGGRESSIVE_FOLD = [
+    (0x0141, 0x004C),  # Ł -> L
+    (0x0142, 0x006C),  # ł -> l
+    (0x00D8, 0x004F),  # Ø -> O
+    (0x00F8, 0x006F),  # ø -> o
+    (0x0110, 0x0044),  # Đ -> D
+    (0x0111, 0x0064),  # đ -> d
+    (0x0126, 0x0048),  # Ħ -> H
+    (0x0127, 0x0068),  # ħ -> h
+    (0x0166, 0x0054),  # Ŧ -> T
+    (0x0167, 0x0074),  # ŧ -> t
+    (0x014A, 0x004E),  # Ŋ -> N
+    (0x014B, 0x006E),  # ŋ -> n
+]
+
+# Aggressive expand (ß->ss, æ->ae, etc.)
+AGGRESSIVE_EXPAND = [
+    (0x00DF, "ss"),   # ß -> ss
+    (0x00E6, "ae"),   # æ -> ae
+    (0x00C6, "AE"),   # Æ -> AE
+    (0x0153, "oe"),   # œ -> oe
+    (0x0152, "OE"),   # Œ -> OE
+    (0x00F0, "d"),    # ð -> d
+    (0x00D0, "D"),    # Ð -> D
+    (0x00FE, "th"),   # þ -> th
+    (0x00DE, "TH"),   # Þ -> TH
+]
+
+
+def general_categories(unicode_data):
+    """
+    Zwraca listę kategorii ogólnych dla wszystkich code pointów (0..10FFFF).
+    Zakresy zapisane w UnicodeData.txt jako <..., First> / <..., Last> są rozwijane.
+    """
+    categories = ['Cn'] * 0x110000
+    first = None
     for cp, info in sorted(unicode_data.items()):
-        if info['upper'] and info['upper'] != cp:
-            upper_map.append((cp, info['upper']))
-        if info['lower'] and info['lower'] != cp:
-            lower_map.append((cp, info['lower']))
+        if info['name'].endswith(', First>'):
+            first = cp
+        elif info['name'].endswith(', Last>') and first is not None:
+            categories[first:cp + 1] = [info['category']] * (cp + 1 - first)
+            first = None
+        else:
+            categories[cp] = info['category']
+    return categories
+
+
+def generate_segmentation_data(grapheme_break, emoji_data, core_properties, word_break, categories):
+    """
+    Generuje plik SegmentationData.cpp z dwustopniowymi tablicami właściwości
+    Grapheme_Cluster_Break (+ Extended_Pictographic i Indic_Conjunct_Break)
+    oraz Word_Break (+ Extended_Pictographic i litery/cyfry bez własnej wartości Word_Break).
+    """
+    values = [0] * 0x110000
+    for first, last, fields in grapheme_break:
+        code = GRAPHEME_BREAK_VALUES.index(fields[0])
+        for cp in range(first, last + 1):
+            values[cp] = code
+    for first, last, fields in emoji_data:
+        if fields[0] == 'Extended_Pictographic':
+            for cp in range(first, last + 1):
+                values[cp] |= GRAPHEME_EXT_PICT
+    for first, last, fields in core_properties:
+        if fields[0] == 'InCB' and len(fields) > 1:
+            for cp in range(first, last + 1):
+                values[cp] = (values[cp] & ~0x60) | INCB_VALUES[fields[1]]
+
+    stage1, stage2 = build_two_stage(values, GRAPHEME_SHIFT)
+    assert len(stage2) >> GRAPHEME_SHIFT <= 256, "grapheme_stage1 must fit in uint8_t"
+
+    word_values = [0] * 0x110000
+    for first, last, fields in word_break:
+        code = WORD_BREAK_VALUES.index(fields[0])
+        for cp in range(first, last + 1):
+            word_values[cp] = code
+    for first, last, fields in emoji_data:
+        if fields[0] == 'Extended_Pictographic':
+            for cp in range(first, last + 1):
+                word_values[cp] |= WORD_EXT_PICT
+    # Ideographs, Hiragana, Thai... have Word_Break=Other, but are still words
+    for cp, category in enumerate(categories):
+        if category[0] in 'LN' and word_values[cp] == 0:
+            word_values[cp] |= WORD_ALNUM
+
+    word_stage1, word_stage2 = build_two_stage(word_values, WORD_SHIFT)
+    assert len(word_stage2) >> WORD_SHIFT <= 256, "word_stage1 must fit in uint8_t"
 
-    # Special case mappings (1:N) - tylko bezwarunkowe
+    output = []
+    output.append("// Auto-generated by generate_tables.py")
+    output.append("// Do not edit manually!")
+    output.append("")
+    output.append('#include "utf/UnicodeData.hpp"')
+    output.append("")
+    output.append("namespace utf::data {")
+    output.append("")
+    output.append("// Grapheme break property: GraphemeBreak in low 4 bits, GRAPHEME_* flags above")
+    output.append(f"// {len(stage1)} block indices, {len(stage2) >> GRAPHEME_SHIFT} distinct blocks of {1 << GRAPHEME_SHIFT}")
+    emit_array(output, "uint8_t", "grapheme_stage1", stage1, fmt="{:d}")
+    output.append("")
+    emit_array(output, "uint8_t", "grapheme_stage2", stage2)
+    output.append("")
+    output.append("// Word break property: WordBreak in low 5 bits, WORD_* flags above")
+    output.append(f"// {len(word_stage1)} block indices, {len(word_stage2) >> WORD_SHIFT} distinct blocks of {1 << WORD_SHIFT}")
+    emit_array(output, "uint8_t", "word_stage1", word_stage1, fmt="{:d}")
+    output.append("")
+    emit_array(output, "uint8_t", "word_stage2", word_stage2)
+    output.append("")
+    output.append("} // namespace utf::data")
+    output.append("")
+
+    return "\n".join(output)
+
+
+def parse_missing_defaults(filepath):
+    """
+    Parsuje linie "# @missing: XXXX..YYYY; Wartość" (wartości domyślne dla nieprzypisanych)
+    Zwraca listę: [(first, last, wartość)]
+    """
+    defaults = []
+    with open(filepath, 'r', encoding='utf-8') as f:
+        for line in f:
+            if not line.startswith('# @missing:'):
+                continue
+            rng, value = (x.strip() for x in line[len('# @missing:'):].split(';')[:2])
+            first, last = (int(x, 16) for x in rng.split('..'))
+            defaults.append((first, last, value))
+    return defaults
+
+
+# Width values stored in width_stage2, must match utf::data::WIDTH_*
+WIDTH_AMBIGUOUS = 3
+WIDTH_SHIFT = 8
+
+
+def generate_width_data(east_asian_width, missing_width, categories, grapheme_break):
+    """
+    Generuje plik WidthData.cpp z dwustopniową tablicą szerokości wyświetlania:
+    0 (znaki łączące, formatujące, sterujące), 1, 2 (East_Asian_Width W/F)
+    lub 3 (East_Asian_Width A: 1 albo 2 zależnie od kontekstu).
+    """
+    widths = [1] * 0x110000
+    for first, last, value in missing_width:
+        widths[first:last + 1] = [2 if value in ('W', 'F') else 1] * (last + 1 - first)
+    for first, last, fields in east_asian_width:
+        value = fields[0]
+        width = 2 if value in ('W', 'F') else WIDTH_AMBIGUOUS if value == 'A' else 1
+        widths[first:last + 1] = [width] * (last + 1 - first)
+    for cp, category in enumerate(categories):
+        if category in ('Mn', 'Me', 'Cf', 'Cc') and cp != 0x00AD:  # soft hyphen is visible
+            widths[cp] = 0
+    # Hangul jamo vowels and trailing consonants join the leading consonant
+    for first, last, fields in grapheme_break:
+        if fields[0] in ('V', 'T'):
+            widths[first:last + 1] = [0] * (last + 1 - first)
+
+    stage1, stage2 = build_two_stage(widths, WIDTH_SHIFT)
+    assert len(stage2) >> WIDTH_SHIFT <= 256, "width_stage1 must fit in uint8_t"
+
+    output = []
+    output.append("// Auto-generated by generate_tables.py")
+    output.append("// Do not edit manually!")
+    output.append("")
+    output.append('#include "utf/UnicodeData.hpp"')
+    output.append("")
+    output.append("namespace utf::data {")
+    output.append("")
+    output.append("// Display width: 0, 1, 2 or WIDTH_AMBIGUOUS")
+    output.append(f"// {len(stage1)} block indices, {len(stage2) >> WIDTH_SHIFT} distinct blocks of {1 << WIDTH_SHIFT}")
+    emit_array(output, "uint8_t", "width_stage1", stage1, fmt="{:d}")
+    output.append("")
+    emit_array(output, "uint8_t", "width_stage2", stage2, per_line=32, fmt="{:d}")
+    output.append("")
+    output.append("} // namespace utf::data")
+    output.append("")
+
+    return "\n".join(output)
+
+
+def special_case_lists(special_casing):
+    """
+    Special case mappings (1:N) - tylko bezwarunkowe
+    Zwraca (special_upper, special_lower): listy [(code_point, targets)] posortowane wg code pointa
+    """
     special_upper = []
     special_lower = []
 
@@ -107,6 +390,24 @@ def generate_case_data(unicode_data, special_casing):
     # Sort for binary search
     special_upper.sort(key=lambda x: x[0])
     special_lower.sort(key=lambda x: x[0])
+    return special_upper, special_lower
+
+
+def generate_case_data(unicode_data, special_casing, case_folding):
+    """
+    Generuje plik CaseData.cpp z tablicami case mapping.
+    """
+    # Simple case mappings (1:1)
+    upper_map = []
+    lower_map = []
+
+    for cp, info in sorted(unicode_data.items()):
+        if info['upper'] and info['upper'] != cp:
+            upper_map.append((cp, info['upper']))
+        if info['lower'] and info['lower'] != cp:
+            lower_map.append((cp, info['lower']))
+
+    special_upper, special_lower = special_case_lists(special_casing)
 
     # Generuj C++
     output = []
@@ -136,6 +437,8 @@ def generate_case_data(unicode_data, special_casing):
     output.append(f"const size_t upper_map_size = {len(upper_map)};")
     output.append("")
 
+    full_fold = case_folding[1]
+
     # Special upper (1:N)
     output.append("// Special toUpper mapping (1:N), e.g., ß -> SS")
     output.append("const SpecialCase special_upper[] = {")
@@ -147,6 +450,17 @@ def generate_case_data(unicode_data, special_casing):
     output.append(f"const size_t special_upper_size = {len(special_upper)};")
     output.append("")
 
+    # Full case folding (1:N), status F
+    output.append("// Full case folding (1:N), e.g., ß -> ss")
+    output.append("const SpecialCase special_fold[] = {")
+    for cp, targets in sorted(full_fold.items()):
+        targets_padded = targets + [0] * (3 - len(targets))
+        targets_str = ", ".join(f"0x{t:04X}" for t in targets_padded)
+        output.append(f"    {{0x{cp:04X}, {{{targets_str}}}, {len(targets)}}},")
+    output.append("};")
+    output.append(f"const size_t special_fold_size = {len(full_fold)};")
+    output.append("")
+
     # Special lower (1:N) - rzadkie, ale dla kompletności
     output.append("const SpecialCase special_lower[] = {")
     for cp, targets in special_lower:
@@ -204,22 +518,7 @@ def generate_decomp_data(unicode_data):
     output.append(f"const size_t decomp_map_size = {len(decomp_map)};")
     output.append("")
 
-    # Aggressive folding (ł->l, ø->o, etc.)
-    aggressive = [
-        (0x0141, 0x004C),  # Ł -> L
-        (0x0142, 0x006C),  # ł -> l
-        (0x00D8, 0x004F),  # Ø -> O
-        (0x00F8, 0x006F),  # ø -> o
-        (0x0110, 0x0044),  # Đ -> D
-        (0x0111, 0x0064),  # đ -> d
-        (0x0126, 0x0048),  # Ħ -> H
-        (0x0127, 0x0068),  # ħ -> h
-        (0x0166, 0x0054),  # Ŧ -> T
-        (0x0167, 0x0074),  # ŧ -> t
-        (0x014A, 0x004E),  # Ŋ -> N
-        (0x014B, 0x006E),  # ŋ -> n
-    ]
-    aggressive.sort(key=lambda x: x[0])  # Sort for binary search
+    aggressive = sorted(AGGRESSIVE_FOLD)  # Sort for binary search
 
     output.append("// Aggressive folding for search (letters without canonical decomposition)")
     output.append("const std::pair<char32_t, char32_t> aggressive_fold[] = {")
@@ -229,19 +528,7 @@ def generate_decomp_data(unicode_data):
     output.append(f"const size_t aggressive_fold_size = {len(aggressive)};")
     output.append("")
 
-    # Aggressive expand (ß->ss, æ->ae, etc.)
-    aggressive_expand = [
-        (0x00DF, "ss"),   # ß -> ss
-        (0x00E6, "ae"),   # æ -> ae
-        (0x00C6, "AE"),   # Æ -> AE
-        (0x0153, "oe"),   # œ -> oe
-        (0x0152, "OE"),   # Œ -> OE
-        (0x00F0, "d"),    # ð -> d
-        (0x00D0, "D"),    # Ð -> D
-        (0x00FE, "th"),   # þ -> th
-        (0x00DE, "TH"),   # Þ -> TH
-    ]
-    aggressive_expand.sort(key=lambda x: x[0])  # Sort for binary search
+    aggressive_expand = sorted(AGGRESSIVE_EXPAND)  # Sort for binary search
 
     output.append("// Aggressive expand for search (1:N mappings)")
     output.append("const AggressiveExpand aggressive_expand[] = {")
@@ -251,6 +538,234 @@ def generate_decomp_data(unicode_data):
     output.append(f"const size_t aggressive_expand_size = {len(aggressive_expand)};")
     output.append("")
 
+    # Byte-pair tables for 2-byte UTF-8 Latin letters
+    bases = accent_bases(unicode_data)
+    aggressive_fold = dict(AGGRESSIVE_FOLD)
+    expand = dict(AGGRESSIVE_EXPAND)
+    for name, aggressive_mode in (("latin_fold8", False), ("latin_fold8_aggressive", True)):
+        entries = []
+        for lead in range(LATIN_FOLD_FIRST_LEAD, LATIN_FOLD_LAST_LEAD + 1):
+            for trail in range(0x80, 0xC0):
+                cp = ((lead & 0x1F) << 6) | (trail & 0x3F)
+                if aggressive_mode and cp in expand:
+                    folded = expand[cp].encode('ascii')
+                else:
+                    target = bases.get(cp, cp)
+                    if aggressive_mode and target == cp:
+                        target = aggressive_fold.get(cp, cp)
+                    folded = chr(target).encode('utf-8')
+                assert len(folded) <= 2
+                entries.append((len(folded), folded[0], folded[1] if len(folded) > 1 else 0))
+        kind = "foldAccents8Aggressive" if aggressive_mode else "foldAccents8"
+        output.append(f"// {kind} of U+{(LATIN_FOLD_FIRST_LEAD & 0x1F) << 6:04X}..U+{((LATIN_FOLD_LAST_LEAD & 0x1F) << 6) | 0x3F:04X}"
+                      " by lead and trail byte: {length, byte, byte}")
+        output.append(f"const uint8_t {name}[][3] = {{")
+        for i in range(0, len(entries), 8):
+            output.append("    " + " ".join(f"{{{n}, 0x{a:02X}, 0x{b:02X}}}," for n, a, b in entries[i:i + 8]))
+        output.append("};")
+        output.append("")
+
+    output.append("} // namespace utf::data")
+    output.append("")
+
+    return "\n".join(output)
+
+
+def accent_bases(unicode_data):
+    """
+    Zwraca {code_point: base} dla kanonicznych dekompozycji ze znakiem łączącym
+    (to samo co foldAccent: ą->a, ale ł zostaje)
+    """
+    bases = {}
+    for cp, info in unicode_data.items():
+        decomp = info['decomp']
+        if decomp and not decomp.startswith('<'):
+            parts = decomp.split()
+            if len(parts) > 1:
+                bases[cp] = int(parts[0], 16)
+    return bases
+
+
+def generate_props_data(unicode_data, special_casing, case_folding, categories):
+    """
+    Generuje plik PropsData.cpp: jeden rekord CharProps na code point
+    (delty case mappingu i foldingu, indeksy mapowań 1:N, baza dekompozycji),
+    w dwustopniowej tablicy - każda kombinacja transformacji to jeden lookup.
+    """
+    simple_fold, full_fold = case_folding
+    special_upper = [cp for cp, targets in special_case_lists(special_casing)[0]]
+    special_fold = sorted(full_fold)
+    expand = [cp for cp, to in sorted(AGGRESSIVE_EXPAND)]
+    aggressive = dict(AGGRESSIVE_FOLD)
+    bases = accent_bases(unicode_data)
+    for table in (special_upper, special_fold, expand):
+        assert len(table) < 256, "special indices must fit in uint8_t"
+
+    marks = {cp for cp, category in enumerate(categories) if category in ('Mn', 'Me')}
+
+    empty = (0, 0, 0, 0, 0, 0, 0, 0, 0)
+    record_index = {empty: 0}
+    records = [0] * 0x110000
+    for cp in set(unicode_data) | set(simple_fold) | set(full_fold) | marks:
+        info = unicode_data.get(cp, {'lower': None, 'upper': None})
+        lower = info['lower'] - cp if info['lower'] else 0
+        upper = info['upper'] - cp if info['upper'] else 0
+        fold = simple_fold[cp] - cp if cp in simple_fold else 0
+        accent = bases[cp] - cp if cp in bases else 0
+        aggressive_delta = accent or (aggressive[cp] - cp if cp in aggressive else 0)
+        record = (lower, upper, fold, accent, aggressive_delta,
+                  special_upper.index(cp) + 1 if cp in special_upper else 0,
+                  special_fold.index(cp) + 1 if cp in special_fold else 0,
+                  expand.index(cp) + 1 if cp in expand else 0,
+                  PROPS_MARK if cp in marks else 0)
+        if record != empty:
+            records[cp] = record_index.setdefault(record, len(record_index))
+    assert len(record_index) <= 0x10000, "props_stage2 entries must fit in uint16_t"
+    last_block = max(cp for cp, index in enumerate(records) if index) >> PROPS_SHIFT
+    stage1, stage2 = build_two_stage(records[:(last_block + 1) << PROPS_SHIFT], PROPS_SHIFT)
+    assert len(stage2) >> PROPS_SHIFT <= 256, "props_stage1 must fit in uint8_t"
+
+    output = []
+    output.append("// Auto-generated by generate_tables.py")
+    output.append("// Do not edit manually!")
+    output.append("")
+    output.append('#include "utf/UnicodeData.hpp"')
+    output.append("")
+    output.append("namespace utf::data {")
+    output.append("")
+    output.append("// Distinct records: {lower, upper, fold, accent, aggressive, specialUpper, specialFold, expand, flags}")
+    output.append("const CharProps char_props[] = {")
+    for record, index in sorted(record_index.items(), key=lambda x: x[1]):
+        output.append("    {" + ", ".join(str(v) for v in record) + "},")
+    output.append("};")
+    output.append("")
+    output.append(f"// {len(stage1)} block indices, {len(stage2) >> PROPS_SHIFT} distinct blocks of {1 << PROPS_SHIFT}")
+    emit_array(output, "uint8_t", "props_stage1", stage1, fmt="{:d}")
+    output.append(f"const size_t props_stage1_size = {len(stage1)};")
+    output.append("")
+    emit_array(output, "uint16_t", "props_stage2", stage2, per_line=16, fmt="{:d}")
+    output.append("")
+    output.append("} // namespace utf::data")
+    output.append("")
+
+    return "\n".join(output)
+
+
+def canonical_decompositions(unicode_data):
+    """
+    Zwraca {code_point: [code_points]} - pełne (rekurencyjne) dekompozycje kanoniczne,
+    bez sylab Hangul (dekomponowanych algorytmicznie)
+    """
+    single = {}
+    for cp, info in unicode_data.items():
+        decomp = info['decomp']
+        if decomp and not decomp.startswith('<'):
+            single[cp] = [int(x, 16) for x in decomp.split()]
+
+    def expand(cp):
+        if cp not in single:
+            return [cp]
+        return [x for part in single[cp] for x in expand(part)]
+
+    return {cp: expand(cp) for cp in single}, single
+
+
+def compatibility_decompositions(unicode_data):
+    """
+    Zwraca {code_point: [code_points]} - pełne dekompozycje kompatybilnościowe
+    tylko tam, gdzie różnią się od kanonicznych (ﬁ -> fi, ① -> 1, Ａ -> A)
+    """
+    canonical, _ = canonical_decompositions(unicode_data)
+    single = {}
+    for cp, info in unicode_data.items():
+        decomp = info['decomp']
+        if decomp:
+            single[cp] = [int(x, 16) for x in decomp.split() if not x.startswith('<')]
+
+    def expand(cp):
+        if cp not in single:
+            return [cp]
+        return [x for part in single[cp] for x in expand(part)]
+
+    return {cp: expand(cp) for cp in single if expand(cp) != canonical.get(cp, [cp])}
+
+
+def generate_norm_data(unicode_data, normalization_props):
+    """
+    Generuje plik NormData.cpp: ccc, flagi quick check (NFC_QC, NFD_QC, NFKC_QC, NFKD_QC)
+    i offset dekompozycji spakowane w jednym uint32_t na code point (dwustopniowa tablica - dwa odczyty),
+    pełne dekompozycje kanoniczne i kompatybilnościowe oraz pary kompozycji (bez Full_Composition_Exclusion).
+    """
+    full, single = canonical_decompositions(unicode_data)
+    compat = compatibility_decompositions(unicode_data)
+    exclusions = set()
+    flags = {}
+    flag_bits = {('NFD_QC', 'N'): NORM_NFD_NO, ('NFC_QC', 'N'): NORM_NFC_NO, ('NFC_QC', 'M'): NORM_NFC_MAYBE,
+                 ('NFKD_QC', 'N'): NORM_NFKD_NO, ('NFKC_QC', 'N'): NORM_NFKC_NO, ('NFKC_QC', 'M'): NORM_NFKC_MAYBE}
+    for first, last, fields in normalization_props:
+        if fields[0] == 'Full_Composition_Exclusion':
+            exclusions.update(range(first, last + 1))
+        elif len(fields) > 1 and (fields[0], fields[1]) in flag_bits:
+            for cp in range(first, last + 1):
+                flags[cp] = flags.get(cp, 0) | flag_bits[(fields[0], fields[1])]
+
+    compositions = sorted((parts[0], parts[1], cp) for cp, parts in single.items()
+                          if len(parts) == 2 and cp not in exclusions)
+    # Kompozycja szuka pary tylko dla znaków NFC_QC=Maybe - każdy drugi element musi nim być
+    seconds = {second for first, second, cp in compositions}
+    maybe = {cp for cp, f in flags.items() if f & NORM_NFC_MAYBE}
+    assert seconds <= maybe, "second characters of compositions must be NFC_QC=Maybe"
+    for cp in full:
+        assert flags.get(cp, 0) & NORM_NFD_NO, f"U+{cp:04X} decomposes but is NFD_QC=Yes"
+    for cp in compat:
+        assert flags.get(cp, 0) & NORM_NFKD_NO, f"U+{cp:04X} decomposes but is NFKD_QC=Yes"
+        flags[cp] |= NORM_COMPAT
+
+    # Kanoniczna (może być pusta), a przy NORM_COMPAT zaraz za nią kompatybilnościowa
+    decomp = [0]  # offset 0: brak dekompozycji
+    offsets = {}
+    for cp in sorted(set(full) | set(compat)):
+        offsets[cp] = len(decomp)
+        decomp.append(len(full.get(cp, [])))
+        decomp.extend(full.get(cp, []))
+        if cp in compat:
+            decomp.append(len(compat[cp]))
+            decomp.extend(compat[cp])
+    assert len(decomp) <= 0x10000, "decomposition offsets must fit in 16 bits"
+
+    values = [0] * 0x110000
+    for cp in set(flags) | set(offsets) | {cp for cp, info in unicode_data.items() if info['ccc']}:
+        ccc = unicode_data[cp]['ccc'] if cp in unicode_data else 0
+        values[cp] = offsets.get(cp, 0) << 16 | flags.get(cp, 0) << 8 | ccc
+    last_block = max(cp for cp, value in enumerate(values) if value) >> NORM_SHIFT
+    stage1, stage2 = build_two_stage(values[:(last_block + 1) << NORM_SHIFT], NORM_SHIFT)
+    assert len(stage2) >> NORM_SHIFT <= 0x10000, "norm_stage1 must fit in uint16_t"
+
+    output = []
+    output.append("// Auto-generated by generate_tables.py")
+    output.append("// Do not edit manually!")
+    output.append("")
+    output.append('#include "utf/UnicodeData.hpp"')
+    output.append("")
+    output.append("namespace utf::data {")
+    output.append("")
+    output.append("// Full decompositions: canonical length and code points, then compatibility ones if NORM_COMPAT")
+    emit_array(output, "char32_t", "norm_decomp", decomp, per_line=8, fmt="0x{:04X}")
+    output.append("")
+    output.append("// Primary composites sorted by {first, second}")
+    output.append("const Composition norm_compositions[] = {")
+    for first, second, cp in compositions:
+        output.append(f"    {{0x{first:04X}, 0x{second:04X}, 0x{cp:04X}}},")
+    output.append("};")
+    output.append(f"const size_t norm_compositions_size = {len(compositions)};")
+    output.append("")
+    output.append(f"// {len(stage1)} block indices, {len(stage2) >> NORM_SHIFT} distinct blocks of {1 << NORM_SHIFT}")
+    emit_array(output, "uint16_t", "norm_stage1", stage1, fmt="{:d}")
+    output.append(f"const size_t norm_stage1_size = {len(stage1)};")
+    output.append("")
+    output.append("// decomposition offset << 16 | NORM_* flags << 8 | ccc")
+    emit_array(output, "uint32_t", "norm_stage2", stage2, per_line=8, fmt="0x{:08X}")
+    output.append("")
     output.append("} // namespace utf::data")
     output.append("")
 
@@ -270,6 +785,23 @@ def main():
         print(f"Error: {special_casing_file} not found. Run get.sh first.")
         sys.exit(1)
 
+    case_folding_file = DATA_DIR / "CaseFolding.txt"
+    if not case_folding_file.exists():
+        print(f"Error: {case_folding_file} not found. Run get.sh first.")
+        sys.exit(1)
+
+    grapheme_break_file = DATA_DIR / "GraphemeBreakProperty.txt"
+    emoji_data_file = DATA_DIR / "emoji-data.txt"
+    core_properties_file = DATA_DIR / "DerivedCoreProperties.txt"
+    word_break_file = DATA_DIR / "WordBreakProperty.txt"
+    east_asian_width_file = DATA_DIR / "EastAsianWidth.txt"
+    normalization_props_file = DATA_DIR / "DerivedNormalizationProps.txt"
+    for path in (grapheme_break_file, emoji_data_file, core_properties_file, word_break_file,
+                 east_asian_width_file, normalization_props_file):
+        if not path.exists():
+            print(f"Error: {path} not found. Run get.sh first.")
+            sys.exit(1)
+
     # Parsuj dane
     print("Parsing UnicodeData.txt...")
     unicode_data = parse_unicode_data(unicode_data_file)
@@ -279,12 +811,16 @@ def main():
     special_casing = parse_special_casing(special_casing_file)
     print(f"  Found {len(special_casing)} special casing entries")
 
+    print("Parsing CaseFolding.txt...")
+    case_folding = parse_case_folding(case_folding_file)
+    print(f"  Found {len(case_folding[0])} simple and {len(case_folding[1])} full foldings")
+
     # Utwórz katalog wyjściowy
     OUTPUT_DIR.mkdir(exist_ok=True)
 
     # Generuj pliki
     print("Generating CaseData.cpp...")
-    case_data = generate_case_data(unicode_data, special_casing)
+    case_data = generate_case_data(unicode_data, special_casing, case_folding)
     case_file = OUTPUT_DIR / "CaseData.cpp"
     with open(case_file, 'w', encoding='utf-8') as f:
         f.write(case_data)
@@ -297,6 +833,45 @@ def main():
         f.write(decomp_data)
     print(f"  Written to {decomp_file}")
 
+    categories = general_categories(unicode_data)
+
+    print("Generating PropsData.cpp...")
+    props_data = generate_props_data(unicode_data, special_casing, case_folding, categories)
+    props_file = OUTPUT_DIR / "PropsData.cpp"
+    with open(props_file, 'w', encoding='utf-8') as f:
+        f.write(props_data)
+    print(f"  Written to {props_file}")
+
+    print("Generating NormData.cpp...")
+    norm_data = generate_norm_data(unicode_data, parse_property_ranges(normalization_props_file))
+    norm_file = OUTPUT_DIR / "NormData.cpp"
+    with open(norm_file, 'w', encoding='utf-8') as f:
+        f.write(norm_data)
+    print(f"  Written to {norm_file}")
+
+    print("Generating SegmentationData.cpp...")
+    segmentation_data = generate_segmentation_data(
+        parse_property_ranges(grapheme_break_file),
+        parse_property_ranges(emoji_data_file),
+        parse_property_ranges(core_properties_file),
+        parse_property_ranges(word_break_file),
+        categories)
+    segmentation_file = OUTPUT_DIR / "SegmentationData.cpp"
+    with open(segmentation_file, 'w', encoding='utf-8') as f:
+        f.write(segmentation_data)
+    print(f"  Written to {segmentation_file}")
+
+    print("Generating WidthData.cpp...")
+    width_data = generate_width_data(
+        parse_property_ranges(east_asian_width_file),
+        parse_missing_defaults(east_asian_width_file),
+        categories,
+        parse_property_ranges(grapheme_break_file))
+    width_file = OUTPUT_DIR / "WidthData.cpp"
+    with open(width_file, 'w', encoding='utf-8') as f:
+        f.write(width_data)
+    print(f"  Written to {width_file}")
+
     print("Done!")
 
 
@@ -14,6 +14,12 @@ echo "Pobieranie danych UCD (Unicode Character Database)..."
 wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/UnicodeData.txt || true
 wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/SpecialCasing.txt || true
 wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/CaseFolding.txt || true
+wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/DerivedCoreProperties.txt || true
+wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/EastAsianWidth.txt || true
+wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/DerivedNormalizationProps.txt || true
+wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/GraphemeBreakProperty.txt || true
+wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/WordBreakProperty.txt || true
+wget -q -nc https://www.unicode.org/Public/UCD/latest/ucd/emoji/emoji-data.txt || true
 
 echo "Pobieranie danych CLDR collation..."
 mkdir -p cldr/collation